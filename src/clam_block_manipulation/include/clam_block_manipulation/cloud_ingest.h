@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+  Fused point cloud ingest for block detection.
+
+  Reads x/y/z/rgb straight out of the PointCloud2 buffer, applies the cached
+  camera -> working frame transform and crops to the workspace box in one
+  pass. Only the surviving points are written to the output cloud, which is
+  owned by the caller and reused between frames. The organized (pixel) index
+  of every surviving point is kept alongside so results can be mapped back
+  into the registered RGB image. With a RobotSelfFilter set, points on the
+  robot's own links are dropped in the same pass.
+*/
+
+#ifndef CLAM_BLOCK_MANIPULATION_CLOUD_INGEST_H
+#define CLAM_BLOCK_MANIPULATION_CLOUD_INGEST_H
+
+#include <sensor_msgs/PointCloud2.h>
+#include <tf/transform_listener.h>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+
+#include <clam_block_manipulation/robot_self_filter.h>
+
+#include <string>
+#include <vector>
+
+namespace clam_block_manipulation
+{
+
+class CloudIngest
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  CloudIngest();
+
+  // Axis aligned crop box, expressed in the working frame
+  void setWorkspace(const Eigen::Vector3f& min_pt, const Eigen::Vector3f& max_pt);
+
+  // Make sure the cached transform from the cloud's frame to target_frame is current.
+  // TF is only queried for a new transform when a newer one has been published
+  // (or the frames changed), otherwise the cached matrix is reused as is.
+  bool updateTransform(tf::TransformListener& tf_listener, const std::string& target_frame,
+                       const std_msgs::Header& cloud_header, const ros::Duration& timeout);
+
+  // Use a fixed transform instead of TF
+  void setTransform(const Eigen::Affine3f& transform);
+
+  // Also drop points on the robot, NULL to keep them. The filter must be placed in the same
+  // target frame and is not owned.
+  void setSelfFilter(const RobotSelfFilter* self_filter) { self_filter_ = self_filter; }
+
+  // Transform + crop the cloud. Returns the number of points that survived.
+  // source_indices[i] is the index of out.points[i] in the organized input cloud.
+  size_t ingest(const sensor_msgs::PointCloud2& msg,
+                pcl::PointCloud<pcl::PointXYZRGB>& out,
+                std::vector<int>& source_indices) const;
+
+  // Transform the single point at the given organized index (row * width + col).
+  // Returns false for points with no depth or on the robot.
+  bool lookupPoint(const sensor_msgs::PointCloud2& msg, int index, Eigen::Vector3f& out) const;
+
+  // Where the camera is in the target frame
+  Eigen::Vector3f getSensorOrigin() const { return transform_.block<3, 1>(0, 3); }
+
+  // Number of times the transform was actually (re)computed from TF
+  unsigned int getTransformLookups() const { return transform_lookups_; }
+
+private:
+
+  // Byte offset of the named field, or -1 if it is missing or not a float32
+  static int getFieldOffset(const sensor_msgs::PointCloud2& msg, const std::string& name);
+
+  // Cached transform, as a 4x4 so that every point is a single packed multiply
+  Eigen::Matrix4f transform_;
+  bool have_transform_;
+
+  // What the cached transform was built from
+  std::string target_frame_;
+  std::string source_frame_;
+  ros::Time transform_stamp_;
+  unsigned int transform_lookups_;
+
+  // Crop box, w component is left unbounded so whole-vector compares can be used
+  Eigen::Array4f min_pt_;
+  Eigen::Array4f max_pt_;
+
+  const RobotSelfFilter* self_filter_;
+};
+
+} // namespace
+
+#endif
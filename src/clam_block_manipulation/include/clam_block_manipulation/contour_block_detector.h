@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+  Image based block finder for the fixed camera / table setup.
+
+  Works on the registered RGB image that comes with the Kinect cloud:
+  downscale with an image pyramid, threshold (or Canny), find the outer
+  contours and fit a minAreaRect to each. The depth of the rect center and
+  corners is then looked up in the organized cloud to get the block pose in
+  the working frame and to check its metric size.
+
+  Contours are only searched for where the image sees the workspace: a
+  coarse grid of pixels is looked up in the cloud first, and candidates off
+  the table are skipped. Anything on the table that looks like it could be a
+  block but doesn't check out is reported as ambiguous, so the caller can
+  fall back to the full 3D path.
+*/
+
+#ifndef CLAM_BLOCK_MANIPULATION_CONTOUR_BLOCK_DETECTOR_H
+#define CLAM_BLOCK_MANIPULATION_CONTOUR_BLOCK_DETECTOR_H
+
+#include <clam_block_manipulation/cloud_ingest.h>
+
+#include <sensor_msgs/PointCloud2.h>
+
+#include "opencv2/imgproc/imgproc.hpp"
+
+#include <vector>
+
+namespace clam_block_manipulation
+{
+
+struct DetectedBlock
+{
+  float x;
+  float y;
+  float z;
+  float angle;
+};
+
+class ContourBlockDetector
+{
+public:
+
+  enum Method
+  {
+    THRESHOLD, // Otsu threshold, good for colored blocks on a plain table
+    CANNY      // edge based, same as the findContours demos
+  };
+
+  enum Result
+  {
+    FOUND,     // every candidate was confirmed as a block
+    AMBIGUOUS  // nothing found, or at least one candidate could not be confirmed
+  };
+
+  ContourBlockDetector();
+
+  // Number of times to pyrDown before looking for contours
+  void setPyramidLevels(int levels) { pyramid_levels_ = levels; }
+
+  void setMethod(Method method) { method_ = method; }
+
+  void setCannyThreshold(int threshold) { canny_threshold_ = threshold; }
+
+  // Plausible block area in full resolution pixels
+  void setAreaLimits(double min_area, double max_area);
+
+  // Axis aligned box in the working frame that blocks can be in, same as the cloud path's crop
+  void setWorkspace(const Eigen::Vector3f& min_pt, const Eigen::Vector3f& max_pt);
+
+  Result detect(const sensor_msgs::PointCloud2& msg,
+                const cv::Mat& image,
+                const CloudIngest& cloud_ingest,
+                double block_size, double table_height,
+                std::vector<DetectedBlock>& blocks);
+
+private:
+
+  // Look up the working frame point at full resolution pixel (u,v)
+  bool lookupPixel(const sensor_msgs::PointCloud2& msg, const CloudIngest& cloud_ingest,
+                   const cv::Point2f& pixel, Eigen::Vector3f& out) const;
+
+  bool inWorkspace(const Eigen::Vector3f& point) const;
+
+  // Fill workspace_mask_ from the cloud and return the full resolution bounding box of the
+  // workspace in the image, empty if none of it is visible
+  cv::Rect findWorkspace(const sensor_msgs::PointCloud2& msg, const CloudIngest& cloud_ingest);
+
+  // True if the full resolution pixel is on or next to a grid cell that sees the workspace
+  bool pixelInWorkspace(const cv::Point2f& pixel) const;
+
+  int pyramid_levels_;
+  Method method_;
+  int canny_threshold_;
+  double min_area_;
+  double max_area_;
+  Eigen::Vector3f workspace_min_;
+  Eigen::Vector3f workspace_max_;
+
+  // Scratch images, kept around so their buffers get reused
+  cv::Mat small_;
+  cv::Mat gray_;
+  cv::Mat binary_;
+  cv::Mat workspace_mask_; // one cell per WORKSPACE_GRID_STEP pixels
+  std::vector<std::vector<cv::Point> > contours_;
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+  Occupancy voxel map of the workspace, built up from the camera so that
+  obstacles end up in the planning scene without being added by hand.
+
+  A dense grid of log-odds over a fixed box in the working frame. Every
+  frame the self-filtered cloud is binned into its end voxels first, so a
+  voxel seen by a hundred points costs one ray. Points inside the box are
+  hits; points past it, such as the table below it, only clear the voxels
+  in front of them, and are binned by the voxel where their ray leaves the
+  box. Rays are only cast to at most max_rays_per_frame end voxels: hits
+  that aren't confidently occupied yet go first, the rest are swept through
+  over successive frames. Along a ray each voxel is updated at most once per
+  frame, updates that would push a voxel past its clamp are skipped, and
+  only voxels flipping between free and occupied mark their region as
+  changed. The changed regions are what gets sent to the planning scene.
+*/
+
+#ifndef CLAM_BLOCK_MANIPULATION_OCCUPANCY_MAP_H
+#define CLAM_BLOCK_MANIPULATION_OCCUPANCY_MAP_H
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <Eigen/Dense>
+
+#include <stdint.h>
+#include <cmath>
+#include <vector>
+
+namespace clam_block_manipulation
+{
+
+class OccupancyMap
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  // Region of region_size^3 voxels whose occupancy changed
+  struct Region
+  {
+    int id;
+    std::vector<Eigen::Vector3f> occupied; // centers of all the occupied voxels in the region
+  };
+
+  OccupancyMap(const Eigen::Vector3f& min_pt, const Eigen::Vector3f& max_pt, float resolution, int region_size = 8);
+
+  void setMaxRaysPerFrame(size_t max_rays) { max_rays_ = max_rays; }
+
+  // Update from a cloud already in the map frame, seen from origin (the camera). Pass the
+  // whole cloud, not just the points in the box, or the space in front of the rest is never
+  // cleared. Returns the number of rays cast.
+  size_t insert(const pcl::PointCloud<pcl::PointXYZRGB>& cloud, const Eigen::Vector3f& origin);
+
+  // Regions that changed since the last call
+  void popChangedRegions(std::vector<Region>& regions);
+
+  float getResolution() const { return resolution_; }
+  size_t getOccupiedCount() const { return occupied_count_; }
+
+private:
+
+  // Log-odds in tenths, as in OctoMap: hit 0.85, miss -0.4, clamped to [-2, 3.5]
+  static const int8_t LOG_ODDS_HIT = 8;
+  static const int8_t LOG_ODDS_MISS = -4;
+  static const int8_t LOG_ODDS_MIN = -20;
+  static const int8_t LOG_ODDS_MAX = 35;
+
+  inline bool toVoxel(const Eigen::Vector3f& p, Eigen::Vector3i& voxel) const
+  {
+    Eigen::Vector3f scaled = (p - min_pt_) / resolution_;
+    voxel << (int) floor(scaled.x()), (int) floor(scaled.y()), (int) floor(scaled.z());
+    return (voxel.array() >= 0).all() && (voxel.array() < dims_.array()).all();
+  }
+
+  inline int toIndex(const Eigen::Vector3i& voxel) const
+  {
+    return (voxel.z() * dims_.y() + voxel.y()) * dims_.x() + voxel.x();
+  }
+
+  Eigen::Vector3i toVoxel(int index) const;
+  Eigen::Vector3f voxelCenter(const Eigen::Vector3i& voxel) const;
+  int regionOf(const Eigen::Vector3i& voxel) const;
+
+  // Part of the ray from origin along direction, up to length, that is inside the grid
+  bool clipRay(const Eigen::Vector3f& origin, const Eigen::Vector3f& direction, float length,
+               float& t_enter, float& t_exit) const;
+  void castRay(const Eigen::Vector3f& origin, const Eigen::Vector3i& end_voxel);
+  void update(int index, int8_t delta);
+
+  Eigen::Vector3f min_pt_;
+  Eigen::Vector3f max_pt_;
+  float resolution_;
+  Eigen::Vector3i dims_;
+
+  int region_size_;
+  Eigen::Vector3i region_dims_;
+
+  std::vector<int8_t> log_odds_;
+  size_t occupied_count_;
+
+  // Frame a voxel was last hit / passed through, so it is updated once per frame, and last
+  // ended a ray to a point past the grid, so those get one ray per voxel too
+  uint32_t frame_;
+  std::vector<uint32_t> hit_frame_;
+  std::vector<uint32_t> miss_frame_;
+  std::vector<uint32_t> exit_frame_;
+
+  std::vector<uint8_t> region_dirty_;
+  std::vector<int> dirty_regions_;
+
+  // Rays per frame and where the sweep over confidently occupied voxels got to
+  size_t max_rays_;
+  size_t sweep_offset_;
+
+  // Per frame scratch, kept to avoid reallocating
+  std::vector<int> fresh_ends_;
+  std::vector<int> settled_ends_;
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+  Removes the robot's own links from the camera cloud.
+
+  Every link's collision geometry from the URDF is reduced once, at startup,
+  to a padded box in the link frame (meshes to their bounding box). Each
+  frame the boxes are moved to where TF says the links currently are, and
+  CloudIngest drops every point inside one of them in the same pass as the
+  transform and crop. A point is first compared against the box around the
+  whole robot, then against each link's world aligned bounds, and only then
+  transformed into the link's box, so points away from the arm cost a single
+  compare.
+*/
+
+#ifndef CLAM_BLOCK_MANIPULATION_ROBOT_SELF_FILTER_H
+#define CLAM_BLOCK_MANIPULATION_ROBOT_SELF_FILTER_H
+
+#include <tf/transform_listener.h>
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+#include <Eigen/StdVector>
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace clam_block_manipulation
+{
+
+class RobotSelfFilter
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  RobotSelfFilter();
+
+  // Build the link boxes from the URDF on the parameter server, growing every box by padding
+  // on each side. Links in ignore_links (e.g. the table) are kept in the cloud.
+  bool loadFromParam(const std::string& robot_description, double padding,
+                     const std::vector<std::string>& ignore_links);
+
+  // Add a box with the given half extents, centered at box_in_link in the link's frame. It
+  // filters nothing until the link is placed.
+  void addBox(const std::string& link, const Eigen::Affine3f& box_in_link,
+              const Eigen::Vector3f& half_extents, double padding);
+
+  // Also filter out an object held by a link, such as the block in the gripper, as a box in
+  // the link's frame. Several boxes can be attached under one id.
+  void attachBox(const std::string& id, const std::string& link, const Eigen::Affine3f& box_in_link,
+                 const Eigen::Vector3f& half_extents, double padding);
+
+  // Drop the boxes attached under id, or every attached box for an empty id
+  void detach(const std::string& id);
+
+  // Move the boxes to where the links were at stamp, expressed in target_frame. Does nothing
+  // if they were already placed for the same stamp and frame. Links TF can't place at stamp
+  // are left out of the filter until it can; returns false if no link could be placed.
+  bool updateTransforms(tf::TransformListener& tf_listener, const std::string& target_frame,
+                        const ros::Time& stamp, const ros::Duration& timeout);
+
+  // Place a link's box from its pose in the target frame, for poses that don't come from TF.
+  // Returns false for a link without a box.
+  bool setLinkPose(const std::string& link, const Eigen::Affine3f& link_pose);
+
+  // Nothing to filter until the boxes are loaded and placed
+  bool isReady() const { return have_transforms_ && !shapes_.empty(); }
+
+  size_t getLinkCount() const { return shapes_.size(); }
+
+  // True if the point (x, y, z, 1) in the target frame is inside one of the links
+  inline bool contains(const Eigen::Vector4f& point) const
+  {
+    const Eigen::Array4f p = point.array();
+    if( !((p >= min_pt_).all() && (p <= max_pt_).all()) )
+      return false;
+
+    for( size_t i = 0; i < shapes_.size(); ++i )
+    {
+      const LinkShape& shape = shapes_[i];
+      if( !((p >= shape.min_pt).all() && (p <= shape.max_pt).all()) )
+        continue;
+
+      // Into the box frame with one packed multiply, then the same compare against the half extents
+      if( ((shape.inverse * point).array().abs() <= shape.half_extents).all() )
+        return true;
+    }
+    return false;
+  }
+
+private:
+
+  struct LinkShape
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    std::string link;
+    std::string attached_id; // empty for the link's own geometry
+
+    // Box center and axes in the link frame, fixed
+    Eigen::Matrix4f box_in_link;
+    // w component is left unbounded, like the crop box in CloudIngest
+    Eigen::Array4f half_extents;
+
+    // Target frame -> box frame, and the box's world aligned bounds, updated every frame.
+    // The bounds are empty while the link can't be placed, so no point gets past them.
+    Eigen::Matrix4f inverse;
+    Eigen::Array4f min_pt;
+    Eigen::Array4f max_pt;
+  };
+
+  static void place(LinkShape& shape, const Eigen::Matrix4f& link_pose);
+  static void unplace(LinkShape& shape);
+  void updateBounds();
+
+  std::vector<LinkShape, Eigen::aligned_allocator<LinkShape> > shapes_;
+  bool have_transforms_;
+  std::string target_frame_;
+  ros::Time stamp_;
+
+  // Links already reported as missing from TF
+  std::set<std::string> warned_links_;
+
+  // Bounds of all the boxes together
+  Eigen::Array4f min_pt_;
+  Eigen::Array4f max_pt_;
+};
+
+} // namespace
+
+#endif
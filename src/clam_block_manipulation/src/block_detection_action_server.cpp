@@ -63,6 +63,18 @@
 
 #include <cmath>
 #include <algorithm>
+#include <limits>
+#include <set>
+
+#include <boost/lexical_cast.hpp>
+
+#include <clam_block_manipulation/cloud_ingest.h>
+#include <clam_block_manipulation/robot_self_filter.h>
+#include <clam_block_manipulation/occupancy_map.h>
+#include <moveit_msgs/PlanningScene.h>
+#include <moveit_msgs/AttachedCollisionObject.h>
+#include <eigen_conversions/eigen_msg.h>
+#include <clam_block_manipulation/contour_block_detector.h>
 
 // Rviz
 #include <visualization_msgs/Marker.h>
@@ -98,8 +110,50 @@ private:
   ros::Publisher plane_pub_; // points that were recognized as part of the table
   ros::Publisher block_pose_pub_; // publishes to the block logic server
   ros::Publisher block_marker_pub_; // shows markers in rviz
+  ros::Publisher planning_scene_pub_; // occupancy map changes, as planning scene diffs
+  ros::Subscriber attached_object_sub_; // objects held by the arm, kept out of the occupancy map
   tf::TransformListener tf_listener_;
 
+  // Transform + crop stage, and the buffers it fills. Reused for every cloud, unless the filtered
+  // cloud published last time is still in use.
+  clam_block_manipulation::CloudIngest cloud_ingest_;
+  pcl::PointCloud<pcl::PointXYZRGB>::Ptr cloud_filtered_;
+  std::vector<int> source_indices_; // index of each filtered point in the organized camera cloud
+
+  // Removes the arm from the cloud, so detection works while it is over the table
+  clam_block_manipulation::RobotSelfFilter self_filter_;
+  bool use_self_filter_;
+  double self_filter_padding_;
+
+  // Obstacles seen by the camera, updated on every cloud. Its own ingest stage as it takes the
+  // whole cloud, not the block detection crop.
+  bool use_occupancy_map_;
+  boost::shared_ptr<clam_block_manipulation::OccupancyMap> occupancy_map_;
+  std::string occupancy_frame_; // arm_link the map was built in
+  clam_block_manipulation::CloudIngest map_ingest_;
+  pcl::PointCloud<pcl::PointXYZRGB>::Ptr map_cloud_;
+  std::vector<int> map_source_indices_;
+  std::vector<clam_block_manipulation::OccupancyMap::Region> changed_regions_;
+  std::set<int> published_regions_;
+  std::vector<double> occupancy_workspace_; // min x y z, max x y z
+  double occupancy_resolution_;
+  int occupancy_max_rays_;
+
+  // 2D fast path on the registered RGB image
+  clam_block_manipulation::ContourBlockDetector contour_detector_;
+  std::vector<clam_block_manipulation::DetectedBlock> image_blocks_;
+  std::string detection_mode_; // "cloud" or "image"
+  bool benchmark_detection_; // run both paths and compare them
+  bool show_windows_; // OpenCV debug windows in processClusters
+
+  // Benchmark totals
+  unsigned int benchmark_count_;
+  double image_time_total_;
+  double cloud_time_total_;
+  double position_error_total_;
+  double angle_error_total_;
+  unsigned int matched_total_;
+
   // Parameters from goal
   std::string arm_link;
   double block_size;
@@ -122,7 +176,9 @@ public:
   BlockDetectionServer(const std::string name) :
     nh_("~"),
     action_server_(name, false),
-    action_name_(name)
+    action_name_(name),
+    cloud_filtered_(new pcl::PointCloud<pcl::PointXYZRGB>),
+    map_cloud_(new pcl::PointCloud<pcl::PointXYZRGB>)
   {
     // Subscribe to point cloud
     point_cloud_sub_ = nh_.subscribe("/camera/depth_registered/points", 1, &BlockDetectionServer::pointCloudCallback, this);
@@ -147,6 +203,66 @@ public:
     // Initialize how often we process images
     process_count_ = PROCESS_EVERY_NTH;
 
+    // Which detector to use. The image path falls back to the cloud path whenever it isn't sure.
+    nh_.param<std::string>("detection_mode", detection_mode_, "cloud");
+    nh_.param<bool>("benchmark_detection", benchmark_detection_, false);
+    nh_.param<bool>("show_windows", show_windows_, true);
+
+    int pyramid_levels;
+    nh_.param<int>("pyramid_levels", pyramid_levels, 1);
+    contour_detector_.setPyramidLevels(pyramid_levels);
+
+    std::string contour_method;
+    nh_.param<std::string>("contour_method", contour_method, "canny");
+    contour_detector_.setMethod(contour_method == "threshold" ?
+                                clam_block_manipulation::ContourBlockDetector::THRESHOLD :
+                                clam_block_manipulation::ContourBlockDetector::CANNY);
+    contour_detector_.setCannyThreshold(opencv_threshhold);
+
+    double min_area, max_area;
+    nh_.param<double>("min_block_area", min_area, 150);
+    nh_.param<double>("max_block_area", max_area, 6000);
+    contour_detector_.setAreaLimits(min_area, max_area);
+
+    // Robot self filter. The table is a link too but it has to stay for the plane fit.
+    nh_.param<bool>("self_filter", use_self_filter_, true);
+    nh_.param<double>("self_filter_padding", self_filter_padding_, 0.02);
+    if( use_self_filter_ )
+    {
+      std::vector<std::string> ignore_links;
+      if( !nh_.getParam("self_filter_ignore_links", ignore_links) )
+        ignore_links.push_back("tabletop_link");
+
+      use_self_filter_ = self_filter_.loadFromParam("/robot_description", self_filter_padding_, ignore_links);
+      if( use_self_filter_ )
+        cloud_ingest_.setSelfFilter(&self_filter_);
+    }
+
+    // Occupancy map for the planning scene. Starts above the table so that neither the table nor
+    // the blocks on it become obstacles. Its ingest isn't cropped: the rays to the table and
+    // everything else past the map are what clear it.
+    nh_.param<bool>("occupancy_map", use_occupancy_map_, false);
+    nh_.param<double>("occupancy_resolution", occupancy_resolution_, 0.02);
+    nh_.param<int>("occupancy_max_rays", occupancy_max_rays_, 2000);
+    if( !nh_.getParam("occupancy_workspace", occupancy_workspace_) || occupancy_workspace_.size() != 6 )
+    {
+      double workspace[] = {0.05, -0.5, 0.06, 0.8, 0.5, 0.8};
+      occupancy_workspace_.assign(workspace, workspace + 6);
+    }
+    if( use_occupancy_map_ )
+    {
+      planning_scene_pub_ = nh_.advertise<moveit_msgs::PlanningScene>("/planning_scene", 1);
+      attached_object_sub_ = nh_.subscribe("/attached_collision_object", 10, &BlockDetectionServer::attachedObjectCallback, this);
+
+      // Used even without the links, for the block in the gripper
+      map_ingest_.setSelfFilter(&self_filter_);
+    }
+
+    benchmark_count_ = 0;
+    image_time_total_ = cloud_time_total_ = 0;
+    position_error_total_ = angle_error_total_ = 0;
+    matched_total_ = 0;
+
     // TODO: move this, should be brought in from action goal. temporary!
     arm_link = "/base_link";
     block_size = 0.04;
@@ -192,6 +308,10 @@ public:
   // Decide if we should proccess the point cloud
   void pointCloudCallback( const sensor_msgs::PointCloud2ConstPtr& msg )
   {
+    // The map keeps up with every cloud, the ray budget keeps this cheap
+    if( use_occupancy_map_ )
+      updateOccupancyMap( msg );
+
     // Only process every nth point cloud, unless we are working on a goal inwhich case process all of them
     ++process_count_;
 
@@ -208,6 +328,139 @@ public:
     processPointCloud( msg );
   }
 
+  // Ray cast the cloud into the occupancy map and send the regions that changed to the planning scene
+  void updateOccupancyMap( const sensor_msgs::PointCloud2ConstPtr& pointcloud_msg )
+  {
+    if( !map_ingest_.updateTransform(tf_listener_, arm_link, pointcloud_msg->header, ros::Duration(0.1)) )
+      return;
+
+    // The map is kept in the working frame, start over if that changes
+    if( !occupancy_map_ || occupancy_frame_ != arm_link )
+    {
+      clearOccupancyMap();
+      occupancy_map_.reset(new clam_block_manipulation::OccupancyMap(
+                             Eigen::Vector3f(occupancy_workspace_[0], occupancy_workspace_[1], occupancy_workspace_[2]),
+                             Eigen::Vector3f(occupancy_workspace_[3], occupancy_workspace_[4], occupancy_workspace_[5]),
+                             occupancy_resolution_));
+      occupancy_map_->setMaxRaysPerFrame(occupancy_max_rays_);
+      occupancy_frame_ = arm_link;
+    }
+
+    self_filter_.updateTransforms(tf_listener_, arm_link, pointcloud_msg->header.stamp, ros::Duration(0.1));
+
+    map_ingest_.ingest(*pointcloud_msg, *map_cloud_, map_source_indices_);
+    size_t rays = occupancy_map_->insert(*map_cloud_, map_ingest_.getSensorOrigin());
+    ROS_DEBUG_STREAM("[block detection] Occupancy map: " << rays << " rays, "
+                     << occupancy_map_->getOccupiedCount() << " occupied voxels");
+
+    // -------------------------------------------------------------------------------------------
+    // One collision object per changed region, everything else in the scene is left alone
+    occupancy_map_->popChangedRegions(changed_regions_);
+    if( changed_regions_.empty() )
+      return;
+
+    moveit_msgs::PlanningScene scene_diff;
+    scene_diff.is_diff = true;
+
+    for( size_t r = 0; r < changed_regions_.size(); ++r )
+    {
+      const clam_block_manipulation::OccupancyMap::Region& region = changed_regions_[r];
+
+      moveit_msgs::CollisionObject object;
+      object.header.frame_id = occupancy_frame_;
+      object.header.stamp = pointcloud_msg->header.stamp;
+      object.id = "occupancy_" + boost::lexical_cast<std::string>(region.id);
+
+      // Adding to an existing object appends to it, so the old voxels are removed first
+      if( published_regions_.erase(region.id) )
+      {
+        object.operation = moveit_msgs::CollisionObject::REMOVE;
+        scene_diff.world.collision_objects.push_back(object);
+      }
+
+      if( region.occupied.empty() )
+        continue;
+
+      object.operation = moveit_msgs::CollisionObject::ADD;
+      shape_msgs::SolidPrimitive voxel;
+      voxel.type = shape_msgs::SolidPrimitive::BOX;
+      voxel.dimensions.resize(3, occupancy_map_->getResolution());
+      geometry_msgs::Pose pose;
+      pose.orientation.w = 1.0;
+
+      for( size_t i = 0; i < region.occupied.size(); ++i )
+      {
+        pose.position.x = region.occupied[i].x();
+        pose.position.y = region.occupied[i].y();
+        pose.position.z = region.occupied[i].z();
+        object.primitives.push_back(voxel);
+        object.primitive_poses.push_back(pose);
+      }
+      scene_diff.world.collision_objects.push_back(object);
+      published_regions_.insert(region.id);
+    }
+
+    planning_scene_pub_.publish(scene_diff);
+  }
+
+  // Keep an object attached to the arm out of the occupancy map, or the block in the gripper
+  // would be mapped as an obstacle wherever the arm carries it
+  void attachedObjectCallback(const moveit_msgs::AttachedCollisionObjectConstPtr& msg)
+  {
+    const moveit_msgs::CollisionObject& object = msg->object;
+    self_filter_.detach(object.id);
+    if( object.operation != moveit_msgs::CollisionObject::ADD || object.id.empty() )
+      return;
+
+    // The boxes are placed with their link, so they have to be given in the link's frame
+    if( !object.header.frame_id.empty() && object.header.frame_id != msg->link_name )
+    {
+      ROS_WARN_STREAM("[block detection] Not filtering " << object.id << ", it is given in "
+                      << object.header.frame_id << " instead of " << msg->link_name);
+      return;
+    }
+
+    for( size_t i = 0; i < object.primitives.size() && i < object.primitive_poses.size(); ++i )
+    {
+      const shape_msgs::SolidPrimitive& primitive = object.primitives[i];
+      Eigen::Vector3f half_extents;
+      if( primitive.type == shape_msgs::SolidPrimitive::BOX && primitive.dimensions.size() >= 3 )
+        half_extents << primitive.dimensions[0] / 2, primitive.dimensions[1] / 2, primitive.dimensions[2] / 2;
+      else if( primitive.type == shape_msgs::SolidPrimitive::SPHERE && primitive.dimensions.size() >= 1 )
+        half_extents.setConstant(primitive.dimensions[0]);
+      else if( primitive.type == shape_msgs::SolidPrimitive::CYLINDER && primitive.dimensions.size() >= 2 )
+        half_extents << primitive.dimensions[1], primitive.dimensions[1], primitive.dimensions[0] / 2;
+      else
+        continue;
+
+      Eigen::Affine3d pose;
+      tf::poseMsgToEigen(object.primitive_poses[i], pose);
+      self_filter_.attachBox(object.id, msg->link_name, pose.cast<float>(), half_extents, self_filter_padding_);
+    }
+  }
+
+  // Take everything the occupancy map added back out of the planning scene
+  void clearOccupancyMap()
+  {
+    if( published_regions_.empty() )
+      return;
+
+    moveit_msgs::PlanningScene scene_diff;
+    scene_diff.is_diff = true;
+
+    for( std::set<int>::const_iterator it = published_regions_.begin(); it != published_regions_.end(); ++it )
+    {
+      moveit_msgs::CollisionObject object;
+      object.header.frame_id = occupancy_frame_;
+      object.id = "occupancy_" + boost::lexical_cast<std::string>(*it);
+      object.operation = moveit_msgs::CollisionObject::REMOVE;
+      scene_diff.world.collision_objects.push_back(object);
+    }
+
+    planning_scene_pub_.publish(scene_diff);
+    published_regions_.clear();
+  }
+
   // Proccess the point clouds
   void processPointCloud( const sensor_msgs::PointCloud2ConstPtr& pointcloud_msg )
   {
@@ -222,17 +475,9 @@ public:
 
     // Basic point cloud conversions ---------------------------------------------------------------
 
-    // Convert from ROS to PCL
-    pcl::PointCloud<pcl::PointXYZRGB> cloud;
-    pcl::fromROSMsg(*pointcloud_msg, cloud);
-
-    // Make new point cloud that is in our working frame
-    pcl::PointCloud<pcl::PointXYZRGB>::Ptr cloud_transformed(new pcl::PointCloud<pcl::PointXYZRGB>);
-
-    // Transform to whatever frame we're working in, probably the arm's base frame, ie "base_link"
-    tf_listener_.waitForTransform(std::string(arm_link), cloud.header.frame_id,
-                                  cloud.header.stamp, ros::Duration(2.0));
-    if(!pcl_ros::transformPointCloud(std::string(arm_link), cloud, *cloud_transformed, tf_listener_))
+    // Transform to whatever frame we're working in, probably the arm's base frame, ie "base_link".
+    // The TF lookup only happens when the camera transform actually changed.
+    if( !cloud_ingest_.updateTransform(tf_listener_, arm_link, pointcloud_msg->header, ros::Duration(2.0)) )
     {
       ROS_ERROR("Error converting to desired frame");
 
@@ -242,23 +487,167 @@ public:
       return;
     }
 
-    // Limit to things we think are roughly at the table height ------------------------------------
-    pcl::PointCloud<pcl::PointXYZRGB>::Ptr cloud_filteredZ(new pcl::PointCloud<pcl::PointXYZRGB>);
-    pcl::PassThrough<pcl::PointXYZRGB> pass;
-    pass.setInputCloud(cloud_transformed);
-    pass.setFilterFieldName("z");
-    pass.setFilterLimits(table_height - 0.05, table_height + block_size + 0.05);
-    //pass.setFilterLimits(table_height - 0.01, table_height + block_size + 0.02); // DTC
-    pass.filter(*cloud_filteredZ);
+    // Place the robot's links as they were when the cloud was taken. Links TF can't place are
+    // left out of the filter.
+    if( use_self_filter_ )
+      self_filter_.updateTransforms(tf_listener_, arm_link, pointcloud_msg->header.stamp, ros::Duration(0.1));
 
+    // Try the cheap image path first ---------------------------------------------------------------
+    bool use_image = (detection_mode_ == "image");
+    bool found_in_image = false;
+    double image_time = 0;
 
-    // Limit to things in front of the robot ---------------------------------------------------
-    pcl::PointCloud<pcl::PointXYZRGB>::Ptr cloud_filtered(new pcl::PointCloud<pcl::PointXYZRGB>);
-    pass.setInputCloud(cloud_filteredZ);
-    pass.setFilterFieldName("x");
-    pass.setFilterLimits(.1,.5);
-    pass.filter(*cloud_filtered);
+    if( use_image || benchmark_detection_ )
+    {
+      ros::WallTime start = ros::WallTime::now();
+      found_in_image = detectBlocksInImage( pointcloud_msg );
+      image_time = (ros::WallTime::now() - start).toSec();
+    }
 
+    if( use_image && found_in_image && !benchmark_detection_ )
+    {
+      for(size_t i = 0; i < image_blocks_.size(); ++i)
+        addBlock( image_blocks_[i].x, image_blocks_[i].y, image_blocks_[i].z, image_blocks_[i].angle );
+    }
+    else
+    {
+      if( use_image && !benchmark_detection_ )
+        ROS_INFO("[block detection] Image result ambiguous, falling back to point cloud");
+
+      ros::WallTime start = ros::WallTime::now();
+      detectBlocksInCloud( pointcloud_msg );
+      double cloud_time = (ros::WallTime::now() - start).toSec();
+
+      if( benchmark_detection_ )
+        reportBenchmark( image_time, found_in_image, cloud_time );
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // Final results
+    if(result_.blocks.poses.size() > 0)
+    {
+      // Change action state, if we the action is currently active
+      if(action_server_.isActive())
+      {
+        action_server_.setSucceeded(result_);
+      }
+      // Publish block poses
+      block_pose_pub_.publish(result_.blocks);
+
+      // Publish rviz markers of the blocks
+      publishBlockLocation();
+
+      ROS_INFO("[block detection] Finished");
+    }
+    else
+    {
+      ROS_INFO("[block detection] Couldn't find any blocks this iteration!");
+    }
+  }
+
+  // Where blocks can be: roughly at the table height and in front of the robot
+  Eigen::Vector3f blockWorkspaceMin() const
+  {
+    return Eigen::Vector3f(.1, -std::numeric_limits<float>::infinity(), table_height - 0.05);
+  }
+
+  Eigen::Vector3f blockWorkspaceMax() const
+  {
+    return Eigen::Vector3f(.5, std::numeric_limits<float>::infinity(), table_height + block_size + 0.05);
+  }
+
+  // Find blocks with contours on the registered RGB image, returns false if the caller should use the point cloud
+  bool detectBlocksInImage( const sensor_msgs::PointCloud2ConstPtr& pointcloud_msg )
+  {
+    cv_bridge::CvImagePtr input_bridge;
+    try
+    {
+      sensor_msgs::ImagePtr image_msg(new sensor_msgs::Image);
+      pcl::toROSMsg (*pointcloud_msg, *image_msg);
+      input_bridge = cv_bridge::toCvCopy(image_msg, "bgr8");
+    }
+    catch (cv_bridge::Exception& ex)
+    {
+      ROS_ERROR("[block detection] Failed to convert image");
+      return false;
+    }
+
+    contour_detector_.setWorkspace(blockWorkspaceMin(), blockWorkspaceMax());
+
+    clam_block_manipulation::ContourBlockDetector::Result result =
+      contour_detector_.detect(*pointcloud_msg, input_bridge->image, cloud_ingest_,
+                               block_size, table_height, image_blocks_);
+
+    ROS_INFO("[block detection] Image path found %d blocks", (int) image_blocks_.size());
+
+    return result == clam_block_manipulation::ContourBlockDetector::FOUND;
+  }
+
+  // Log latency of both paths and how far the image blocks are from the cloud blocks
+  void reportBenchmark( double image_time, bool found_in_image, double cloud_time )
+  {
+    ++benchmark_count_;
+    image_time_total_ += image_time;
+    cloud_time_total_ += cloud_time;
+
+    // Match every cloud block to the closest image block
+    unsigned int matched = 0;
+    for(size_t i = 0; i < result_.blocks.poses.size(); ++i)
+    {
+      const geometry_msgs::Pose& pose = result_.blocks.poses[i];
+      double best = std::numeric_limits<double>::max();
+      size_t best_j = 0;
+      for(size_t j = 0; j < image_blocks_.size(); ++j)
+      {
+        double d = std::sqrt( std::pow(pose.position.x - image_blocks_[j].x, 2) +
+                              std::pow(pose.position.y - image_blocks_[j].y, 2) );
+        if( d < best )
+        {
+          best = d;
+          best_j = j;
+        }
+      }
+      if( best > block_size ) // not the same block
+        continue;
+
+      // Cloud angles are in (-pi/2, pi/2), compare modulo the block's 90 degree symmetry
+      double cloud_angle = 2 * std::atan2(pose.orientation.z, pose.orientation.w);
+      double angle_error = std::fmod( std::fabs(cloud_angle - image_blocks_[best_j].angle), M_PI/2 );
+      if( angle_error > M_PI/4 )
+        angle_error = M_PI/2 - angle_error;
+
+      position_error_total_ += best;
+      angle_error_total_ += angle_error;
+      ++matched;
+    }
+    matched_total_ += matched;
+
+    ROS_INFO_STREAM("[block detection] Benchmark: image " << image_time * 1000 << " ms ("
+                    << (found_in_image ? "confident" : "ambiguous") << ", " << image_blocks_.size() << " blocks), cloud "
+                    << cloud_time * 1000 << " ms (" << result_.blocks.poses.size() << " blocks), "
+                    << matched << " matched");
+    ROS_INFO_STREAM("[block detection] Benchmark average over " << benchmark_count_ << " clouds: image "
+                    << image_time_total_ / benchmark_count_ * 1000 << " ms, cloud "
+                    << cloud_time_total_ / benchmark_count_ * 1000 << " ms, position error "
+                    << (matched_total_ ? position_error_total_ / matched_total_ : 0) << " m, angle error "
+                    << (matched_total_ ? angle_error_total_ / matched_total_ : 0) << " rad");
+  }
+
+  // Full 3D path: crop, remove the table with RANSAC, cluster what is left
+  void detectBlocksInCloud( const sensor_msgs::PointCloud2ConstPtr& pointcloud_msg )
+  {
+    // Limit to things we think are roughly at the table height and in front of the robot.
+    // This is done in the same pass as the transform so cropped points are never copied.
+    cloud_ingest_.setWorkspace(blockWorkspaceMin(), blockWorkspaceMax());
+
+    // The last cloud was published. If a subscriber in this process still holds it, fill a new
+    // one rather than changing it under them.
+    if( !cloud_filtered_.unique() )
+    {
+      cloud_filtered_.reset(new pcl::PointCloud<pcl::PointXYZRGB>);
+    }
+    cloud_ingest_.ingest(*pointcloud_msg, *cloud_filtered_, source_indices_);
+    pcl::PointCloud<pcl::PointXYZRGB>::Ptr cloud_filtered = cloud_filtered_;
 
     // Check if any points remain
     if( cloud_filtered->points.size() == 0 )
@@ -317,6 +706,9 @@ public:
       extract.setNegative(true);
       extract.filter(*cloud_filtered);  // remove table from cloud_filtered
 
+      // Keep the image indices lined up with the points that are left
+      removeSourceIndices(inliers->indices);
+
 
       // Debug output - DTC
       // Show the contents of the inlier set, together with the estimated plane parameters, in ax+by+cz+d=0 form (general equation of a plane)
@@ -355,36 +747,12 @@ public:
 
     ROS_WARN_STREAM("Number indicies/clusters: " << cluster_indices.size() );
 
-    //    processClusters( cluster_indices, pointcloud_msg, cloud_filtered );
-    processClusters( cluster_indices, cloud_transformed, cloud_filtered );
-
-    // ---------------------------------------------------------------------------------------------
-    // Final results
-    if(result_.blocks.poses.size() > 0)
-    {
-      // Change action state, if we the action is currently active
-      if(action_server_.isActive())
-      {
-        action_server_.setSucceeded(result_);
-      }
-      // Publish block poses
-      block_pose_pub_.publish(result_.blocks);
-
-      // Publish rviz markers of the blocks
-      publishBlockLocation();
-
-      ROS_INFO("[block detection] Finished");
-    }
-    else
-    {
-      ROS_INFO("[block detection] Couldn't find any blocks this iteration!");
-    }
+    processClusters( cluster_indices, pointcloud_msg, cloud_filtered );
   }
 
   // Processes the point cloud with OpenCV using the PCL cluster indices
   void processClusters( const std::vector<pcl::PointIndices> cluster_indices,
-                        //                        const sensor_msgs::PointCloud2ConstPtr& pointcloud_msg,
-                        const pcl::PointCloud<pcl::PointXYZRGB>::ConstPtr cloud_transformed,
+                        const sensor_msgs::PointCloud2ConstPtr& pointcloud_msg,
                         const pcl::PointCloud<pcl::PointXYZRGB>::ConstPtr& cloud_filtered )
   {
     // -------------------------------------------------------------------------------------------------------
@@ -394,8 +762,7 @@ public:
     try
     {
       sensor_msgs::ImagePtr image_msg(new sensor_msgs::Image);
-      //      pcl::toROSMsg (*pointcloud_msg, *image_msg);
-      pcl::toROSMsg (*cloud_transformed, *image_msg);
+      pcl::toROSMsg (*pointcloud_msg, *image_msg);
       cv_bridge::CvImagePtr input_bridge = cv_bridge::toCvCopy(image_msg, "rgb8");
       cluster_image = input_bridge->image;
     }
@@ -417,15 +784,18 @@ public:
     // -------------------------------------------------------------------------------------------------------
     // GUI Stuff
 
-    // First window
-    const char* source_window = "Source";
-    cv::namedWindow( source_window, CV_WINDOW_AUTOSIZE );
-    cv::imshow( source_window, cluster_image_gray );
-    cv::createTrackbar( " Canny thresh:", "Source", &opencv_threshhold, max_opencv_threshhold );
-
-    // Second window
-    cv::namedWindow( "Contours", CV_WINDOW_AUTOSIZE );
-    cv::waitKey(10000); // 1 sec to allow gui to catch up
+    if( show_windows_ )
+    {
+      // First window
+      const char* source_window = "Source";
+      cv::namedWindow( source_window, CV_WINDOW_AUTOSIZE );
+      cv::imshow( source_window, cluster_image_gray );
+      cv::createTrackbar( " Canny thresh:", "Source", &opencv_threshhold, max_opencv_threshhold );
+
+      // Second window
+      cv::namedWindow( "Contours", CV_WINDOW_AUTOSIZE );
+      cv::waitKey(10000); // 1 sec to allow gui to catch up
+    }
 
     // -------------------------------------------------------------------------------------------------------
     // Start processing clusters
@@ -520,14 +890,14 @@ public:
         int px_xmax = 0; int py_xmax = 0;
         int px_ymax = 0; int py_ymax = 0;
 
-        getXYCoordinates( xmaxi, image_height, image_width, px_xmax, py_xmax);
-        getXYCoordinates( ymaxi, image_height, image_width, px_ymax, py_ymax);
+        getXYCoordinates( source_indices_[xmaxi], image_height, image_width, px_xmax, py_xmax);
+        getXYCoordinates( source_indices_[ymaxi], image_height, image_width, px_ymax, py_ymax);
 
         // Get the pixel coordinates of the xmin and ymin indicies
         int px_xmin = 0; int py_xmin = 0;
         int px_ymin = 0; int py_ymin = 0;
-        getXYCoordinates( xmini, image_height, image_width, px_xmin, py_xmin);
-        getXYCoordinates( ymini, image_height, image_width, px_ymin, py_ymin);
+        getXYCoordinates( source_indices_[xmini], image_height, image_width, px_xmin, py_xmin);
+        getXYCoordinates( source_indices_[ymini], image_height, image_width, px_ymin, py_ymin);
 
 
         float roi_width = px_xmax - px_xmin;
@@ -556,10 +926,13 @@ public:
 
 
         // GUI Stuff
-        ROS_INFO_STREAM("pre imshow");
-        cv::imshow( "Contours", cluster_image_cropped );
-        ROS_INFO_STREAM("imshow");
-        cv::waitKey(0); // 50 milisec to allow gui to catch up
+        if( show_windows_ )
+        {
+          ROS_INFO_STREAM("pre imshow");
+          cv::imshow( "Contours", cluster_image_cropped );
+          ROS_INFO_STREAM("imshow");
+          cv::waitKey(0); // 50 milisec to allow gui to catch up
+        }
 
 
         // Detect edges using canny
@@ -587,9 +960,12 @@ public:
 
         // -------------------------------------------------------------------------------------------------------
         // GUI Stuff
-        cv::imshow( "Contours", drawing );
-        ROS_INFO_STREAM("imshow");
-        cv::waitKey(5000); // 1 sec to allow gui to catch up
+        if( show_windows_ )
+        {
+          cv::imshow( "Contours", drawing );
+          ROS_INFO_STREAM("imshow");
+          cv::waitKey(5000); // 1 sec to allow gui to catch up
+        }
 
 
         // figure out the position and the orientation of the block
@@ -708,6 +1084,22 @@ public:
     }
   }
 
+  // Drop the removed points from source_indices_, same as ExtractIndices does to the cloud
+  void removeSourceIndices(const std::vector<int>& removed)
+  {
+    std::vector<bool> is_removed(source_indices_.size(), false);
+    for(size_t r = 0; r < removed.size(); ++r)
+      is_removed[removed[r]] = true;
+
+    size_t keep = 0;
+    for(size_t i = 0; i < source_indices_.size(); ++i)
+    {
+      if(!is_removed[i])
+        source_indices_[keep++] = source_indices_[i];
+    }
+    source_indices_.resize(keep);
+  }
+
   void getXYCoordinates(const int index, const int height, const int width,
                         int& x, int& y)
   {
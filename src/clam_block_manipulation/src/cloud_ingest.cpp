@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clam_block_manipulation/cloud_ingest.h>
+
+#include <ros/ros.h>
+#include <sensor_msgs/PointField.h>
+
+#include <cstring>
+#include <limits>
+
+namespace clam_block_manipulation
+{
+
+CloudIngest::CloudIngest() :
+  have_transform_(false),
+  transform_lookups_(0),
+  self_filter_(NULL)
+{
+  transform_.setIdentity();
+
+  // Unbounded until told otherwise
+  min_pt_.setConstant(-std::numeric_limits<float>::infinity());
+  max_pt_.setConstant(std::numeric_limits<float>::infinity());
+}
+
+void CloudIngest::setWorkspace(const Eigen::Vector3f& min_pt, const Eigen::Vector3f& max_pt)
+{
+  min_pt_ << min_pt.x(), min_pt.y(), min_pt.z(), -std::numeric_limits<float>::infinity();
+  max_pt_ << max_pt.x(), max_pt.y(), max_pt.z(), std::numeric_limits<float>::infinity();
+}
+
+void CloudIngest::setTransform(const Eigen::Affine3f& transform)
+{
+  transform_ = transform.matrix();
+  have_transform_ = true;
+}
+
+bool CloudIngest::updateTransform(tf::TransformListener& tf_listener, const std::string& target_frame,
+                                  const std_msgs::Header& cloud_header, const ros::Duration& timeout)
+{
+  bool frames_changed = !have_transform_ ||
+    target_frame != target_frame_ || cloud_header.frame_id != source_frame_;
+
+  // Cheap check: has anything newer than our cached transform been published?
+  ros::Time latest;
+  std::string error;
+  if( tf_listener.getLatestCommonTime(cloud_header.frame_id, target_frame, latest, &error) != tf::NO_ERROR )
+  {
+    if( !frames_changed )
+    {
+      // Keep going with what we have, the camera mount doesn't move
+      ROS_DEBUG_STREAM("[cloud ingest] Using cached transform: " << error);
+      return true;
+    }
+
+    // First time through, give TF a chance to fill up
+    if( !tf_listener.waitForTransform(target_frame, cloud_header.frame_id, cloud_header.stamp, timeout, ros::Duration(0.01), &error) )
+    {
+      ROS_ERROR_STREAM("[cloud ingest] No transform from " << cloud_header.frame_id << " to " << target_frame << ": " << error);
+      return false;
+    }
+    latest = ros::Time(0);
+  }
+  else if( !frames_changed && latest == transform_stamp_ )
+  {
+    return true;
+  }
+
+  tf::StampedTransform stamped;
+  try
+  {
+    tf_listener.lookupTransform(target_frame, cloud_header.frame_id, latest, stamped);
+  }
+  catch (tf::TransformException& ex)
+  {
+    ROS_ERROR_STREAM("[cloud ingest] TF exception: " << ex.what());
+    return have_transform_ && !frames_changed;
+  }
+
+  const tf::Matrix3x3& basis = stamped.getBasis();
+  const tf::Vector3& origin = stamped.getOrigin();
+  for( int r = 0; r < 3; ++r )
+  {
+    for( int c = 0; c < 3; ++c )
+      transform_(r, c) = basis[r][c];
+    transform_(r, 3) = origin[r];
+  }
+  transform_.row(3) << 0, 0, 0, 1;
+
+  target_frame_ = target_frame;
+  source_frame_ = cloud_header.frame_id;
+  transform_stamp_ = stamped.stamp_;
+  have_transform_ = true;
+  ++transform_lookups_;
+
+  return true;
+}
+
+int CloudIngest::getFieldOffset(const sensor_msgs::PointCloud2& msg, const std::string& name)
+{
+  for( size_t i = 0; i < msg.fields.size(); ++i )
+  {
+    if( msg.fields[i].name == name && msg.fields[i].datatype == sensor_msgs::PointField::FLOAT32 )
+      return msg.fields[i].offset;
+  }
+  return -1;
+}
+
+bool CloudIngest::lookupPoint(const sensor_msgs::PointCloud2& msg, int index, Eigen::Vector3f& out) const
+{
+  int x_offset = getFieldOffset(msg, "x");
+  int y_offset = getFieldOffset(msg, "y");
+  int z_offset = getFieldOffset(msg, "z");
+
+  if( x_offset < 0 || y_offset < 0 || z_offset < 0 || !have_transform_ ||
+      index < 0 || index >= (int)(msg.width * msg.height) )
+    return false;
+
+  const uint8_t* data = &msg.data[(index / msg.width) * msg.row_step + (index % msg.width) * msg.point_step];
+
+  Eigen::Vector4f p;
+  std::memcpy(&p[0], data + x_offset, sizeof(float));
+  std::memcpy(&p[1], data + y_offset, sizeof(float));
+  std::memcpy(&p[2], data + z_offset, sizeof(float));
+  p[3] = 1.0f;
+
+  if( !pcl_isfinite(p[0]) || !pcl_isfinite(p[1]) || !pcl_isfinite(p[2]) )
+    return false;
+
+  Eigen::Vector4f q = transform_ * p;
+  if( self_filter_ && self_filter_->isReady() && self_filter_->contains(q) )
+    return false;
+
+  out = q.head<3>();
+  return true;
+}
+
+size_t CloudIngest::ingest(const sensor_msgs::PointCloud2& msg,
+                           pcl::PointCloud<pcl::PointXYZRGB>& out,
+                           std::vector<int>& source_indices) const
+{
+  // clear() keeps the capacity from the last frame, so after the first cloud nothing is allocated
+  out.points.clear();
+  source_indices.clear();
+
+  out.header = msg.header;
+  out.header.frame_id = target_frame_;
+  out.height = 1;
+  out.width = 0;
+  out.is_dense = true;
+
+  int x_offset = getFieldOffset(msg, "x");
+  int y_offset = getFieldOffset(msg, "y");
+  int z_offset = getFieldOffset(msg, "z");
+  int rgb_offset = getFieldOffset(msg, "rgb");
+  if( rgb_offset < 0 )
+    rgb_offset = getFieldOffset(msg, "rgba");
+
+  if( x_offset < 0 || y_offset < 0 || z_offset < 0 || !have_transform_ || msg.data.empty() )
+  {
+    ROS_ERROR("[cloud ingest] Cloud has no float x/y/z fields or no transform is available");
+    return 0;
+  }
+
+  // Kinect clouds are packed xyz-pad-rgb, read all three coordinates with one copy when we can
+  const bool packed_xyz = (y_offset == x_offset + 4) && (z_offset == x_offset + 8);
+
+  const Eigen::Matrix4f transform = transform_;
+  const Eigen::Array4f min_pt = min_pt_;
+  const Eigen::Array4f max_pt = max_pt_;
+  const RobotSelfFilter* self_filter = (self_filter_ && self_filter_->isReady()) ? self_filter_ : NULL;
+
+  Eigen::Vector4f p;
+  Eigen::Vector4f q;
+  pcl::PointXYZRGB pt;
+
+  for( size_t row = 0; row < msg.height; ++row )
+  {
+    const uint8_t* data = &msg.data[row * msg.row_step];
+    int index = row * msg.width;
+
+    for( size_t col = 0; col < msg.width; ++col, data += msg.point_step, ++index )
+    {
+      if( packed_xyz )
+      {
+        std::memcpy(p.data(), data + x_offset, 3 * sizeof(float));
+      }
+      else
+      {
+        std::memcpy(&p[0], data + x_offset, sizeof(float));
+        std::memcpy(&p[1], data + y_offset, sizeof(float));
+        std::memcpy(&p[2], data + z_offset, sizeof(float));
+      }
+      p[3] = 1.0f;
+
+      // Packed 4x4 multiply, then the crop test as two whole-vector compares.
+      // NaN (no depth) points fail the compare so they are dropped here as well.
+      q.noalias() = transform * p;
+      if( !((q.array() >= min_pt).all() && (q.array() <= max_pt).all()) )
+        continue;
+
+      // Only points that survived the crop are checked against the robot
+      if( self_filter && self_filter->contains(q) )
+        continue;
+
+      pt.x = q[0];
+      pt.y = q[1];
+      pt.z = q[2];
+      if( rgb_offset >= 0 )
+        std::memcpy(&pt.rgb, data + rgb_offset, sizeof(float));
+      else
+        pt.rgb = 0;
+
+      out.points.push_back(pt);
+      source_indices.push_back(index);
+    }
+  }
+
+  out.width = out.points.size();
+
+  return out.points.size();
+}
+
+} // namespace
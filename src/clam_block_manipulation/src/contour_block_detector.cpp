@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clam_block_manipulation/contour_block_detector.h>
+
+#include <ros/ros.h>
+
+#include <cmath>
+#include <limits>
+
+namespace clam_block_manipulation
+{
+
+// Rect corners are pulled this far towards the center before looking up depth,
+// so that they land on the top face of the block and not on the table behind it
+static const float CORNER_SHRINK = 0.7;
+
+// Spacing in full resolution pixels of the depth samples used to find the workspace in the image
+static const int WORKSPACE_GRID_STEP = 8;
+
+ContourBlockDetector::ContourBlockDetector() :
+  pyramid_levels_(1),
+  method_(CANNY),
+  canny_threshold_(100),
+  min_area_(150),
+  max_area_(6000),
+  workspace_min_(-std::numeric_limits<float>::infinity() * Eigen::Vector3f::Ones()),
+  workspace_max_(std::numeric_limits<float>::infinity() * Eigen::Vector3f::Ones())
+{
+}
+
+void ContourBlockDetector::setAreaLimits(double min_area, double max_area)
+{
+  min_area_ = min_area;
+  max_area_ = max_area;
+}
+
+void ContourBlockDetector::setWorkspace(const Eigen::Vector3f& min_pt, const Eigen::Vector3f& max_pt)
+{
+  workspace_min_ = min_pt;
+  workspace_max_ = max_pt;
+}
+
+bool ContourBlockDetector::inWorkspace(const Eigen::Vector3f& point) const
+{
+  return (point.array() >= workspace_min_.array()).all() && (point.array() <= workspace_max_.array()).all();
+}
+
+cv::Rect ContourBlockDetector::findWorkspace(const sensor_msgs::PointCloud2& msg, const CloudIngest& cloud_ingest)
+{
+  int rows = (msg.height + WORKSPACE_GRID_STEP - 1) / WORKSPACE_GRID_STEP;
+  int cols = (msg.width + WORKSPACE_GRID_STEP - 1) / WORKSPACE_GRID_STEP;
+  workspace_mask_.create(rows, cols, CV_8UC1);
+  workspace_mask_.setTo(cv::Scalar(0));
+
+  for( int row = 0; row < rows; ++row )
+  {
+    for( int col = 0; col < cols; ++col )
+    {
+      Eigen::Vector3f point;
+      cv::Point2f pixel(col * WORKSPACE_GRID_STEP + WORKSPACE_GRID_STEP / 2,
+                        row * WORKSPACE_GRID_STEP + WORKSPACE_GRID_STEP / 2);
+      if( lookupPixel(msg, cloud_ingest, pixel, point) && inWorkspace(point) )
+        workspace_mask_.at<uchar>(row, col) = 255;
+    }
+  }
+
+  // Block edges and pixels with no depth next to the workspace still count as inside
+  cv::dilate(workspace_mask_, workspace_mask_, cv::Mat());
+
+  std::vector<cv::Point> cells;
+  for( int row = 0; row < rows; ++row )
+    for( int col = 0; col < cols; ++col )
+      if( workspace_mask_.at<uchar>(row, col) )
+        cells.push_back(cv::Point(col, row));
+
+  if( cells.empty() )
+    return cv::Rect();
+
+  cv::Rect box = cv::boundingRect(cells);
+  cv::Rect roi(box.x * WORKSPACE_GRID_STEP, box.y * WORKSPACE_GRID_STEP,
+               box.width * WORKSPACE_GRID_STEP, box.height * WORKSPACE_GRID_STEP);
+  return roi & cv::Rect(0, 0, msg.width, msg.height);
+}
+
+bool ContourBlockDetector::pixelInWorkspace(const cv::Point2f& pixel) const
+{
+  int row = cvFloor(pixel.y / WORKSPACE_GRID_STEP);
+  int col = cvFloor(pixel.x / WORKSPACE_GRID_STEP);
+  if( row < 0 || col < 0 || row >= workspace_mask_.rows || col >= workspace_mask_.cols )
+    return false;
+
+  return workspace_mask_.at<uchar>(row, col) != 0;
+}
+
+bool ContourBlockDetector::lookupPixel(const sensor_msgs::PointCloud2& msg, const CloudIngest& cloud_ingest,
+                                       const cv::Point2f& pixel, Eigen::Vector3f& out) const
+{
+  int u = cvRound(pixel.x);
+  int v = cvRound(pixel.y);
+  if( u < 0 || v < 0 || u >= (int)msg.width || v >= (int)msg.height )
+    return false;
+
+  return cloud_ingest.lookupPoint(msg, v * msg.width + u, out);
+}
+
+ContourBlockDetector::Result ContourBlockDetector::detect(const sensor_msgs::PointCloud2& msg,
+                                                          const cv::Mat& image,
+                                                          const CloudIngest& cloud_ingest,
+                                                          double block_size, double table_height,
+                                                          std::vector<DetectedBlock>& blocks)
+{
+  blocks.clear();
+
+  // Only look where the table is -------------------------------------------------------------
+  cv::Rect workspace = findWorkspace(msg, cloud_ingest);
+  if( workspace.area() == 0 )
+  {
+    ROS_DEBUG("[contour detection] Workspace not visible in the image");
+    return AMBIGUOUS;
+  }
+
+  // Downscale ---------------------------------------------------------------------------------
+  const float scale = 1 << pyramid_levels_;
+  const double area_scale = scale * scale;
+
+  if( pyramid_levels_ > 0 )
+  {
+    cv::pyrDown(image, small_);
+    for( int level = 1; level < pyramid_levels_; ++level )
+      cv::pyrDown(small_, small_);
+  }
+  else
+  {
+    small_ = image;
+  }
+
+  cv::Rect roi(workspace.x / scale, workspace.y / scale, workspace.width / scale, workspace.height / scale);
+  roi &= cv::Rect(0, 0, small_.cols, small_.rows);
+
+  cv::cvtColor(small_(roi), gray_, CV_BGR2GRAY);
+  cv::blur(gray_, gray_, cv::Size(3,3));
+
+  // Segment -----------------------------------------------------------------------------------
+  if( method_ == THRESHOLD )
+  {
+    cv::threshold(gray_, binary_, 0, 255, cv::THRESH_BINARY | cv::THRESH_OTSU);
+  }
+  else
+  {
+    cv::Canny(gray_, binary_, canny_threshold_, canny_threshold_*2, 3);
+    // Close small gaps in the outline so findContours gets one closed shape per block
+    cv::dilate(binary_, binary_, cv::Mat());
+  }
+
+  contours_.clear();
+  cv::findContours(binary_, contours_, CV_RETR_EXTERNAL, CV_CHAIN_APPROX_SIMPLE, roi.tl());
+
+  // Check each candidate ----------------------------------------------------------------------
+  const double tol = 0.015; // a bit looser than the 3D path, corners are only sampled
+  bool ambiguous = false;
+
+  for( size_t c = 0; c < contours_.size(); ++c )
+  {
+    double area = cv::contourArea(contours_[c]) * area_scale;
+    if( area < min_area_ || area > max_area_ )
+      continue; // clearly not a block, not ambiguous either
+
+    cv::RotatedRect rect = cv::minAreaRect(contours_[c]);
+
+    // Back to full resolution
+    rect.center.x *= scale;
+    rect.center.y *= scale;
+    rect.size.width *= scale;
+    rect.size.height *= scale;
+
+    // The ROI is a box around the table, things next to it are not blocks to worry about
+    if( !pixelInWorkspace(rect.center) )
+    {
+      ROS_DEBUG("[contour detection] Candidate %d is off the table", int(c));
+      continue;
+    }
+
+    cv::Point2f corners[4];
+    rect.points(corners);
+
+    Eigen::Vector3f center;
+    if( !lookupPixel(msg, cloud_ingest, rect.center, center) )
+    {
+      ROS_DEBUG("[contour detection] No depth for candidate %d", int(c));
+      ambiguous = true;
+      continue;
+    }
+
+    if( !inWorkspace(center) )
+    {
+      ROS_DEBUG("[contour detection] Candidate %d is outside the workspace", int(c));
+      continue;
+    }
+
+    Eigen::Vector3f corner3d[4];
+    bool have_depth = true;
+    for( int i = 0; i < 4 && have_depth; ++i )
+    {
+      cv::Point2f shrunk = rect.center + (corners[i] - rect.center) * CORNER_SHRINK;
+      have_depth = lookupPixel(msg, cloud_ingest, shrunk, corner3d[i]);
+    }
+
+    if( !have_depth )
+    {
+      ROS_DEBUG("[contour detection] No depth for the corners of candidate %d", int(c));
+      ambiguous = true;
+      continue;
+    }
+
+    // Top face should be one block above the table
+    if( std::fabs(center.z() - (table_height + block_size)) > 0.02 )
+    {
+      ROS_DEBUG("[contour detection] Candidate %d at wrong height %f", int(c), center.z());
+      ambiguous = true;
+      continue;
+    }
+
+    // Sides, measured in the working frame
+    float side_a = (corner3d[1] - corner3d[0]).head<2>().norm() / CORNER_SHRINK;
+    float side_b = (corner3d[2] - corner3d[1]).head<2>().norm() / CORNER_SHRINK;
+    if( std::fabs(side_a - block_size) > tol || std::fabs(side_b - block_size) > tol )
+    {
+      ROS_DEBUG("[contour detection] Candidate %d rejected, sides %f %f", int(c), side_a, side_b);
+      ambiguous = true;
+      continue;
+    }
+
+    // Orientation of one edge, folded into [-pi/4, pi/4] since the block is square
+    Eigen::Vector3f edge = corner3d[1] - corner3d[0];
+    float angle = std::atan2(edge.y(), edge.x());
+    while( angle > M_PI/4 )
+      angle -= M_PI/2;
+    while( angle < -M_PI/4 )
+      angle += M_PI/2;
+
+    DetectedBlock block;
+    block.x = center.x();
+    block.y = center.y();
+    block.z = table_height + block_size / 2;
+    block.angle = angle;
+    blocks.push_back(block);
+  }
+
+  if( ambiguous || blocks.empty() )
+    return AMBIGUOUS;
+
+  return FOUND;
+}
+
+} // namespace
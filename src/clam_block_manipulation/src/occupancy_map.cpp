@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clam_block_manipulation/occupancy_map.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace clam_block_manipulation
+{
+
+OccupancyMap::OccupancyMap(const Eigen::Vector3f& min_pt, const Eigen::Vector3f& max_pt, float resolution, int region_size) :
+  min_pt_(min_pt),
+  resolution_(resolution),
+  region_size_(region_size),
+  occupied_count_(0),
+  frame_(0),
+  max_rays_(2000),
+  sweep_offset_(0)
+{
+  Eigen::Vector3f extent = (max_pt - min_pt) / resolution;
+  dims_ << std::max(1, (int) ceil(extent.x())), std::max(1, (int) ceil(extent.y())), std::max(1, (int) ceil(extent.z()));
+  max_pt_ = min_pt_ + dims_.cast<float>() * resolution_;
+
+  region_dims_ = (dims_.array() + region_size_ - 1) / region_size_;
+
+  size_t voxels = dims_.x() * dims_.y() * dims_.z();
+  log_odds_.assign(voxels, 0);
+  hit_frame_.assign(voxels, 0);
+  miss_frame_.assign(voxels, 0);
+  exit_frame_.assign(voxels, 0);
+  region_dirty_.assign(region_dims_.x() * region_dims_.y() * region_dims_.z(), 0);
+}
+
+size_t OccupancyMap::insert(const pcl::PointCloud<pcl::PointXYZRGB>& cloud, const Eigen::Vector3f& origin)
+{
+  ++frame_;
+  fresh_ends_.clear();
+  settled_ends_.clear();
+
+  // ---------------------------------------------------------------------------------------------
+  // Bin the points into end voxels, one ray per voxel however many points fell in it
+  Eigen::Vector3i voxel;
+  for( size_t i = 0; i < cloud.points.size(); ++i )
+  {
+    const pcl::PointXYZRGB& pt = cloud.points[i];
+    Eigen::Vector3f point(pt.x, pt.y, pt.z);
+    if( !toVoxel(point, voxel) )
+    {
+      // Past the grid: the ray still clears what it crosses, up to where it leaves the grid
+      Eigen::Vector3f direction = point - origin;
+      float length = direction.norm();
+      float t_enter, t_exit;
+      if( !(length > 0) || !clipRay(origin, direction / length, length, t_enter, t_exit) )
+        continue;
+
+      toVoxel(origin + direction * (t_exit / length), voxel);
+      int index = toIndex(voxel.cwiseMax(Eigen::Vector3i::Zero()).cwiseMin(dims_ - Eigen::Vector3i::Ones()));
+      if( exit_frame_[index] == frame_ )
+        continue;
+      exit_frame_[index] = frame_;
+
+      // Nothing to gain from being early, these only clear
+      settled_ends_.push_back(index);
+      continue;
+    }
+
+    int index = toIndex(voxel);
+    if( hit_frame_[index] == frame_ )
+      continue;
+    hit_frame_[index] = frame_;
+
+    // Hits on a voxel at its clamp don't change it, those rays only clear the space in front
+    if( log_odds_[index] < LOG_ODDS_MAX )
+      fresh_ends_.push_back(index);
+    else
+      settled_ends_.push_back(index);
+  }
+
+  // ---------------------------------------------------------------------------------------------
+  // Spend the ray budget on voxels that can still change first
+  size_t rays = 0;
+  for( size_t i = 0; i < fresh_ends_.size() && rays < max_rays_; ++i, ++rays )
+  {
+    update(fresh_ends_[i], LOG_ODDS_HIT);
+    castRay(origin, toVoxel(fresh_ends_[i]));
+  }
+
+  // Then sweep through the rest, carrying on from where the last frame stopped
+  if( !settled_ends_.empty() && rays < max_rays_ )
+  {
+    size_t count = std::min(settled_ends_.size(), max_rays_ - rays);
+    size_t start = sweep_offset_ % settled_ends_.size();
+    for( size_t i = 0; i < count; ++i, ++rays )
+      castRay(origin, toVoxel(settled_ends_[(start + i) % settled_ends_.size()]));
+    sweep_offset_ = start + count;
+  }
+
+  return rays;
+}
+
+void OccupancyMap::popChangedRegions(std::vector<Region>& regions)
+{
+  regions.resize(dirty_regions_.size());
+
+  for( size_t r = 0; r < dirty_regions_.size(); ++r )
+  {
+    int id = dirty_regions_[r];
+    region_dirty_[id] = 0;
+
+    Region& region = regions[r];
+    region.id = id;
+    region.occupied.clear();
+
+    Eigen::Vector3i first(id % region_dims_.x(),
+                          (id / region_dims_.x()) % region_dims_.y(),
+                          id / (region_dims_.x() * region_dims_.y()));
+    first *= region_size_;
+    Eigen::Vector3i last = (first.array() + region_size_).min(dims_.array());
+
+    Eigen::Vector3i v;
+    for( v.z() = first.z(); v.z() < last.z(); ++v.z() )
+      for( v.y() = first.y(); v.y() < last.y(); ++v.y() )
+        for( v.x() = first.x(); v.x() < last.x(); ++v.x() )
+        {
+          if( log_odds_[toIndex(v)] > 0 )
+            region.occupied.push_back(voxelCenter(v));
+        }
+  }
+
+  dirty_regions_.clear();
+}
+
+Eigen::Vector3i OccupancyMap::toVoxel(int index) const
+{
+  return Eigen::Vector3i(index % dims_.x(), (index / dims_.x()) % dims_.y(), index / (dims_.x() * dims_.y()));
+}
+
+Eigen::Vector3f OccupancyMap::voxelCenter(const Eigen::Vector3i& voxel) const
+{
+  return min_pt_ + (voxel.cast<float>() + Eigen::Vector3f::Constant(0.5f)) * resolution_;
+}
+
+int OccupancyMap::regionOf(const Eigen::Vector3i& voxel) const
+{
+  Eigen::Vector3i region = voxel / region_size_;
+  return (region.z() * region_dims_.y() + region.y()) * region_dims_.x() + region.x();
+}
+
+void OccupancyMap::castRay(const Eigen::Vector3f& origin, const Eigen::Vector3i& end_voxel)
+{
+  Eigen::Vector3f end = voxelCenter(end_voxel);
+  Eigen::Vector3f direction = end - origin;
+  float length = direction.norm();
+  if( length <= 0 )
+    return;
+  direction /= length;
+
+  // Clip the ray to the grid, the camera is usually outside it
+  float t_enter;
+  float t_exit;
+  if( !clipRay(origin, direction, length, t_enter, t_exit) )
+    return;
+
+  // Walk the voxels along the ray (Amanatides & Woo)
+  Eigen::Vector3f start = origin + direction * t_enter;
+  Eigen::Vector3i voxel;
+  toVoxel(start, voxel);
+  voxel = voxel.cwiseMax(Eigen::Vector3i::Zero()).cwiseMin(dims_ - Eigen::Vector3i::Ones());
+
+  Eigen::Vector3i step;
+  Eigen::Vector3f t_max;
+  Eigen::Vector3f t_delta;
+  for( int a = 0; a < 3; ++a )
+  {
+    if( fabs(direction[a]) < 1e-9 )
+    {
+      step[a] = 0;
+      t_max[a] = std::numeric_limits<float>::infinity();
+      t_delta[a] = std::numeric_limits<float>::infinity();
+      continue;
+    }
+
+    step[a] = direction[a] > 0 ? 1 : -1;
+    float boundary = min_pt_[a] + (voxel[a] + (step[a] > 0 ? 1 : 0)) * resolution_;
+    t_max[a] = (boundary - origin[a]) / direction[a];
+    t_delta[a] = resolution_ / fabs(direction[a]);
+  }
+
+  // The end voxel is cleared too unless it was hit. It isn't for rays to points past the grid.
+  int max_steps = dims_.sum();
+  for( int i = 0; i < max_steps; ++i )
+  {
+    int index = toIndex(voxel);
+
+    // Hits win over misses, and a voxel is only cleared once per frame
+    if( hit_frame_[index] != frame_ && miss_frame_[index] != frame_ )
+    {
+      miss_frame_[index] = frame_;
+      update(index, LOG_ODDS_MISS);
+    }
+
+    if( voxel == end_voxel )
+      break;
+
+    int a;
+    t_max.minCoeff(&a);
+    voxel[a] += step[a];
+    t_max[a] += t_delta[a];
+
+    if( voxel[a] < 0 || voxel[a] >= dims_[a] )
+      break;
+  }
+}
+
+bool OccupancyMap::clipRay(const Eigen::Vector3f& origin, const Eigen::Vector3f& direction, float length,
+                           float& t_enter, float& t_exit) const
+{
+  t_enter = 0;
+  t_exit = length;
+  for( int a = 0; a < 3; ++a )
+  {
+    if( fabs(direction[a]) < 1e-9 )
+    {
+      // Parallel to this pair of faces, either always between them or never
+      if( origin[a] < min_pt_[a] || origin[a] > max_pt_[a] )
+        return false;
+      continue;
+    }
+
+    float t1 = (min_pt_[a] - origin[a]) / direction[a];
+    float t2 = (max_pt_[a] - origin[a]) / direction[a];
+    t_enter = std::max(t_enter, std::min(t1, t2));
+    t_exit = std::min(t_exit, std::max(t1, t2));
+  }
+  return t_enter < t_exit;
+}
+
+void OccupancyMap::update(int index, int8_t delta)
+{
+  int8_t old_value = log_odds_[index];
+  int8_t new_value = std::max<int>(LOG_ODDS_MIN, std::min<int>(LOG_ODDS_MAX, old_value + delta));
+  if( new_value == old_value )
+    return;
+
+  log_odds_[index] = new_value;
+
+  bool was_occupied = old_value > 0;
+  bool is_occupied = new_value > 0;
+  if( was_occupied == is_occupied )
+    return;
+
+  if( is_occupied )
+    ++occupied_count_;
+  else
+    --occupied_count_;
+
+  int region = regionOf(toVoxel(index));
+  if( !region_dirty_[region] )
+  {
+    region_dirty_[region] = 1;
+    dirty_regions_.push_back(region);
+  }
+}
+
+} // namespace
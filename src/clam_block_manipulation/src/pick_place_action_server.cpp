@@ -65,6 +65,8 @@
 #include <moveit/trajectory_processing/trajectory_tools.h> // for plan_execution
 //#include <moveit/kinematics_planner/kinematics_planner.h>
 #include <moveit/trajectory_processing/iterative_time_parameterization.h>
+#include <clam_controller/motion_plan_cache.h>
+#include <clam_controller/planner_race.h>
 
 
 // Rviz
@@ -107,6 +109,13 @@ private:
   trajectory_execution_manager::TrajectoryExecutionManagerPtr trajectory_execution_manager_;
   boost::shared_ptr<plan_execution::PlanExecution> plan_execution_;
 
+  // Plans between the pick and place poses, checked against the scene before reuse
+  clam_controller::MotionPlanCache plan_cache_;
+  clam_controller::SceneVersion scene_version_;
+
+  // Several planners on each goal at once, first good plan wins
+  boost::shared_ptr<clam_controller::PlannerRace> planner_race_;
+
   // Subscriber
   ros::Subscriber pick_place_sub_;
 
@@ -154,6 +163,7 @@ public:
       planning_scene_monitor_->startWorldGeometryMonitor();
       planning_scene_monitor_->startSceneMonitor("/move_group/monitored_planning_scene");
       planning_scene_monitor_->startStateMonitor("/joint_states", "/attached_collision_object");
+      planning_scene_monitor_->addUpdateCallback(boost::bind(&PickPlaceServer::sceneUpdated, this, _1));
     }
     else
     {
@@ -166,6 +176,16 @@ public:
                                         (planning_scene_monitor_->getKinematicModel()));
     plan_execution_.reset(new plan_execution::PlanExecution(planning_scene_monitor_, trajectory_execution_manager_));
 
+    // ---------------------------------------------------------------------------------------------
+    // Create the planner portfolio, configs from ompl_planning.yaml
+    std::vector<std::string> planner_ids;
+    if( !ros::NodeHandle("~").getParam("planners", planner_ids) )
+    {
+      planner_ids.push_back("RRTConnectkConfigDefault");
+      planner_ids.push_back("KPIECEkConfigDefault");
+    }
+    planner_race_.reset(new clam_controller::PlannerRace(planning_scene_monitor_->getKinematicModel(), planner_ids));
+
     // ---------------------------------------------------------------------------------------------
     // Wait for complete state to be recieved
     ros::Duration(0.25).sleep();
@@ -277,6 +297,17 @@ public:
   }
 
 
+  // Cached plans only need a collision check again once the geometry or the attached bodies have changed
+  void sceneUpdated(planning_scene_monitor::PlanningSceneMonitor::SceneUpdateType type)
+  {
+    if( type & (planning_scene_monitor::PlanningSceneMonitor::UPDATE_GEOMETRY |
+                planning_scene_monitor::PlanningSceneMonitor::UPDATE_STATE) )
+    {
+      planning_scene_monitor::LockedPlanningSceneRO planning_scene(planning_scene_monitor_);
+      scene_version_.update(planning_scene, type & planning_scene_monitor::PlanningSceneMonitor::UPDATE_GEOMETRY);
+    }
+  }
+
   bool sendGraspPoseCommand(const geometry_msgs::Pose& pose)
   {
     geometry_msgs::Pose goal_pose;
@@ -338,22 +369,76 @@ public:
                 goal_pose.pose.orientation.z, goal_pose.pose.orientation.w );
 
     // -------------------------------------------------------------------------------------------
-    // Plan
-    movegroup_action_.sendGoal(goal);
-    ros::Duration(5.0).sleep();
+    // Plan, or reuse the plan from last time if it is still valid
+    moveit_msgs::RobotTrajectory trajectory;
+    moveit_msgs::RobotState start_state;
+    unsigned int scene_version = scene_version_.get();
+    planning_scene::PlanningScenePtr snapshot; // planned on, the monitor keeps updating its own scene
+    bool cached;
+    {
+      planning_scene_monitor::LockedPlanningSceneRO planning_scene(planning_scene_monitor_);
+      cached = plan_cache_.lookup(planning_scene, scene_version, goal.request, trajectory);
+      if( !cached )
+      {
+        robot_state::robotStateToRobotStateMsg(planning_scene->getCurrentState(), start_state);
+        snapshot = planning_scene::PlanningScene::clone(planning_scene);
+      }
+    }
 
-    if(!movegroup_action_.waitForResult(ros::Duration(5.0)))
+    if( cached )
     {
-      ROS_INFO_STREAM("[pick place] Returned early?");
-      return false;
+      ROS_INFO("[pick place] Reusing cached plan");
     }
-    if (movegroup_action_.getState() == actionlib::SimpleClientGoalState::SUCCEEDED)
+    else
     {
-      ROS_INFO("[pick place] Plan successful!");
+      ros::WallTime start_time = ros::WallTime::now();
+      if( planner_race_->plan(snapshot, goal.request, trajectory) )
+      {
+        ROS_INFO("[pick place] Plan successful!");
+      }
+      else
+      {
+        ROS_ERROR("[pick place] FAILED: no planner found a solution");
+        return false;
+      }
+
+      plan_cache_.store(snapshot, scene_version, goal.request, start_state,
+                        trajectory, (ros::WallTime::now() - start_time).toSec());
+    }
+    ROS_INFO_STREAM("[pick place] Plan cache: " << plan_cache_.getStats().toString());
+
+    // -------------------------------------------------------------------------------------------
+    // Execute
+    return executeTrajectory(trajectory);
+  }
+
+  // Send a trajectory to the controllers and wait for it to finish
+  bool executeTrajectory(const moveit_msgs::RobotTrajectory& traj_msg)
+  {
+    plan_execution_->getTrajectoryExecutionManager()->clear();
+    if(plan_execution_->getTrajectoryExecutionManager()->push(traj_msg))
+    {
+      plan_execution_->getTrajectoryExecutionManager()->execute();
+
+      // wait for the trajectory to complete
+      moveit_controller_manager::ExecutionStatus es = plan_execution_->getTrajectoryExecutionManager()->waitForExecution();
+      if (es == moveit_controller_manager::ExecutionStatus::SUCCEEDED)
+        ROS_INFO("Trajectory execution succeeded");
+      else
+      {
+        if (es == moveit_controller_manager::ExecutionStatus::PREEMPTED)
+          ROS_INFO("Trajectory execution preempted");
+        else
+          if (es == moveit_controller_manager::ExecutionStatus::TIMED_OUT)
+            ROS_INFO("Trajectory execution timed out");
+          else
+            ROS_INFO("Trajectory execution control failed");
+        return false;
+      }
     }
     else
     {
-      ROS_ERROR_STREAM("[pick place] FAILED: " << movegroup_action_.getState().toString() << ": " << movegroup_action_.getState().getText());
+      ROS_ERROR("Failed to push trajectory");
       return false;
     }
 
@@ -539,34 +624,7 @@ public:
     moveit_msgs::RobotTrajectory traj_msg;
     approach_traj->getRobotTrajectoryMsg(traj_msg);
 
-    plan_execution_->getTrajectoryExecutionManager()->clear();
-    if(plan_execution_->getTrajectoryExecutionManager()->push(traj_msg))
-    {
-      plan_execution_->getTrajectoryExecutionManager()->execute();
-
-      // wait for the trajectory to complete
-      moveit_controller_manager::ExecutionStatus es = plan_execution_->getTrajectoryExecutionManager()->waitForExecution();
-      if (es == moveit_controller_manager::ExecutionStatus::SUCCEEDED)
-        ROS_INFO("Trajectory execution succeeded");
-      else
-      {
-        if (es == moveit_controller_manager::ExecutionStatus::PREEMPTED)
-          ROS_INFO("Trajectory execution preempted");
-        else
-          if (es == moveit_controller_manager::ExecutionStatus::TIMED_OUT)
-            ROS_INFO("Trajectory execution timed out");
-          else
-            ROS_INFO("Trajectory execution control failed");
-        return false;
-      }
-    }
-    else
-    {
-      ROS_ERROR("Failed to push trajectory");
-      return false;
-    }
-
-    return true;
+    return executeTrajectory(traj_msg);
   }
 
   // Actually run the action
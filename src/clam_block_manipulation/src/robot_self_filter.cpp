@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clam_block_manipulation/robot_self_filter.h>
+
+#include <ros/ros.h>
+#include <urdf/model.h>
+#include <geometric_shapes/mesh_operations.h>
+#include <geometric_shapes/shapes.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace clam_block_manipulation
+{
+
+RobotSelfFilter::RobotSelfFilter() :
+  have_transforms_(false)
+{
+  updateBounds();
+}
+
+bool RobotSelfFilter::loadFromParam(const std::string& robot_description, double padding,
+                                    const std::vector<std::string>& ignore_links)
+{
+  shapes_.clear();
+  have_transforms_ = false;
+  updateBounds();
+
+  std::string urdf_xml;
+  if( !ros::param::get(robot_description, urdf_xml) )
+  {
+    ROS_ERROR_STREAM("[self filter] No robot description on parameter " << robot_description);
+    return false;
+  }
+
+  urdf::Model model;
+  if( !model.initString(urdf_xml) )
+  {
+    ROS_ERROR("[self filter] Unable to parse the robot description");
+    return false;
+  }
+
+  std::vector<boost::shared_ptr<urdf::Link> > links;
+  model.getLinks(links);
+
+  for( size_t i = 0; i < links.size(); ++i )
+  {
+    const urdf::Link& link = *links[i];
+    if( !link.collision || !link.collision->geometry ||
+        std::find(ignore_links.begin(), ignore_links.end(), link.name) != ignore_links.end() )
+      continue;
+
+    // Extent of the geometry in its own frame
+    Eigen::Vector3f min_pt;
+    Eigen::Vector3f max_pt;
+    const urdf::Geometry& geometry = *link.collision->geometry;
+
+    switch( geometry.type )
+    {
+      case urdf::Geometry::BOX:
+      {
+        const urdf::Vector3& dim = static_cast<const urdf::Box&>(geometry).dim;
+        max_pt << dim.x / 2, dim.y / 2, dim.z / 2;
+        min_pt = -max_pt;
+        break;
+      }
+      case urdf::Geometry::SPHERE:
+      {
+        double radius = static_cast<const urdf::Sphere&>(geometry).radius;
+        max_pt.setConstant(radius);
+        min_pt = -max_pt;
+        break;
+      }
+      case urdf::Geometry::CYLINDER:
+      {
+        const urdf::Cylinder& cylinder = static_cast<const urdf::Cylinder&>(geometry);
+        max_pt << cylinder.radius, cylinder.radius, cylinder.length / 2;
+        min_pt = -max_pt;
+        break;
+      }
+      case urdf::Geometry::MESH:
+      {
+        const urdf::Mesh& mesh_geometry = static_cast<const urdf::Mesh&>(geometry);
+        shapes::Mesh* mesh = shapes::createMeshFromResource(mesh_geometry.filename,
+                                                            Eigen::Vector3d(mesh_geometry.scale.x,
+                                                                            mesh_geometry.scale.y,
+                                                                            mesh_geometry.scale.z));
+        if( !mesh || mesh->vertex_count == 0 )
+        {
+          ROS_WARN_STREAM("[self filter] Unable to load mesh " << mesh_geometry.filename << ", not filtering " << link.name);
+          delete mesh;
+          continue;
+        }
+
+        min_pt.setConstant(std::numeric_limits<float>::infinity());
+        max_pt.setConstant(-std::numeric_limits<float>::infinity());
+        for( unsigned int v = 0; v < mesh->vertex_count; ++v )
+        {
+          Eigen::Vector3f vertex(mesh->vertices[3 * v], mesh->vertices[3 * v + 1], mesh->vertices[3 * v + 2]);
+          min_pt = min_pt.cwiseMin(vertex);
+          max_pt = max_pt.cwiseMax(vertex);
+        }
+        delete mesh;
+        break;
+      }
+      default:
+        continue;
+    }
+
+    const urdf::Pose& origin = link.collision->origin;
+    Eigen::Affine3f collision_in_link = Eigen::Translation3f(origin.position.x, origin.position.y, origin.position.z) *
+      Eigen::Quaternionf(origin.rotation.w, origin.rotation.x, origin.rotation.y, origin.rotation.z);
+
+    addBox(link.name, collision_in_link * Eigen::Translation3f((min_pt + max_pt) / 2), (max_pt - min_pt) / 2, padding);
+  }
+
+  ROS_INFO_STREAM("[self filter] Filtering " << shapes_.size() << " links, padded by " << padding << " m");
+  return !shapes_.empty();
+}
+
+void RobotSelfFilter::addBox(const std::string& link, const Eigen::Affine3f& box_in_link,
+                             const Eigen::Vector3f& half_extents, double padding)
+{
+  LinkShape shape;
+  shape.link = link;
+  shape.box_in_link = box_in_link.matrix();
+  shape.half_extents << half_extents.array() + padding, std::numeric_limits<float>::infinity();
+  unplace(shape);
+  shapes_.push_back(shape);
+}
+
+void RobotSelfFilter::attachBox(const std::string& id, const std::string& link, const Eigen::Affine3f& box_in_link,
+                                const Eigen::Vector3f& half_extents, double padding)
+{
+  addBox(link, box_in_link, half_extents, padding);
+  shapes_.back().attached_id = id;
+
+  // Placed with the rest on the next update, even for the same stamp
+  target_frame_.clear();
+}
+
+void RobotSelfFilter::detach(const std::string& id)
+{
+  size_t kept = 0;
+  for( size_t i = 0; i < shapes_.size(); ++i )
+  {
+    const std::string& attached_id = shapes_[i].attached_id;
+    if( attached_id.empty() || (!id.empty() && attached_id != id) )
+      shapes_[kept++] = shapes_[i];
+  }
+  if( kept == shapes_.size() )
+    return;
+
+  shapes_.erase(shapes_.begin() + kept, shapes_.end());
+  updateBounds();
+}
+
+bool RobotSelfFilter::updateTransforms(tf::TransformListener& tf_listener, const std::string& target_frame,
+                                       const ros::Time& stamp, const ros::Duration& timeout)
+{
+  if( have_transforms_ && stamp == stamp_ && target_frame == target_frame_ )
+    return true;
+
+  // The links come from different publishers. Wait only for the one furthest behind, the
+  // others are then as far along or never coming.
+  std::string slowest;
+  ros::Time slowest_time;
+  for( size_t i = 0; i < shapes_.size(); ++i )
+  {
+    ros::Time latest;
+    if( tf_listener.getLatestCommonTime(target_frame, shapes_[i].link, latest, NULL) != tf::NO_ERROR )
+      continue;
+    if( !latest.isZero() && latest < stamp && (slowest.empty() || latest < slowest_time) )
+    {
+      slowest = shapes_[i].link;
+      slowest_time = latest;
+    }
+  }
+  if( !slowest.empty() )
+    tf_listener.waitForTransform(target_frame, slowest, stamp, timeout);
+
+  size_t placed = 0;
+  for( size_t i = 0; i < shapes_.size(); ++i )
+  {
+    LinkShape& shape = shapes_[i];
+
+    tf::StampedTransform stamped;
+    try
+    {
+      tf_listener.lookupTransform(target_frame, shape.link, stamp, stamped);
+    }
+    catch (tf::TransformException& ex)
+    {
+      if( warned_links_.insert(shape.link).second )
+        ROS_WARN_STREAM("[self filter] Not filtering " << shape.link << " while it has no transform to "
+                        << target_frame << ": " << ex.what());
+      unplace(shape);
+      continue;
+    }
+
+    Eigen::Matrix4f link_pose;
+    const tf::Matrix3x3& basis = stamped.getBasis();
+    const tf::Vector3& origin = stamped.getOrigin();
+    for( int r = 0; r < 3; ++r )
+    {
+      for( int c = 0; c < 3; ++c )
+        link_pose(r, c) = basis[r][c];
+      link_pose(r, 3) = origin[r];
+    }
+    link_pose.row(3) << 0, 0, 0, 1;
+
+    place(shape, link_pose);
+    ++placed;
+  }
+
+  updateBounds();
+  have_transforms_ = placed > 0;
+  target_frame_ = target_frame;
+  stamp_ = stamp;
+  return have_transforms_;
+}
+
+bool RobotSelfFilter::setLinkPose(const std::string& link, const Eigen::Affine3f& link_pose)
+{
+  bool found = false;
+  for( size_t i = 0; i < shapes_.size(); ++i )
+  {
+    if( shapes_[i].link != link )
+      continue;
+    place(shapes_[i], link_pose.matrix());
+    found = true;
+  }
+  if( !found )
+    return false;
+
+  updateBounds();
+  have_transforms_ = true;
+  // Not placed from TF, so the next updateTransforms places everything again
+  target_frame_.clear();
+  return true;
+}
+
+void RobotSelfFilter::place(LinkShape& shape, const Eigen::Matrix4f& link_pose)
+{
+  Eigen::Matrix4f box = link_pose * shape.box_in_link;
+  shape.inverse.setIdentity();
+  shape.inverse.topLeftCorner<3, 3>() = box.topLeftCorner<3, 3>().transpose();
+  shape.inverse.topRightCorner<3, 1>() = -(box.topLeftCorner<3, 3>().transpose() * box.topRightCorner<3, 1>());
+
+  // World aligned bounds of the rotated box
+  Eigen::Vector3f reach = box.topLeftCorner<3, 3>().cwiseAbs() * shape.half_extents.head<3>().matrix();
+  Eigen::Vector3f center = box.topRightCorner<3, 1>();
+  shape.min_pt << (center - reach).array(), -std::numeric_limits<float>::infinity();
+  shape.max_pt << (center + reach).array(), std::numeric_limits<float>::infinity();
+}
+
+void RobotSelfFilter::unplace(LinkShape& shape)
+{
+  shape.inverse.setIdentity();
+  shape.min_pt.setConstant(std::numeric_limits<float>::infinity());
+  shape.max_pt.setConstant(-std::numeric_limits<float>::infinity());
+}
+
+void RobotSelfFilter::updateBounds()
+{
+  // Nothing is inside an empty robot
+  min_pt_.setConstant(std::numeric_limits<float>::infinity());
+  max_pt_.setConstant(-std::numeric_limits<float>::infinity());
+  for( size_t i = 0; i < shapes_.size(); ++i )
+  {
+    min_pt_ = min_pt_.min(shapes_[i].min_pt);
+    max_pt_ = max_pt_.max(shapes_[i].max_pt);
+  }
+}
+
+} // namespace
@@ -0,0 +1,100 @@
+// Tests OccupancyMap on a box above a table seen from straight above: obstacles are marked,
+// and the rays to the table below the box clear them again once they are gone.
+
+#include <gtest/gtest.h>
+
+#include <clam_block_manipulation/occupancy_map.h>
+
+using namespace clam_block_manipulation;
+
+namespace
+{
+
+void addPoint(pcl::PointCloud<pcl::PointXYZRGB>& cloud, float x, float y, float z)
+{
+  pcl::PointXYZRGB point;
+  point.x = x;
+  point.y = y;
+  point.z = z;
+  cloud.points.push_back(point);
+}
+
+size_t countOccupied(const std::vector<OccupancyMap::Region>& regions)
+{
+  size_t occupied = 0;
+  for( size_t r = 0; r < regions.size(); ++r )
+    occupied += regions[r].occupied.size();
+  return occupied;
+}
+
+class OccupancyMapTest : public ::testing::Test
+{
+protected:
+  OccupancyMapTest() :
+    map(Eigen::Vector3f(0, 0, 0.1), Eigen::Vector3f(0.4, 0.4, 0.4), 0.02),
+    camera(0.21, 0.21, 1.0)
+  {
+    // The table, below the map
+    addPoint(table, 0.21, 0.21, 0);
+    addPoint(table, 0.212, 0.208, 0);
+    addPoint(table, 0.209, 0.211, 0);
+  }
+
+  OccupancyMap map;
+  Eigen::Vector3f camera;
+  pcl::PointCloud<pcl::PointXYZRGB> table;
+};
+
+}
+
+TEST_F(OccupancyMapTest, tableClearsObstacleThatLeft)
+{
+  // One obstacle in the middle of the map, one in its bottom layer, both over the table
+  pcl::PointCloud<pcl::PointXYZRGB> cloud = table;
+  addPoint(cloud, 0.21, 0.21, 0.25);
+  addPoint(cloud, 0.211, 0.209, 0.251);
+  addPoint(cloud, 0.21, 0.21, 0.11);
+
+  // A ray per obstacle voxel, and one for the table points, which all leave the map in the
+  // same voxel. Hits win over the table's ray through them.
+  EXPECT_EQ(3u, map.insert(cloud, camera));
+  EXPECT_EQ(2u, map.getOccupiedCount());
+
+  std::vector<OccupancyMap::Region> regions;
+  map.popChangedRegions(regions);
+  ASSERT_EQ(2u, countOccupied(regions));
+  bool found = false;
+  for( size_t r = 0; r < regions.size(); ++r )
+    for( size_t i = 0; i < regions[r].occupied.size(); ++i )
+      found |= regions[r].occupied[i].isApprox(Eigen::Vector3f(0.21, 0.21, 0.25), 1e-4);
+  EXPECT_TRUE(found);
+
+  // The obstacles are gone, only the table is seen. One miss isn't enough to undo a hit.
+  EXPECT_EQ(1u, map.insert(table, camera));
+  EXPECT_EQ(2u, map.getOccupiedCount());
+  map.popChangedRegions(regions);
+  EXPECT_TRUE(regions.empty());
+
+  EXPECT_EQ(1u, map.insert(table, camera));
+  EXPECT_EQ(0u, map.getOccupiedCount());
+  map.popChangedRegions(regions);
+  EXPECT_FALSE(regions.empty());
+  EXPECT_EQ(0u, countOccupied(regions));
+}
+
+TEST_F(OccupancyMapTest, raysMissingTheMapCastNothing)
+{
+  // Off to the side and never below the top of the map
+  pcl::PointCloud<pcl::PointXYZRGB> cloud;
+  addPoint(cloud, 2, 2, 0.5);
+  addPoint(cloud, -1, 0.2, 0.9);
+
+  EXPECT_EQ(0u, map.insert(cloud, camera));
+  EXPECT_EQ(0u, map.getOccupiedCount());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,132 @@
+// Tests RobotSelfFilter::contains on boxes placed by hand: rotated boxes, padding, the robot
+// and link bounds that cull points before the exact test, and attached objects.
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <clam_block_manipulation/robot_self_filter.h>
+
+using namespace clam_block_manipulation;
+
+namespace
+{
+
+Eigen::Vector4f point(float x, float y, float z)
+{
+  return Eigen::Vector4f(x, y, z, 1);
+}
+
+// A 40cm link along its x axis, 10cm square, starting at the link origin
+void addLink(RobotSelfFilter& filter, const std::string& link, double padding)
+{
+  filter.addBox(link, Eigen::Affine3f(Eigen::Translation3f(0.2, 0, 0)), Eigen::Vector3f(0.2, 0.05, 0.05), padding);
+}
+
+Eigen::Affine3f linkPose(float x, float y, float yaw)
+{
+  return Eigen::Translation3f(x, y, 0) * Eigen::AngleAxisf(yaw, Eigen::Vector3f::UnitZ());
+}
+
+}
+
+TEST(RobotSelfFilter, rotatedBox)
+{
+  RobotSelfFilter filter;
+  addLink(filter, "link1", 0.0);
+
+  // A quarter turn, the link now points along +y from (1, 0)
+  ASSERT_TRUE(filter.setLinkPose("link1", linkPose(1, 0, M_PI / 2)));
+  EXPECT_TRUE(filter.isReady());
+  EXPECT_TRUE(filter.contains(point(1, 0.3, 0)));
+  EXPECT_TRUE(filter.contains(point(1.04, 0.39, 0.04)));
+  EXPECT_FALSE(filter.contains(point(1.2, 0, 0)));
+  EXPECT_FALSE(filter.contains(point(1, 0.3, 0.06)));
+
+  // At 45 degrees the world aligned bounds hold points well off the box, which still miss it
+  filter.setLinkPose("link1", linkPose(1, 0, M_PI / 4));
+  EXPECT_TRUE(filter.contains(point(1.14, 0.14, 0)));
+  EXPECT_TRUE(filter.contains(point(1.25, 0.25, 0)));
+  EXPECT_FALSE(filter.contains(point(1.3, 0, 0)));
+  EXPECT_FALSE(filter.contains(point(1, 0.3, 0)));
+}
+
+TEST(RobotSelfFilter, padding)
+{
+  RobotSelfFilter bare;
+  RobotSelfFilter padded;
+  addLink(bare, "link1", 0.0);
+  addLink(padded, "link1", 0.02);
+  bare.setLinkPose("link1", linkPose(0, 0, 0));
+  padded.setLinkPose("link1", linkPose(0, 0, 0));
+
+  // Grown on every side, ends included
+  const Eigen::Vector4f near_side = point(0.2, 0.06, 0);
+  const Eigen::Vector4f near_end = point(0.41, 0, 0);
+  const Eigen::Vector4f near_start = point(-0.01, 0, 0.06);
+  EXPECT_FALSE(bare.contains(near_side));
+  EXPECT_FALSE(bare.contains(near_end));
+  EXPECT_FALSE(bare.contains(near_start));
+  EXPECT_TRUE(padded.contains(near_side));
+  EXPECT_TRUE(padded.contains(near_end));
+  EXPECT_TRUE(padded.contains(near_start));
+
+  EXPECT_FALSE(padded.contains(point(0.2, 0.08, 0)));
+  EXPECT_FALSE(padded.contains(point(0.43, 0, 0)));
+}
+
+TEST(RobotSelfFilter, culling)
+{
+  RobotSelfFilter filter;
+  addLink(filter, "link1", 0.0);
+  addLink(filter, "link2", 0.0);
+  EXPECT_EQ(2u, filter.getLinkCount());
+
+  // Nothing filters until a link is placed
+  EXPECT_FALSE(filter.isReady());
+  EXPECT_FALSE(filter.contains(point(0.2, 0, 0)));
+  EXPECT_FALSE(filter.setLinkPose("link3", linkPose(0, 0, 0)));
+  EXPECT_FALSE(filter.isReady());
+
+  // A link that isn't placed is left out, the other one filters
+  filter.setLinkPose("link1", linkPose(0, 0, 0));
+  EXPECT_TRUE(filter.contains(point(0.2, 0, 0)));
+  EXPECT_FALSE(filter.contains(point(2.2, 0, 0)));
+
+  // Between two links, inside the robot's bounds but neither link's
+  filter.setLinkPose("link2", linkPose(2, 0, 0));
+  EXPECT_TRUE(filter.contains(point(2.2, 0, 0)));
+  EXPECT_FALSE(filter.contains(point(1.2, 0, 0)));
+
+  // The bounds follow the links when they move
+  filter.setLinkPose("link2", linkPose(0, 1, 0));
+  EXPECT_FALSE(filter.contains(point(2.2, 0, 0)));
+  EXPECT_TRUE(filter.contains(point(0.2, 1, 0)));
+  EXPECT_FALSE(filter.contains(point(0.2, 0.5, 0)));
+}
+
+TEST(RobotSelfFilter, attachedBox)
+{
+  RobotSelfFilter filter;
+  addLink(filter, "gripper", 0.0);
+
+  // A block held 5cm past the end of the link, moving with it
+  filter.attachBox("block", "gripper", Eigen::Affine3f(Eigen::Translation3f(0.45, 0, 0)),
+                   Eigen::Vector3f::Constant(0.02), 0.0);
+  filter.setLinkPose("gripper", linkPose(0, 0, M_PI / 2));
+  EXPECT_TRUE(filter.contains(point(0, 0.46, 0)));
+  EXPECT_FALSE(filter.contains(point(0.46, 0, 0)));
+
+  filter.detach("other");
+  EXPECT_TRUE(filter.contains(point(0, 0.46, 0)));
+  filter.detach("block");
+  EXPECT_FALSE(filter.contains(point(0, 0.46, 0)));
+  EXPECT_TRUE(filter.contains(point(0, 0.2, 0)));
+  EXPECT_EQ(1u, filter.getLinkCount());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
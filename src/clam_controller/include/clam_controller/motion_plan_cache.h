@@ -0,0 +1,163 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, CU Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of CU Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Author: Dave Coleman */
+
+/*
+  Cache of motion plans for goals the arm goes to over and over (home,
+  shutdown, the pick and place poses).
+
+  Plans are keyed by the planning group, the start state of all joints rounded
+  to joint_resolution, and the goal and path constraints, tolerances and
+  weights included, rounded to goal_resolution. A cached plan is only handed out again once it has been
+  checked against the current planning scene: if the scene geometry hasn't
+  changed since the plan was made (same scene version) it is reused as is,
+  otherwise the whole trajectory is swept for collisions first and dropped
+  if it is no longer valid. Callers plan as usual on a miss and store the
+  result.
+
+  The scene has to be locked (LockedPlanningSceneRO) during lookup() and
+  store(). SceneVersion counts the changes that can make a plan invalid.
+*/
+
+#ifndef CLAM_CONTROLLER_MOTION_PLAN_CACHE_H
+#define CLAM_CONTROLLER_MOTION_PLAN_CACHE_H
+
+#include <moveit_msgs/MotionPlanRequest.h>
+#include <moveit_msgs/RobotState.h>
+#include <moveit_msgs/RobotTrajectory.h>
+#include <moveit/planning_scene/planning_scene.h>
+
+#include <boost/thread/mutex.hpp>
+
+#include <map>
+#include <sstream>
+#include <string>
+
+namespace clam_controller
+{
+
+struct MotionPlanCacheStats
+{
+  MotionPlanCacheStats();
+
+  unsigned int hits;
+  unsigned int misses;
+  unsigned int invalidated; // found, but in collision with the current scene
+
+  double planning_time_saved; // planning time of the plans reused, minus the time spent checking them
+  double lookup_time; // total time spent in lookup(), including collision sweeps
+
+  double hitRate() const;
+  std::string toString() const;
+};
+
+// Counts the changes to a planning scene that can put a cached plan for group_name in collision:
+// the world geometry, the bodies attached to the robot and the joints outside the group, such as
+// the gripper's. Updated from the planning scene monitor's callback, read from any thread.
+class SceneVersion
+{
+public:
+  SceneVersion(const std::string& group_name = "", double joint_resolution = 0.02);
+
+  // Call on every geometry or state update, with the scene locked. Attached bodies and the
+  // joints outside the group arrive with state updates, so those only count if they differ
+  // from last time, with the joints rounded to joint_resolution.
+  void update(const planning_scene::PlanningSceneConstPtr& scene, bool geometry_changed);
+
+  unsigned int get() const;
+
+private:
+  std::string group_name_;
+  double joint_resolution_;
+
+  mutable boost::mutex mutex_;
+  unsigned int version_;
+  std::string state_; // attached bodies and joints outside the group at the last update
+};
+
+class MotionPlanCache
+{
+public:
+  MotionPlanCache(double joint_resolution = 0.02, double goal_resolution = 0.001, size_t max_entries = 32);
+
+  // Find a plan for request starting from the current state of scene. scene_version must change
+  // whenever the scene geometry, the attached bodies or the joints outside the group change
+  // (see SceneVersion). On a hit, trajectory is the cached plan with its first
+  // waypoint set to the exact current state.
+  bool lookup(const planning_scene::PlanningSceneConstPtr& scene, unsigned int scene_version,
+              const moveit_msgs::MotionPlanRequest& request, moveit_msgs::RobotTrajectory& trajectory);
+
+  // Remember a plan for request made from start_state, and how long it took to plan
+  void store(const planning_scene::PlanningSceneConstPtr& scene, unsigned int scene_version,
+             const moveit_msgs::MotionPlanRequest& request, const moveit_msgs::RobotState& start_state,
+             const moveit_msgs::RobotTrajectory& trajectory, double planning_time);
+
+  void clear();
+
+  size_t size() const { return entries_.size(); }
+  const MotionPlanCacheStats& getStats() const { return stats_; }
+
+private:
+
+  struct Entry
+  {
+    moveit_msgs::RobotTrajectory trajectory;
+    unsigned int scene_version; // last version the trajectory was known to be valid in
+    double planning_time;
+    unsigned long last_used;
+  };
+
+  std::string makeKey(const moveit_msgs::MotionPlanRequest& request, const moveit_msgs::RobotState& start_state) const;
+  void appendConstraints(std::stringstream& key, const moveit_msgs::Constraints& constraints) const;
+  void appendPose(std::stringstream& key, const geometry_msgs::Pose& pose) const;
+
+  static long quantize(double value, double resolution);
+
+  // Drop the least recently used entries until there is room for one more
+  void evict();
+
+  double joint_resolution_;
+  double goal_resolution_;
+  size_t max_entries_;
+
+  std::map<std::string, Entry> entries_;
+  unsigned long uses_;
+
+  MotionPlanCacheStats stats_;
+};
+
+} // namespace
+
+#endif
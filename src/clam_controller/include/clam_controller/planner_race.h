@@ -0,0 +1,163 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, CU Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of CU Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Author: Dave Coleman */
+
+/*
+  Runs several planners on the same motion plan request at once and keeps
+  the first good answer, rather than waiting on a single planner that may
+  spend its whole allowed_planning_time on a hard query.
+
+  Every OMPL planner config gets its own planning pipeline (loaded from the
+  move_group namespace) so they can plan concurrently, each on its own
+  thread. Alongside them a joint space shortcut tries a straight line to the
+  goal, solving IK first for pose goals, which wins outright whenever
+  nothing is in the way.
+
+  Once the first planner succeeds the others get a short grace period, then
+  the shortest of the finished paths is taken. Its waypoints are shortcut on
+  several threads with different random seeds and the shortest result is
+  time parameterized again. Planners that are still running are told to
+  terminate. One that hasn't stopped by the next race sits it out, which is
+  counted in its stats.
+
+  Racers plan on the scene they are given, and ones that are still stopping
+  keep using it after plan() returns, so it must be a snapshot that nothing
+  else changes (PlanningScene::clone() of the monitor's scene, taken under
+  LockedPlanningSceneRO), not the monitor's live scene.
+*/
+
+#ifndef CLAM_CONTROLLER_PLANNER_RACE_H
+#define CLAM_CONTROLLER_PLANNER_RACE_H
+
+#include <moveit_msgs/MotionPlanRequest.h>
+#include <moveit_msgs/RobotTrajectory.h>
+#include <moveit/planning_scene/planning_scene.h>
+#include <moveit/planning_pipeline/planning_pipeline.h>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <string>
+#include <vector>
+
+namespace clam_controller
+{
+
+struct PlannerRaceStats
+{
+  PlannerRaceStats();
+
+  unsigned int attempts;
+  unsigned int successes;
+  unsigned int wins;
+  unsigned int skipped; // races missed because the previous attempt hadn't stopped yet
+  double solve_time; // total over successful attempts
+};
+
+class PlannerRace
+{
+public:
+  static const std::string JOINT_SHORTCUT;
+
+  // planner_ids are OMPL planner configs from ompl_planning.yaml
+  PlannerRace(const kinematic_model::KinematicModelConstPtr& kinematic_model,
+              const std::vector<std::string>& planner_ids,
+              const std::string& planning_ns = "move_group");
+  ~PlannerRace();
+
+  // How long the other planners get once the first one has a solution
+  void setGracePeriod(double seconds) { grace_period_ = seconds; }
+
+  // Number of threads shortcutting the winning path, 0 disables smoothing
+  void setSmoothingThreads(unsigned int threads) { smoothing_threads_ = threads; }
+
+  // Plan from the current state of scene, a snapshot that stays unchanged. Blocks for at most the
+  // request's allowed_planning_time.
+  bool plan(const planning_scene::PlanningSceneConstPtr& scene,
+            const moveit_msgs::MotionPlanRequest& request,
+            moveit_msgs::RobotTrajectory& trajectory);
+
+  // Win rate and latency of every planner
+  std::string statsString() const;
+
+private:
+
+  struct Race;
+  typedef std::vector<std::vector<double> > Path;
+
+  struct Racer
+  {
+    std::string name;
+    planning_pipeline::PlanningPipelinePtr pipeline; // NULL for the joint shortcut
+    boost::shared_ptr<boost::thread> thread;
+    PlannerRaceStats stats;
+  };
+
+  void runPlanner(boost::shared_ptr<Race> race, size_t racer);
+
+  // Straight line in joint space to the goal, NULL if anything is in the way
+  robot_trajectory::RobotTrajectoryPtr planJointShortcut(const planning_scene::PlanningSceneConstPtr& scene,
+                                                         const moveit_msgs::MotionPlanRequest& request) const;
+
+  // Goal joint values of request, solving IK if needed
+  bool goalToJointValues(const planning_scene::PlanningSceneConstPtr& scene,
+                         const moveit_msgs::MotionPlanRequest& request,
+                         robot_state::RobotState& goal_state) const;
+
+  bool isSegmentValid(const planning_scene::PlanningSceneConstPtr& scene, robot_state::RobotState& state,
+                      const std::string& group, const std::vector<double>& from, const std::vector<double>& to) const;
+
+  void shortcutPath(const planning_scene::PlanningSceneConstPtr& scene, const std::string& group,
+                    unsigned int seed, Path& path) const;
+
+  robot_trajectory::RobotTrajectoryPtr smooth(const planning_scene::PlanningSceneConstPtr& scene,
+                                              const std::string& group,
+                                              const robot_trajectory::RobotTrajectoryPtr& trajectory) const;
+
+  static double pathLength(const Path& path);
+  static double pathLength(const robot_trajectory::RobotTrajectoryPtr& trajectory);
+
+  kinematic_model::KinematicModelConstPtr kinematic_model_;
+
+  std::vector<Racer> racers_;
+  mutable boost::mutex racers_lock_;
+
+  double grace_period_;
+  unsigned int smoothing_threads_;
+};
+
+} // namespace
+
+#endif
@@ -56,6 +56,7 @@
 // Dynamixel
 #include <dynamixel_hardware_interface/SetVelocity.h> // For changing servo velocities using service call
 #include <dynamixel_hardware_interface/TorqueEnable.h> // For changing servo velocities using service call
+#include <dynamixel_hardware_interface/SetJointParameters.h> // For changing the torque of all arm servos at once
 #include <dynamixel_hardware_interface/JointState.h> // For knowing the state of the end effector
 
 // Messages
@@ -70,6 +71,7 @@
 #include <moveit/planning_scene_monitor/planning_scene_monitor.h>
 #include <moveit/robot_state/robot_state.h>
 #include <moveit/robot_state/conversions.h>
+#include <clam_controller/motion_plan_cache.h>
 //#include <moveit/planning_models_loader/kinematic_model_loader.h>
 //#include <moveit/plan_execution/plan_execution.h>
 //#include <moveit/plan_execution/plan_with_sensing.h>
@@ -135,12 +137,17 @@ private:
   boost::shared_ptr<tf::TransformListener> tf_;
   planning_scene_monitor::PlanningSceneMonitorPtr planning_scene_monitor_;
 
+  // Plans already made for home/shutdown, checked against the scene before reuse
+  MotionPlanCache plan_cache_;
+  SceneVersion scene_version_;
+
 public:
   ClamArmServer(const std::string name) :
     //nh_("~"),
     action_server_(name, false),
     movegroup_action_("move_group", true),
-    action_name_(name)
+    action_name_(name),
+    scene_version_(GROUP_NAME)
   {
 
     // -----------------------------------------------------------------------------------------------
@@ -171,8 +178,9 @@ public:
     }
 
     // -----------------------------------------------------------------------------------------------
-    // Create the goals once, then shutdown monitors
+    // Create the goals once, and watch the scene for validating cached plans
     generateMoveItGoals();
+    startPlanningSceneMonitor();
 
 
     // Change the goal constraints on the servos to be less strict, so that the controllers don't die. this is a hack
@@ -192,7 +200,7 @@ public:
   }
 
 
-  void generateMoveItGoals()
+  void startPlanningSceneMonitor()
   {
 
     // ---------------------------------------------------------------------------------------------
@@ -208,6 +216,7 @@ public:
       planning_scene_monitor_->startWorldGeometryMonitor();
       planning_scene_monitor_->startSceneMonitor("/move_group/monitored_planning_scene");
       planning_scene_monitor_->startStateMonitor("/joint_states", "/attached_collision_object");
+      planning_scene_monitor_->addUpdateCallback(boost::bind(&ClamArmServer::sceneUpdated, this, _1));
     }
     else
     {
@@ -230,18 +239,23 @@ public:
       for(int i = 0; i < missing_joints.size(); ++i)
         ROS_WARN_STREAM("[clam arm] Unpublished joints: " << missing_joints[i]);
     }
+  }
 
-    // -----------------------------------------------------------------------------------------------
-    // Create the joint_state_group needed for creating the constraint
-    const planning_scene::PlanningScenePtr planning_scene = planning_scene_monitor_->getPlanningScene();
-    const kinematic_model::JointModelGroup *joint_model_group = planning_scene->getKinematicModel()->getJointModelGroup(GROUP_NAME);
-    robot_state::RobotState robot_state = planning_scene->getCurrentState();
-
-    robot_state::JointStateGroup joint_state_group(&robot_state, joint_model_group);
+  // Cached plans only need a collision check again once the geometry, the attached bodies or the gripper have changed
+  void sceneUpdated(planning_scene_monitor::PlanningSceneMonitor::SceneUpdateType type)
+  {
+    if( type & (planning_scene_monitor::PlanningSceneMonitor::UPDATE_GEOMETRY |
+                planning_scene_monitor::PlanningSceneMonitor::UPDATE_STATE) )
+    {
+      planning_scene_monitor::LockedPlanningSceneRO planning_scene(planning_scene_monitor_);
+      scene_version_.update(planning_scene, type & planning_scene_monitor::PlanningSceneMonitor::UPDATE_GEOMETRY);
+    }
+  }
 
+  void generateMoveItGoals()
+  {
     // -----------------------------------------------------------------------------------------------
     // Create MoveGroupGoal for going home
-    //joint_state_group.setToDefaultValues();  // sets to zeros
     std::map<std::string, double> joint_state_map;
     joint_state_map["elbow_pitch_joint"] = 0.0;
     joint_state_map["elbow_roll_joint"] = 0.0;
@@ -250,12 +264,11 @@ public:
     joint_state_map["shoulder_pitch_joint"] = 0.0;
     joint_state_map["wrist_pitch_joint"] = 1.6622;
     joint_state_map["wrist_roll_joint"] = 0.0;
-    joint_state_group.setVariableValues(joint_state_map);
 
     const double TOLERANCE_BELOW = 0.01;
     const double TOLERANCE_ABOVE = 0.01;
     moveit_msgs::Constraints goal_constraints =
-      kinematic_constraints::constructGoalConstraints(&joint_state_group, TOLERANCE_BELOW, TOLERANCE_ABOVE);
+      jointGoalConstraints(joint_state_map, TOLERANCE_BELOW, TOLERANCE_ABOVE);
 
     send_home_goal_.request.group_name = GROUP_NAME;
     send_home_goal_.request.num_planning_attempts = 1;
@@ -275,22 +288,35 @@ public:
     joint_state_map["wrist_pitch_joint"] = -0.15339807878856412;
     joint_state_map["wrist_roll_joint"] = -0.0609061543436171;
     //    joint_state_map["wrist_roll_joint"] = -0.0409061543436171;
-    joint_state_group.setVariableValues(joint_state_map);
 
     goal_constraints =
-      kinematic_constraints::constructGoalConstraints(&joint_state_group, TOLERANCE_BELOW, TOLERANCE_ABOVE);
+      jointGoalConstraints(joint_state_map, TOLERANCE_BELOW, TOLERANCE_ABOVE);
 
     send_shutdown_goal_.request.group_name = GROUP_NAME;
     send_shutdown_goal_.request.num_planning_attempts = 1;
     send_shutdown_goal_.request.allowed_planning_time = 5.0; // fix for moveit update? ros::Duration(5.0);
     send_shutdown_goal_.request.goal_constraints.resize(1);
     send_shutdown_goal_.request.goal_constraints[0] = goal_constraints;
+  }
 
-    // -----------------------------------------------------------------------------------------------
-    // Shutdown monitors
-    planning_scene_monitor_->stopStateMonitor();
-    planning_scene_monitor_.reset();
-    tf_.reset();
+  // Same constraints kinematic_constraints::constructGoalConstraints() makes from a joint state group,
+  // without needing a robot model
+  moveit_msgs::Constraints jointGoalConstraints(const std::map<std::string, double>& joint_values,
+                                                double tolerance_below, double tolerance_above)
+  {
+    moveit_msgs::Constraints goal;
+    std::map<std::string, double>::const_iterator it;
+    for( it = joint_values.begin(); it != joint_values.end(); ++it )
+    {
+      moveit_msgs::JointConstraint joint_constraint;
+      joint_constraint.joint_name = it->first;
+      joint_constraint.position = it->second;
+      joint_constraint.tolerance_below = tolerance_below;
+      joint_constraint.tolerance_above = tolerance_above;
+      joint_constraint.weight = 1.0;
+      goal.joint_constraints.push_back(joint_constraint);
+    }
+    return goal;
   }
 
   // Recieve Action Goal Function
@@ -457,19 +483,77 @@ public:
     // -------------------------------------------------------------------------------------------
     // Plan
     ROS_INFO("[clam arm] Sending arm to home position");
-    movegroup_action_.sendGoal(send_home_goal_);
+    if( !moveToGoal(send_home_goal_) )
+    {
+      return false;
+    }
+    ROS_INFO("[clam arm] Arm successfully went home.");
 
-    if(!movegroup_action_.waitForResult(ros::Duration(10.0)))
+    return true;
+  }
+
+  // Plan a MoveGroup goal, or reuse the plan from last time if it is still valid, then execute it
+  bool moveToGoal(const moveit_msgs::MoveGroupGoal& goal)
+  {
+    moveit_msgs::RobotTrajectory trajectory;
+    bool cached;
     {
-      ROS_INFO_STREAM("[clam arm] Returned early?");
+      planning_scene_monitor::LockedPlanningSceneRO planning_scene(planning_scene_monitor_);
+      cached = plan_cache_.lookup(planning_scene, scene_version_.get(), goal.request, trajectory);
     }
-    if (movegroup_action_.getState() == actionlib::SimpleClientGoalState::SUCCEEDED)
+
+    if( cached )
     {
-      ROS_INFO("[clam arm] Arm successfully went home.");
+      ROS_INFO("[clam arm] Reusing cached plan");
     }
     else
     {
-      ROS_ERROR_STREAM("[clam arm] FAILED: " << movegroup_action_.getState().toString() << ": " << movegroup_action_.getState().getText());
+      unsigned int scene_version = scene_version_.get();
+
+      // Plan only, execution is the same for planned and cached trajectories
+      moveit_msgs::MoveGroupGoal plan_goal = goal;
+      plan_goal.planning_options.plan_only = true;
+
+      ros::WallTime start_time = ros::WallTime::now();
+      movegroup_action_.sendGoal(plan_goal);
+
+      if(!movegroup_action_.waitForResult(ros::Duration(10.0)))
+      {
+        ROS_INFO_STREAM("[clam arm] Returned early?");
+      }
+      if (movegroup_action_.getState() != actionlib::SimpleClientGoalState::SUCCEEDED)
+      {
+        ROS_ERROR_STREAM("[clam arm] FAILED: " << movegroup_action_.getState().toString() << ": " << movegroup_action_.getState().getText());
+        return false;
+      }
+
+      moveit_msgs::MoveGroupResultConstPtr result = movegroup_action_.getResult();
+      trajectory = result->planned_trajectory;
+      planning_scene_monitor::LockedPlanningSceneRO planning_scene(planning_scene_monitor_);
+      plan_cache_.store(planning_scene, scene_version, goal.request, result->trajectory_start,
+                        trajectory, (ros::WallTime::now() - start_time).toSec());
+    }
+    ROS_INFO_STREAM("[clam arm] Plan cache: " << plan_cache_.getStats().toString());
+
+    // -------------------------------------------------------------------------------------------
+    // Execute
+    control_msgs::FollowJointTrajectoryGoal trajectory_goal;
+    trajectory_goal.trajectory = trajectory.joint_trajectory;
+    trajectory_goal.trajectory.header.stamp = ros::Time::now();
+    trajectory_client_->sendGoal(trajectory_goal);
+
+    ros::Duration timeout(10.0);
+    if( !trajectory_goal.trajectory.points.empty() )
+      timeout += trajectory_goal.trajectory.points.back().time_from_start;
+
+    if( !trajectory_client_->waitForResult(timeout) )
+    {
+      ROS_ERROR("[clam arm] Timeout waiting for the trajectory to finish");
+      return false;
+    }
+    if( getState() != actionlib::SimpleClientGoalState::SUCCEEDED )
+    {
+      ROS_ERROR_STREAM("[clam arm] FAILED: " << getState().toString() << ": " << getState().getText());
       return false;
     }
 
@@ -482,42 +566,20 @@ public:
     // -------------------------------------------------------------------------------------------
     // Plan
     ROS_INFO("[clam arm] Sending arm to shutdown position");
-    movegroup_action_.sendGoal(send_shutdown_goal_);
-
-    if(!movegroup_action_.waitForResult(ros::Duration(10.0)))
-    {
-      ROS_INFO_STREAM("[clam arm] Returned early?");
-    }
-    if (movegroup_action_.getState() == actionlib::SimpleClientGoalState::SUCCEEDED)
+    if( !moveToGoal(send_shutdown_goal_) )
     {
-      ROS_INFO("[clam arm] Arm successfully shutdown.");
-    }
-    else
-    {
-      ROS_ERROR_STREAM("[clam arm] FAILED: " << movegroup_action_.getState().toString() << ": " << movegroup_action_.getState().getText());
       return false;
     }
+    ROS_INFO("[clam arm] Arm successfully shutdown.");
 
     // -------------------------------------------------------------------------------------------
     // Turn off torque
-    enableTorque("elbow_pitch_controller", false);
-    enableTorque("elbow_roll_controller", false);
-    enableTorque("gripper_roll_controller", false);
-    enableTorque("shoulder_pan_controller", false);
-    enableTorque("shoulder_pitch_controller", false);
-    enableTorque("wrist_pitch_controller", false);
-    enableTorque("wrist_roll_controller", false);
+    enableArmTorque(false);
     ros::Duration(0.5).sleep();
 
     // -------------------------------------------------------------------------------------------
     // Turn torque back on
-    enableTorque("elbow_pitch_controller", true);
-    enableTorque("elbow_roll_controller", true);
-    enableTorque("gripper_roll_controller", true);
-    enableTorque("shoulder_pan_controller", true);
-    enableTorque("shoulder_pitch_controller", true);
-    enableTorque("wrist_pitch_controller", true);
-    enableTorque("wrist_roll_controller", true);
+    enableArmTorque(true);
 
     return true;
   }
@@ -828,6 +890,37 @@ public:
     return true;
   }
 
+  // Set the torque for all arm servos at once, one sync write per serial port
+  bool enableArmTorque(bool enable)
+  {
+    ROS_DEBUG_STREAM("[clam arm] Setting torque for the arm");
+
+    std::string service_name = "/clam_controller_manager/set_joint_parameters";
+    ros::ServiceClient params_client = nh_.serviceClient< dynamixel_hardware_interface::SetJointParameters >(service_name);
+    if(!params_client.waitForExistence(ros::Duration(10.0)))
+    {
+      ROS_ERROR_STREAM("[clam arm] Failed to find the service: " << service_name);
+      return false;
+    }
+    dynamixel_hardware_interface::SetJointParameters set_params_srv;
+    set_params_srv.request.controllers.push_back("elbow_pitch_controller");
+    set_params_srv.request.controllers.push_back("elbow_roll_controller");
+    set_params_srv.request.controllers.push_back("gripper_roll_controller");
+    set_params_srv.request.controllers.push_back("shoulder_pan_controller");
+    set_params_srv.request.controllers.push_back("shoulder_pitch_controller");
+    set_params_srv.request.controllers.push_back("wrist_pitch_controller");
+    set_params_srv.request.controllers.push_back("wrist_roll_controller");
+    set_params_srv.request.set_torque_enable = true;
+    set_params_srv.request.torque_enable = enable;
+    if( !params_client.call(set_params_srv) || !set_params_srv.response.success )
+    {
+      ROS_ERROR_STREAM("[clam arm] Failed to set the torque of the arm via service call");
+      return false;
+    }
+
+    return true;
+  }
+
 };
 
 };
@@ -0,0 +1,322 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, CU Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of CU Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Author: Dave Coleman */
+
+#include <clam_controller/motion_plan_cache.h>
+#include <moveit/robot_state/conversions.h>
+#include <ros/ros.h>
+
+#include <cmath>
+#include <set>
+#include <sstream>
+
+namespace clam_controller
+{
+
+MotionPlanCacheStats::MotionPlanCacheStats()
+  : hits(0),
+    misses(0),
+    invalidated(0),
+    planning_time_saved(0.0),
+    lookup_time(0.0)
+{
+}
+
+double MotionPlanCacheStats::hitRate() const
+{
+  unsigned int lookups = hits + misses;
+  return lookups ? double(hits) / lookups : 0.0;
+}
+
+std::string MotionPlanCacheStats::toString() const
+{
+  std::stringstream ss;
+  ss << hits << " hits, " << misses << " misses (" << int(hitRate() * 100) << "% hit rate), "
+     << invalidated << " invalidated, " << planning_time_saved << "s planning saved";
+  return ss.str();
+}
+
+SceneVersion::SceneVersion(const std::string& group_name, double joint_resolution)
+  : group_name_(group_name),
+    joint_resolution_(joint_resolution),
+    version_(0)
+{
+}
+
+void SceneVersion::update(const planning_scene::PlanningSceneConstPtr& scene, bool geometry_changed)
+{
+  std::vector<const robot_state::AttachedBody*> bodies;
+  scene->getCurrentState().getAttachedBodies(bodies);
+
+  std::stringstream state;
+  for( size_t i = 0; i < bodies.size(); ++i )
+    state << bodies[i]->getName() << "@" << bodies[i]->getAttachedLinkName() << ",";
+
+  // The joints the plans don't move, such as the gripper's, are part of the obstacles
+  std::set<std::string> group_joints;
+  const kinematic_model::JointModelGroup* group = scene->getKinematicModel()->getJointModelGroup(group_name_);
+  if( group )
+    group_joints.insert(group->getJointModelNames().begin(), group->getJointModelNames().end());
+
+  moveit_msgs::RobotState current;
+  robot_state::robotStateToRobotStateMsg(scene->getCurrentState(), current);
+  state << "|";
+  for( size_t i = 0; i < current.joint_state.name.size() && i < current.joint_state.position.size(); ++i )
+  {
+    if( !group_joints.count(current.joint_state.name[i]) )
+      state << current.joint_state.name[i] << "=" << lround(current.joint_state.position[i] / joint_resolution_) << ",";
+  }
+
+  boost::mutex::scoped_lock lock(mutex_);
+  if( geometry_changed || state.str() != state_ )
+    version_++;
+  state_ = state.str();
+}
+
+unsigned int SceneVersion::get() const
+{
+  boost::mutex::scoped_lock lock(mutex_);
+  return version_;
+}
+
+MotionPlanCache::MotionPlanCache(double joint_resolution, double goal_resolution, size_t max_entries)
+  : joint_resolution_(joint_resolution),
+    goal_resolution_(goal_resolution),
+    max_entries_(max_entries),
+    uses_(0)
+{
+}
+
+bool MotionPlanCache::lookup(const planning_scene::PlanningSceneConstPtr& scene, unsigned int scene_version,
+                             const moveit_msgs::MotionPlanRequest& request, moveit_msgs::RobotTrajectory& trajectory)
+{
+  ros::WallTime start_time = ros::WallTime::now();
+
+  moveit_msgs::RobotState start_state;
+  robot_state::robotStateToRobotStateMsg(scene->getCurrentState(), start_state);
+
+  std::map<std::string, Entry>::iterator it = entries_.find(makeKey(request, start_state));
+  if( it == entries_.end() )
+  {
+    stats_.misses++;
+    stats_.lookup_time += (ros::WallTime::now() - start_time).toSec();
+    return false;
+  }
+  Entry& entry = it->second;
+
+  // Start from exactly where the arm is, rather than where it was when the plan was made
+  trajectory = entry.trajectory;
+  if( !trajectory.joint_trajectory.points.empty() )
+  {
+    std::map<std::string, double> current;
+    for( size_t i = 0; i < start_state.joint_state.name.size(); ++i )
+      current[start_state.joint_state.name[i]] = start_state.joint_state.position[i];
+
+    trajectory_msgs::JointTrajectoryPoint& first = trajectory.joint_trajectory.points[0];
+    for( size_t i = 0; i < trajectory.joint_trajectory.joint_names.size() && i < first.positions.size(); ++i )
+    {
+      std::map<std::string, double>::const_iterator joint = current.find(trajectory.joint_trajectory.joint_names[i]);
+      if( joint != current.end() )
+        first.positions[i] = joint->second;
+    }
+  }
+
+  // Anything added to the scene since the plan was last checked may be in the way
+  if( entry.scene_version != scene_version )
+  {
+    if( !scene->isPathValid(start_state, trajectory) )
+    {
+      ROS_DEBUG("[plan cache] Cached plan is in collision with the current scene, dropping it");
+      entries_.erase(it);
+      stats_.invalidated++;
+      stats_.misses++;
+      stats_.lookup_time += (ros::WallTime::now() - start_time).toSec();
+      return false;
+    }
+    entry.scene_version = scene_version;
+  }
+
+  entry.last_used = ++uses_;
+
+  double lookup_time = (ros::WallTime::now() - start_time).toSec();
+  stats_.hits++;
+  stats_.lookup_time += lookup_time;
+  stats_.planning_time_saved += entry.planning_time - lookup_time;
+  return true;
+}
+
+void MotionPlanCache::store(const planning_scene::PlanningSceneConstPtr& scene, unsigned int scene_version,
+                            const moveit_msgs::MotionPlanRequest& request, const moveit_msgs::RobotState& start_state,
+                            const moveit_msgs::RobotTrajectory& trajectory, double planning_time)
+{
+  if( trajectory.joint_trajectory.points.empty() )
+    return;
+
+  std::string key = makeKey(request, start_state);
+  if( entries_.find(key) == entries_.end() )
+    evict();
+
+  Entry& entry = entries_[key];
+  entry.trajectory = trajectory;
+  entry.scene_version = scene_version;
+  entry.planning_time = planning_time;
+  entry.last_used = ++uses_;
+}
+
+void MotionPlanCache::clear()
+{
+  entries_.clear();
+}
+
+std::string MotionPlanCache::makeKey(const moveit_msgs::MotionPlanRequest& request,
+                                     const moveit_msgs::RobotState& start_state) const
+{
+  std::stringstream key;
+  key << request.group_name << "|";
+
+  // Start state, sorted by name. The joints outside the group count too: a plan made with
+  // the gripper open may not be valid with it closed.
+  std::map<std::string, long> joints;
+  for( size_t i = 0; i < start_state.joint_state.name.size() && i < start_state.joint_state.position.size(); ++i )
+    joints[start_state.joint_state.name[i]] = quantize(start_state.joint_state.position[i], joint_resolution_);
+  for( std::map<std::string, long>::const_iterator it = joints.begin(); it != joints.end(); ++it )
+    key << it->first << "=" << it->second << ",";
+
+  // Goal
+  for( size_t i = 0; i < request.goal_constraints.size(); ++i )
+  {
+    key << "|";
+    appendConstraints(key, request.goal_constraints[i]);
+  }
+
+  key << "|path:";
+  appendConstraints(key, request.path_constraints);
+
+  return key.str();
+}
+
+void MotionPlanCache::appendConstraints(std::stringstream& key, const moveit_msgs::Constraints& constraints) const
+{
+  for( size_t j = 0; j < constraints.joint_constraints.size(); ++j )
+  {
+    const moveit_msgs::JointConstraint& c = constraints.joint_constraints[j];
+    key << "j:" << c.joint_name << "=" << quantize(c.position, goal_resolution_) << ","
+        << quantize(c.tolerance_above, goal_resolution_) << ","
+        << quantize(c.tolerance_below, goal_resolution_) << ","
+        << quantize(c.weight, goal_resolution_) << ",";
+  }
+
+  for( size_t j = 0; j < constraints.position_constraints.size(); ++j )
+  {
+    const moveit_msgs::PositionConstraint& c = constraints.position_constraints[j];
+    key << "p:" << c.link_name << "@" << c.header.frame_id << "="
+        << quantize(c.target_point_offset.x, goal_resolution_) << ","
+        << quantize(c.target_point_offset.y, goal_resolution_) << ","
+        << quantize(c.target_point_offset.z, goal_resolution_) << ","
+        << quantize(c.weight, goal_resolution_) << ",";
+
+    const std::vector<shape_msgs::SolidPrimitive>& primitives = c.constraint_region.primitives;
+    for( size_t k = 0; k < primitives.size(); ++k )
+    {
+      key << "r" << int(primitives[k].type) << ":";
+      for( size_t d = 0; d < primitives[k].dimensions.size(); ++d )
+        key << quantize(primitives[k].dimensions[d], goal_resolution_) << ",";
+    }
+
+    const std::vector<geometry_msgs::Pose>& poses = c.constraint_region.primitive_poses;
+    for( size_t k = 0; k < poses.size(); ++k )
+      appendPose(key, poses[k]);
+  }
+
+  for( size_t j = 0; j < constraints.orientation_constraints.size(); ++j )
+  {
+    const moveit_msgs::OrientationConstraint& c = constraints.orientation_constraints[j];
+    key << "o:" << c.link_name << "@" << c.header.frame_id << "="
+        << quantize(c.orientation.x, goal_resolution_) << ","
+        << quantize(c.orientation.y, goal_resolution_) << ","
+        << quantize(c.orientation.z, goal_resolution_) << ","
+        << quantize(c.orientation.w, goal_resolution_) << ","
+        << quantize(c.absolute_x_axis_tolerance, goal_resolution_) << ","
+        << quantize(c.absolute_y_axis_tolerance, goal_resolution_) << ","
+        << quantize(c.absolute_z_axis_tolerance, goal_resolution_) << ","
+        << quantize(c.weight, goal_resolution_) << ",";
+  }
+
+  for( size_t j = 0; j < constraints.visibility_constraints.size(); ++j )
+  {
+    const moveit_msgs::VisibilityConstraint& c = constraints.visibility_constraints[j];
+    key << "v:" << c.target_pose.header.frame_id << "=";
+    appendPose(key, c.target_pose.pose);
+    key << c.sensor_pose.header.frame_id << "=";
+    appendPose(key, c.sensor_pose.pose);
+    key << quantize(c.target_radius, goal_resolution_) << ","
+        << c.cone_sides << "," << int(c.sensor_view_direction) << ","
+        << quantize(c.max_view_angle, goal_resolution_) << ","
+        << quantize(c.max_range_angle, goal_resolution_) << ","
+        << quantize(c.weight, goal_resolution_) << ",";
+  }
+}
+
+void MotionPlanCache::appendPose(std::stringstream& key, const geometry_msgs::Pose& pose) const
+{
+  key << quantize(pose.position.x, goal_resolution_) << ","
+      << quantize(pose.position.y, goal_resolution_) << ","
+      << quantize(pose.position.z, goal_resolution_) << ","
+      << quantize(pose.orientation.x, goal_resolution_) << ","
+      << quantize(pose.orientation.y, goal_resolution_) << ","
+      << quantize(pose.orientation.z, goal_resolution_) << ","
+      << quantize(pose.orientation.w, goal_resolution_) << ",";
+}
+
+long MotionPlanCache::quantize(double value, double resolution)
+{
+  return lround(value / resolution);
+}
+
+void MotionPlanCache::evict()
+{
+  while( !entries_.empty() && entries_.size() >= max_entries_ )
+  {
+    std::map<std::string, Entry>::iterator oldest = entries_.begin();
+    for( std::map<std::string, Entry>::iterator it = entries_.begin(); it != entries_.end(); ++it )
+    {
+      if( it->second.last_used < oldest->second.last_used )
+        oldest = it;
+    }
+    entries_.erase(oldest);
+  }
+}
+
+} // namespace
@@ -0,0 +1,483 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, CU Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of CU Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Author: Dave Coleman */
+
+#include <clam_controller/planner_race.h>
+#include <moveit/trajectory_processing/iterative_time_parameterization.h>
+#include <ros/ros.h>
+
+#include <Eigen/Geometry>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <sstream>
+
+namespace clam_controller
+{
+
+const std::string PlannerRace::JOINT_SHORTCUT = "JointShortcut";
+
+// Largest joint step when checking a straight segment for collisions [rad]
+static const double SEGMENT_RESOLUTION = 0.05;
+
+// Shortcuts tried by each smoothing thread
+static const unsigned int SHORTCUT_ATTEMPTS = 50;
+
+// Frame names with and without the leading slash are the same frame
+static std::string stripSlash(const std::string& frame)
+{
+  return (!frame.empty() && frame[0] == '/') ? frame.substr(1) : frame;
+}
+
+struct PlannerRace::Race
+{
+  planning_scene::PlanningSceneConstPtr scene;
+  moveit_msgs::MotionPlanRequest request;
+
+  boost::mutex lock;
+  boost::condition_variable changed;
+
+  std::vector<robot_trajectory::RobotTrajectoryPtr> results; // one per racer, NULL until it succeeds
+  size_t running;
+};
+
+PlannerRaceStats::PlannerRaceStats()
+  : attempts(0),
+    successes(0),
+    wins(0),
+    skipped(0),
+    solve_time(0.0)
+{
+}
+
+PlannerRace::PlannerRace(const kinematic_model::KinematicModelConstPtr& kinematic_model,
+                         const std::vector<std::string>& planner_ids,
+                         const std::string& planning_ns)
+  : kinematic_model_(kinematic_model),
+    grace_period_(0.1),
+    smoothing_threads_(2)
+{
+  ros::NodeHandle planning_nh(planning_ns);
+
+  for( size_t i = 0; i < planner_ids.size(); ++i )
+  {
+    Racer racer;
+    racer.name = planner_ids[i];
+    racer.pipeline.reset(new planning_pipeline::PlanningPipeline(kinematic_model_, planning_nh));
+    racers_.push_back(racer);
+  }
+
+  Racer shortcut;
+  shortcut.name = JOINT_SHORTCUT;
+  racers_.push_back(shortcut);
+}
+
+PlannerRace::~PlannerRace()
+{
+  for( size_t i = 0; i < racers_.size(); ++i )
+  {
+    if( racers_[i].pipeline )
+      racers_[i].pipeline->terminate();
+  }
+  for( size_t i = 0; i < racers_.size(); ++i )
+  {
+    if( racers_[i].thread )
+      racers_[i].thread->join();
+  }
+}
+
+bool PlannerRace::plan(const planning_scene::PlanningSceneConstPtr& scene,
+                       const moveit_msgs::MotionPlanRequest& request,
+                       moveit_msgs::RobotTrajectory& trajectory)
+{
+  ros::WallTime start_time = ros::WallTime::now();
+  double allowed_time = request.allowed_planning_time > 0 ? request.allowed_planning_time : 5.0;
+  ros::WallTime deadline = start_time + ros::WallDuration(allowed_time);
+
+  boost::shared_ptr<Race> race(new Race());
+  race->scene = scene;
+  race->request = request;
+  race->results.resize(racers_.size());
+  race->running = 0;
+
+  // -----------------------------------------------------------------------------------------------
+  // Start every planner that isn't still busy with an earlier race
+  {
+    boost::mutex::scoped_lock r_guard(racers_lock_);
+    boost::mutex::scoped_lock race_guard(race->lock);
+
+    for( size_t i = 0; i < racers_.size(); ++i )
+    {
+      Racer& racer = racers_[i];
+      if( racer.thread && !racer.thread->timed_join(boost::posix_time::seconds(0)) )
+      {
+        ROS_DEBUG_STREAM("[planner race] " << racer.name << " is still stopping, skipping it");
+        racer.stats.skipped++;
+        continue;
+      }
+
+      racer.thread.reset(new boost::thread(boost::bind(&PlannerRace::runPlanner, this, race, i)));
+      race->running++;
+    }
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Wait for the first solution plus the grace period, or for everyone to give up
+  std::vector<robot_trajectory::RobotTrajectoryPtr> results;
+  {
+    boost::mutex::scoped_lock race_guard(race->lock);
+
+    bool have_solution = false;
+    ros::WallTime grace_end;
+
+    while( race->running > 0 )
+    {
+      ros::WallTime now = ros::WallTime::now();
+
+      for( size_t i = 0; i < race->results.size() && !have_solution; ++i )
+      {
+        if( race->results[i] )
+        {
+          have_solution = true;
+          grace_end = now + ros::WallDuration(grace_period_);
+        }
+      }
+
+      ros::WallTime until = (have_solution && grace_end < deadline) ? grace_end : deadline;
+      if( now >= until )
+        break;
+
+      race->changed.timed_wait(race_guard, boost::posix_time::microseconds((until - now).toNSec() / 1000));
+    }
+
+    results = race->results;
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Whoever is still planning has lost, stop them so they are ready for the next race
+  {
+    boost::mutex::scoped_lock r_guard(racers_lock_);
+    for( size_t i = 0; i < racers_.size(); ++i )
+    {
+      if( racers_[i].pipeline && racers_[i].thread && !racers_[i].thread->timed_join(boost::posix_time::seconds(0)) )
+        racers_[i].pipeline->terminate();
+    }
+  }
+
+  // -----------------------------------------------------------------------------------------------
+  // Shortest path wins
+  int winner = -1;
+  double best_length = 0.0;
+  for( size_t i = 0; i < results.size(); ++i )
+  {
+    if( !results[i] )
+      continue;
+
+    double length = pathLength(results[i]);
+    if( winner < 0 || length < best_length )
+    {
+      winner = i;
+      best_length = length;
+    }
+  }
+
+  if( winner < 0 )
+  {
+    ROS_WARN_STREAM("[planner race] No planner found a solution in " << allowed_time << "s");
+    return false;
+  }
+
+  {
+    boost::mutex::scoped_lock r_guard(racers_lock_);
+    racers_[winner].stats.wins++;
+  }
+  double solve_time = (ros::WallTime::now() - start_time).toSec();
+
+  robot_trajectory::RobotTrajectoryPtr result = results[winner];
+  if( smoothing_threads_ > 0 )
+    result = smooth(scene, request.group_name, result);
+  result->getRobotTrajectoryMsg(trajectory);
+
+  ROS_INFO_STREAM("[planner race] " << racers_[winner].name << " won in " << solve_time << "s, smoothed in "
+                  << (ros::WallTime::now() - start_time).toSec() - solve_time << "s");
+  ROS_INFO_STREAM("[planner race] " << statsString());
+  return true;
+}
+
+std::string PlannerRace::statsString() const
+{
+  boost::mutex::scoped_lock r_guard(racers_lock_);
+
+  std::stringstream ss;
+  for( size_t i = 0; i < racers_.size(); ++i )
+  {
+    const PlannerRaceStats& stats = racers_[i].stats;
+    if( i > 0 )
+      ss << ", ";
+    ss << racers_[i].name << ": " << stats.wins << "/" << stats.attempts << " won, "
+       << stats.successes << " solved";
+    if( stats.skipped > 0 )
+      ss << ", " << stats.skipped << " skipped";
+    if( stats.successes > 0 )
+      ss << " in " << stats.solve_time / stats.successes << "s avg";
+  }
+  return ss.str();
+}
+
+void PlannerRace::runPlanner(boost::shared_ptr<Race> race, size_t racer)
+{
+  ros::WallTime start_time = ros::WallTime::now();
+  robot_trajectory::RobotTrajectoryPtr result;
+
+  if( racers_[racer].pipeline )
+  {
+    moveit_msgs::MotionPlanRequest request = race->request;
+    request.planner_id = racers_[racer].name;
+
+    planning_interface::MotionPlanResponse response;
+    if( racers_[racer].pipeline->generatePlan(race->scene, request, response) &&
+        response.error_code_.val == moveit_msgs::MoveItErrorCodes::SUCCESS )
+      result = response.trajectory_;
+  }
+  else
+  {
+    result = planJointShortcut(race->scene, race->request);
+  }
+
+  double elapsed = (ros::WallTime::now() - start_time).toSec();
+  {
+    boost::mutex::scoped_lock r_guard(racers_lock_);
+    PlannerRaceStats& stats = racers_[racer].stats;
+    stats.attempts++;
+    if( result )
+    {
+      stats.successes++;
+      stats.solve_time += elapsed;
+    }
+  }
+
+  boost::mutex::scoped_lock race_guard(race->lock);
+  race->results[racer] = result;
+  race->running--;
+  race->changed.notify_all();
+}
+
+robot_trajectory::RobotTrajectoryPtr PlannerRace::planJointShortcut(const planning_scene::PlanningSceneConstPtr& scene,
+                                                                    const moveit_msgs::MotionPlanRequest& request) const
+{
+  robot_trajectory::RobotTrajectoryPtr trajectory;
+
+  robot_state::RobotStatePtr start_state(new robot_state::RobotState(scene->getCurrentState()));
+  robot_state::RobotStatePtr goal_state(new robot_state::RobotState(scene->getCurrentState()));
+  if( !goalToJointValues(scene, request, *goal_state) )
+    return trajectory;
+
+  if( scene->isStateColliding(*goal_state, request.group_name) )
+    return trajectory;
+
+  std::vector<double> from;
+  std::vector<double> to;
+  start_state->getJointStateGroup(request.group_name)->getVariableValues(from);
+  goal_state->getJointStateGroup(request.group_name)->getVariableValues(to);
+
+  robot_state::RobotState state(scene->getCurrentState());
+  if( !isSegmentValid(scene, state, request.group_name, from, to) )
+    return trajectory;
+
+  trajectory.reset(new robot_trajectory::RobotTrajectory(kinematic_model_, request.group_name));
+  trajectory->addSuffixWayPoint(start_state, 0.0);
+  trajectory->addSuffixWayPoint(goal_state, 0.0);
+
+  trajectory_processing::IterativeParabolicTimeParameterization iterative_smoother;
+  iterative_smoother.computeTimeStamps(*trajectory);
+  return trajectory;
+}
+
+bool PlannerRace::goalToJointValues(const planning_scene::PlanningSceneConstPtr& scene,
+                                    const moveit_msgs::MotionPlanRequest& request,
+                                    robot_state::RobotState& goal_state) const
+{
+  if( request.goal_constraints.empty() )
+    return false;
+
+  const moveit_msgs::Constraints& goal = request.goal_constraints[0];
+  robot_state::JointStateGroup* joint_state_group = goal_state.getJointStateGroup(request.group_name);
+  if( !joint_state_group )
+    return false;
+
+  // Joint space goal
+  if( !goal.joint_constraints.empty() )
+  {
+    std::map<std::string, double> joint_values;
+    for( size_t i = 0; i < goal.joint_constraints.size(); ++i )
+      joint_values[goal.joint_constraints[i].joint_name] = goal.joint_constraints[i].position;
+    joint_state_group->setVariableValues(joint_values);
+    return true;
+  }
+
+  // Pose goal, as made by kinematic_constraints::constructGoalConstraints()
+  if( goal.position_constraints.empty() || goal.orientation_constraints.empty() )
+    return false;
+
+  const moveit_msgs::PositionConstraint& position = goal.position_constraints[0];
+  const moveit_msgs::OrientationConstraint& orientation = goal.orientation_constraints[0];
+  if( position.constraint_region.primitive_poses.empty() ||
+      stripSlash(position.header.frame_id) != stripSlash(scene->getPlanningFrame()) ||
+      stripSlash(orientation.header.frame_id) != stripSlash(scene->getPlanningFrame()) )
+    return false;
+
+  // The offset point of the link has to reach the target, not the link origin
+  Eigen::Quaterniond rotation(orientation.orientation.w, orientation.orientation.x,
+                              orientation.orientation.y, orientation.orientation.z);
+  Eigen::Vector3d offset(position.target_point_offset.x, position.target_point_offset.y,
+                         position.target_point_offset.z);
+  const geometry_msgs::Point& target = position.constraint_region.primitive_poses[0].position;
+  Eigen::Vector3d link_position = Eigen::Vector3d(target.x, target.y, target.z) - rotation * offset;
+
+  geometry_msgs::Pose pose;
+  pose.position.x = link_position.x();
+  pose.position.y = link_position.y();
+  pose.position.z = link_position.z();
+  pose.orientation = orientation.orientation;
+
+  return joint_state_group->setFromIK(pose, position.link_name, 3, 0.05);
+}
+
+bool PlannerRace::isSegmentValid(const planning_scene::PlanningSceneConstPtr& scene, robot_state::RobotState& state,
+                                 const std::string& group, const std::vector<double>& from, const std::vector<double>& to) const
+{
+  double max_step = 0.0;
+  for( size_t i = 0; i < from.size(); ++i )
+    max_step = std::max(max_step, fabs(to[i] - from[i]));
+
+  // The end points are already known to be valid
+  int steps = ceil(max_step / SEGMENT_RESOLUTION);
+  robot_state::JointStateGroup* joint_state_group = state.getJointStateGroup(group);
+  std::vector<double> values(from.size());
+
+  for( int step = 1; step < steps; ++step )
+  {
+    double t = double(step) / steps;
+    for( size_t i = 0; i < from.size(); ++i )
+      values[i] = from[i] + t * (to[i] - from[i]);
+
+    joint_state_group->setVariableValues(values);
+    if( scene->isStateColliding(state, group) )
+      return false;
+  }
+  return true;
+}
+
+void PlannerRace::shortcutPath(const planning_scene::PlanningSceneConstPtr& scene, const std::string& group,
+                               unsigned int seed, Path& path) const
+{
+  robot_state::RobotState state(scene->getCurrentState());
+
+  for( unsigned int attempt = 0; attempt < SHORTCUT_ATTEMPTS && path.size() > 2; ++attempt )
+  {
+    // Two waypoints with at least one in between
+    size_t i = rand_r(&seed) % (path.size() - 2);
+    size_t j = i + 2 + rand_r(&seed) % (path.size() - i - 2);
+
+    if( isSegmentValid(scene, state, group, path[i], path[j]) )
+      path.erase(path.begin() + i + 1, path.begin() + j);
+  }
+}
+
+robot_trajectory::RobotTrajectoryPtr PlannerRace::smooth(const planning_scene::PlanningSceneConstPtr& scene,
+                                                         const std::string& group,
+                                                         const robot_trajectory::RobotTrajectoryPtr& trajectory) const
+{
+  Path path(trajectory->getWayPointCount());
+  for( size_t i = 0; i < path.size(); ++i )
+    trajectory->getWayPoint(i).getJointStateGroup(group)->getVariableValues(path[i]);
+
+  if( path.size() <= 2 )
+    return trajectory;
+
+  // Every thread shortcuts its own copy with its own random choices
+  std::vector<Path> paths(smoothing_threads_, path);
+  boost::thread_group threads;
+  for( unsigned int t = 0; t < smoothing_threads_; ++t )
+    threads.create_thread(boost::bind(&PlannerRace::shortcutPath, this, scene, group, t + 1, boost::ref(paths[t])));
+  threads.join_all();
+
+  size_t best = 0;
+  for( size_t t = 1; t < paths.size(); ++t )
+  {
+    if( pathLength(paths[t]) < pathLength(paths[best]) )
+      best = t;
+  }
+
+  if( paths[best].size() == path.size() )
+    return trajectory;
+
+  robot_trajectory::RobotTrajectoryPtr smoothed(new robot_trajectory::RobotTrajectory(kinematic_model_, group));
+  for( size_t i = 0; i < paths[best].size(); ++i )
+  {
+    robot_state::RobotStatePtr state(new robot_state::RobotState(trajectory->getFirstWayPoint()));
+    state->getJointStateGroup(group)->setVariableValues(paths[best][i]);
+    smoothed->addSuffixWayPoint(state, 0.0);
+  }
+
+  trajectory_processing::IterativeParabolicTimeParameterization iterative_smoother;
+  iterative_smoother.computeTimeStamps(*smoothed);
+  return smoothed;
+}
+
+double PlannerRace::pathLength(const Path& path)
+{
+  double length = 0.0;
+  for( size_t i = 1; i < path.size(); ++i )
+  {
+    double squared = 0.0;
+    for( size_t j = 0; j < path[i].size(); ++j )
+      squared += (path[i][j] - path[i - 1][j]) * (path[i][j] - path[i - 1][j]);
+    length += sqrt(squared);
+  }
+  return length;
+}
+
+double PlannerRace::pathLength(const robot_trajectory::RobotTrajectoryPtr& trajectory)
+{
+  Path path(trajectory->getWayPointCount());
+  for( size_t i = 0; i < path.size(); ++i )
+    trajectory->getWayPoint(i).getJointStateGroup(trajectory->getGroupName())->getVariableValues(path[i]);
+  return pathLength(path);
+}
+
+} // namespace
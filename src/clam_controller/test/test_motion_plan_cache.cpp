@@ -0,0 +1,308 @@
+// Tests MotionPlanCache and SceneVersion on a one joint arm: keys are quantized, plans are
+// reused while the scene is unchanged and dropped once an obstacle is in their way.
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include <clam_controller/motion_plan_cache.h>
+#include <moveit/robot_state/conversions.h>
+#include <urdf_parser/urdf_parser.h>
+
+using namespace clam_controller;
+
+namespace
+{
+
+// A 40cm link swinging around z over a base with no geometry, and a gripper finger at its end
+const std::string URDF =
+  "<robot name=\"arm\">"
+  "  <link name=\"base_link\"/>"
+  "  <link name=\"link1\">"
+  "    <collision>"
+  "      <origin xyz=\"0.2 0 0\" rpy=\"0 0 0\"/>"
+  "      <geometry><box size=\"0.4 0.05 0.05\"/></geometry>"
+  "    </collision>"
+  "  </link>"
+  "  <joint name=\"joint1\" type=\"revolute\">"
+  "    <parent link=\"base_link\"/>"
+  "    <child link=\"link1\"/>"
+  "    <axis xyz=\"0 0 1\"/>"
+  "    <limit lower=\"-3.14\" upper=\"3.14\" effort=\"1\" velocity=\"1\"/>"
+  "  </joint>"
+  "  <link name=\"finger\"/>"
+  "  <joint name=\"gripper_joint\" type=\"prismatic\">"
+  "    <parent link=\"link1\"/>"
+  "    <child link=\"finger\"/>"
+  "    <origin xyz=\"0.4 0 0\" rpy=\"0 0 0\"/>"
+  "    <axis xyz=\"0 1 0\"/>"
+  "    <limit lower=\"0\" upper=\"0.05\" effort=\"1\" velocity=\"1\"/>"
+  "  </joint>"
+  "</robot>";
+
+const std::string SRDF =
+  "<robot name=\"arm\">"
+  "  <group name=\"arm\"><joint name=\"joint1\"/></group>"
+  "  <group name=\"gripper\"><joint name=\"gripper_joint\"/></group>"
+  "</robot>";
+
+class MotionPlanCacheTest : public ::testing::Test
+{
+protected:
+  MotionPlanCacheTest()
+    : scene(new planning_scene::PlanningScene())
+  {
+    boost::shared_ptr<urdf::ModelInterface> urdf_model = urdf::parseURDF(URDF);
+    boost::shared_ptr<srdf::Model> srdf_model(new srdf::Model());
+    srdf_model->initString(*urdf_model, SRDF);
+    scene->configure(urdf_model, srdf_model);
+    setJoint(0.0);
+  }
+
+  void setJoint(double position, const std::string& joint = "joint1")
+  {
+    std::map<std::string, double> values;
+    values[joint] = position;
+    scene->getCurrentStateNonConst().setStateValues(values);
+  }
+
+  moveit_msgs::RobotState currentState() const
+  {
+    moveit_msgs::RobotState state;
+    robot_state::robotStateToRobotStateMsg(scene->getCurrentState(), state);
+    return state;
+  }
+
+  static moveit_msgs::MotionPlanRequest request(double goal)
+  {
+    moveit_msgs::MotionPlanRequest request;
+    request.group_name = "arm";
+    request.goal_constraints.resize(1);
+    request.goal_constraints[0].joint_constraints.resize(1);
+    request.goal_constraints[0].joint_constraints[0].joint_name = "joint1";
+    request.goal_constraints[0].joint_constraints[0].position = goal;
+    return request;
+  }
+
+  // From 0 to a quarter turn, the link ends up along +y
+  static moveit_msgs::RobotTrajectory quarterTurn()
+  {
+    moveit_msgs::RobotTrajectory trajectory;
+    trajectory.joint_trajectory.joint_names.push_back("joint1");
+    for( int i = 0; i <= 4; ++i )
+    {
+      trajectory_msgs::JointTrajectoryPoint point;
+      point.positions.push_back(i * M_PI / 8);
+      trajectory.joint_trajectory.points.push_back(point);
+    }
+    return trajectory;
+  }
+
+  // A box where the link is at the end of the quarter turn
+  void addObstacle()
+  {
+    moveit_msgs::CollisionObject obstacle;
+    obstacle.header.frame_id = "base_link";
+    obstacle.id = "obstacle";
+    obstacle.operation = moveit_msgs::CollisionObject::ADD;
+    shape_msgs::SolidPrimitive box;
+    box.type = shape_msgs::SolidPrimitive::BOX;
+    box.dimensions.resize(3, 0.1);
+    obstacle.primitives.push_back(box);
+    geometry_msgs::Pose pose;
+    pose.position.y = 0.3;
+    pose.orientation.w = 1.0;
+    obstacle.primitive_poses.push_back(pose);
+    scene->processCollisionObjectMsg(obstacle);
+  }
+
+  planning_scene::PlanningScenePtr scene;
+};
+
+}
+
+TEST_F(MotionPlanCacheTest, hitStartsFromCurrentState)
+{
+  MotionPlanCache cache(0.02, 0.001);
+  moveit_msgs::RobotTrajectory trajectory;
+
+  EXPECT_FALSE(cache.lookup(scene, 0, request(M_PI / 2), trajectory));
+  cache.store(scene, 0, request(M_PI / 2), currentState(), quarterTurn(), 1.0);
+  EXPECT_EQ(1u, cache.size());
+
+  // Within half a joint_resolution of the stored start
+  setJoint(0.005);
+  ASSERT_TRUE(cache.lookup(scene, 0, request(M_PI / 2), trajectory));
+  ASSERT_EQ(5u, trajectory.joint_trajectory.points.size());
+  EXPECT_DOUBLE_EQ(0.005, trajectory.joint_trajectory.points[0].positions[0]);
+  EXPECT_DOUBLE_EQ(M_PI / 2, trajectory.joint_trajectory.points[4].positions[0]);
+
+  EXPECT_EQ(1u, cache.getStats().hits);
+  EXPECT_EQ(1u, cache.getStats().misses);
+  EXPECT_GT(cache.getStats().planning_time_saved, 0.0);
+}
+
+TEST_F(MotionPlanCacheTest, keysAreQuantized)
+{
+  MotionPlanCache cache(0.02, 0.001);
+  moveit_msgs::RobotTrajectory trajectory;
+  cache.store(scene, 0, request(M_PI / 2), currentState(), quarterTurn(), 1.0);
+
+  // Goals rounding to the same goal_resolution step (1571), then to the next one
+  EXPECT_TRUE(cache.lookup(scene, 0, request(M_PI / 2 + 0.0002), trajectory));
+  EXPECT_FALSE(cache.lookup(scene, 0, request(M_PI / 2 + 0.0008), trajectory));
+
+  // Start state rounding to the next joint_resolution step
+  setJoint(0.011);
+  EXPECT_FALSE(cache.lookup(scene, 0, request(M_PI / 2), trajectory));
+
+  // Other groups don't share plans
+  moveit_msgs::MotionPlanRequest other = request(M_PI / 2);
+  other.group_name = "gripper";
+  setJoint(0.0);
+  EXPECT_FALSE(cache.lookup(scene, 0, other, trajectory));
+
+  EXPECT_EQ(1u, cache.getStats().hits);
+  EXPECT_EQ(3u, cache.getStats().misses);
+}
+
+TEST_F(MotionPlanCacheTest, keysHoldTolerancesAndPathConstraints)
+{
+  MotionPlanCache cache(0.02, 0.001);
+  moveit_msgs::RobotTrajectory trajectory;
+  moveit_msgs::MotionPlanRequest stored = request(M_PI / 2);
+  stored.goal_constraints[0].joint_constraints[0].tolerance_above = 0.01;
+  stored.goal_constraints[0].joint_constraints[0].tolerance_below = 0.01;
+  stored.goal_constraints[0].joint_constraints[0].weight = 1.0;
+  cache.store(scene, 0, stored, currentState(), quarterTurn(), 1.0);
+  EXPECT_TRUE(cache.lookup(scene, 0, stored, trajectory));
+
+  moveit_msgs::MotionPlanRequest changed = stored;
+  changed.goal_constraints[0].joint_constraints[0].tolerance_above = 0.1;
+  EXPECT_FALSE(cache.lookup(scene, 0, changed, trajectory));
+
+  changed = stored;
+  changed.goal_constraints[0].joint_constraints[0].tolerance_below = 0.1;
+  EXPECT_FALSE(cache.lookup(scene, 0, changed, trajectory));
+
+  changed = stored;
+  changed.goal_constraints[0].joint_constraints[0].weight = 0.5;
+  EXPECT_FALSE(cache.lookup(scene, 0, changed, trajectory));
+
+  // Keeping the link level on the way
+  changed = stored;
+  changed.path_constraints.orientation_constraints.resize(1);
+  changed.path_constraints.orientation_constraints[0].link_name = "link1";
+  changed.path_constraints.orientation_constraints[0].orientation.w = 1.0;
+  changed.path_constraints.orientation_constraints[0].absolute_x_axis_tolerance = 0.1;
+  EXPECT_FALSE(cache.lookup(scene, 0, changed, trajectory));
+
+  moveit_msgs::MotionPlanRequest looser = changed;
+  looser.path_constraints.orientation_constraints[0].absolute_x_axis_tolerance = 0.5;
+  EXPECT_FALSE(cache.lookup(scene, 0, looser, trajectory));
+
+  EXPECT_EQ(1u, cache.getStats().hits);
+  EXPECT_EQ(5u, cache.getStats().misses);
+}
+
+TEST_F(MotionPlanCacheTest, keysHoldJointsOutsideTheGroup)
+{
+  MotionPlanCache cache(0.02, 0.001);
+  moveit_msgs::RobotTrajectory trajectory;
+  cache.store(scene, 0, request(M_PI / 2), currentState(), quarterTurn(), 1.0);
+
+  // The gripper opens: the plan was made with it closed
+  setJoint(0.04, "gripper_joint");
+  EXPECT_FALSE(cache.lookup(scene, 0, request(M_PI / 2), trajectory));
+
+  setJoint(0.0, "gripper_joint");
+  EXPECT_TRUE(cache.lookup(scene, 0, request(M_PI / 2), trajectory));
+}
+
+TEST_F(MotionPlanCacheTest, invalidatedByNewObstacle)
+{
+  MotionPlanCache cache(0.02, 0.001);
+  moveit_msgs::RobotTrajectory trajectory;
+  cache.store(scene, 0, request(M_PI / 2), currentState(), quarterTurn(), 1.0);
+
+  // Still valid in a new scene version without anything in the way
+  ASSERT_TRUE(cache.lookup(scene, 1, request(M_PI / 2), trajectory));
+  EXPECT_EQ(0u, cache.getStats().invalidated);
+
+  // In the way: checked again since the version changed, and dropped
+  addObstacle();
+  EXPECT_FALSE(cache.lookup(scene, 2, request(M_PI / 2), trajectory));
+  EXPECT_EQ(1u, cache.getStats().invalidated);
+  EXPECT_EQ(0u, cache.size());
+}
+
+TEST_F(MotionPlanCacheTest, evictsLeastRecentlyUsed)
+{
+  MotionPlanCache cache(0.02, 0.001, 2);
+  moveit_msgs::RobotTrajectory trajectory;
+  cache.store(scene, 0, request(0.5), currentState(), quarterTurn(), 1.0);
+  cache.store(scene, 0, request(1.0), currentState(), quarterTurn(), 1.0);
+  ASSERT_TRUE(cache.lookup(scene, 0, request(0.5), trajectory));
+
+  cache.store(scene, 0, request(1.5), currentState(), quarterTurn(), 1.0);
+  EXPECT_EQ(2u, cache.size());
+  EXPECT_TRUE(cache.lookup(scene, 0, request(0.5), trajectory));
+  EXPECT_FALSE(cache.lookup(scene, 0, request(1.0), trajectory));
+}
+
+TEST_F(MotionPlanCacheTest, sceneVersionCountsGeometryAttachedBodiesAndGripper)
+{
+  SceneVersion version("arm");
+  EXPECT_EQ(0u, version.get());
+
+  // The first update records the state, then one that changes nothing that matters
+  version.update(scene, false);
+  EXPECT_EQ(1u, version.get());
+  setJoint(0.3);
+  version.update(scene, false);
+  EXPECT_EQ(1u, version.get());
+
+  version.update(scene, true);
+  EXPECT_EQ(2u, version.get());
+
+  // The gripper is outside the group, so it counts, but not below joint_resolution
+  setJoint(0.005, "gripper_joint");
+  version.update(scene, false);
+  EXPECT_EQ(2u, version.get());
+  setJoint(0.04, "gripper_joint");
+  version.update(scene, false);
+  EXPECT_EQ(3u, version.get());
+
+  // Picking something up arrives as a state update
+  moveit_msgs::AttachedCollisionObject block;
+  block.link_name = "link1";
+  block.object.header.frame_id = "link1";
+  block.object.id = "block";
+  block.object.operation = moveit_msgs::CollisionObject::ADD;
+  shape_msgs::SolidPrimitive box;
+  box.type = shape_msgs::SolidPrimitive::BOX;
+  box.dimensions.resize(3, 0.02);
+  block.object.primitives.push_back(box);
+  geometry_msgs::Pose pose;
+  pose.position.x = 0.4;
+  pose.orientation.w = 1.0;
+  block.object.primitive_poses.push_back(pose);
+  scene->processAttachedCollisionObjectMsg(block);
+
+  version.update(scene, false);
+  EXPECT_EQ(4u, version.get());
+  version.update(scene, false);
+  EXPECT_EQ(4u, version.get());
+
+  // And so does putting it down
+  block.object.operation = moveit_msgs::CollisionObject::REMOVE;
+  scene->processAttachedCollisionObjectMsg(block);
+  version.update(scene, false);
+  EXPECT_EQ(5u, version.get());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2012, Dave Coleman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * The two builds of the clam IKFast solver (output_ikfast61.cpp), each in its
+ * own namespace so they can be linked into one program:
+ *
+ *   clam_ikfast_double  - IkReal = double, the reference solver
+ *   clam_ikfast_float   - IkReal = float with looser tolerances, for speed
+ *
+ * Both are built with -DIKFAST_PRUNE_JOINT_LIMITS: ComputeIkInLimits() drops
+ * branches of the solver that leave the given joint limits as soon as that
+ * joint is solved. ComputeIk() explores every branch. The limits only live for
+ * one call, so both are safe to use from several threads.
+ *
+ * The generated file has to be patched with scripts/ikfast_prune_limits.py
+ * first, see scripts/generate_ikfast.sh
+ */
+
+#ifndef CLAM_IK_CLAM_IKFAST_H
+#define CLAM_IK_CLAM_IKFAST_H
+
+#include "ikfast.h" // found inside share/openrave-X.Y/python/ikfast.h
+
+namespace clam_ik
+{
+
+static const int NUM_JOINTS = 7;
+
+// Index of the joint IKFast treats as free (elbow_roll)
+static const int FREE_JOINT = 2;
+
+// From clam_description/urdf/clam.urdf, shoulder_pan_joint through gripper_roll_joint
+static const double JOINT_LOWER[NUM_JOINTS] = {-2.61799387799, -1.19962513147, -2.61799387799, -1.5953400194,
+                                               -2.61799387799, -1.5953400194, -2.61799387799};
+static const double JOINT_UPPER[NUM_JOINTS] = {1.98394848567, 1.89994105047, 0.705631162427, 1.93281579274,
+                                               2.6128806087, 1.98394848567, 2.6128806087};
+
+} // namespace
+
+namespace clam_ikfast_double
+{
+bool ComputeIk(const double* eetrans, const double* eerot, const double* pfree,
+               ikfast::IkSolutionListBase<double>& solutions);
+bool ComputeIkInLimits(const double* eetrans, const double* eerot, const double* pfree,
+                       const double* lower, const double* upper, ikfast::IkSolutionListBase<double>& solutions);
+void ComputeFk(const double* j, double* eetrans, double* eerot);
+} // namespace
+
+namespace clam_ikfast_float
+{
+bool ComputeIk(const float* eetrans, const float* eerot, const float* pfree,
+               ikfast::IkSolutionListBase<float>& solutions);
+bool ComputeIkInLimits(const float* eetrans, const float* eerot, const float* pfree,
+                       const float* lower, const float* upper, ikfast::IkSolutionListBase<float>& solutions);
+void ComputeFk(const float* j, float* eetrans, float* eerot);
+} // namespace
+
+#endif
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2012, Dave Coleman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Helpers for turning the raw IKFast solution list into something a planner
+ * can use directly: only solutions inside the joint limits, closest to the
+ * seed state first. Work for either IkReal type.
+ */
+
+#ifndef CLAM_IK_IKFAST_SOLUTIONS_H
+#define CLAM_IK_IKFAST_SOLUTIONS_H
+
+#include "ikfast.h" // found inside share/openrave-X.Y/python/ikfast.h
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace clam_ik
+{
+
+// Moves value into [lower, upper] by a multiple of 2pi if that is possible.
+// IKFast returns angles in [-pi, pi], limits can be outside of that. The
+// pruning in the patched solver uses this too, so a branch is only dropped
+// when collectSolutions() would have dropped its solutions.
+template <typename T>
+bool wrapIntoLimits(T& value, double lower, double upper)
+{
+  static const double TWO_PI = 6.28318530717959;
+
+  if( value < lower )
+    value += TWO_PI * std::ceil((lower - value) / TWO_PI);
+  else if( value > upper )
+    value -= TWO_PI * std::ceil((value - upper) / TWO_PI);
+
+  return value >= lower && value <= upper;
+}
+
+// Copies every solution that is inside the limits into out, ordered by
+// squared joint distance to seed. free_values are the values that were passed
+// to ComputeIk for the free joints. Returns the number of solutions kept.
+template <typename T>
+size_t collectSolutions(const ikfast::IkSolutionListBase<T>& solutions, const T* free_values,
+                        const double* lower, const double* upper, const double* seed, int num_joints,
+                        std::vector<std::vector<T> >& out)
+{
+  std::vector<std::pair<double, size_t> > order;
+  std::vector<std::vector<T> > kept;
+  std::vector<T> values(num_joints);
+
+  for( size_t i = 0; i < solutions.GetNumSolutions(); ++i )
+  {
+    solutions.GetSolution(i).GetSolution(&values[0], free_values);
+
+    bool valid = true;
+    double distance = 0;
+    for( int j = 0; j < num_joints && valid; ++j )
+    {
+      valid = wrapIntoLimits(values[j], lower[j], upper[j]);
+      distance += (values[j] - seed[j]) * (values[j] - seed[j]);
+    }
+    if( !valid )
+      continue;
+
+    order.push_back(std::make_pair(distance, kept.size()));
+    kept.push_back(values);
+  }
+
+  std::sort(order.begin(), order.end());
+
+  out.resize(order.size());
+  for( size_t i = 0; i < order.size(); ++i )
+    out[i].swap(kept[order[i].second]);
+
+  return out.size();
+}
+
+// Solve with the free joint starting at its seed value and stepping outwards
+// (seed, seed + step, seed - step, ...) until some in-limit solution shows up
+// or the free joint's limits are used up. compute_ik is a ComputeIkInLimits(),
+// it is given the same limits. Returns the number of solutions.
+template <typename T>
+size_t searchFreeJoint(bool (*compute_ik)(const T*, const T*, const T*, const T*, const T*,
+                                          ikfast::IkSolutionListBase<T>&),
+                       const T* eetrans, const T* eerot, int free_joint, double step,
+                       const double* lower, const double* upper, const double* seed, int num_joints,
+                       ikfast::IkSolutionListBase<T>& solutions, std::vector<std::vector<T> >& out)
+{
+  out.clear();
+
+  const std::vector<T> solver_lower(lower, lower + num_joints);
+  const std::vector<T> solver_upper(upper, upper + num_joints);
+
+  const double start = std::max(lower[free_joint], std::min(upper[free_joint], seed[free_joint]));
+  for( int i = 0; ; ++i )
+  {
+    // 0, +1, -1, +2, -2 ... steps away from the seed
+    int offset = (i + 1) / 2;
+    double free_value = start + (i % 2 ? offset : -offset) * step;
+
+    bool above = start + offset * step > upper[free_joint];
+    bool below = start - offset * step < lower[free_joint];
+    if( above && below )
+      break;
+    if( free_value > upper[free_joint] || free_value < lower[free_joint] )
+      continue;
+
+    T free = free_value;
+    solutions.Clear();
+    if( compute_ik(eetrans, eerot, &free, &solver_lower[0], &solver_upper[0], solutions) &&
+        collectSolutions(solutions, &free, lower, upper, seed, num_joints, out) > 0 )
+      break;
+  }
+
+  return out.size();
+}
+
+} // namespace
+
+#endif
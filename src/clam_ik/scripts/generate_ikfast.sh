@@ -25,8 +25,29 @@ roscd clam_ik/src
 #python /usr/lib/python2.7/dist-packages/openravepy/_openravepy_0_8/ikfast.py --robot=/home/dave/ros/clam/clam_description/urdf/clam.dae --iktype=transform6d --baselink=0 --eelink=6 --savefile=output_ikfast61.cpp #--freeindex=2
 python /usr/lib/python2.7/dist-packages/openravepy/_openravepy_0_8/ikfast.py --robot=/home/dave/ros/clam/clam_description/urdf_ikfast/clam.dae --iktype=transform6d --baselink=0 --eelink=7 --savefile=output_ikfast61.cpp --freeindex=2
 
+# Add joint limit pruning and the float tolerances to the generated file (does nothing if run twice)
+python ../scripts/ikfast_prune_limits.py output_ikfast61.cpp
+
 # Compile test program. I had to add the -I part myself, is system dependent probably
-g++ -lstdc++ -llapack -o ../bin/test_ikfast ikfastdemo.cpp -lrt -I /usr/lib/python2.7/dist-packages/openravepy/_openravepy_0_8/
+g++ -lstdc++ -llapack -o ../bin/test_ikfast ikfastdemo.cpp -lrt -I ../include -I /usr/lib/python2.7/dist-packages/openravepy/_openravepy_0_8/
+
+# The float vs double check is built along with the solvers by catkin, when ikfast.h is
+# found (set IKFAST_INCLUDE_DIR otherwise). It checks that pruning on the joint limits keeps
+# the same solutions as ComputeIk() with the limits checked afterwards, that every double
+# solution has a float one landing in the same place, and prints calls/sec and solutions/sec
+# for each variant.
+rosrun clam_ik ikfast_validate
+# Results: 10/18/26, 100000 random states, Release build
+#   over every pose:                     double 0.27-0.31 us/call
+#                                        pruned 1.42-1.47x, float pruned 1.22-1.37x
+#   over the 311 poses with an in-limit solution:
+#                                        double 8.5-10.0 us/call
+#                                        pruned 2.55-2.59x, float pruned 1.97-2.07x
+#   float against double: position max 0.21 mm, rotation max 1.2e-6, no missed solutions
+#   pruning mismatches: 0
+# The current output_ikfast61.cpp gets the orientation right but misses the position by about
+# 0.15 m, so it inverts none of its own FK poses and only finds solutions for 0.3% of them.
+# It has to be regenerated for this arm, then run ikfast_validate again.
 
 # Do a bunch of tests
 ../bin/test_ikfast iktiming 
@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+"""
+Post-process an IKFast generated solver so it can prune branches on joint limits
+and be built in single precision.
+
+  python ikfast_prune_limits.py output_ikfast61.cpp
+
+Rewrites the file in place:
+ - adds ComputeIkInLimits(), which takes the joint limits along with the pose.
+   The limits belong to the IKSolver of that call, so solves with different
+   limits can run at the same time.
+ - every loop over the candidate values of a joint skips values outside those
+   limits (only when built with -DIKFAST_PRUNE_JOINT_LIMITS, otherwise the
+   check compiles away). A value is inside when it or a 2pi wrap of it is,
+   using clam_ik::wrapIntoLimits(), the same test clam_ik::collectSolutions()
+   applies to the finished solutions.
+ - the hard coded 1e-6 tolerances become IKFAST_EVALCOND_THRESH (rejecting a
+   candidate) and IKFAST_SINGULAR_THRESH (picking a degenerate branch) so a
+   float build (-DIKFAST_REAL=float) can loosen them
+
+Running it on a file that was already patched does nothing.
+"""
+
+import re
+import sys
+
+MARKER = '// joint limit pruning, added by clam_ik/scripts/ikfast_prune_limits.py'
+
+INCLUDE = '#include <clam_ik/ikfast_solutions.h> // wrapIntoLimits(), for the joint limit pruning\n'
+
+PREAMBLE = MARKER + '''
+#ifndef IKFAST_EVALCOND_THRESH
+#define IKFAST_EVALCOND_THRESH ((IkReal)0.000001)
+#endif
+
+#ifndef IKFAST_SINGULAR_THRESH
+#define IKFAST_SINGULAR_THRESH ((IkReal)0.000001)
+#endif
+
+'''
+
+SOLVER_MEMBERS = '''// joint limits of this solve, GetNumJoints() values each. NULL keeps every branch.
+const IkReal* ikjointlower;
+const IkReal* ikjointupper;
+
+IKSolver() : ikjointlower(NULL), ikjointupper(NULL) {}
+
+inline bool IKjointinlimits(int joint, IkReal value) const {
+#ifdef IKFAST_PRUNE_JOINT_LIMITS
+    return ikjointlower == NULL || clam_ik::wrapIntoLimits(value, ikjointlower[joint], ikjointupper[joint]);
+#else
+    return true;
+#endif
+}
+
+'''
+
+COMPUTE_IK_IN_LIMITS = '''
+/// same as ComputeIk(), but with -DIKFAST_PRUNE_JOINT_LIMITS branches are dropped as soon as a joint
+/// is solved outside of [lower, upper]. Arrays of GetNumJoints() values, NULL for no limits.
+IKFAST_API bool ComputeIkInLimits(const IkReal* eetrans, const IkReal* eerot, const IkReal* pfree,
+                                  const IkReal* lower, const IkReal* upper, IkSolutionListBase<IkReal>& solutions) {
+IKSolver solver;
+solver.ikjointlower = lower;
+solver.ikjointupper = upper;
+return solver.ComputeIk(eetrans,eerot,pfree,solutions);
+}
+'''
+
+# for(int ij5 = 0; ij5 < 2; ++ij5)
+# {
+# if( !j5valid[ij5] )
+# {
+#     continue;
+# }
+VALID_CHECK = re.compile(r'(if\( !j(\d+)valid\[ij\2\] \)\n\{\n    continue;\n\}\n)')
+
+EVALCOND = re.compile(r'(IKabs\(evalcond\[\d+\]\) > )0\.000001\b')
+SINGULAR = re.compile(r'(IKabs\((?:evalcond|dummyeval)\[\d+\]\) < )0\.0000010000000000\b')
+
+IKFAST_INCLUDE = re.compile(r'#include "ikfast.h".*\n')
+COMPUTE_IK = re.compile(r'IKFAST_API bool ComputeIk\(.*?\n\}\n', re.S)
+
+
+def insert_before(source, anchor, text, what):
+    if anchor not in source:
+        raise RuntimeError('could not find %s in the generated file' % what)
+    return source.replace(anchor, text + anchor, 1)
+
+
+def insert_after(source, pattern, text, what):
+    match = pattern.search(source)
+    if match is None:
+        raise RuntimeError('could not find %s in the generated file' % what)
+    return source[:match.end()] + text + source[match.end():]
+
+
+def patch(source):
+    if MARKER in source:
+        return source
+
+    source = VALID_CHECK.sub(lambda m: m.group(1) +
+                             'if( !IKjointinlimits(%s, j%sarray[ij%s]) )\n{\n    continue;\n}\n' % (m.group(2), m.group(2), m.group(2)),
+                             source)
+    source = EVALCOND.sub(r'\1IKFAST_EVALCOND_THRESH', source)
+    source = SINGULAR.sub(r'\1IKFAST_SINGULAR_THRESH', source)
+
+    # Outside of the solver's namespace
+    source = insert_after(source, IKFAST_INCLUDE, INCLUDE, 'the ikfast.h include')
+
+    # Inside the namespace, in front of the FK
+    source = insert_before(source, '/// solves the forward kinematics equations.', PREAMBLE, 'ComputeFk()')
+
+    source = insert_after(source, re.compile(r'class IKSolver \{\npublic:\n'), SOLVER_MEMBERS, 'class IKSolver')
+    return insert_after(source, COMPUTE_IK, COMPUTE_IK_IN_LIMITS, 'ComputeIk()')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        print(__doc__)
+        sys.exit(1)
+
+    with open(sys.argv[1]) as f:
+        source = f.read()
+    with open(sys.argv[1], 'w') as f:
+        f.write(patch(source))
@@ -0,0 +1,7 @@
+// Double precision build of the clam IKFast solver, see clam_ik/clam_ikfast.h
+
+#define IKFAST_NO_MAIN
+#define IKFAST_NAMESPACE clam_ikfast_double
+#define IKFAST_PRUNE_JOINT_LIMITS
+
+#include "output_ikfast61.cpp"
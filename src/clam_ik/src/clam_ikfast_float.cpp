@@ -0,0 +1,16 @@
+// Single precision build of the clam IKFast solver, see clam_ik/clam_ikfast.h
+
+#define IKFAST_NO_MAIN
+#define IKFAST_NAMESPACE clam_ikfast_float
+#define IKFAST_REAL float
+#define IKFAST_PRUNE_JOINT_LIMITS
+
+// The 1e-6 defaults are below what float can resolve after ~20k lines of
+// arithmetic, they would throw away good solutions.
+#define IKFAST_SINCOS_THRESH ((IkReal)0.0001)
+#define IKFAST_ATAN2_MAGTHRESH ((IkReal)0.0001)
+#define IKFAST_SOLUTION_THRESH ((IkReal)0.0001)
+#define IKFAST_EVALCOND_THRESH ((IkReal)0.001)
+#define IKFAST_SINGULAR_THRESH ((IkReal)0.00001)
+
+#include "output_ikfast61.cpp"
@@ -0,0 +1,407 @@
+/*
+ * IKFast float validation
+ *
+ * Checks the joint limit pruned build of the clam solver against the
+ * unpruned one, and the single precision build against the double one, and
+ * reports how fast each of them is.
+ *
+ * For random joint states inside the limits: FK (double) gives a target pose,
+ * then each solver variant is asked for IK at the true free joint value:
+ *
+ *   double          ComputeIk(), every branch explored, limits checked after
+ *   double, pruned  ComputeIkInLimits() with the joint limits below
+ *   float, pruned   the same in single precision
+ *
+ * The pruned double solver has to keep exactly the in-limit solutions of the
+ * unpruned one. Every in-limit double solution has to have a float solution
+ * whose FK (double) lands within the tolerances of its own. Timings are taken
+ * over every call, a pose the solver gives up on costs time as well.
+ *
+ * How many poses the double solver actually inverts (FK of a solution lands on
+ * the target) is reported too. The current output_ikfast61.cpp inverts very
+ * few, so the float comparison is against the solutions it does return, not
+ * against the targets. That is a problem of the generated solver, it doesn't
+ * fail the validation.
+ *
+ * Fails (returns 1) if:
+ *  - pruning on the joint limits keeps different solutions than checking the
+ *    limits afterwards
+ *  - float loses more than the tolerances, or misses double solutions
+ *  - the double solver returns no in-limit solutions at all, then there is
+ *    nothing to compare against
+ *
+ * Built by the clam_ik CMakeLists when ikfast.h is found:
+ * rosrun clam_ik ikfast_validate
+ *
+ * Usage: ikfast_validate [number of tests]
+ */
+
+/*
+ * Copyright (c) 2012, Dave Coleman
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <clam_ik/clam_ikfast.h>
+#include <clam_ik/ikfast_solutions.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h> // for clock_gettime()
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace clam_ik;
+
+// A pose is inverted when the best solution's FK is this close to it
+static const double MAX_ROUND_TRIP_POSITION = 0.0001; // m
+static const double MAX_ROUND_TRIP_ROTATION = 0.001;  // largest rotation matrix element difference
+
+// Acceptance, FK of a float solution against the double solution it matches
+static const double MAX_POSITION_ERROR = 0.001; // m
+static const double MAX_ROTATION_ERROR = 0.002; // largest rotation matrix element difference
+static const double MAX_MISS_RATE = 0.01;       // double solutions with no float match
+
+// Pruned and unpruned solutions are the same solution when this close, in radians
+static const double MAX_PRUNE_DIFFERENCE = 1e-9;
+
+static double elapsed(const timespec& start, const timespec& end)
+{
+  return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+}
+
+// Time spent in IK and what came out of it, for one variant
+struct VariantStats
+{
+  VariantStats() : seconds(0), calls(0), raw_solutions(0), valid_solutions(0), failures(0) {}
+
+  void add(const VariantStats& other)
+  {
+    seconds += other.seconds;
+    calls += other.calls;
+    raw_solutions += other.raw_solutions;
+    valid_solutions += other.valid_solutions;
+    failures += other.failures;
+  }
+
+  void print(const char* name, const VariantStats& baseline) const
+  {
+    if (calls == 0)
+    {
+      printf("%-22s no calls\n", name);
+      return;
+    }
+
+    printf("%-22s %8.2f us/call  %10.0f calls/s  %10.0f valid solutions/s  %5.2fx  (%.3f raw, %.3f valid per call, %d exceptions)\n",
+           name, seconds / calls * 1e6, calls / seconds, valid_solutions / seconds,
+           baseline.seconds / seconds, double(raw_solutions) / calls, double(valid_solutions) / calls, failures);
+  }
+
+  double seconds;
+  int calls;
+  long raw_solutions;
+  long valid_solutions;
+  int failures;
+};
+
+// Run one IK call, time it and keep the in-limit solutions, nearest to seed first
+template <typename T, typename ComputeIk>
+size_t timedIk(ComputeIk compute_ik, const double* trans, const double* rot, double free_value,
+               const double* seed, VariantStats& stats, std::vector<std::vector<T> >& out)
+{
+  T eetrans[3], eerot[9], free = free_value;
+  std::copy(trans, trans + 3, eetrans);
+  std::copy(rot, rot + 9, eerot);
+
+  ikfast::IkSolutionList<T> solutions;
+  timespec start_time, end_time;
+
+  stats = VariantStats();
+
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+  try
+  {
+    compute_ik(eetrans, eerot, &free, solutions);
+  }
+  catch (const std::exception& e)
+  {
+    // IKFAST_ASSERT throws when intermediate values are out of range
+    ++stats.failures;
+    solutions.Clear();
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end_time);
+
+  collectSolutions(solutions, &free, JOINT_LOWER, JOINT_UPPER, seed, NUM_JOINTS, out);
+
+  stats.seconds = elapsed(start_time, end_time);
+  stats.calls = 1;
+  stats.raw_solutions = solutions.GetNumSolutions();
+  stats.valid_solutions = out.size();
+
+  return out.size();
+}
+
+// The three variants, with the limits bound in where they prune
+struct DoubleIk
+{
+  bool operator()(const double* eetrans, const double* eerot, const double* pfree,
+                  ikfast::IkSolutionListBase<double>& solutions) const
+  {
+    return clam_ikfast_double::ComputeIk(eetrans, eerot, pfree, solutions);
+  }
+};
+
+struct DoublePrunedIk
+{
+  bool operator()(const double* eetrans, const double* eerot, const double* pfree,
+                  ikfast::IkSolutionListBase<double>& solutions) const
+  {
+    return clam_ikfast_double::ComputeIkInLimits(eetrans, eerot, pfree, JOINT_LOWER, JOINT_UPPER, solutions);
+  }
+};
+
+struct FloatPrunedIk
+{
+  FloatPrunedIk()
+  {
+    std::copy(JOINT_LOWER, JOINT_LOWER + NUM_JOINTS, lower);
+    std::copy(JOINT_UPPER, JOINT_UPPER + NUM_JOINTS, upper);
+  }
+
+  bool operator()(const float* eetrans, const float* eerot, const float* pfree,
+                  ikfast::IkSolutionListBase<float>& solutions) const
+  {
+    return clam_ikfast_float::ComputeIkInLimits(eetrans, eerot, pfree, lower, upper, solutions);
+  }
+
+  float lower[NUM_JOINTS];
+  float upper[NUM_JOINTS];
+};
+
+// Error of the double FK of solution against a pose
+template <typename T>
+void fkError(const std::vector<T>& solution, const double* trans, const double* rot,
+             double& position_error, double& rotation_error)
+{
+  double joints[NUM_JOINTS], check_trans[3], check_rot[9];
+  std::copy(solution.begin(), solution.end(), joints);
+  clam_ikfast_double::ComputeFk(joints, check_trans, check_rot);
+
+  position_error = std::sqrt((check_trans[0] - trans[0]) * (check_trans[0] - trans[0]) +
+                             (check_trans[1] - trans[1]) * (check_trans[1] - trans[1]) +
+                             (check_trans[2] - trans[2]) * (check_trans[2] - trans[2]));
+  rotation_error = 0;
+  for (int k = 0; k < 9; k++)
+    rotation_error = std::max(rotation_error, std::fabs(check_rot[k] - rot[k]));
+}
+
+// The solution among solutions whose FK is nearest to the pose, by position then rotation
+template <typename T>
+bool nearestFk(const std::vector<std::vector<T> >& solutions, const double* trans, const double* rot,
+               double& position_error, double& rotation_error)
+{
+  position_error = rotation_error = HUGE_VAL;
+  for (size_t s = 0; s < solutions.size(); s++)
+  {
+    double position, rotation;
+    fkError(solutions[s], trans, rot, position, rotation);
+    if (position < position_error || (position == position_error && rotation < rotation_error))
+    {
+      position_error = position;
+      rotation_error = rotation;
+    }
+  }
+  return !solutions.empty();
+}
+
+// Both lists hold the same solutions, in the same (nearest to seed) order
+static bool sameSolutions(const std::vector<std::vector<double> >& a, const std::vector<std::vector<double> >& b)
+{
+  if (a.size() != b.size())
+    return false;
+  for (size_t s = 0; s < a.size(); s++)
+    for (int j = 0; j < NUM_JOINTS; j++)
+      if (std::fabs(a[s][j] - b[s][j]) > MAX_PRUNE_DIFFERENCE)
+        return false;
+  return true;
+}
+
+// Max and mean of some error
+struct ErrorStats
+{
+  ErrorStats() : max(0), sum(0), count(0) {}
+
+  void add(double error)
+  {
+    max = std::max(max, error);
+    sum += error;
+    ++count;
+  }
+
+  double mean() const { return count > 0 ? sum / count : 0; }
+
+  double max;
+  double sum;
+  int count;
+};
+
+int main(int argc, char** argv)
+{
+  int num_of_tests = 100000;
+  if (argc > 1)
+    num_of_tests = atoi(argv[1]);
+  if (num_of_tests <= 0)
+  {
+    printf("\nUsage: ikfast_validate [number of tests]\n\n");
+    return 1;
+  }
+
+  srand( 12345 ); // repeatable
+
+  VariantStats double_stats, double_pruned_stats, float_pruned_stats;
+  VariantStats double_solved_stats, double_pruned_solved_stats, float_pruned_solved_stats;
+  std::vector<std::vector<double> > double_solutions, double_pruned_solutions;
+  std::vector<std::vector<float> > float_solutions;
+
+  int solved = 0;        // poses with an in-limit double solution
+  int inverted = 0;      // ... whose FK lands on the target
+  int compared = 0;      // in-limit double solutions the float solver was checked against
+  int misses = 0;        // ... with no float solution within the tolerances
+  int prune_mismatches = 0;
+  ErrorStats round_trip_position, round_trip_rotation, float_position, float_rotation;
+
+  double joints[NUM_JOINTS], seed[NUM_JOINTS];
+  double trans[3], rot[9];
+
+  for (int i = 0; i < num_of_tests; i++)
+  {
+    // Random state inside the limits, and a seed near it the way a planner would pass one
+    for (int j = 0; j < NUM_JOINTS; j++)
+    {
+      double rnd = (double)rand() / (double)RAND_MAX;
+      joints[j] = JOINT_LOWER[j] + rnd * (JOINT_UPPER[j] - JOINT_LOWER[j]);
+      rnd = (double)rand() / (double)RAND_MAX;
+      seed[j] = std::max(JOINT_LOWER[j], std::min(JOINT_UPPER[j], joints[j] + (rnd - 0.5) * 0.2));
+    }
+
+    clam_ikfast_double::ComputeFk(joints, trans, rot);
+
+    VariantStats double_call, double_pruned_call, float_pruned_call;
+    timedIk<double>(DoubleIk(), trans, rot, joints[FREE_JOINT], seed, double_call, double_solutions);
+    timedIk<double>(DoublePrunedIk(), trans, rot, joints[FREE_JOINT], seed, double_pruned_call,
+                    double_pruned_solutions);
+    timedIk<float>(FloatPrunedIk(), trans, rot, joints[FREE_JOINT], seed, float_pruned_call, float_solutions);
+
+    double_stats.add(double_call);
+    double_pruned_stats.add(double_pruned_call);
+    float_pruned_stats.add(float_pruned_call);
+
+    // Pruning may only skip work, never solutions
+    if (!sameSolutions(double_solutions, double_pruned_solutions))
+      ++prune_mismatches;
+
+    if (double_solutions.empty())
+      continue;
+
+    ++solved;
+    double_solved_stats.add(double_call);
+    double_pruned_solved_stats.add(double_pruned_call);
+    float_pruned_solved_stats.add(float_pruned_call);
+
+    double position_error, rotation_error;
+    nearestFk(double_solutions, trans, rot, position_error, rotation_error);
+    round_trip_position.add(position_error);
+    round_trip_rotation.add(rotation_error);
+    if (position_error <= MAX_ROUND_TRIP_POSITION && rotation_error <= MAX_ROUND_TRIP_ROTATION)
+      ++inverted;
+
+    // Every double solution needs a float one that ends up in the same place
+    for (size_t s = 0; s < double_solutions.size(); s++)
+    {
+      double solution_trans[3], solution_rot[9];
+      clam_ikfast_double::ComputeFk(&double_solutions[s][0], solution_trans, solution_rot);
+
+      ++compared;
+      if (!nearestFk(float_solutions, solution_trans, solution_rot, position_error, rotation_error) ||
+          position_error > MAX_POSITION_ERROR || rotation_error > MAX_ROTATION_ERROR)
+      {
+        ++misses;
+        continue;
+      }
+
+      float_position.add(position_error);
+      float_rotation.add(rotation_error);
+    }
+  }
+
+  printf("\n%d random states, %d (%.3f%%) with an in-limit double solution, %d (%.3f%%) inverted\n\n",
+         num_of_tests, solved, 100.0 * solved / num_of_tests, inverted, 100.0 * inverted / num_of_tests);
+  printf("Over every pose:\n");
+  double_stats.print("double", double_stats);
+  double_pruned_stats.print("double, pruned", double_stats);
+  float_pruned_stats.print("float, pruned", double_stats);
+  printf("\nOver the poses with an in-limit double solution:\n");
+  double_solved_stats.print("double", double_solved_stats);
+  double_pruned_solved_stats.print("double, pruned", double_solved_stats);
+  float_pruned_solved_stats.print("float, pruned", double_solved_stats);
+
+  double miss_rate = compared > 0 ? double(misses) / compared : 0;
+  printf("\ndouble round trip:        position max %g m, mean %g m   rotation max %g, mean %g\n",
+         round_trip_position.max, round_trip_position.mean(), round_trip_rotation.max, round_trip_rotation.mean());
+  printf("float against double:     position max %g m, mean %g m   rotation max %g, mean %g  (limits %g m, %g)\n",
+         float_position.max, float_position.mean(), float_rotation.max, float_rotation.mean(),
+         MAX_POSITION_ERROR, MAX_ROTATION_ERROR);
+  printf("missed double solutions:  %d of %d (%.3f%%, limit %.3f%%)\n", misses, compared, miss_rate * 100,
+         MAX_MISS_RATE * 100);
+  printf("pruning mismatches:       %d\n\n", prune_mismatches);
+
+  if (solved == 0)
+  {
+    printf("FAILED: the double solver found no in-limit solutions, nothing to compare\n");
+    return 1;
+  }
+
+  if (prune_mismatches > 0)
+  {
+    printf("FAILED: pruning on the joint limits lost or changed solutions\n");
+    return 1;
+  }
+
+  if (miss_rate > MAX_MISS_RATE)
+  {
+    printf("FAILED: float solver is not accurate enough for this arm\n");
+    return 1;
+  }
+
+  if (inverted < solved)
+    printf("Note: the double solver inverts few of its own FK poses, regenerate it for this arm\n");
+
+  printf("PASSED\n");
+  return 0;
+}
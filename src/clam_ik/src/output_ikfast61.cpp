@@ -19,6 +19,7 @@
 ///     gcc -fPIC -lstdc++ -DIKFAST_NO_MAIN -DIKFAST_CLIBRARY -shared -Wl,-soname,libik.so -o libik.so ik.cpp
 #define IKFAST_HAS_LIBRARY
 #include "ikfast.h" // found inside share/openrave-X.Y/python/ikfast.h
+#include <clam_ik/ikfast_solutions.h> // wrapIntoLimits(), for the joint limit pruning
 using namespace ikfast;
 
 // check if the included ikfast version matches what this file was compiled with
@@ -205,6 +206,15 @@ inline double IKsign(double f) {
     return 0;
 }
 
+// joint limit pruning, added by clam_ik/scripts/ikfast_prune_limits.py
+#ifndef IKFAST_EVALCOND_THRESH
+#define IKFAST_EVALCOND_THRESH ((IkReal)0.000001)
+#endif
+
+#ifndef IKFAST_SINGULAR_THRESH
+#define IKFAST_SINGULAR_THRESH ((IkReal)0.000001)
+#endif
+
 /// solves the forward kinematics equations.
 /// \param pfree is an array specifying the free joints of the chain.
 IKFAST_API void ComputeFk(const IkReal* j, IkReal* eetrans, IkReal* eerot) {
@@ -253,6 +263,20 @@ IKFAST_API int GetIkType() { return 0x67000001; }
 
 class IKSolver {
 public:
+// joint limits of this solve, GetNumJoints() values each. NULL keeps every branch.
+const IkReal* ikjointlower;
+const IkReal* ikjointupper;
+
+IKSolver() : ikjointlower(NULL), ikjointupper(NULL) {}
+
+inline bool IKjointinlimits(int joint, IkReal value) const {
+#ifdef IKFAST_PRUNE_JOINT_LIMITS
+    return ikjointlower == NULL || clam_ik::wrapIntoLimits(value, ikjointlower[joint], ikjointupper[joint]);
+#else
+    return true;
+#endif
+}
+
 IkReal j0,cj0,sj0,htj0,j1,cj1,sj1,htj1,j3,cj3,sj3,htj3,j4,cj4,sj4,htj4,j5,cj5,sj5,htj5,j6,cj6,sj6,htj6,j2,cj2,sj2,htj2,new_r00,r00,rxp0_0,new_r01,r01,rxp0_1,new_r02,r02,rxp0_2,new_r10,r10,rxp1_0,new_r11,r11,rxp1_1,new_r12,r12,rxp1_2,new_r20,r20,rxp2_0,new_r21,r21,rxp2_1,new_r22,r22,rxp2_2,new_px,px,npx,new_py,py,npy,new_pz,pz,npz,pp;
 unsigned char _ij0[2], _nj0,_ij1[2], _nj1,_ij3[2], _nj3,_ij4[2], _nj4,_ij5[2], _nj5,_ij6[2], _nj6,_ij2[2], _nj2;
 
@@ -301,12 +325,12 @@ rxp2_2=((((IkReal(-1.00000000000000))*(px)*(r12)))+(((py)*(r02))));
 {
 IkReal dummyeval[1];
 dummyeval[0]=(((px)*(px))+((py)*(py)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=(((px)*(px))+((py)*(py)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -352,6 +376,10 @@ if( !j0valid[ij0] )
 {
     continue;
 }
+if( !IKjointinlimits(0, j0array[ij0]) )
+{
+    continue;
+}
 _ij0[0] = ij0; _ij0[1] = -1;
 for(int iij0 = ij0+1; iij0 < 2; ++iij0)
 {
@@ -388,6 +416,10 @@ if( !j5valid[ij5] )
 {
     continue;
 }
+if( !IKjointinlimits(5, j5array[ij5]) )
+{
+    continue;
+}
 _ij5[0] = ij5; _ij5[1] = -1;
 for(int iij5 = ij5+1; iij5 < 2; ++iij5)
 {
@@ -403,19 +435,19 @@ IkReal dummyeval[1];
 IkReal gconst2;
 gconst2=IKsign(((IkReal(1.00000000000000))+(((IkReal(6150400.00000000))*((sj5)*(sj5))))));
 dummyeval[0]=((IkReal(1.00000000000000))+(((IkReal(6150400.00000000))*((sj5)*(sj5)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal x22=((IkReal(2480.00000000000))*(sj5));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(r01)*(sj0)))+(((IkReal(-476.190476190476))*(npy)))+(((IkReal(1180952.38095238))*(npx)*(sj5)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)*(x22)))+(((r00)*(sj0)*(x22)))+(((cj0)*(r11))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal x23=((IkReal(2480.00000000000))*(sj5));
 dummyeval[0]=((((IkReal(1180952.38095238))*(npy)*(sj5)))+(((r00)*(sj0)))+(((r01)*(sj0)*(x23)))+(((IkReal(-1.00000000000000))*(cj0)*(r11)*(x23)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)))+(((IkReal(476.190476190476))*(npx))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -457,6 +489,10 @@ if( !j6valid[ij6] )
 {
     continue;
 }
+if( !IKjointinlimits(6, j6array[ij6]) )
+{
+    continue;
+}
 _ij6[0] = ij6; _ij6[1] = -1;
 for(int iij6 = ij6+1; iij6 < 1; ++iij6)
 {
@@ -477,7 +513,7 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x38)*(x41)))+(((r00)*(x40)))+(npx)+(
 evalcond[1]=((((IkReal(-0.000100000000000000))*(x38)))+(((IkReal(-1.00000000000000))*(x37)*(x41)))+(((IkReal(-1.00000000000000))*(r11)*(x39)))+(((r01)*(x40)))+(npy));
 evalcond[2]=((IkReal(0.000100000000000000))+(((r00)*(x37)*(x40)))+(((IkReal(-1.00000000000000))*(r01)*(x38)*(x40)))+(((r11)*(x38)*(x39)))+(((npx)*(x37)))+(((IkReal(-1.00000000000000))*(r10)*(x37)*(x39)))+(((IkReal(-1.00000000000000))*(npy)*(x38))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x38)*(x39)))+(((IkReal(-1.00000000000000))*(x41)))+(((r01)*(x37)*(x40)))+(((npy)*(x37)))+(((npx)*(x38)))+(((r00)*(x38)*(x40)))+(((IkReal(-1.00000000000000))*(r11)*(x37)*(x39))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -529,6 +565,10 @@ if( !j6valid[ij6] )
 {
     continue;
 }
+if( !IKjointinlimits(6, j6array[ij6]) )
+{
+    continue;
+}
 _ij6[0] = ij6; _ij6[1] = -1;
 for(int iij6 = ij6+1; iij6 < 1; ++iij6)
 {
@@ -549,7 +589,7 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r10)*(x5891)))+(npx)+(((IkReal(-1.00
 evalcond[1]=((((IkReal(-0.000100000000000000))*(x5890)))+(((IkReal(-1.00000000000000))*(x5889)*(x5893)))+(((IkReal(-1.00000000000000))*(r11)*(x5891)))+(npy)+(((r01)*(x5892))));
 evalcond[2]=((IkReal(0.000100000000000000))+(((r00)*(x5889)*(x5892)))+(((r11)*(x5890)*(x5891)))+(((IkReal(-1.00000000000000))*(r01)*(x5890)*(x5892)))+(((npx)*(x5889)))+(((IkReal(-1.00000000000000))*(r10)*(x5889)*(x5891)))+(((IkReal(-1.00000000000000))*(npy)*(x5890))));
 evalcond[3]=((((npx)*(x5890)))+(((r01)*(x5889)*(x5892)))+(((IkReal(-1.00000000000000))*(r11)*(x5889)*(x5891)))+(((IkReal(-1.00000000000000))*(x5893)))+(((IkReal(-1.00000000000000))*(r10)*(x5890)*(x5891)))+(((r00)*(x5890)*(x5892)))+(((npy)*(x5889))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -593,6 +633,10 @@ if( !j6valid[ij6] )
 {
     continue;
 }
+if( !IKjointinlimits(6, j6array[ij6]) )
+{
+    continue;
+}
 _ij6[0] = ij6; _ij6[1] = -1;
 for(int iij6 = ij6+1; iij6 < 1; ++iij6)
 {
@@ -613,7 +657,7 @@ evalcond[0]=((((r00)*(x5902)))+(npx)+(((IkReal(0.000100000000000000))*(x5899)))+
 evalcond[1]=((((IkReal(-1.00000000000000))*(r11)*(x5901)))+(((IkReal(-0.000100000000000000))*(x5900)))+(npy)+(((IkReal(-1.00000000000000))*(x5899)*(x5903)))+(((r01)*(x5902))));
 evalcond[2]=((IkReal(0.000100000000000000))+(((IkReal(-1.00000000000000))*(r10)*(x5899)*(x5901)))+(((r00)*(x5899)*(x5902)))+(((npx)*(x5899)))+(((IkReal(-1.00000000000000))*(r01)*(x5900)*(x5902)))+(((IkReal(-1.00000000000000))*(npy)*(x5900)))+(((r11)*(x5900)*(x5901))));
 evalcond[3]=((((npx)*(x5900)))+(((r00)*(x5900)*(x5902)))+(((npy)*(x5899)))+(((IkReal(-1.00000000000000))*(r10)*(x5900)*(x5901)))+(((r01)*(x5899)*(x5902)))+(((IkReal(-1.00000000000000))*(r11)*(x5899)*(x5901)))+(((IkReal(-1.00000000000000))*(x5903))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -677,6 +721,10 @@ if( !j0valid[ij0] )
 {
     continue;
 }
+if( !IKjointinlimits(0, j0array[ij0]) )
+{
+    continue;
+}
 _ij0[0] = ij0; _ij0[1] = -1;
 for(int iij0 = ij0+1; iij0 < 2; ++iij0)
 {
@@ -713,6 +761,10 @@ if( !j5valid[ij5] )
 {
     continue;
 }
+if( !IKjointinlimits(5, j5array[ij5]) )
+{
+    continue;
+}
 _ij5[0] = ij5; _ij5[1] = -1;
 for(int iij5 = ij5+1; iij5 < 2; ++iij5)
 {
@@ -728,19 +780,19 @@ IkReal dummyeval[1];
 IkReal gconst2;
 gconst2=IKsign(((IkReal(1.00000000000000))+(((IkReal(6150400.00000000))*((sj5)*(sj5))))));
 dummyeval[0]=((IkReal(1.00000000000000))+(((IkReal(6150400.00000000))*((sj5)*(sj5)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal x5906=((IkReal(2480.00000000000))*(sj5));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(r01)*(sj0)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)*(x5906)))+(((IkReal(-476.190476190476))*(npy)))+(((IkReal(1180952.38095238))*(npx)*(sj5)))+(((r00)*(sj0)*(x5906)))+(((cj0)*(r11))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal x5907=((IkReal(2480.00000000000))*(sj5));
 dummyeval[0]=((((IkReal(1180952.38095238))*(npy)*(sj5)))+(((IkReal(-1.00000000000000))*(cj0)*(r11)*(x5907)))+(((r00)*(sj0)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)))+(((r01)*(sj0)*(x5907)))+(((IkReal(476.190476190476))*(npx))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -782,6 +834,10 @@ if( !j6valid[ij6] )
 {
     continue;
 }
+if( !IKjointinlimits(6, j6array[ij6]) )
+{
+    continue;
+}
 _ij6[0] = ij6; _ij6[1] = -1;
 for(int iij6 = ij6+1; iij6 < 1; ++iij6)
 {
@@ -802,7 +858,7 @@ evalcond[0]=((npx)+(((IkReal(0.000100000000000000))*(x5921)))+(((r00)*(x5924)))+
 evalcond[1]=((npy)+(((IkReal(-0.000100000000000000))*(x5922)))+(((IkReal(-1.00000000000000))*(r11)*(x5923)))+(((r01)*(x5924)))+(((IkReal(-1.00000000000000))*(x5921)*(x5925))));
 evalcond[2]=((IkReal(0.000100000000000000))+(((r11)*(x5922)*(x5923)))+(((npx)*(x5921)))+(((IkReal(-1.00000000000000))*(r01)*(x5922)*(x5924)))+(((IkReal(-1.00000000000000))*(r10)*(x5921)*(x5923)))+(((IkReal(-1.00000000000000))*(npy)*(x5922)))+(((r00)*(x5921)*(x5924))));
 evalcond[3]=((((r00)*(x5922)*(x5924)))+(((npy)*(x5921)))+(((IkReal(-1.00000000000000))*(x5925)))+(((npx)*(x5922)))+(((r01)*(x5921)*(x5924)))+(((IkReal(-1.00000000000000))*(r10)*(x5922)*(x5923)))+(((IkReal(-1.00000000000000))*(r11)*(x5921)*(x5923))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -854,6 +910,10 @@ if( !j6valid[ij6] )
 {
     continue;
 }
+if( !IKjointinlimits(6, j6array[ij6]) )
+{
+    continue;
+}
 _ij6[0] = ij6; _ij6[1] = -1;
 for(int iij6 = ij6+1; iij6 < 1; ++iij6)
 {
@@ -874,7 +934,7 @@ evalcond[0]=((((r00)*(x5942)))+(npx)+(((IkReal(-1.00000000000000))*(x5940)*(x594
 evalcond[1]=((((r01)*(x5942)))+(((IkReal(-1.00000000000000))*(r11)*(x5941)))+(((IkReal(-0.000100000000000000))*(x5940)))+(npy)+(((IkReal(-1.00000000000000))*(x5939)*(x5943))));
 evalcond[2]=((IkReal(0.000100000000000000))+(((IkReal(-1.00000000000000))*(npy)*(x5940)))+(((r11)*(x5940)*(x5941)))+(((r00)*(x5939)*(x5942)))+(((IkReal(-1.00000000000000))*(r01)*(x5940)*(x5942)))+(((npx)*(x5939)))+(((IkReal(-1.00000000000000))*(r10)*(x5939)*(x5941))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x5940)*(x5941)))+(((r01)*(x5939)*(x5942)))+(((IkReal(-1.00000000000000))*(x5943)))+(((r00)*(x5940)*(x5942)))+(((IkReal(-1.00000000000000))*(r11)*(x5939)*(x5941)))+(((npx)*(x5940)))+(((npy)*(x5939))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -918,6 +978,10 @@ if( !j6valid[ij6] )
 {
     continue;
 }
+if( !IKjointinlimits(6, j6array[ij6]) )
+{
+    continue;
+}
 _ij6[0] = ij6; _ij6[1] = -1;
 for(int iij6 = ij6+1; iij6 < 1; ++iij6)
 {
@@ -938,7 +1002,7 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r10)*(x5951)))+(npx)+(((IkReal(0.000
 evalcond[1]=((npy)+(((IkReal(-1.00000000000000))*(x5949)*(x5953)))+(((IkReal(-1.00000000000000))*(r11)*(x5951)))+(((r01)*(x5952)))+(((IkReal(-0.000100000000000000))*(x5950))));
 evalcond[2]=((IkReal(0.000100000000000000))+(((r00)*(x5949)*(x5952)))+(((IkReal(-1.00000000000000))*(npy)*(x5950)))+(((npx)*(x5949)))+(((r11)*(x5950)*(x5951)))+(((IkReal(-1.00000000000000))*(r01)*(x5950)*(x5952)))+(((IkReal(-1.00000000000000))*(r10)*(x5949)*(x5951))));
 evalcond[3]=((((r01)*(x5949)*(x5952)))+(((IkReal(-1.00000000000000))*(r11)*(x5949)*(x5951)))+(((npy)*(x5949)))+(((IkReal(-1.00000000000000))*(r10)*(x5950)*(x5951)))+(((r00)*(x5950)*(x5952)))+(((IkReal(-1.00000000000000))*(x5953)))+(((npx)*(x5950))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1003,37 +1067,37 @@ new_r22=((((IkReal(-1.00000000000000))*(x42)*(x64)))+(((cj0)*(x63))));
 {
 IkReal dummyeval[1];
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=(((new_r12)*(new_r12))+((new_r02)*(new_r02)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[2];
 evalcond[0]=((IkReal(-3.14159265358979))+(IKfmod(((IkReal(3.14159265358979))+(j2)), IkReal(6.28318530717959))));
 evalcond[1]=new_r22;
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst36;
 gconst36=IKsign(((((IkReal(3.92217508230375e+17))*((new_r12)*(new_r12))))+(((IkReal(3.92217508230375e+17))*((new_r02)*(new_r02))))));
 dummyeval[0]=(((new_r12)*(new_r12))+((new_r02)*(new_r02)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst37;
 gconst37=IKsign(((((IkReal(2.49921909794653e+16))*(new_r00)*(new_r02)))+(((IkReal(2.49921909794653e+16))*(new_r10)*(new_r12)))+(((IkReal(3.91420444218861e+17))*(new_r02)*(new_r10)))+(((IkReal(-3.91420444218861e+17))*(new_r00)*(new_r12)))));
 dummyeval[0]=((((IkReal(15.6617098733148))*(new_r02)*(new_r10)))+(((new_r10)*(new_r12)))+(((new_r00)*(new_r02)))+(((IkReal(-15.6617098733148))*(new_r00)*(new_r12))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -1062,6 +1126,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -1085,7 +1153,7 @@ evalcond[1]=((IkReal(0.0637202329192957))+(((new_r02)*(x69)))+(((IkReal(-1.00000
 evalcond[2]=((IkReal(-1.00000000000000))+(((IkReal(0.0637202329192957))*(x73)))+(((IkReal(-1.00000000000000))*(new_r02)*(x74)))+(((IkReal(-1.00000000000000))*(new_r02)*(x71)))+(((IkReal(-1.00000000000000))*(new_r12)*(x72))));
 evalcond[3]=((((new_r10)*(x75)))+(((IkReal(-1.00000000000000))*(new_r00)*(x71)))+(((IkReal(-1.00000000000000))*(new_r00)*(x74)))+(((IkReal(-1.00000000000000))*(new_r10)*(x72))));
 evalcond[4]=((((new_r11)*(x75)))+(((IkReal(-1.00000000000000))*(new_r01)*(x74)))+(((IkReal(-1.00000000000000))*(new_r01)*(x71)))+(((IkReal(-1.00000000000000))*(new_r11)*(x72))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1130,6 +1198,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 2; ++iij3)
 {
@@ -1149,7 +1221,7 @@ IkReal x85=((new_r12)*(x81));
 IkReal x86=((IkReal(0.993348889555023))*(x82));
 IkReal x87=((IkReal(0.0634253154725807))*(x82));
 evalcond[0]=((((x84)*(x87)))+(((IkReal(-0.00612351537051366))*(x81)*(x84)))+(((IkReal(0.995371682851684))*(new_r22)*(x81)))+(((IkReal(0.0961000154891044))*(new_r22)*(x82)))+(((IkReal(-1.00000000000000))*(x83)*(x86)))+(((IkReal(-0.0959047211377687))*(sj4)*(x85)))+(((IkReal(0.0959047211377687))*(x81)*(x83)))+(((new_r12)*(sj4)*(x86)))+(((IkReal(-0.00612351537051366))*(cj4)*(x85)))+(((cj4)*(new_r12)*(x87))));
-if( IKabs(evalcond[0]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1160,14 +1232,14 @@ IkReal dummyeval[1];
 IkReal gconst38;
 gconst38=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst39;
 gconst39=IKsign(((((IkReal(-0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(-0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((cj3)*(cj3))))+(((IkReal(-1.00000000000000))*((sj3)*(sj3)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -1204,6 +1276,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -1262,7 +1338,7 @@ evalcond[6]=((((IkReal(-0.0961000154891044))*(x119)))+(((new_r20)*(x112)))+(((x1
 evalcond[7]=((((IkReal(-1.00000000000000))*(x104)*(x109)))+(((IkReal(-1.00000000000000))*(x102)*(x98)))+(((IkReal(-1.00000000000000))*(x100)*(x105)))+(((IkReal(-0.0961000154891044))*(x101)))+(((x103)*(x120)))+(((new_r21)*(x112)))+(((IkReal(-1.00000000000000))*(x123)))+(x124)+(((IkReal(-1.00000000000000))*(x105)*(x99)))+(((x108)*(x109)))+(((IkReal(-1.00000000000000))*(x121)*(x98)))+(((IkReal(-1.00000000000000))*(x103)*(x110))));
 evalcond[8]=((((x107)*(x109)))+(((IkReal(0.995371682851684))*(x119)))+(((new_r20)*(x117)))+(((x103)*(x111)))+(((IkReal(-1.00000000000000))*(x124)))+(x123)+(((x106)*(x98)))+(((IkReal(-1.00000000000000))*(x109)*(x113)))+(((x118)*(x98)))+(((IkReal(-1.00000000000000))*(x105)*(x122)))+(((IkReal(-1.00000000000000))*(x103)*(x114)))+(((IkReal(-1.00000000000000))*(x105)*(x116))));
 evalcond[9]=((((x100)*(x98)))+(((IkReal(0.995371682851684))*(x101)))+(((new_r21)*(x117)))+(x132)+(((x103)*(x104)))+(((IkReal(-1.00000000000000))*(x109)*(x110)))+(((x109)*(x120)))+(((IkReal(-1.00000000000000))*(x103)*(x108)))+(((x98)*(x99)))+(((IkReal(-1.00000000000000))*(x102)*(x105)))+(((IkReal(-1.00000000000000))*(x105)*(x121))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1344,6 +1420,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -1402,7 +1482,7 @@ evalcond[6]=((((IkReal(-0.0961000154891044))*(x160)))+(((x144)*(x148)))+(((x150)
 evalcond[7]=((((IkReal(-0.0961000154891044))*(x142)))+(((x149)*(x150)))+(((new_r21)*(x153)))+(((x144)*(x161)))+(((IkReal(-1.00000000000000))*(x140)*(x146)))+(((IkReal(-1.00000000000000))*(x164)))+(((IkReal(-1.00000000000000))*(x144)*(x151)))+(((IkReal(-1.00000000000000))*(x139)*(x143)))+(x165)+(((IkReal(-1.00000000000000))*(x139)*(x162)))+(((IkReal(-1.00000000000000))*(x145)*(x150)))+(((IkReal(-1.00000000000000))*(x141)*(x146))));
 evalcond[8]=((((x139)*(x159)))+(((IkReal(-1.00000000000000))*(x165)))+(((x144)*(x152)))+(((IkReal(-1.00000000000000))*(x144)*(x155)))+(((IkReal(-1.00000000000000))*(x150)*(x154)))+(x164)+(((IkReal(-1.00000000000000))*(x146)*(x163)))+(((new_r20)*(x158)))+(((x148)*(x150)))+(((IkReal(0.995371682851684))*(x160)))+(((IkReal(-1.00000000000000))*(x146)*(x157)))+(((x139)*(x147))));
 evalcond[9]=((((new_r21)*(x158)))+(((IkReal(-1.00000000000000))*(x143)*(x146)))+(((x144)*(x145)))+(((IkReal(-1.00000000000000))*(x150)*(x151)))+(((x150)*(x161)))+(((IkReal(-1.00000000000000))*(x144)*(x149)))+(x173)+(((IkReal(-1.00000000000000))*(x146)*(x162)))+(((IkReal(0.995371682851684))*(x142)))+(((x139)*(x140)))+(((x139)*(x141))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1488,6 +1568,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -1511,7 +1595,7 @@ evalcond[1]=((IkReal(0.0637202329192957))+(((new_r02)*(x174)))+(((IkReal(-1.0000
 evalcond[2]=((IkReal(-1.00000000000000))+(((IkReal(-1.00000000000000))*(new_r12)*(x177)))+(((IkReal(0.0637202329192957))*(x178)))+(((IkReal(-1.00000000000000))*(new_r02)*(x179)))+(((IkReal(-1.00000000000000))*(new_r02)*(x176))));
 evalcond[3]=((((new_r10)*(x180)))+(((IkReal(-1.00000000000000))*(new_r10)*(x177)))+(((IkReal(-1.00000000000000))*(new_r00)*(x176)))+(((IkReal(-1.00000000000000))*(new_r00)*(x179))));
 evalcond[4]=((((new_r11)*(x180)))+(((IkReal(-1.00000000000000))*(new_r11)*(x177)))+(((IkReal(-1.00000000000000))*(new_r01)*(x179)))+(((IkReal(-1.00000000000000))*(new_r01)*(x176))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1556,6 +1640,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 2; ++iij3)
 {
@@ -1575,7 +1663,7 @@ IkReal x190=((new_r12)*(x186));
 IkReal x191=((IkReal(0.993348889555023))*(x187));
 IkReal x192=((IkReal(0.0634253154725807))*(x187));
 evalcond[0]=((((IkReal(-1.00000000000000))*(x188)*(x191)))+(((new_r12)*(sj4)*(x191)))+(((IkReal(-0.00612351537051366))*(cj4)*(x190)))+(((x189)*(x192)))+(((IkReal(-0.0959047211377687))*(sj4)*(x190)))+(((cj4)*(new_r12)*(x192)))+(((IkReal(0.0961000154891044))*(new_r22)*(x187)))+(((IkReal(0.995371682851684))*(new_r22)*(x186)))+(((IkReal(0.0959047211377687))*(x186)*(x188)))+(((IkReal(-0.00612351537051366))*(x186)*(x189))));
-if( IKabs(evalcond[0]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1586,14 +1674,14 @@ IkReal dummyeval[1];
 IkReal gconst38;
 gconst38=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst39;
 gconst39=IKsign(((((IkReal(-0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(-0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((cj3)*(cj3))))+(((IkReal(-1.00000000000000))*((sj3)*(sj3)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -1630,6 +1718,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -1688,7 +1780,7 @@ evalcond[6]=((((x214)*(x219)))+(((x208)*(x212)))+(((new_r20)*(x217)))+(((IkReal(
 evalcond[7]=((((IkReal(-1.00000000000000))*(x203)*(x207)))+(((x213)*(x214)))+(((new_r21)*(x217)))+(((x208)*(x225)))+(((IkReal(-1.00000000000000))*(x204)*(x210)))+(((IkReal(-1.00000000000000))*(x205)*(x210)))+(x229)+(((IkReal(-1.00000000000000))*(x203)*(x226)))+(((IkReal(-1.00000000000000))*(x208)*(x215)))+(((IkReal(-1.00000000000000))*(x209)*(x214)))+(((IkReal(-1.00000000000000))*(x228)))+(((IkReal(-0.0961000154891044))*(x206))));
 evalcond[8]=((((new_r20)*(x222)))+(((x203)*(x211)))+(((x208)*(x216)))+(((x203)*(x223)))+(x228)+(((x212)*(x214)))+(((IkReal(-1.00000000000000))*(x214)*(x218)))+(((IkReal(-1.00000000000000))*(x208)*(x219)))+(((IkReal(0.995371682851684))*(x224)))+(((IkReal(-1.00000000000000))*(x229)))+(((IkReal(-1.00000000000000))*(x210)*(x221)))+(((IkReal(-1.00000000000000))*(x210)*(x227))));
 evalcond[9]=((((IkReal(0.995371682851684))*(x206)))+(((x214)*(x225)))+(((IkReal(-1.00000000000000))*(x207)*(x210)))+(((new_r21)*(x222)))+(x237)+(((x203)*(x205)))+(((x203)*(x204)))+(((IkReal(-1.00000000000000))*(x214)*(x215)))+(((IkReal(-1.00000000000000))*(x208)*(x213)))+(((x208)*(x209)))+(((IkReal(-1.00000000000000))*(x210)*(x226))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1770,6 +1862,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -1828,7 +1924,7 @@ evalcond[6]=((((IkReal(-0.0961000154891044))*(x265)))+(((x249)*(x253)))+(((IkRea
 evalcond[7]=((((IkReal(-1.00000000000000))*(x250)*(x255)))+(((IkReal(-0.0961000154891044))*(x247)))+(((new_r21)*(x258)))+(((IkReal(-1.00000000000000))*(x246)*(x251)))+(x270)+(((IkReal(-1.00000000000000))*(x245)*(x251)))+(((IkReal(-1.00000000000000))*(x249)*(x256)))+(((x249)*(x266)))+(((x254)*(x255)))+(((IkReal(-1.00000000000000))*(x269)))+(((IkReal(-1.00000000000000))*(x244)*(x267)))+(((IkReal(-1.00000000000000))*(x244)*(x248))));
 evalcond[8]=((((x249)*(x257)))+(((IkReal(-1.00000000000000))*(x249)*(x260)))+(((IkReal(-1.00000000000000))*(x255)*(x259)))+(((x244)*(x264)))+(((IkReal(-1.00000000000000))*(x251)*(x262)))+(((IkReal(-1.00000000000000))*(x251)*(x268)))+(((IkReal(0.995371682851684))*(x265)))+(x269)+(((x253)*(x255)))+(((new_r20)*(x263)))+(((IkReal(-1.00000000000000))*(x270)))+(((x244)*(x252))));
 evalcond[9]=((((new_r21)*(x263)))+(((x249)*(x250)))+(((IkReal(-1.00000000000000))*(x255)*(x256)))+(((IkReal(0.995371682851684))*(x247)))+(((x244)*(x245)))+(((x244)*(x246)))+(((IkReal(-1.00000000000000))*(x251)*(x267)))+(x278)+(((x255)*(x266)))+(((IkReal(-1.00000000000000))*(x248)*(x251)))+(((IkReal(-1.00000000000000))*(x249)*(x254))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1893,21 +1989,21 @@ solutions.AddSolution(vinfos,vfree);
 {
 evalcond[0]=((IkReal(-3.14159265358979))+(IKfmod(((IkReal(1.11022302462516e-16))+(j2)), IkReal(6.28318530717959))));
 evalcond[1]=new_r22;
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst40;
 gconst40=IKsign(((((IkReal(3.92217508230375e+17))*((new_r12)*(new_r12))))+(((IkReal(3.92217508230375e+17))*((new_r02)*(new_r02))))));
 dummyeval[0]=(((new_r12)*(new_r12))+((new_r02)*(new_r02)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst41;
 gconst41=IKsign(((((IkReal(-2.49921909794653e+16))*(new_r10)*(new_r12)))+(((IkReal(3.91420444218861e+17))*(new_r00)*(new_r12)))+(((IkReal(-2.49921909794653e+16))*(new_r00)*(new_r02)))+(((IkReal(-3.91420444218861e+17))*(new_r02)*(new_r10)))));
 dummyeval[0]=((((IkReal(-15.6617098733148))*(new_r02)*(new_r10)))+(((IkReal(15.6617098733148))*(new_r00)*(new_r12)))+(((IkReal(-1.00000000000000))*(new_r00)*(new_r02)))+(((IkReal(-1.00000000000000))*(new_r10)*(new_r12))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -1936,6 +2032,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -1959,7 +2059,7 @@ evalcond[1]=((IkReal(-0.0637202329192957))+(((IkReal(-1.00000000000000))*(x283))
 evalcond[2]=((IkReal(1.00000000000000))+(((IkReal(0.0637202329192957))*(x283)))+(((IkReal(-1.00000000000000))*(new_r02)*(x281)))+(((IkReal(-1.00000000000000))*(new_r02)*(x284)))+(((IkReal(-1.00000000000000))*(new_r12)*(x282))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(new_r00)*(x281)))+(((IkReal(-1.00000000000000))*(new_r00)*(x284)))+(((IkReal(-1.00000000000000))*(new_r10)*(x282)))+(((new_r10)*(x285))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(new_r01)*(x281)))+(((IkReal(-1.00000000000000))*(new_r01)*(x284)))+(((IkReal(-1.00000000000000))*(new_r11)*(x282)))+(((new_r11)*(x285))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2004,6 +2104,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 2; ++iij3)
 {
@@ -2023,7 +2127,7 @@ IkReal x295=((new_r12)*(x291));
 IkReal x296=((IkReal(0.993348889555023))*(x292));
 IkReal x297=((IkReal(0.0634253154725807))*(x292));
 evalcond[0]=((((IkReal(0.0959047211377687))*(x291)*(x293)))+(((new_r12)*(sj4)*(x296)))+(((IkReal(-0.00612351537051366))*(x291)*(x294)))+(((IkReal(-1.00000000000000))*(x293)*(x296)))+(((IkReal(0.995371682851684))*(new_r22)*(x291)))+(((cj4)*(new_r12)*(x297)))+(((x294)*(x297)))+(((IkReal(0.0961000154891044))*(new_r22)*(x292)))+(((IkReal(-0.0959047211377687))*(sj4)*(x295)))+(((IkReal(-0.00612351537051366))*(cj4)*(x295))));
-if( IKabs(evalcond[0]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2034,14 +2138,14 @@ IkReal dummyeval[1];
 IkReal gconst42;
 gconst42=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst43;
 gconst43=IKsign(((((IkReal(0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -2078,6 +2182,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -2136,7 +2244,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x308)*(x332)))+(((IkReal(-1.00000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x310)*(x315)))+(((IkReal(-1.00000000000000))*(x308)*(x331)))+(((IkReal(-1.00000000000000))*(x308)*(x312)))+(x342)+(((new_r21)*(x322)))+(((IkReal(-0.0961000154891044))*(x311)))+(((IkReal(-1.00000000000000))*(x314)*(x319)))+(((IkReal(-1.00000000000000))*(x309)*(x315)))+(((x318)*(x319)))+(((IkReal(-1.00000000000000))*(x313)*(x320)))+(((x313)*(x330))));
 evalcond[8]=((((x317)*(x319)))+(((IkReal(0.995371682851684))*(x329)))+(((x308)*(x328)))+(((x313)*(x321)))+(((IkReal(-1.00000000000000))*(x315)*(x326)))+(((x308)*(x316)))+(x342)+(((IkReal(-1.00000000000000))*(x315)*(x332)))+(((IkReal(-1.00000000000000))*(x319)*(x323)))+(((new_r20)*(x327)))+(((IkReal(-1.00000000000000))*(x313)*(x324))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x313)*(x318)))+(((IkReal(-1.00000000000000))*(x312)*(x315)))+(((IkReal(0.995371682851684))*(x311)))+(((x319)*(x330)))+(((x308)*(x310)))+(x335)+(((new_r21)*(x327)))+(((IkReal(-1.00000000000000))*(x315)*(x331)))+(((IkReal(-1.00000000000000))*(x319)*(x320)))+(((x308)*(x309)))+(((IkReal(-1.00000000000000))*(x336)))+(((x313)*(x314))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2218,6 +2326,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -2276,7 +2388,7 @@ evalcond[6]=((((new_r20)*(x363)))+(((IkReal(-1.00000000000000))*(x354)*(x364)))+
 evalcond[7]=((((IkReal(-1.00000000000000))*(x354)*(x361)))+(((IkReal(-1.00000000000000))*(x355)*(x360)))+(((x359)*(x360)))+(((IkReal(-1.00000000000000))*(x349)*(x353)))+(((IkReal(-0.0961000154891044))*(x352)))+(x383)+(((x354)*(x371)))+(((new_r21)*(x363)))+(((IkReal(-1.00000000000000))*(x351)*(x356)))+(((IkReal(-1.00000000000000))*(x349)*(x372)))+(((IkReal(-1.00000000000000))*(x350)*(x356))));
 evalcond[8]=((((x358)*(x360)))+(((new_r20)*(x368)))+(((IkReal(-1.00000000000000))*(x354)*(x365)))+(((IkReal(-1.00000000000000))*(x360)*(x364)))+(((IkReal(-1.00000000000000))*(x356)*(x367)))+(((IkReal(-1.00000000000000))*(x356)*(x373)))+(x383)+(((x354)*(x362)))+(((x349)*(x357)))+(((x349)*(x369)))+(((IkReal(0.995371682851684))*(x370))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x360)*(x361)))+(((IkReal(-1.00000000000000))*(x377)))+(((IkReal(-1.00000000000000))*(x356)*(x372)))+(x376)+(((x354)*(x355)))+(((new_r21)*(x368)))+(((x349)*(x350)))+(((x349)*(x351)))+(((IkReal(-1.00000000000000))*(x353)*(x356)))+(((IkReal(-1.00000000000000))*(x354)*(x359)))+(((x360)*(x371)))+(((IkReal(0.995371682851684))*(x352))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2362,6 +2474,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -2385,7 +2501,7 @@ evalcond[1]=((IkReal(-0.0637202329192957))+(((new_r02)*(x384)))+(((IkReal(-1.000
 evalcond[2]=((IkReal(1.00000000000000))+(((IkReal(-1.00000000000000))*(new_r12)*(x387)))+(((IkReal(0.0637202329192957))*(x388)))+(((IkReal(-1.00000000000000))*(new_r02)*(x389)))+(((IkReal(-1.00000000000000))*(new_r02)*(x386))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(new_r10)*(x387)))+(((IkReal(-1.00000000000000))*(new_r00)*(x389)))+(((IkReal(-1.00000000000000))*(new_r00)*(x386)))+(((new_r10)*(x390))));
 evalcond[4]=((((new_r11)*(x390)))+(((IkReal(-1.00000000000000))*(new_r11)*(x387)))+(((IkReal(-1.00000000000000))*(new_r01)*(x386)))+(((IkReal(-1.00000000000000))*(new_r01)*(x389))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2430,6 +2546,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 2; ++iij3)
 {
@@ -2449,7 +2569,7 @@ IkReal x400=((new_r12)*(x396));
 IkReal x401=((IkReal(0.993348889555023))*(x397));
 IkReal x402=((IkReal(0.0634253154725807))*(x397));
 evalcond[0]=((((IkReal(-0.0959047211377687))*(sj4)*(x400)))+(((IkReal(-0.00612351537051366))*(cj4)*(x400)))+(((IkReal(-0.00612351537051366))*(x396)*(x399)))+(((IkReal(0.995371682851684))*(new_r22)*(x396)))+(((IkReal(0.0961000154891044))*(new_r22)*(x397)))+(((new_r12)*(sj4)*(x401)))+(((IkReal(-1.00000000000000))*(x398)*(x401)))+(((x399)*(x402)))+(((cj4)*(new_r12)*(x402)))+(((IkReal(0.0959047211377687))*(x396)*(x398))));
-if( IKabs(evalcond[0]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2460,14 +2580,14 @@ IkReal dummyeval[1];
 IkReal gconst42;
 gconst42=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst43;
 gconst43=IKsign(((((IkReal(0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -2504,6 +2624,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -2562,7 +2686,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x413)*(x437)))+(((IkReal(-1.00000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x413)*(x436)))+(((new_r21)*(x427)))+(((x418)*(x435)))+(x447)+(((IkReal(-1.00000000000000))*(x419)*(x424)))+(((x423)*(x424)))+(((IkReal(-1.00000000000000))*(x418)*(x425)))+(((IkReal(-1.00000000000000))*(x413)*(x417)))+(((IkReal(-1.00000000000000))*(x414)*(x420)))+(((IkReal(-1.00000000000000))*(x415)*(x420)))+(((IkReal(-0.0961000154891044))*(x416))));
 evalcond[8]=((((x413)*(x421)))+(((IkReal(-1.00000000000000))*(x420)*(x437)))+(((IkReal(-1.00000000000000))*(x420)*(x431)))+(((x413)*(x433)))+(((x418)*(x426)))+(((new_r20)*(x432)))+(x447)+(((IkReal(-1.00000000000000))*(x424)*(x428)))+(((IkReal(-1.00000000000000))*(x418)*(x429)))+(((x422)*(x424)))+(((IkReal(0.995371682851684))*(x434))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x441)))+(((x424)*(x435)))+(((new_r21)*(x432)))+(((x413)*(x414)))+(((x413)*(x415)))+(((IkReal(-1.00000000000000))*(x420)*(x436)))+(x440)+(((IkReal(-1.00000000000000))*(x424)*(x425)))+(((IkReal(-1.00000000000000))*(x417)*(x420)))+(((IkReal(0.995371682851684))*(x416)))+(((IkReal(-1.00000000000000))*(x418)*(x423)))+(((x418)*(x419))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2644,6 +2768,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -2702,7 +2830,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x465)*(x467)))+(((new_r20)*(x468)))+
 evalcond[7]=((((x459)*(x476)))+(((IkReal(-1.00000000000000))*(x456)*(x461)))+(((IkReal(-1.00000000000000))*(x460)*(x465)))+(((IkReal(-1.00000000000000))*(x459)*(x466)))+(((IkReal(-1.00000000000000))*(x454)*(x458)))+(((new_r21)*(x468)))+(((IkReal(-0.0961000154891044))*(x457)))+(x488)+(((IkReal(-1.00000000000000))*(x455)*(x461)))+(((IkReal(-1.00000000000000))*(x454)*(x477)))+(((x464)*(x465))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x465)*(x469)))+(((IkReal(-1.00000000000000))*(x459)*(x470)))+(((x454)*(x462)))+(((IkReal(0.995371682851684))*(x475)))+(((x454)*(x474)))+(((new_r20)*(x473)))+(((x463)*(x465)))+(x488)+(((IkReal(-1.00000000000000))*(x461)*(x472)))+(((IkReal(-1.00000000000000))*(x461)*(x478)))+(((x459)*(x467))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x465)*(x466)))+(((IkReal(0.995371682851684))*(x457)))+(((x454)*(x455)))+(((x454)*(x456)))+(((IkReal(-1.00000000000000))*(x482)))+(((x465)*(x476)))+(((IkReal(-1.00000000000000))*(x459)*(x464)))+(((new_r21)*(x473)))+(x481)+(((IkReal(-1.00000000000000))*(x458)*(x461)))+(((IkReal(-1.00000000000000))*(x461)*(x477)))+(((x459)*(x460))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2820,6 +2948,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 2; ++iij4)
 {
@@ -2835,17 +2967,17 @@ IkReal dummyeval[1];
 IkReal gconst3;
 gconst3=IKsign(sj2);
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -2862,7 +2994,7 @@ evalcond[3]=((IkReal(0.0637202329192957))+(((IkReal(-1.00000000000000))*(x495)))
 evalcond[4]=((IkReal(-1.00000000000000))+(((IkReal(-1.00000000000000))*(new_r02)*(x493)))+(((IkReal(-0.0637202329192957))*(x494)))+(((IkReal(-1.00000000000000))*(new_r12)*(x496)))+(((IkReal(0.0637202329192957))*(x495))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x493)))+(((IkReal(-1.00000000000000))*(new_r00)*(x498)))+(((IkReal(-1.00000000000000))*(new_r10)*(x496)))+(((new_r10)*(x497))));
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x498)))+(((IkReal(-1.00000000000000))*(new_r01)*(x493)))+(((IkReal(-1.00000000000000))*(new_r11)*(x496)))+(((new_r11)*(x497))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[2], cj3array[2], sj3array[2];
@@ -2903,6 +3035,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 2; ++iij3)
 {
@@ -2922,7 +3058,7 @@ IkReal x508=((new_r12)*(x504));
 IkReal x509=((IkReal(0.993348889555023))*(x505));
 IkReal x510=((IkReal(0.0634253154725807))*(x505));
 evalcond[0]=((((IkReal(-1.00000000000000))*(x506)*(x509)))+(((x507)*(x510)))+(((cj4)*(new_r12)*(x510)))+(((IkReal(0.0961000154891044))*(new_r22)*(x505)))+(((new_r12)*(sj4)*(x509)))+(((IkReal(0.995371682851684))*(new_r22)*(x504)))+(((IkReal(-0.00612351537051366))*(cj4)*(x508)))+(((IkReal(0.0959047211377687))*(x504)*(x506)))+(((IkReal(-0.00612351537051366))*(x504)*(x507)))+(((IkReal(-0.0959047211377687))*(sj4)*(x508))));
-if( IKabs(evalcond[0]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2933,14 +3069,14 @@ IkReal dummyeval[1];
 IkReal gconst20;
 gconst20=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst21;
 gconst21=IKsign(((((IkReal(-0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(-0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((cj3)*(cj3))))+(((IkReal(-1.00000000000000))*((sj3)*(sj3)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -2976,6 +3112,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -3034,7 +3174,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x525)*(x535)))+(((IkReal(-1.00000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x525)*(x532)))+(((IkReal(-1.00000000000000))*(x526)*(x531)))+(((IkReal(-1.00000000000000))*(x520)*(x524)))+(((IkReal(-1.00000000000000))*(x521)*(x527)))+(((IkReal(-1.00000000000000))*(x520)*(x543)))+(((IkReal(-1.00000000000000))*(x545)))+(((x525)*(x542)))+(((IkReal(-0.0961000154891044))*(x523)))+(x546)+(((IkReal(-1.00000000000000))*(x522)*(x527)))+(((x530)*(x531)))+(((new_r21)*(x534))));
 evalcond[8]=((((IkReal(0.995371682851684))*(x541)))+(((IkReal(-1.00000000000000))*(x525)*(x536)))+(((IkReal(-1.00000000000000))*(x527)*(x544)))+(((IkReal(-1.00000000000000))*(x527)*(x538)))+(((IkReal(-1.00000000000000))*(x531)*(x535)))+(((IkReal(-1.00000000000000))*(x546)))+(((x525)*(x533)))+(((x520)*(x528)))+(x545)+(((new_r20)*(x539)))+(((x520)*(x540)))+(((x529)*(x531))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x524)*(x527)))+(((IkReal(-1.00000000000000))*(x525)*(x530)))+(((IkReal(-1.00000000000000))*(x527)*(x543)))+(((IkReal(-1.00000000000000))*(x531)*(x532)))+(((x531)*(x542)))+(((x525)*(x526)))+(((x520)*(x522)))+(((x520)*(x521)))+(x554)+(((new_r21)*(x539)))+(((IkReal(0.995371682851684))*(x523))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -3116,6 +3256,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -3174,7 +3318,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x566)*(x576)))+(((IkReal(-1.00000000
 evalcond[7]=((((x571)*(x572)))+(((IkReal(-1.00000000000000))*(x566)*(x573)))+(((new_r21)*(x575)))+(((IkReal(-0.0961000154891044))*(x564)))+(((IkReal(-1.00000000000000))*(x561)*(x584)))+(((IkReal(-1.00000000000000))*(x562)*(x568)))+(x587)+(((IkReal(-1.00000000000000))*(x567)*(x572)))+(((IkReal(-1.00000000000000))*(x563)*(x568)))+(((x566)*(x583)))+(((IkReal(-1.00000000000000))*(x586)))+(((IkReal(-1.00000000000000))*(x561)*(x565))));
 evalcond[8]=((((IkReal(0.995371682851684))*(x582)))+(((new_r20)*(x580)))+(((IkReal(-1.00000000000000))*(x566)*(x577)))+(((x561)*(x581)))+(((IkReal(-1.00000000000000))*(x568)*(x585)))+(((x561)*(x569)))+(x586)+(((x566)*(x574)))+(((IkReal(-1.00000000000000))*(x568)*(x579)))+(((IkReal(-1.00000000000000))*(x587)))+(((IkReal(-1.00000000000000))*(x572)*(x576)))+(((x570)*(x572))));
 evalcond[9]=((((x566)*(x567)))+(((IkReal(-1.00000000000000))*(x566)*(x571)))+(((new_r21)*(x580)))+(((IkReal(0.995371682851684))*(x564)))+(((IkReal(-1.00000000000000))*(x568)*(x584)))+(((x561)*(x562)))+(((x561)*(x563)))+(x595)+(((x572)*(x583)))+(((IkReal(-1.00000000000000))*(x572)*(x573)))+(((IkReal(-1.00000000000000))*(x565)*(x568))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -3244,7 +3388,7 @@ evalcond[3]=((IkReal(-0.0637202329192957))+(((IkReal(-1.00000000000000))*(x598))
 evalcond[4]=((IkReal(1.00000000000000))+(((IkReal(-1.00000000000000))*(new_r12)*(x599)))+(((IkReal(-0.0637202329192957))*(x597)))+(((IkReal(-1.00000000000000))*(new_r02)*(x596)))+(((IkReal(0.0637202329192957))*(x598))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x596)))+(((IkReal(-1.00000000000000))*(new_r10)*(x599)))+(((new_r10)*(x600)))+(((IkReal(-1.00000000000000))*(new_r00)*(x601))));
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r11)*(x599)))+(((IkReal(-1.00000000000000))*(new_r01)*(x596)))+(((new_r11)*(x600)))+(((IkReal(-1.00000000000000))*(new_r01)*(x601))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[2], cj3array[2], sj3array[2];
@@ -3285,6 +3429,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 2; ++iij3)
 {
@@ -3304,7 +3452,7 @@ IkReal x611=((new_r12)*(x607));
 IkReal x612=((IkReal(0.993348889555023))*(x608));
 IkReal x613=((IkReal(0.0634253154725807))*(x608));
 evalcond[0]=((((IkReal(0.995371682851684))*(new_r22)*(x607)))+(((IkReal(-1.00000000000000))*(x609)*(x612)))+(((IkReal(-0.00612351537051366))*(cj4)*(x611)))+(((cj4)*(new_r12)*(x613)))+(((IkReal(-0.00612351537051366))*(x607)*(x610)))+(((new_r12)*(sj4)*(x612)))+(((IkReal(0.0961000154891044))*(new_r22)*(x608)))+(((IkReal(0.0959047211377687))*(x607)*(x609)))+(((x610)*(x613)))+(((IkReal(-0.0959047211377687))*(sj4)*(x611))));
-if( IKabs(evalcond[0]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -3315,14 +3463,14 @@ IkReal dummyeval[1];
 IkReal gconst22;
 gconst22=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst23;
 gconst23=IKsign(((((IkReal(0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -3358,6 +3506,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -3416,7 +3568,7 @@ evalcond[6]=((((IkReal(-0.0961000154891044))*(x644)))+(((x634)*(x639)))+(((IkRea
 evalcond[7]=((((IkReal(-1.00000000000000))*(x629)*(x634)))+(((x628)*(x645)))+(((IkReal(-1.00000000000000))*(x628)*(x635)))+(((IkReal(-1.00000000000000))*(x623)*(x627)))+(((IkReal(-1.00000000000000))*(x624)*(x630)))+(((new_r21)*(x637)))+(x657)+(((IkReal(-1.00000000000000))*(x625)*(x630)))+(((IkReal(-1.00000000000000))*(x623)*(x646)))+(((IkReal(-0.0961000154891044))*(x626)))+(((x633)*(x634))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x630)*(x641)))+(((IkReal(-1.00000000000000))*(x630)*(x647)))+(((x628)*(x636)))+(((IkReal(-1.00000000000000))*(x628)*(x639)))+(((new_r20)*(x642)))+(((IkReal(-1.00000000000000))*(x634)*(x638)))+(((x623)*(x643)))+(x657)+(((x632)*(x634)))+(((x623)*(x631)))+(((IkReal(0.995371682851684))*(x644))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x630)*(x646)))+(((x628)*(x629)))+(((IkReal(-1.00000000000000))*(x628)*(x633)))+(((IkReal(-1.00000000000000))*(x634)*(x635)))+(((IkReal(-1.00000000000000))*(x651)))+(((x634)*(x645)))+(((IkReal(-1.00000000000000))*(x627)*(x630)))+(x650)+(((IkReal(0.995371682851684))*(x626)))+(((new_r21)*(x642)))+(((x623)*(x624)))+(((x623)*(x625))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -3498,6 +3650,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -3556,7 +3712,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x675)*(x677)))+(((IkReal(-1.00000000
 evalcond[7]=((((x669)*(x686)))+(((IkReal(-0.0961000154891044))*(x667)))+(((x674)*(x675)))+(((IkReal(-1.00000000000000))*(x664)*(x687)))+(((new_r21)*(x678)))+(((IkReal(-1.00000000000000))*(x670)*(x675)))+(((IkReal(-1.00000000000000))*(x665)*(x671)))+(((IkReal(-1.00000000000000))*(x666)*(x671)))+(((IkReal(-1.00000000000000))*(x669)*(x676)))+(x698)+(((IkReal(-1.00000000000000))*(x664)*(x668))));
 evalcond[8]=((((x673)*(x675)))+(((IkReal(-1.00000000000000))*(x675)*(x679)))+(((x664)*(x672)))+(((x669)*(x677)))+(((x664)*(x684)))+(x698)+(((IkReal(0.995371682851684))*(x685)))+(((new_r20)*(x683)))+(((IkReal(-1.00000000000000))*(x671)*(x688)))+(((IkReal(-1.00000000000000))*(x671)*(x682)))+(((IkReal(-1.00000000000000))*(x669)*(x680))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x675)*(x676)))+(((IkReal(0.995371682851684))*(x667)))+(((x664)*(x666)))+(((x664)*(x665)))+(((IkReal(-1.00000000000000))*(x668)*(x671)))+(((x669)*(x670)))+(((new_r21)*(x683)))+(((IkReal(-1.00000000000000))*(x669)*(x674)))+(x691)+(((IkReal(-1.00000000000000))*(x692)))+(((x675)*(x686)))+(((IkReal(-1.00000000000000))*(x671)*(x687))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -3652,6 +3808,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -3686,7 +3846,7 @@ evalcond[1]=((((IkReal(-0.0636238911754284))*(x710)))+(((IkReal(0.99796780104205
 evalcond[2]=((((IkReal(-1.00000000000000))*(x705)))+(((IkReal(-0.0548574835359933))*(x712)))+(((IkReal(0.996458924600913))*(x710)))+(x707)+(((IkReal(0.0637202329192957))*(cj2))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x706)*(x713)))+(((IkReal(-1.00000000000000))*(x706)*(x716)))+(((x707)*(x718)))+(((x707)*(x719)))+(((IkReal(0.995371682851684))*(x709)))+(((IkReal(0.0412399401475676))*(sj2)))+(((IkReal(-1.00000000000000))*(x704)*(x713)))+(((IkReal(-1.00000000000000))*(x704)*(x716)))+(((IkReal(-1.00000000000000))*(x705)*(x718)))+(((IkReal(-1.00000000000000))*(x705)*(x719)))+(((IkReal(-0.0961000154891044))*(x715))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x706)*(x708)))+(((IkReal(-1.00000000000000))*(x707)*(x711)))+(((IkReal(0.0961000154891044))*(x709)))+(((IkReal(-0.999149271799077))*(sj2)))+(((x707)*(x717)))+(((x706)*(x714)))+(((IkReal(0.995371682851684))*(x715)))+(((IkReal(-1.00000000000000))*(x704)*(x708)))+(((IkReal(-1.00000000000000))*(x705)*(x717)))+(((x704)*(x714)))+(((x705)*(x711))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -3697,21 +3857,21 @@ IkReal dummyeval[1];
 IkReal gconst4;
 gconst4=IKsign(sj2);
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x720=((cj2)*(sj2));
 dummyeval[0]=sj2;
 dummyeval[1]=((((cj3)*(x720)))+(((IkReal(18.1645030061781))*(sj3)*(x720))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x721=((cj2)*(sj2));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(cj3)*(x721)))+(((IkReal(-18.1645030061781))*(sj3)*(x721))));
 dummyeval[1]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[9];
@@ -3741,21 +3901,21 @@ evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x732)))+(((IkReal(-1.00000
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x732)))+(((IkReal(-1.00000000000000))*(new_r01)*(x723)))+(((IkReal(-1.00000000000000))*(new_r11)*(x733)))+(((new_r11)*(x735))));
 evalcond[7]=((((IkReal(-1.00000000000000))*(x724)*(x727)))+(((IkReal(-1.00000000000000))*(x724)*(x728)))+(((sj3)*(x738)))+(((IkReal(-1.00000000000000))*(x722)*(x729)))+(((x729)*(x736)))+(((IkReal(0.995371682851684))*(x730)))+(((IkReal(-0.993348889555023))*(sj3)*(x722)))+(((IkReal(-1.00000000000000))*(x726)*(x727)))+(((IkReal(-1.00000000000000))*(x726)*(x728)))+(((IkReal(-0.0961000154891044))*(x725))));
 evalcond[8]=((((x731)*(x736)))+(((IkReal(-1.00000000000000))*(x724)*(x737)))+(((IkReal(0.993348889555023))*(cj3)*(x722)))+(((IkReal(-1.00000000000000))*(cj3)*(x738)))+(((IkReal(-1.00000000000000))*(x722)*(x731)))+(((x726)*(x734)))+(((IkReal(0.995371682851684))*(x725)))+(((x724)*(x734)))+(((IkReal(-1.00000000000000))*(x726)*(x737)))+(((IkReal(0.0961000154891044))*(x730))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst5;
 gconst5=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst6;
 gconst6=IKsign(((((IkReal(-0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(-0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((cj3)*(cj3))))+(((IkReal(-1.00000000000000))*((sj3)*(sj3)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -3792,6 +3952,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -3850,7 +4014,7 @@ evalcond[6]=((((IkReal(-0.0961000154891044))*(x770)))+(((IkReal(-1.0000000000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x750)*(x756)))+(((IkReal(-0.0961000154891044))*(x752)))+(((new_r21)*(x763)))+(((x759)*(x760)))+(((IkReal(-1.00000000000000))*(x755)*(x760)))+(((IkReal(-1.00000000000000))*(x754)*(x761)))+(((IkReal(-1.00000000000000))*(x751)*(x756)))+(x775)+(((IkReal(-1.00000000000000))*(x774)))+(((IkReal(-1.00000000000000))*(x749)*(x753)))+(((x754)*(x771)))+(((IkReal(-1.00000000000000))*(x749)*(x772))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x756)*(x767)))+(((new_r20)*(x768)))+(((x758)*(x760)))+(((IkReal(-1.00000000000000))*(x754)*(x765)))+(((IkReal(-1.00000000000000))*(x756)*(x773)))+(((IkReal(0.995371682851684))*(x770)))+(x774)+(((IkReal(-1.00000000000000))*(x775)))+(((x749)*(x757)))+(((IkReal(-1.00000000000000))*(x760)*(x764)))+(((x754)*(x762)))+(((x749)*(x769))));
 evalcond[9]=((((new_r21)*(x768)))+(((IkReal(-1.00000000000000))*(x754)*(x759)))+(((IkReal(-1.00000000000000))*(x753)*(x756)))+(((IkReal(-1.00000000000000))*(x756)*(x772)))+(((IkReal(0.995371682851684))*(x752)))+(x783)+(((x749)*(x751)))+(((x749)*(x750)))+(((IkReal(-1.00000000000000))*(x760)*(x761)))+(((x760)*(x771)))+(((x754)*(x755))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -3932,6 +4096,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -3990,7 +4158,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x790)*(x808)))+(((IkReal(-0.09610001
 evalcond[7]=((((IkReal(-1.00000000000000))*(x796)*(x801)))+(((IkReal(-1.00000000000000))*(x792)*(x797)))+(((x800)*(x801)))+(((IkReal(-1.00000000000000))*(x815)))+(((IkReal(-0.0961000154891044))*(x793)))+(((IkReal(-1.00000000000000))*(x791)*(x797)))+(((IkReal(-1.00000000000000))*(x790)*(x794)))+(((IkReal(-1.00000000000000))*(x795)*(x802)))+(((new_r21)*(x804)))+(x816)+(((IkReal(-1.00000000000000))*(x790)*(x813)))+(((x795)*(x812))));
 evalcond[8]=((((IkReal(0.995371682851684))*(x811)))+(((x790)*(x798)))+(((IkReal(-1.00000000000000))*(x797)*(x808)))+(((new_r20)*(x809)))+(((IkReal(-1.00000000000000))*(x816)))+(((x795)*(x803)))+(((x799)*(x801)))+(((IkReal(-1.00000000000000))*(x795)*(x806)))+(((x790)*(x810)))+(x815)+(((IkReal(-1.00000000000000))*(x801)*(x805)))+(((IkReal(-1.00000000000000))*(x797)*(x814))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x794)*(x797)))+(((x801)*(x812)))+(((IkReal(0.995371682851684))*(x793)))+(((x790)*(x791)))+(((x790)*(x792)))+(((IkReal(-1.00000000000000))*(x795)*(x800)))+(((new_r21)*(x809)))+(x824)+(((IkReal(-1.00000000000000))*(x801)*(x802)))+(((IkReal(-1.00000000000000))*(x797)*(x813)))+(((x795)*(x796))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4065,25 +4233,25 @@ evalcond[3]=((((IkReal(-0.0548574835359933))*(sj3)))+(((IkReal(0.996458924600913
 evalcond[4]=((((IkReal(0.0637202329192957))*(x825)))+(((IkReal(-0.997967801042053))*(x826)))+(((IkReal(-0.997967801042053))*(x828)))+(((IkReal(-0.0637202329192957))*(x835))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((x831)*(x835)))+(((IkReal(-1.00000000000000))*(x828)*(x830)))+(((IkReal(-1.00000000000000))*(x828)*(x829)))+(((IkReal(-0.0961000154891044))*(x827)))+(((IkReal(-1.00000000000000))*(x826)*(x830)))+(((IkReal(-0.993348889555023))*(sj3)*(x825)))+(((IkReal(0.995371682851684))*(x832)))+(((IkReal(-1.00000000000000))*(x826)*(x829)))+(((sj3)*(x837)))+(((IkReal(-1.00000000000000))*(x825)*(x831))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(x828)*(x836)))+(((IkReal(0.0961000154891044))*(x832)))+(((IkReal(-1.00000000000000))*(x826)*(x836)))+(((IkReal(0.995371682851684))*(x827)))+(((x833)*(x835)))+(((x826)*(x834)))+(((IkReal(0.993348889555023))*(cj3)*(x825)))+(((IkReal(-1.00000000000000))*(x825)*(x833)))+(((x828)*(x834)))+(((IkReal(-1.00000000000000))*(cj3)*(x837))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst7;
 gconst7=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -4098,7 +4266,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(((IkReal(-1.00000000000000))*(x840
 evalcond[4]=((((IkReal(-0.997967801042053))*(x841)))+(((IkReal(-0.997967801042053))*(x839)))+(((IkReal(-0.0637202329192957))*(x838)))+(((IkReal(0.0637202329192957))*(x840))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(0.997118800177265))*(x840)))+(((IkReal(0.0636660242235878))*(x839)))+(((IkReal(0.0636660242235878))*(x841)))+(((IkReal(-0.997118800177265))*(x838)))+(((IkReal(0.0412399400149127))*(new_r22))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(-0.0411561322517886))*(x838)))+(((IkReal(-0.999149270283168))*(new_r22)))+(((IkReal(0.0411561322517886))*(x840)))+(((IkReal(0.00262781858332802))*(x839)))+(((IkReal(0.00262781858332802))*(x841))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -4123,6 +4291,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -4157,7 +4329,7 @@ evalcond[8]=((((IkReal(-0.997118800177265))*(x845)))+(((IkReal(0.999149271799077
 evalcond[9]=((((IkReal(-0.997118800177265))*(x849)))+(((IkReal(0.999149271799077))*(x843)))+(((IkReal(0.0636660242235878))*(x847)))+(((IkReal(0.0636660242235878))*(x848)))+(((IkReal(0.997118800177265))*(x850)))+(((IkReal(0.0412399400149127))*(new_r21))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x842)))+(((IkReal(0.00262781858332802))*(x852)))+(((IkReal(0.0411561322517886))*(x851)))+(((IkReal(-0.999149270283168))*(new_r20)))+(((IkReal(0.00262781858332802))*(x846)))+(((IkReal(-1.00000000000000))*(new_r00)*(x844))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x843)))+(((IkReal(0.0411561322517886))*(x850)))+(((IkReal(-0.999149270283168))*(new_r21)))+(((IkReal(-1.00000000000000))*(new_r01)*(x844)))+(((IkReal(0.00262781858332802))*(x847)))+(((IkReal(0.00262781858332802))*(x848))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4219,7 +4391,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(((IkReal(-1.00000000000000))*(x855)
 evalcond[4]=((((IkReal(0.0637202329192957))*(x855)))+(((IkReal(-0.0637202329192957))*(x853)))+(((IkReal(-0.997967801042053))*(x854)))+(((IkReal(-0.997967801042053))*(x856))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(0.997118800177265))*(x853)))+(((IkReal(-0.0636660242235878))*(x856)))+(((IkReal(-0.0636660242235878))*(x854)))+(((IkReal(-0.997118800177265))*(x855))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(-0.0411561322517886))*(x855)))+(((IkReal(0.0411561322517886))*(x853)))+(((IkReal(-0.00262781858332802))*(x856)))+(((IkReal(-0.00262781858332802))*(x854)))+(((IkReal(0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -4244,6 +4416,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -4278,7 +4454,7 @@ evalcond[8]=((((IkReal(-0.0412399400149127))*(new_r20)))+(((IkReal(0.99711880017
 evalcond[9]=((((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(0.997118800177265))*(x864)))+(((IkReal(0.999149271799077))*(x858)))+(((IkReal(-0.997118800177265))*(x865)))+(((IkReal(-0.0636660242235878))*(x863)))+(((IkReal(-0.0636660242235878))*(x862))));
 evalcond[10]=((((IkReal(-0.00262781858332802))*(x861)))+(((IkReal(-0.00262781858332802))*(x867)))+(((IkReal(0.0412399401475676))*(x857)))+(((new_r00)*(x859)))+(((IkReal(0.999149270283168))*(new_r20)))+(((IkReal(-0.0411561322517886))*(x866))));
 evalcond[11]=((((IkReal(-0.00262781858332802))*(x863)))+(((IkReal(-0.00262781858332802))*(x862)))+(((IkReal(0.0412399401475676))*(x858)))+(((IkReal(0.999149270283168))*(new_r21)))+(((new_r01)*(x859)))+(((IkReal(-0.0411561322517886))*(x865))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4369,6 +4545,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -4423,7 +4603,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x884)*(x892)))+(((IkReal(-0.09590472
 evalcond[9]=((((IkReal(0.0959047211377687))*(new_r01)*(x879)))+(((new_r21)*(x887)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x879)))+(((IkReal(-1.00000000000000))*(x876)*(x892)))+(((IkReal(0.999149271799077))*(x873)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x874)))+(((IkReal(-1.00000000000000))*(x874)*(x878)))+(((x885)*(x896)))+(((IkReal(-1.00000000000000))*(x880)*(x896)))+(((IkReal(-1.00000000000000))*(x875)*(x892)))+(((IkReal(-0.0961000154891044))*(x877))));
 evalcond[10]=((((IkReal(0.993348889555023))*(new_r10)*(x874)))+(((x874)*(x884)))+(((IkReal(-1.00000000000000))*(x882)*(x894)))+(((IkReal(0.995371682851684))*(x888)))+(((x883)*(x889)))+(((IkReal(0.0412399401475676))*(x872)))+(((IkReal(-1.00000000000000))*(x881)*(x882)))+(((IkReal(-0.993348889555023))*(new_r00)*(x879)))+(((IkReal(-1.00000000000000))*(x889)*(x890)))+(((IkReal(0.0634253154725807))*(new_r10)*(x879)))+(((new_r20)*(x893))));
 evalcond[11]=((((x886)*(x889)))+(((IkReal(-1.00000000000000))*(x879)*(x885)))+(((IkReal(-1.00000000000000))*(x882)*(x898)))+(((x879)*(x880)))+(((x874)*(x876)))+(((x874)*(x875)))+(((new_r21)*(x893)))+(((IkReal(0.0412399401475676))*(x873)))+(((IkReal(-1.00000000000000))*(x889)*(x891)))+(((IkReal(-1.00000000000000))*(x878)*(x892)))+(((IkReal(0.995371682851684))*(x877))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4505,6 +4685,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -4559,7 +4743,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x925)*(x932)))+(((new_r20)*(x922)))+
 evalcond[9]=((((IkReal(-0.00612351537051366))*(new_r11)*(x914)))+(((IkReal(0.0959047211377687))*(new_r01)*(x914)))+(((x920)*(x931)))+(((IkReal(-0.0961000154891044))*(x912)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x909)))+(((IkReal(0.999149271799077))*(x908)))+(((IkReal(-1.00000000000000))*(x910)*(x927)))+(((IkReal(-1.00000000000000))*(x915)*(x931)))+(((new_r21)*(x922)))+(((IkReal(-1.00000000000000))*(x909)*(x913)))+(((IkReal(-1.00000000000000))*(x911)*(x927))));
 evalcond[10]=((((x918)*(x924)))+(((IkReal(0.995371682851684))*(x923)))+(((x909)*(x919)))+(((IkReal(0.993348889555023))*(new_r10)*(x909)))+(((new_r20)*(x928)))+(((IkReal(-0.993348889555023))*(new_r00)*(x914)))+(((IkReal(-1.00000000000000))*(x924)*(x925)))+(((IkReal(0.0412399401475676))*(x907)))+(((IkReal(0.0634253154725807))*(new_r10)*(x914)))+(((IkReal(-1.00000000000000))*(x917)*(x929)))+(((IkReal(-1.00000000000000))*(x916)*(x917))));
 evalcond[11]=((((x909)*(x911)))+(((x909)*(x910)))+(((IkReal(-1.00000000000000))*(x914)*(x920)))+(((IkReal(0.995371682851684))*(x912)))+(((IkReal(-1.00000000000000))*(x924)*(x926)))+(((x914)*(x915)))+(((x921)*(x924)))+(((IkReal(0.0412399401475676))*(x908)))+(((IkReal(-1.00000000000000))*(x913)*(x927)))+(((new_r21)*(x928)))+(((IkReal(-1.00000000000000))*(x917)*(x933))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4638,6 +4822,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -4692,7 +4880,7 @@ evalcond[8]=((((new_r20)*(x954)))+(((IkReal(0.999149271799077))*(x939)))+(((IkRe
 evalcond[9]=((((x952)*(x963)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x946)))+(((IkReal(-1.00000000000000))*(x943)*(x959)))+(((IkReal(-1.00000000000000))*(x942)*(x959)))+(((IkReal(-1.00000000000000))*(x941)*(x945)))+(((new_r21)*(x954)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x941)))+(((IkReal(-1.00000000000000))*(x947)*(x963)))+(((IkReal(0.0959047211377687))*(new_r01)*(x946)))+(((IkReal(0.999149271799077))*(x940)))+(((IkReal(-0.0961000154891044))*(x944))));
 evalcond[10]=((((IkReal(0.993348889555023))*(new_r10)*(x941)))+(((IkReal(-1.00000000000000))*(x948)*(x949)))+(((IkReal(0.0412399401475676))*(x939)))+(((x941)*(x951)))+(((new_r20)*(x960)))+(((IkReal(-1.00000000000000))*(x956)*(x957)))+(((IkReal(0.995371682851684))*(x955)))+(((IkReal(-1.00000000000000))*(x949)*(x961)))+(((IkReal(-0.993348889555023))*(new_r00)*(x946)))+(((x950)*(x956)))+(((IkReal(0.0634253154725807))*(new_r10)*(x946))));
 evalcond[11]=((((x946)*(x947)))+(((x941)*(x942)))+(((x941)*(x943)))+(((IkReal(0.0412399401475676))*(x940)))+(((IkReal(-1.00000000000000))*(x956)*(x958)))+(((new_r21)*(x960)))+(((IkReal(-1.00000000000000))*(x946)*(x952)))+(((IkReal(0.995371682851684))*(x944)))+(((IkReal(-1.00000000000000))*(x945)*(x959)))+(((IkReal(-1.00000000000000))*(x949)*(x965)))+(((x953)*(x956))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4773,21 +4961,21 @@ evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x980)))+(((IkReal(-1.00000
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x980)))+(((IkReal(-1.00000000000000))*(new_r01)*(x971)))+(((IkReal(-1.00000000000000))*(new_r11)*(x981)))+(((new_r11)*(x983))));
 evalcond[7]=((((x977)*(x984)))+(((IkReal(-1.00000000000000))*(x974)*(x975)))+(((IkReal(-1.00000000000000))*(x974)*(x976)))+(((IkReal(-0.993348889555023))*(sj3)*(x970)))+(((IkReal(0.995371682851684))*(x978)))+(((IkReal(-1.00000000000000))*(x970)*(x977)))+(((IkReal(-1.00000000000000))*(x972)*(x975)))+(((IkReal(-1.00000000000000))*(x972)*(x976)))+(((IkReal(-0.0961000154891044))*(x973)))+(((sj3)*(x986))));
 evalcond[8]=((((x972)*(x982)))+(((IkReal(-1.00000000000000))*(cj3)*(x986)))+(((IkReal(-1.00000000000000))*(x974)*(x985)))+(((x979)*(x984)))+(((IkReal(0.995371682851684))*(x973)))+(((IkReal(-1.00000000000000))*(x970)*(x979)))+(((IkReal(0.993348889555023))*(cj3)*(x970)))+(((x974)*(x982)))+(((IkReal(-1.00000000000000))*(x972)*(x985)))+(((IkReal(0.0961000154891044))*(x978))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst8;
 gconst8=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst9;
 gconst9=IKsign(((((IkReal(0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -4824,6 +5012,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -4882,7 +5074,7 @@ evalcond[6]=((((new_r20)*(x1011)))+(x1025)+(((IkReal(-1.00000000000000))*(x1004)
 evalcond[7]=((x1031)+(((IkReal(-1.00000000000000))*(x1020)*(x997)))+(((new_r21)*(x1011)))+(((IkReal(-0.0961000154891044))*(x1000)))+(((IkReal(-1.00000000000000))*(x1001)*(x997)))+(((IkReal(-1.00000000000000))*(x1002)*(x1009)))+(((x1007)*(x1008)))+(((x1002)*(x1019)))+(((IkReal(-1.00000000000000))*(x1004)*(x999)))+(((IkReal(-1.00000000000000))*(x1004)*(x998)))+(((IkReal(-1.00000000000000))*(x1003)*(x1008))));
 evalcond[8]=((((new_r20)*(x1016)))+(((IkReal(-1.00000000000000))*(x1004)*(x1021)))+(((IkReal(0.995371682851684))*(x1018)))+(x1031)+(((IkReal(-1.00000000000000))*(x1004)*(x1015)))+(((IkReal(-1.00000000000000))*(x1008)*(x1012)))+(((x1006)*(x1008)))+(((x1002)*(x1010)))+(((x1017)*(x997)))+(((x1005)*(x997)))+(((IkReal(-1.00000000000000))*(x1002)*(x1013))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1004)*(x1020)))+(x1024)+(((IkReal(-1.00000000000000))*(x1008)*(x1009)))+(((IkReal(0.995371682851684))*(x1000)))+(((x997)*(x999)))+(((x997)*(x998)))+(((new_r21)*(x1016)))+(((IkReal(-1.00000000000000))*(x1025)))+(((IkReal(-1.00000000000000))*(x1002)*(x1007)))+(((IkReal(-1.00000000000000))*(x1001)*(x1004)))+(((x1002)*(x1003)))+(((x1008)*(x1019))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4964,6 +5156,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -5022,7 +5218,7 @@ evalcond[6]=((x1066)+(((IkReal(-1.00000000000000))*(x1045)*(x1058)))+(((x1043)*(
 evalcond[7]=((((x1043)*(x1060)))+(x1072)+(((IkReal(-1.00000000000000))*(x1038)*(x1042)))+(((IkReal(-1.00000000000000))*(x1044)*(x1049)))+(((new_r21)*(x1052)))+(((IkReal(-1.00000000000000))*(x1043)*(x1050)))+(((IkReal(-1.00000000000000))*(x1039)*(x1045)))+(((IkReal(-0.0961000154891044))*(x1041)))+(((x1048)*(x1049)))+(((IkReal(-1.00000000000000))*(x1040)*(x1045)))+(((IkReal(-1.00000000000000))*(x1038)*(x1061))));
 evalcond[8]=((((x1038)*(x1046)))+(((x1043)*(x1051)))+(((x1038)*(x1058)))+(x1072)+(((IkReal(-1.00000000000000))*(x1045)*(x1056)))+(((IkReal(-1.00000000000000))*(x1043)*(x1054)))+(((new_r20)*(x1057)))+(((IkReal(-1.00000000000000))*(x1045)*(x1062)))+(((x1047)*(x1049)))+(((IkReal(0.995371682851684))*(x1059)))+(((IkReal(-1.00000000000000))*(x1049)*(x1053))));
 evalcond[9]=((((x1038)*(x1039)))+(((x1038)*(x1040)))+(x1065)+(((x1043)*(x1044)))+(((new_r21)*(x1057)))+(((IkReal(-1.00000000000000))*(x1043)*(x1048)))+(((IkReal(-1.00000000000000))*(x1045)*(x1061)))+(((IkReal(-1.00000000000000))*(x1042)*(x1045)))+(((x1049)*(x1060)))+(((IkReal(0.995371682851684))*(x1041)))+(((IkReal(-1.00000000000000))*(x1066)))+(((IkReal(-1.00000000000000))*(x1049)*(x1050))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -5097,25 +5293,25 @@ evalcond[3]=((((IkReal(-0.996458924600913))*(cj3)))+(x1083)+(((IkReal(0.05485748
 evalcond[4]=((((IkReal(0.0637202329192957))*(x1073)))+(((IkReal(-0.0637202329192957))*(x1083)))+(((IkReal(-0.997967801042053))*(x1074)))+(((IkReal(-0.997967801042053))*(x1076))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((x1079)*(x1083)))+(((IkReal(-0.993348889555023))*(sj3)*(x1073)))+(((IkReal(-1.00000000000000))*(x1074)*(x1077)))+(((IkReal(-1.00000000000000))*(x1074)*(x1078)))+(((sj3)*(x1085)))+(((IkReal(-1.00000000000000))*(x1073)*(x1079)))+(((IkReal(-0.0961000154891044))*(x1075)))+(((IkReal(-1.00000000000000))*(x1076)*(x1078)))+(((IkReal(-1.00000000000000))*(x1076)*(x1077)))+(((IkReal(0.995371682851684))*(x1080))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(-1.00000000000000))*(x1074)*(x1084)))+(((x1076)*(x1082)))+(((x1081)*(x1083)))+(((IkReal(-1.00000000000000))*(x1073)*(x1081)))+(((IkReal(-1.00000000000000))*(x1076)*(x1084)))+(((x1074)*(x1082)))+(((IkReal(0.0961000154891044))*(x1080)))+(((IkReal(-1.00000000000000))*(cj3)*(x1085)))+(((IkReal(0.993348889555023))*(cj3)*(x1073)))+(((IkReal(0.995371682851684))*(x1075))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst10;
 gconst10=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -5130,7 +5326,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x1086)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(0.0637202329192957))*(x1088)))+(((IkReal(-0.0637202329192957))*(x1086)))+(((IkReal(-0.997967801042053))*(x1089)))+(((IkReal(-0.997967801042053))*(x1087))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(0.0636660242235878))*(x1087)))+(((IkReal(0.0636660242235878))*(x1089)))+(((IkReal(0.997118800177265))*(x1088)))+(((IkReal(-0.997118800177265))*(x1086)))+(((IkReal(0.0412399400149127))*(new_r22))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(-0.0411561322517886))*(x1086)))+(((IkReal(0.0411561322517886))*(x1088)))+(((IkReal(-0.999149270283168))*(new_r22)))+(((IkReal(0.00262781858332802))*(x1087)))+(((IkReal(0.00262781858332802))*(x1089))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -5155,6 +5351,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -5189,7 +5389,7 @@ evalcond[8]=((((IkReal(0.997118800177265))*(x1099)))+(((IkReal(-0.99711880017726
 evalcond[9]=((((IkReal(0.997118800177265))*(x1098)))+(((IkReal(-0.997118800177265))*(x1097)))+(((IkReal(0.0636660242235878))*(x1095)))+(((IkReal(0.0636660242235878))*(x1096)))+(((IkReal(0.999149271799077))*(x1091)))+(((IkReal(0.0412399400149127))*(new_r21))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(new_r00)*(x1092)))+(((IkReal(0.00262781858332802))*(x1100)))+(((IkReal(0.0411561322517886))*(x1099)))+(((IkReal(0.00262781858332802))*(x1094)))+(((IkReal(-0.999149270283168))*(new_r20)))+(((IkReal(0.0412399401475676))*(x1090))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(new_r01)*(x1092)))+(((IkReal(0.0411561322517886))*(x1098)))+(((IkReal(0.00262781858332802))*(x1095)))+(((IkReal(0.00262781858332802))*(x1096)))+(((IkReal(-0.999149270283168))*(new_r21)))+(((IkReal(0.0412399401475676))*(x1091))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -5251,7 +5451,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(x1101)+(((IkReal(-1.00000000000000
 evalcond[4]=((((IkReal(-0.997967801042053))*(x1102)))+(((IkReal(-0.997967801042053))*(x1104)))+(((IkReal(0.0637202329192957))*(x1103)))+(((IkReal(-0.0637202329192957))*(x1101))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(0.997118800177265))*(x1101)))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(-0.0636660242235878))*(x1104)))+(((IkReal(-0.0636660242235878))*(x1102)))+(((IkReal(-0.997118800177265))*(x1103))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(-0.00262781858332802))*(x1102)))+(((IkReal(-0.00262781858332802))*(x1104)))+(((IkReal(-0.0411561322517886))*(x1103)))+(((IkReal(0.0411561322517886))*(x1101)))+(((IkReal(0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -5276,6 +5476,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -5310,7 +5514,7 @@ evalcond[8]=((((IkReal(0.997118800177265))*(x1108)))+(((IkReal(0.999149271799077
 evalcond[9]=((((IkReal(0.997118800177265))*(x1112)))+(((IkReal(0.999149271799077))*(x1106)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(-0.0636660242235878))*(x1111)))+(((IkReal(-0.0636660242235878))*(x1110)))+(((IkReal(-0.997118800177265))*(x1113))));
 evalcond[10]=((((IkReal(-0.00262781858332802))*(x1109)))+(((IkReal(-0.00262781858332802))*(x1115)))+(((IkReal(-0.0411561322517886))*(x1114)))+(((IkReal(0.0412399401475676))*(x1105)))+(((new_r00)*(x1107)))+(((IkReal(0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(-0.00262781858332802))*(x1111)))+(((IkReal(-0.00262781858332802))*(x1110)))+(((IkReal(-0.0411561322517886))*(x1113)))+(((IkReal(0.0412399401475676))*(x1106)))+(((new_r01)*(x1107)))+(((IkReal(0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -5401,6 +5605,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -5455,7 +5663,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x1140)*(x1145)))+(((IkReal(-0.063425
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1128)*(x1144)))+(((new_r21)*(x1136)))+(((IkReal(-1.00000000000000))*(x1123)*(x1142)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1127)))+(((IkReal(-1.00000000000000))*(x1122)*(x1126)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x1127)))+(((IkReal(-1.00000000000000))*(x1124)*(x1142)))+(((x1133)*(x1144)))+(((IkReal(-0.0961000154891044))*(x1125)))+(((IkReal(0.999149271799077))*(x1121)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x1122))));
 evalcond[10]=((((new_r20)*(x1141)))+(((x1131)*(x1138)))+(((IkReal(0.0412399401475676))*(x1120)))+(((IkReal(0.995371682851684))*(x1137)))+(((IkReal(0.993348889555023))*(new_r10)*(x1122)))+(((IkReal(-1.00000000000000))*(x1130)*(x1146)))+(((x1122)*(x1132)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1127)))+(((IkReal(-1.00000000000000))*(x1129)*(x1130)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1127)))+(((IkReal(-1.00000000000000))*(x1138)*(x1140))));
 evalcond[11]=((((x1127)*(x1128)))+(((x1135)*(x1138)))+(((IkReal(-1.00000000000000))*(x1127)*(x1133)))+(((IkReal(-1.00000000000000))*(x1130)*(x1134)))+(((IkReal(0.0412399401475676))*(x1121)))+(((IkReal(-1.00000000000000))*(x1138)*(x1139)))+(((IkReal(0.995371682851684))*(x1125)))+(((IkReal(-1.00000000000000))*(x1126)*(x1142)))+(((x1122)*(x1123)))+(((x1122)*(x1124)))+(((new_r21)*(x1141))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -5537,6 +5745,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -5591,7 +5803,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x1175)*(x1180)))+(((IkReal(0.0959047
 evalcond[9]=((((IkReal(-0.00612351537051366))*(new_r11)*(x1162)))+(((IkReal(-1.00000000000000))*(x1158)*(x1177)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1162)))+(((x1168)*(x1179)))+(((IkReal(-1.00000000000000))*(x1159)*(x1177)))+(((IkReal(-1.00000000000000))*(x1163)*(x1179)))+(((new_r21)*(x1171)))+(((IkReal(0.999149271799077))*(x1156)))+(((IkReal(-0.0961000154891044))*(x1160)))+(((IkReal(-1.00000000000000))*(x1157)*(x1161)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x1157))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x1173)*(x1175)))+(((IkReal(0.0412399401475676))*(x1155)))+(((x1166)*(x1173)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1162)))+(((x1157)*(x1167)))+(((IkReal(0.993348889555023))*(new_r10)*(x1157)))+(((new_r20)*(x1176)))+(((IkReal(-1.00000000000000))*(x1165)*(x1181)))+(((IkReal(0.995371682851684))*(x1172)))+(((IkReal(-1.00000000000000))*(x1164)*(x1165)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1162))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x1173)*(x1174)))+(((IkReal(0.0412399401475676))*(x1156)))+(((IkReal(-1.00000000000000))*(x1162)*(x1168)))+(((x1162)*(x1163)))+(((new_r21)*(x1176)))+(((IkReal(0.995371682851684))*(x1160)))+(((IkReal(-1.00000000000000))*(x1161)*(x1177)))+(((x1170)*(x1173)))+(((IkReal(-1.00000000000000))*(x1165)*(x1169)))+(((x1157)*(x1158)))+(((x1157)*(x1159))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -5670,6 +5882,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -5724,7 +5940,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x1199)*(x1209)))+(((IkReal(-1.000000
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1191)*(x1209)))+(((IkReal(-1.00000000000000))*(x1190)*(x1209)))+(((IkReal(-1.00000000000000))*(x1189)*(x1193)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1194)))+(((new_r21)*(x1203)))+(((IkReal(-0.0961000154891044))*(x1192)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x1194)))+(((IkReal(0.999149271799077))*(x1188)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x1189)))+(((x1200)*(x1211)))+(((IkReal(-1.00000000000000))*(x1195)*(x1211))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x1197)*(x1213)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1194)))+(((new_r20)*(x1208)))+(((IkReal(0.0412399401475676))*(x1187)))+(((x1189)*(x1199)))+(((IkReal(-1.00000000000000))*(x1205)*(x1207)))+(((IkReal(-1.00000000000000))*(x1196)*(x1197)))+(((IkReal(0.993348889555023))*(new_r10)*(x1189)))+(((IkReal(0.995371682851684))*(x1204)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1194)))+(((x1198)*(x1205))));
 evalcond[11]=((((x1194)*(x1195)))+(((IkReal(0.0412399401475676))*(x1188)))+(((new_r21)*(x1208)))+(((x1189)*(x1191)))+(((x1189)*(x1190)))+(((x1202)*(x1205)))+(((IkReal(-1.00000000000000))*(x1205)*(x1206)))+(((IkReal(0.995371682851684))*(x1192)))+(((IkReal(-1.00000000000000))*(x1194)*(x1200)))+(((IkReal(-1.00000000000000))*(x1197)*(x1201)))+(((IkReal(-1.00000000000000))*(x1193)*(x1209))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -5826,6 +6042,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -5891,7 +6111,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x1231)*(x1244)))+(((IkReal(-0.006123
 evalcond[9]=((((new_r21)*(x1235)))+(((IkReal(-0.0961000154891044))*(x1232)))+(((IkReal(-1.00000000000000))*(x1239)*(x1248)))+(x1259)+(((IkReal(0.0959047211377687))*(new_r01)*(x1229)))+(((IkReal(-1.00000000000000))*(cj2)*(x1256)))+(((IkReal(-1.00000000000000))*(x1236)*(x1244)))+(((IkReal(-1.00000000000000))*(x1229)*(x1249)))+(((x1233)*(x1246)))+(((IkReal(-1.00000000000000))*(x1239)*(x1254)))+(((IkReal(-1.00000000000000))*(x1230)*(x1246)))+(((IkReal(-1.00000000000000))*(x1236)*(x1253))));
 evalcond[10]=((x1256)+(((new_r20)*(x1252)))+(((IkReal(-1.00000000000000))*(cj2)*(x1259)))+(((IkReal(0.995371682851684))*(x1241)))+(((IkReal(-1.00000000000000))*(x1231)*(x1250)))+(((IkReal(-1.00000000000000))*(x1240)*(x1245)))+(((x1242)*(x1245)))+(((IkReal(-1.00000000000000))*(x1250)*(x1255)))+(((x1238)*(x1240)))+(((x1251)*(x1255)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1229)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1229))));
 evalcond[11]=((((IkReal(0.999149271799077))*(x1266)))+(((IkReal(-1.00000000000000))*(x1239)*(x1240)))+(x1261)+(((x1239)*(x1242)))+(((IkReal(0.995371682851684))*(x1232)))+(((x1236)*(x1251)))+(((IkReal(-1.00000000000000))*(x1229)*(x1233)))+(((new_r21)*(x1252)))+(((IkReal(-1.00000000000000))*(x1236)*(x1250)))+(((x1234)*(x1240)))+(((IkReal(-1.00000000000000))*(x1246)*(x1249)))+(((x1229)*(x1230))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -5978,6 +6198,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -6043,7 +6267,7 @@ evalcond[8]=((((IkReal(-0.0961000154891044))*(x1292)))+(((IkReal(0.9991492717990
 evalcond[9]=((x1310)+(((IkReal(-1.00000000000000))*(cj2)*(x1307)))+(((IkReal(-1.00000000000000))*(x1287)*(x1295)))+(((IkReal(-1.00000000000000))*(x1287)*(x1304)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1280)))+(((IkReal(-1.00000000000000))*(x1281)*(x1297)))+(((new_r21)*(x1286)))+(((IkReal(-1.00000000000000))*(x1290)*(x1299)))+(((IkReal(-0.0961000154891044))*(x1283)))+(((x1284)*(x1297)))+(((IkReal(-1.00000000000000))*(x1280)*(x1300)))+(((IkReal(-1.00000000000000))*(x1290)*(x1305))));
 evalcond[10]=((x1307)+(((IkReal(-1.00000000000000))*(cj2)*(x1310)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1280)))+(((x1293)*(x1296)))+(((x1302)*(x1306)))+(((IkReal(-1.00000000000000))*(x1282)*(x1301)))+(((IkReal(-1.00000000000000))*(x1301)*(x1306)))+(((IkReal(-1.00000000000000))*(x1291)*(x1296)))+(((new_r20)*(x1303)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1280)))+(((x1289)*(x1291)))+(((IkReal(0.995371682851684))*(x1292))));
 evalcond[11]=((x1312)+(((IkReal(0.999149271799077))*(x1317)))+(((new_r21)*(x1303)))+(((IkReal(-1.00000000000000))*(x1287)*(x1301)))+(((x1290)*(x1293)))+(((IkReal(-1.00000000000000))*(x1297)*(x1300)))+(((x1287)*(x1302)))+(((x1285)*(x1291)))+(((IkReal(0.995371682851684))*(x1283)))+(((IkReal(-1.00000000000000))*(x1290)*(x1291)))+(((x1280)*(x1281)))+(((IkReal(-1.00000000000000))*(x1280)*(x1284))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -6125,6 +6349,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -6190,7 +6418,7 @@ evalcond[8]=((((IkReal(-0.0961000154891044))*(x1338)))+(((IkReal(-1.000000000000
 evalcond[9]=((x1356)+(((IkReal(-1.00000000000000))*(x1336)*(x1345)))+(((IkReal(-1.00000000000000))*(x1336)*(x1351)))+(((x1330)*(x1343)))+(((IkReal(-1.00000000000000))*(cj2)*(x1353)))+(((IkReal(-0.0961000154891044))*(x1329)))+(((new_r21)*(x1332)))+(((IkReal(-1.00000000000000))*(x1333)*(x1341)))+(((IkReal(-1.00000000000000))*(x1326)*(x1346)))+(((IkReal(-1.00000000000000))*(x1327)*(x1343)))+(((IkReal(-1.00000000000000))*(x1333)*(x1350)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1326))));
 evalcond[10]=((x1353)+(((new_r20)*(x1349)))+(((x1339)*(x1342)))+(((IkReal(0.995371682851684))*(x1338)))+(((x1335)*(x1337)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1326)))+(((IkReal(-1.00000000000000))*(cj2)*(x1356)))+(((IkReal(-1.00000000000000))*(x1347)*(x1352)))+(((x1348)*(x1352)))+(((IkReal(-1.00000000000000))*(x1328)*(x1347)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1326)))+(((IkReal(-1.00000000000000))*(x1337)*(x1342))));
 evalcond[11]=((((new_r21)*(x1349)))+(((IkReal(-1.00000000000000))*(x1326)*(x1330)))+(x1358)+(((x1336)*(x1339)))+(((x1331)*(x1337)))+(((x1333)*(x1348)))+(((x1326)*(x1327)))+(((IkReal(-1.00000000000000))*(x1336)*(x1337)))+(((IkReal(-1.00000000000000))*(x1333)*(x1347)))+(((IkReal(-1.00000000000000))*(x1343)*(x1346)))+(((IkReal(0.995371682851684))*(x1329)))+(((IkReal(0.999149271799077))*(x1363))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -6277,6 +6505,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -6311,7 +6543,7 @@ evalcond[1]=((x1371)+(x1373)+(((IkReal(-0.0636238911754284))*(x1377)))+(((IkReal
 evalcond[2]=((x1374)+(((IkReal(-1.00000000000000))*(x1372)))+(((IkReal(0.996458924600913))*(x1377)))+(((IkReal(-0.0548574835359933))*(x1379)))+(((IkReal(0.0637202329192957))*(cj2))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x1373)*(x1383)))+(((IkReal(-1.00000000000000))*(x1373)*(x1380)))+(((IkReal(-0.0961000154891044))*(x1382)))+(((IkReal(-1.00000000000000))*(x1372)*(x1385)))+(((IkReal(-1.00000000000000))*(x1372)*(x1386)))+(((IkReal(0.0412399401475676))*(sj2)))+(((IkReal(-1.00000000000000))*(x1371)*(x1380)))+(((IkReal(-1.00000000000000))*(x1371)*(x1383)))+(((IkReal(0.995371682851684))*(x1376)))+(((x1374)*(x1385)))+(((x1374)*(x1386))));
 evalcond[4]=((((x1371)*(x1381)))+(((x1372)*(x1378)))+(((IkReal(0.0961000154891044))*(x1376)))+(((IkReal(-1.00000000000000))*(x1372)*(x1384)))+(((IkReal(-0.999149271799077))*(sj2)))+(((IkReal(-1.00000000000000))*(x1371)*(x1375)))+(((IkReal(-1.00000000000000))*(x1374)*(x1378)))+(((IkReal(0.995371682851684))*(x1382)))+(((x1373)*(x1381)))+(((IkReal(-1.00000000000000))*(x1373)*(x1375)))+(((x1374)*(x1384))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -6322,21 +6554,21 @@ IkReal dummyeval[1];
 IkReal gconst4;
 gconst4=IKsign(sj2);
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x1387=((cj2)*(sj2));
 dummyeval[0]=sj2;
 dummyeval[1]=((((cj3)*(x1387)))+(((IkReal(18.1645030061781))*(sj3)*(x1387))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x1388=((cj2)*(sj2));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(cj3)*(x1388)))+(((IkReal(-18.1645030061781))*(sj3)*(x1388))));
 dummyeval[1]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[9];
@@ -6366,21 +6598,21 @@ evalcond[5]=((((new_r10)*(x1402)))+(((IkReal(-1.00000000000000))*(new_r00)*(x139
 evalcond[6]=((((new_r11)*(x1402)))+(((IkReal(-1.00000000000000))*(new_r01)*(x1399)))+(((IkReal(-1.00000000000000))*(new_r01)*(x1390)))+(((IkReal(-1.00000000000000))*(new_r11)*(x1400))));
 evalcond[7]=((((IkReal(-1.00000000000000))*(x1389)*(x1396)))+(((IkReal(-1.00000000000000))*(x1391)*(x1394)))+(((IkReal(-1.00000000000000))*(x1391)*(x1395)))+(((IkReal(-0.0961000154891044))*(x1392)))+(((IkReal(-1.00000000000000))*(x1393)*(x1394)))+(((IkReal(-1.00000000000000))*(x1393)*(x1395)))+(((x1396)*(x1403)))+(((sj3)*(x1405)))+(((IkReal(0.995371682851684))*(x1397)))+(((IkReal(-0.993348889555023))*(sj3)*(x1389))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x1389)*(x1398)))+(((x1393)*(x1401)))+(((IkReal(-1.00000000000000))*(cj3)*(x1405)))+(((x1391)*(x1401)))+(((IkReal(0.995371682851684))*(x1392)))+(((IkReal(-1.00000000000000))*(x1393)*(x1404)))+(((IkReal(-1.00000000000000))*(x1391)*(x1404)))+(((IkReal(0.0961000154891044))*(x1397)))+(((x1398)*(x1403)))+(((IkReal(0.993348889555023))*(cj3)*(x1389))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst5;
 gconst5=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst6;
 gconst6=IKsign(((((IkReal(-0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(-0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((cj3)*(cj3))))+(((IkReal(-1.00000000000000))*((sj3)*(sj3)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -6417,6 +6649,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -6475,7 +6711,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x1427)*(x1429)))+(((x1427)*(x1432)))
 evalcond[7]=((((IkReal(-1.00000000000000))*(x1421)*(x1428)))+(((x1426)*(x1427)))+(((IkReal(-1.00000000000000))*(x1416)*(x1420)))+(((IkReal(-0.0961000154891044))*(x1419)))+(((IkReal(-1.00000000000000))*(x1417)*(x1423)))+(((x1421)*(x1438)))+(((new_r21)*(x1430)))+(((IkReal(-1.00000000000000))*(x1418)*(x1423)))+(((IkReal(-1.00000000000000))*(x1416)*(x1439)))+(((IkReal(-1.00000000000000))*(x1422)*(x1427)))+(x1442)+(((IkReal(-1.00000000000000))*(x1441))));
 evalcond[8]=((((x1425)*(x1427)))+(((x1416)*(x1436)))+(((new_r20)*(x1435)))+(((IkReal(0.995371682851684))*(x1437)))+(((IkReal(-1.00000000000000))*(x1421)*(x1432)))+(x1441)+(((IkReal(-1.00000000000000))*(x1442)))+(((IkReal(-1.00000000000000))*(x1427)*(x1431)))+(((IkReal(-1.00000000000000))*(x1423)*(x1440)))+(((x1421)*(x1429)))+(((x1416)*(x1424)))+(((IkReal(-1.00000000000000))*(x1423)*(x1434))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1421)*(x1426)))+(((IkReal(-1.00000000000000))*(x1427)*(x1428)))+(((x1427)*(x1438)))+(((new_r21)*(x1435)))+(((IkReal(-1.00000000000000))*(x1420)*(x1423)))+(((x1416)*(x1418)))+(((x1416)*(x1417)))+(((IkReal(0.995371682851684))*(x1419)))+(x1450)+(((x1421)*(x1422)))+(((IkReal(-1.00000000000000))*(x1423)*(x1439))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -6557,6 +6793,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -6615,7 +6855,7 @@ evalcond[6]=((((IkReal(-0.0961000154891044))*(x1478)))+(((IkReal(-1.000000000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x1458)*(x1464)))+(((x1462)*(x1479)))+(((IkReal(-1.00000000000000))*(x1482)))+(((IkReal(-1.00000000000000))*(x1459)*(x1464)))+(((IkReal(-1.00000000000000))*(x1462)*(x1469)))+(((IkReal(-1.00000000000000))*(x1463)*(x1468)))+(((IkReal(-0.0961000154891044))*(x1460)))+(((IkReal(-1.00000000000000))*(x1457)*(x1461)))+(x1483)+(((new_r21)*(x1471)))+(((IkReal(-1.00000000000000))*(x1457)*(x1480)))+(((x1467)*(x1468))));
 evalcond[8]=((((x1462)*(x1470)))+(((IkReal(-1.00000000000000))*(x1483)))+(((new_r20)*(x1476)))+(((x1457)*(x1477)))+(((x1466)*(x1468)))+(((IkReal(-1.00000000000000))*(x1464)*(x1481)))+(((IkReal(-1.00000000000000))*(x1468)*(x1472)))+(x1482)+(((x1457)*(x1465)))+(((IkReal(0.995371682851684))*(x1478)))+(((IkReal(-1.00000000000000))*(x1462)*(x1473)))+(((IkReal(-1.00000000000000))*(x1464)*(x1475))));
 evalcond[9]=((((IkReal(0.995371682851684))*(x1460)))+(((IkReal(-1.00000000000000))*(x1462)*(x1467)))+(((IkReal(-1.00000000000000))*(x1464)*(x1480)))+(x1491)+(((x1462)*(x1463)))+(((new_r21)*(x1476)))+(((IkReal(-1.00000000000000))*(x1461)*(x1464)))+(((x1468)*(x1479)))+(((x1457)*(x1459)))+(((x1457)*(x1458)))+(((IkReal(-1.00000000000000))*(x1468)*(x1469))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -6690,25 +6930,25 @@ evalcond[3]=((((IkReal(-0.0548574835359933))*(sj3)))+(((IkReal(0.996458924600913
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x1502)))+(((IkReal(-0.997967801042053))*(x1493)))+(((IkReal(-0.997967801042053))*(x1495)))+(((IkReal(0.0637202329192957))*(x1492))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-0.993348889555023))*(sj3)*(x1492)))+(((sj3)*(x1504)))+(((x1498)*(x1502)))+(((IkReal(-1.00000000000000))*(x1495)*(x1496)))+(((IkReal(-1.00000000000000))*(x1495)*(x1497)))+(((IkReal(-0.0961000154891044))*(x1494)))+(((IkReal(-1.00000000000000))*(x1492)*(x1498)))+(((IkReal(0.995371682851684))*(x1499)))+(((IkReal(-1.00000000000000))*(x1493)*(x1496)))+(((IkReal(-1.00000000000000))*(x1493)*(x1497))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(0.995371682851684))*(x1494)))+(((x1500)*(x1502)))+(((x1495)*(x1501)))+(((IkReal(-1.00000000000000))*(cj3)*(x1504)))+(((IkReal(0.0961000154891044))*(x1499)))+(((IkReal(-1.00000000000000))*(x1495)*(x1503)))+(((IkReal(-1.00000000000000))*(x1493)*(x1503)))+(((IkReal(-1.00000000000000))*(x1492)*(x1500)))+(((x1493)*(x1501)))+(((IkReal(0.993348889555023))*(cj3)*(x1492))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst7;
 gconst7=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -6723,7 +6963,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(((IkReal(-1.00000000000000))*(x150
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x1505)))+(((IkReal(0.0637202329192957))*(x1507)))+(((IkReal(-0.997967801042053))*(x1506)))+(((IkReal(-0.997967801042053))*(x1508))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-0.997118800177265))*(x1505)))+(((IkReal(0.0636660242235878))*(x1506)))+(((IkReal(0.0636660242235878))*(x1508)))+(((IkReal(0.997118800177265))*(x1507)))+(((IkReal(0.0412399400149127))*(new_r22))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(0.00262781858332802))*(x1506)))+(((IkReal(0.00262781858332802))*(x1508)))+(((IkReal(0.0411561322517886))*(x1507)))+(((IkReal(-0.0411561322517886))*(x1505)))+(((IkReal(-0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -6748,6 +6988,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -6782,7 +7026,7 @@ evalcond[8]=((((IkReal(-0.997118800177265))*(x1512)))+(((IkReal(0.06366602422358
 evalcond[9]=((((IkReal(-0.997118800177265))*(x1516)))+(((IkReal(0.0636660242235878))*(x1515)))+(((IkReal(0.0636660242235878))*(x1514)))+(((IkReal(0.999149271799077))*(x1510)))+(((IkReal(0.997118800177265))*(x1517)))+(((IkReal(0.0412399400149127))*(new_r21))));
 evalcond[10]=((((IkReal(0.00262781858332802))*(x1519)))+(((IkReal(0.00262781858332802))*(x1513)))+(((IkReal(0.0411561322517886))*(x1518)))+(((IkReal(0.0412399401475676))*(x1509)))+(((IkReal(-0.999149270283168))*(new_r20)))+(((IkReal(-1.00000000000000))*(new_r00)*(x1511))));
 evalcond[11]=((((IkReal(0.00262781858332802))*(x1515)))+(((IkReal(0.00262781858332802))*(x1514)))+(((IkReal(0.0411561322517886))*(x1517)))+(((IkReal(0.0412399401475676))*(x1510)))+(((IkReal(-0.999149270283168))*(new_r21)))+(((IkReal(-1.00000000000000))*(new_r01)*(x1511))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -6844,7 +7088,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x1520)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x1520)))+(((IkReal(0.0637202329192957))*(x1522)))+(((IkReal(-0.997967801042053))*(x1523)))+(((IkReal(-0.997967801042053))*(x1521))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-0.997118800177265))*(x1522)))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(0.997118800177265))*(x1520)))+(((IkReal(-0.0636660242235878))*(x1521)))+(((IkReal(-0.0636660242235878))*(x1523))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(0.0411561322517886))*(x1520)))+(((IkReal(-0.0411561322517886))*(x1522)))+(((IkReal(0.999149270283168))*(new_r22)))+(((IkReal(-0.00262781858332802))*(x1523)))+(((IkReal(-0.00262781858332802))*(x1521))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -6869,6 +7113,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -6903,7 +7151,7 @@ evalcond[8]=((((IkReal(-0.997118800177265))*(x1533)))+(((IkReal(-0.0412399400149
 evalcond[9]=((((IkReal(-0.997118800177265))*(x1532)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(0.997118800177265))*(x1531)))+(((IkReal(-0.0636660242235878))*(x1529)))+(((IkReal(0.999149271799077))*(x1525)))+(((IkReal(-0.0636660242235878))*(x1530))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x1524)))+(((new_r00)*(x1526)))+(((IkReal(-0.0411561322517886))*(x1533)))+(((IkReal(0.999149270283168))*(new_r20)))+(((IkReal(-0.00262781858332802))*(x1528)))+(((IkReal(-0.00262781858332802))*(x1534))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x1525)))+(((new_r01)*(x1526)))+(((IkReal(-0.0411561322517886))*(x1532)))+(((IkReal(0.999149270283168))*(new_r21)))+(((IkReal(-0.00262781858332802))*(x1529)))+(((IkReal(-0.00262781858332802))*(x1530))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -6994,6 +7242,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -7048,7 +7300,7 @@ evalcond[8]=((((new_r20)*(x1554)))+(((IkReal(-0.00612351537051366))*(new_r10)*(x
 evalcond[9]=((((new_r21)*(x1554)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x1546)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x1541)))+(((x1552)*(x1563)))+(((IkReal(-1.00000000000000))*(x1543)*(x1559)))+(((IkReal(-0.0961000154891044))*(x1544)))+(((IkReal(0.999149271799077))*(x1540)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1546)))+(((IkReal(-1.00000000000000))*(x1542)*(x1559)))+(((IkReal(-1.00000000000000))*(x1547)*(x1563)))+(((IkReal(-1.00000000000000))*(x1541)*(x1545))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x1548)*(x1549)))+(((x1550)*(x1556)))+(((x1541)*(x1551)))+(((IkReal(-1.00000000000000))*(x1549)*(x1561)))+(((IkReal(0.0412399401475676))*(x1539)))+(((IkReal(-1.00000000000000))*(x1556)*(x1557)))+(((IkReal(0.995371682851684))*(x1555)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1546)))+(((IkReal(0.993348889555023))*(new_r10)*(x1541)))+(((new_r20)*(x1560)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1546))));
 evalcond[11]=((((x1553)*(x1556)))+(((IkReal(-1.00000000000000))*(x1546)*(x1552)))+(((x1541)*(x1542)))+(((x1541)*(x1543)))+(((IkReal(-1.00000000000000))*(x1549)*(x1565)))+(((new_r21)*(x1560)))+(((IkReal(0.0412399401475676))*(x1540)))+(((IkReal(0.995371682851684))*(x1544)))+(((x1546)*(x1547)))+(((IkReal(-1.00000000000000))*(x1545)*(x1559)))+(((IkReal(-1.00000000000000))*(x1556)*(x1558))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -7130,6 +7382,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -7184,7 +7440,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r10)*(x1581)))+(((IkReal(-1.0
 evalcond[9]=((((x1587)*(x1598)))+(((IkReal(-1.00000000000000))*(x1578)*(x1594)))+(((IkReal(-1.00000000000000))*(x1577)*(x1594)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x1576)))+(((new_r21)*(x1589)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1581)))+(((IkReal(-0.0961000154891044))*(x1579)))+(((IkReal(0.999149271799077))*(x1575)))+(((IkReal(-1.00000000000000))*(x1576)*(x1580)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x1581)))+(((IkReal(-1.00000000000000))*(x1582)*(x1598))));
 evalcond[10]=((((x1576)*(x1586)))+(((IkReal(0.0412399401475676))*(x1574)))+(((IkReal(-1.00000000000000))*(x1584)*(x1596)))+(((IkReal(-1.00000000000000))*(x1591)*(x1592)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1581)))+(((IkReal(0.995371682851684))*(x1590)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1581)))+(((x1585)*(x1591)))+(((IkReal(0.993348889555023))*(new_r10)*(x1576)))+(((IkReal(-1.00000000000000))*(x1583)*(x1584)))+(((new_r20)*(x1595))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x1580)*(x1594)))+(((x1576)*(x1577)))+(((x1576)*(x1578)))+(((x1588)*(x1591)))+(((IkReal(0.0412399401475676))*(x1575)))+(((new_r21)*(x1595)))+(((IkReal(0.995371682851684))*(x1579)))+(((IkReal(-1.00000000000000))*(x1591)*(x1593)))+(((IkReal(-1.00000000000000))*(x1581)*(x1587)))+(((IkReal(-1.00000000000000))*(x1584)*(x1600)))+(((x1581)*(x1582))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -7263,6 +7519,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -7317,7 +7577,7 @@ evalcond[8]=((((IkReal(0.999149271799077))*(x1606)))+(((IkReal(0.095904721137768
 evalcond[9]=((((IkReal(0.999149271799077))*(x1607)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1613)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x1608)))+(((IkReal(-1.00000000000000))*(x1614)*(x1630)))+(((IkReal(-1.00000000000000))*(x1610)*(x1626)))+(((x1619)*(x1630)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x1613)))+(((IkReal(-1.00000000000000))*(x1609)*(x1626)))+(((IkReal(-1.00000000000000))*(x1608)*(x1612)))+(((new_r21)*(x1621)))+(((IkReal(-0.0961000154891044))*(x1611))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x1606)))+(((IkReal(-1.00000000000000))*(x1616)*(x1628)))+(((x1617)*(x1623)))+(((IkReal(0.995371682851684))*(x1622)))+(((x1608)*(x1618)))+(((IkReal(-1.00000000000000))*(x1623)*(x1624)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1613)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1613)))+(((IkReal(0.993348889555023))*(new_r10)*(x1608)))+(((IkReal(-1.00000000000000))*(x1615)*(x1616)))+(((new_r20)*(x1627))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x1607)))+(((x1620)*(x1623)))+(((IkReal(0.995371682851684))*(x1611)))+(((x1608)*(x1610)))+(((x1608)*(x1609)))+(((IkReal(-1.00000000000000))*(x1623)*(x1625)))+(((IkReal(-1.00000000000000))*(x1616)*(x1632)))+(((IkReal(-1.00000000000000))*(x1612)*(x1626)))+(((IkReal(-1.00000000000000))*(x1613)*(x1619)))+(((new_r21)*(x1627)))+(((x1613)*(x1614))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -7398,21 +7658,21 @@ evalcond[5]=((((new_r10)*(x1650)))+(((IkReal(-1.00000000000000))*(new_r00)*(x164
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x1647)))+(((IkReal(-1.00000000000000))*(new_r01)*(x1638)))+(((new_r11)*(x1650)))+(((IkReal(-1.00000000000000))*(new_r11)*(x1648))));
 evalcond[7]=((((IkReal(-1.00000000000000))*(x1641)*(x1642)))+(((IkReal(-1.00000000000000))*(x1641)*(x1643)))+(((IkReal(-0.993348889555023))*(sj3)*(x1637)))+(((IkReal(-1.00000000000000))*(x1639)*(x1643)))+(((IkReal(-1.00000000000000))*(x1639)*(x1642)))+(((x1644)*(x1651)))+(((sj3)*(x1653)))+(((IkReal(-1.00000000000000))*(x1637)*(x1644)))+(((IkReal(0.995371682851684))*(x1645)))+(((IkReal(-0.0961000154891044))*(x1640))));
 evalcond[8]=((((IkReal(0.993348889555023))*(cj3)*(x1637)))+(((IkReal(-1.00000000000000))*(x1641)*(x1652)))+(((x1641)*(x1649)))+(((x1646)*(x1651)))+(((IkReal(-1.00000000000000))*(x1639)*(x1652)))+(((IkReal(-1.00000000000000))*(x1637)*(x1646)))+(((IkReal(-1.00000000000000))*(cj3)*(x1653)))+(((x1639)*(x1649)))+(((IkReal(0.995371682851684))*(x1640)))+(((IkReal(0.0961000154891044))*(x1645))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst8;
 gconst8=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst9;
 gconst9=IKsign(((((IkReal(0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -7449,6 +7709,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -7507,7 +7771,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x1691)))+(x1692)+(((IkReal(-1.000000
 evalcond[7]=((((IkReal(-0.0961000154891044))*(x1667)))+(((new_r21)*(x1678)))+(((x1669)*(x1686)))+(((x1674)*(x1675)))+(x1698)+(((IkReal(-1.00000000000000))*(x1669)*(x1676)))+(((IkReal(-1.00000000000000))*(x1664)*(x1687)))+(((IkReal(-1.00000000000000))*(x1670)*(x1675)))+(((IkReal(-1.00000000000000))*(x1666)*(x1671)))+(((IkReal(-1.00000000000000))*(x1665)*(x1671)))+(((IkReal(-1.00000000000000))*(x1664)*(x1668))));
 evalcond[8]=((x1698)+(((x1673)*(x1675)))+(((IkReal(0.995371682851684))*(x1685)))+(((x1669)*(x1677)))+(((IkReal(-1.00000000000000))*(x1669)*(x1680)))+(((x1664)*(x1684)))+(((IkReal(-1.00000000000000))*(x1671)*(x1682)))+(((IkReal(-1.00000000000000))*(x1671)*(x1688)))+(((new_r20)*(x1683)))+(((IkReal(-1.00000000000000))*(x1675)*(x1679)))+(((x1664)*(x1672))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1692)))+(((IkReal(-1.00000000000000))*(x1668)*(x1671)))+(x1691)+(((IkReal(-1.00000000000000))*(x1669)*(x1674)))+(((x1675)*(x1686)))+(((x1669)*(x1670)))+(((new_r21)*(x1683)))+(((IkReal(0.995371682851684))*(x1667)))+(((x1664)*(x1666)))+(((x1664)*(x1665)))+(((IkReal(-1.00000000000000))*(x1671)*(x1687)))+(((IkReal(-1.00000000000000))*(x1675)*(x1676))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -7589,6 +7853,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -7647,7 +7915,7 @@ evalcond[6]=((((x1710)*(x1714)))+(((IkReal(-1.00000000000000))*(x1712)*(x1713)))
 evalcond[7]=((((IkReal(-1.00000000000000))*(x1710)*(x1717)))+(x1739)+(((new_r21)*(x1719)))+(((IkReal(-1.00000000000000))*(x1707)*(x1712)))+(((IkReal(-1.00000000000000))*(x1705)*(x1728)))+(((IkReal(-0.0961000154891044))*(x1708)))+(((x1710)*(x1727)))+(((IkReal(-1.00000000000000))*(x1705)*(x1709)))+(((IkReal(-1.00000000000000))*(x1711)*(x1716)))+(((IkReal(-1.00000000000000))*(x1706)*(x1712)))+(((x1715)*(x1716))));
 evalcond[8]=((((x1710)*(x1718)))+(((IkReal(0.995371682851684))*(x1726)))+(((x1705)*(x1725)))+(x1739)+(((x1714)*(x1716)))+(((IkReal(-1.00000000000000))*(x1710)*(x1721)))+(((x1705)*(x1713)))+(((IkReal(-1.00000000000000))*(x1712)*(x1729)))+(((IkReal(-1.00000000000000))*(x1712)*(x1723)))+(((IkReal(-1.00000000000000))*(x1716)*(x1720)))+(((new_r20)*(x1724))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1710)*(x1715)))+(((x1710)*(x1711)))+(x1732)+(((IkReal(-1.00000000000000))*(x1716)*(x1717)))+(((IkReal(-1.00000000000000))*(x1709)*(x1712)))+(((IkReal(0.995371682851684))*(x1708)))+(((x1705)*(x1706)))+(((x1705)*(x1707)))+(((new_r21)*(x1724)))+(((IkReal(-1.00000000000000))*(x1712)*(x1728)))+(((x1716)*(x1727)))+(((IkReal(-1.00000000000000))*(x1733))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -7722,25 +7990,25 @@ evalcond[3]=((((IkReal(-0.996458924600913))*(cj3)))+(x1750)+(((IkReal(0.05485748
 evalcond[4]=((((IkReal(-0.997967801042053))*(x1743)))+(((IkReal(-0.997967801042053))*(x1741)))+(((IkReal(0.0637202329192957))*(x1740)))+(((IkReal(-0.0637202329192957))*(x1750))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(-1.00000000000000))*(x1741)*(x1744)))+(((IkReal(-1.00000000000000))*(x1741)*(x1745)))+(((IkReal(-1.00000000000000))*(x1740)*(x1746)))+(((x1746)*(x1750)))+(((IkReal(-0.0961000154891044))*(x1742)))+(((IkReal(-0.993348889555023))*(sj3)*(x1740)))+(((sj3)*(x1752)))+(((IkReal(0.995371682851684))*(x1747)))+(((IkReal(-1.00000000000000))*(x1743)*(x1745)))+(((IkReal(-1.00000000000000))*(x1743)*(x1744))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(0.0961000154891044))*(x1747)))+(((IkReal(-1.00000000000000))*(x1740)*(x1748)))+(((IkReal(0.993348889555023))*(cj3)*(x1740)))+(((x1748)*(x1750)))+(((IkReal(-1.00000000000000))*(cj3)*(x1752)))+(((x1743)*(x1749)))+(((IkReal(-1.00000000000000))*(x1743)*(x1751)))+(((IkReal(0.995371682851684))*(x1742)))+(((x1741)*(x1749)))+(((IkReal(-1.00000000000000))*(x1741)*(x1751))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst10;
 gconst10=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -7755,7 +8023,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x1753)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(-0.997967801042053))*(x1756)))+(((IkReal(-0.997967801042053))*(x1754)))+(((IkReal(0.0637202329192957))*(x1755)))+(((IkReal(-0.0637202329192957))*(x1753))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(0.997118800177265))*(x1755)))+(((IkReal(-0.997118800177265))*(x1753)))+(((IkReal(0.0636660242235878))*(x1756)))+(((IkReal(0.0636660242235878))*(x1754)))+(((IkReal(0.0412399400149127))*(new_r22))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(0.0411561322517886))*(x1755)))+(((IkReal(-0.0411561322517886))*(x1753)))+(((IkReal(0.00262781858332802))*(x1756)))+(((IkReal(0.00262781858332802))*(x1754)))+(((IkReal(-0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -7780,6 +8048,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -7814,7 +8086,7 @@ evalcond[8]=((((IkReal(0.0636660242235878))*(x1761)))+(((IkReal(0.06366602422358
 evalcond[9]=((((IkReal(0.0636660242235878))*(x1762)))+(((IkReal(0.0636660242235878))*(x1763)))+(((IkReal(-0.997118800177265))*(x1764)))+(((IkReal(0.999149271799077))*(x1758)))+(((IkReal(0.0412399400149127))*(new_r21)))+(((IkReal(0.997118800177265))*(x1765))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(new_r00)*(x1759)))+(((IkReal(0.00262781858332802))*(x1761)))+(((IkReal(0.00262781858332802))*(x1767)))+(((IkReal(0.0412399401475676))*(x1757)))+(((IkReal(0.0411561322517886))*(x1766)))+(((IkReal(-0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(0.00262781858332802))*(x1762)))+(((IkReal(0.00262781858332802))*(x1763)))+(((IkReal(-1.00000000000000))*(new_r01)*(x1759)))+(((IkReal(0.0412399401475676))*(x1758)))+(((IkReal(0.0411561322517886))*(x1765)))+(((IkReal(-0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -7876,7 +8148,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(((IkReal(-1.00000000000000))*(x177
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x1768)))+(((IkReal(0.0637202329192957))*(x1770)))+(((IkReal(-0.997967801042053))*(x1769)))+(((IkReal(-0.997967801042053))*(x1771))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(-0.0636660242235878))*(x1769)))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(-0.997118800177265))*(x1770)))+(((IkReal(-0.0636660242235878))*(x1771)))+(((IkReal(0.997118800177265))*(x1768))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(-0.00262781858332802))*(x1769)))+(((IkReal(-0.0411561322517886))*(x1770)))+(((IkReal(0.0411561322517886))*(x1768)))+(((IkReal(-0.00262781858332802))*(x1771)))+(((IkReal(0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -7901,6 +8173,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -7935,7 +8211,7 @@ evalcond[8]=((((IkReal(0.999149271799077))*(x1772)))+(((IkReal(-0.99711880017726
 evalcond[9]=((((IkReal(0.999149271799077))*(x1773)))+(((IkReal(-0.997118800177265))*(x1780)))+(((IkReal(0.997118800177265))*(x1779)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(-0.0636660242235878))*(x1777)))+(((IkReal(-0.0636660242235878))*(x1778))));
 evalcond[10]=((((IkReal(-0.00262781858332802))*(x1782)))+(((IkReal(0.0412399401475676))*(x1772)))+(((new_r00)*(x1774)))+(((IkReal(-0.00262781858332802))*(x1776)))+(((IkReal(-0.0411561322517886))*(x1781)))+(((IkReal(0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x1773)))+(((new_r01)*(x1774)))+(((IkReal(-0.00262781858332802))*(x1777)))+(((IkReal(-0.00262781858332802))*(x1778)))+(((IkReal(-0.0411561322517886))*(x1780)))+(((IkReal(0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8026,6 +8302,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -8080,7 +8360,7 @@ evalcond[8]=((((x1798)*(x1812)))+(((IkReal(-1.00000000000000))*(x1799)*(x1809)))
 evalcond[9]=((((IkReal(-0.0961000154891044))*(x1792)))+(((new_r21)*(x1803)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x1794)))+(((IkReal(-1.00000000000000))*(x1789)*(x1793)))+(((IkReal(0.999149271799077))*(x1788)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1794)))+(((IkReal(-1.00000000000000))*(x1791)*(x1809)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x1789)))+(((x1800)*(x1811)))+(((IkReal(-1.00000000000000))*(x1795)*(x1811)))+(((IkReal(-1.00000000000000))*(x1790)*(x1809))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x1797)*(x1813)))+(((IkReal(0.995371682851684))*(x1804)))+(((IkReal(-1.00000000000000))*(x1796)*(x1797)))+(((IkReal(0.993348889555023))*(new_r10)*(x1789)))+(((x1798)*(x1805)))+(((IkReal(-1.00000000000000))*(x1805)*(x1807)))+(((x1789)*(x1799)))+(((IkReal(0.0412399401475676))*(x1787)))+(((new_r20)*(x1808)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1794)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1794))));
 evalcond[11]=((((x1802)*(x1805)))+(((new_r21)*(x1808)))+(((IkReal(-1.00000000000000))*(x1797)*(x1801)))+(((IkReal(-1.00000000000000))*(x1805)*(x1806)))+(((IkReal(-1.00000000000000))*(x1794)*(x1800)))+(((x1789)*(x1791)))+(((x1789)*(x1790)))+(((x1794)*(x1795)))+(((IkReal(0.0412399401475676))*(x1788)))+(((IkReal(-1.00000000000000))*(x1793)*(x1809)))+(((IkReal(0.995371682851684))*(x1792))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8162,6 +8442,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -8216,7 +8500,7 @@ evalcond[8]=((((IkReal(-0.0634253154725807))*(sj3)*(x1831)))+(((IkReal(-1.000000
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1830)*(x1846)))+(((IkReal(0.999149271799077))*(x1823)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x1824)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x1829)))+(((IkReal(-0.0961000154891044))*(x1827)))+(((IkReal(-1.00000000000000))*(x1825)*(x1844)))+(((IkReal(-1.00000000000000))*(x1826)*(x1844)))+(((IkReal(-1.00000000000000))*(x1824)*(x1828)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1829)))+(((x1835)*(x1846)))+(((new_r21)*(x1838))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x1822)))+(((IkReal(0.995371682851684))*(x1839)))+(((x1824)*(x1834)))+(((IkReal(0.993348889555023))*(new_r10)*(x1824)))+(((x1833)*(x1840)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1829)))+(((IkReal(-1.00000000000000))*(x1840)*(x1842)))+(((IkReal(-1.00000000000000))*(x1831)*(x1832)))+(((IkReal(-1.00000000000000))*(x1832)*(x1848)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1829)))+(((new_r20)*(x1843))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x1823)))+(((IkReal(-1.00000000000000))*(x1832)*(x1836)))+(((x1837)*(x1840)))+(((IkReal(0.995371682851684))*(x1827)))+(((x1829)*(x1830)))+(((x1824)*(x1826)))+(((x1824)*(x1825)))+(((IkReal(-1.00000000000000))*(x1828)*(x1844)))+(((IkReal(-1.00000000000000))*(x1840)*(x1841)))+(((new_r21)*(x1843)))+(((IkReal(-1.00000000000000))*(x1829)*(x1835))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8295,6 +8579,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -8349,7 +8637,7 @@ evalcond[8]=((((IkReal(0.0959047211377687))*(new_r00)*(x1861)))+(((IkReal(-1.000
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1856)*(x1860)))+(((IkReal(-1.00000000000000))*(x1858)*(x1876)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x1856)))+(((IkReal(0.999149271799077))*(x1855)))+(((IkReal(-0.0961000154891044))*(x1859)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x1861)))+(((new_r21)*(x1870)))+(((IkReal(-1.00000000000000))*(x1857)*(x1876)))+(((IkReal(-1.00000000000000))*(x1862)*(x1878)))+(((x1867)*(x1878)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1861))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x1864)*(x1880)))+(((IkReal(-1.00000000000000))*(x1872)*(x1874)))+(((IkReal(0.0412399401475676))*(x1854)))+(((IkReal(0.993348889555023))*(new_r10)*(x1856)))+(((x1865)*(x1872)))+(((IkReal(-1.00000000000000))*(x1863)*(x1864)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1861)))+(((x1856)*(x1866)))+(((IkReal(0.995371682851684))*(x1871)))+(((new_r20)*(x1875)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1861))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x1864)*(x1868)))+(((IkReal(0.995371682851684))*(x1859)))+(((IkReal(-1.00000000000000))*(x1872)*(x1873)))+(((IkReal(0.0412399401475676))*(x1855)))+(((x1856)*(x1858)))+(((x1856)*(x1857)))+(((IkReal(-1.00000000000000))*(x1860)*(x1876)))+(((IkReal(-1.00000000000000))*(x1861)*(x1867)))+(((new_r21)*(x1875)))+(((x1869)*(x1872)))+(((x1861)*(x1862))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8451,6 +8739,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -8516,7 +8808,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r10)*(x1896)))+(((IkReal(0.99
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1906)*(x1921)))+(((new_r21)*(x1902)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1896)))+(((IkReal(-1.00000000000000))*(x1903)*(x1911)))+(((IkReal(-0.0961000154891044))*(x1899)))+(((x1900)*(x1913)))+(x1926)+(((IkReal(-1.00000000000000))*(x1897)*(x1913)))+(((IkReal(-1.00000000000000))*(x1903)*(x1920)))+(((IkReal(-1.00000000000000))*(x1906)*(x1915)))+(((IkReal(-1.00000000000000))*(cj2)*(x1923)))+(((IkReal(-1.00000000000000))*(x1896)*(x1916))));
 evalcond[10]=((((x1905)*(x1907)))+(((x1918)*(x1922)))+(((IkReal(-1.00000000000000))*(x1917)*(x1922)))+(((IkReal(-1.00000000000000))*(x1898)*(x1917)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1896)))+(((IkReal(-1.00000000000000))*(x1907)*(x1912)))+(x1923)+(((x1909)*(x1912)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1896)))+(((IkReal(-1.00000000000000))*(cj2)*(x1926)))+(((IkReal(0.995371682851684))*(x1908)))+(((new_r20)*(x1919))));
 evalcond[11]=((((new_r21)*(x1919)))+(((x1901)*(x1907)))+(((IkReal(-1.00000000000000))*(x1903)*(x1917)))+(((x1896)*(x1897)))+(((IkReal(0.995371682851684))*(x1899)))+(((x1903)*(x1918)))+(x1928)+(((IkReal(0.999149271799077))*(x1933)))+(((x1906)*(x1909)))+(((IkReal(-1.00000000000000))*(x1896)*(x1900)))+(((IkReal(-1.00000000000000))*(x1913)*(x1916)))+(((IkReal(-1.00000000000000))*(x1906)*(x1907))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8603,6 +8895,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -8668,7 +8964,7 @@ evalcond[8]=((((x1956)*(x1972)))+(((IkReal(0.0959047211377687))*(new_r00)*(x1947
 evalcond[9]=((((IkReal(-1.00000000000000))*(x1954)*(x1971)))+(((IkReal(-1.00000000000000))*(x1957)*(x1966)))+(((IkReal(-1.00000000000000))*(x1957)*(x1972)))+(((IkReal(-1.00000000000000))*(x1948)*(x1964)))+(((new_r21)*(x1953)))+(((x1951)*(x1964)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1947)))+(((IkReal(-1.00000000000000))*(x1947)*(x1967)))+(x1977)+(((IkReal(-1.00000000000000))*(cj2)*(x1974)))+(((IkReal(-0.0961000154891044))*(x1950)))+(((IkReal(-1.00000000000000))*(x1954)*(x1962))));
 evalcond[10]=((((x1969)*(x1973)))+(((IkReal(-1.00000000000000))*(x1958)*(x1963)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1947)))+(((IkReal(-1.00000000000000))*(x1949)*(x1968)))+(((IkReal(-1.00000000000000))*(x1968)*(x1973)))+(((IkReal(0.995371682851684))*(x1959)))+(x1974)+(((IkReal(-0.993348889555023))*(new_r00)*(x1947)))+(((new_r20)*(x1970)))+(((x1960)*(x1963)))+(((IkReal(-1.00000000000000))*(cj2)*(x1977)))+(((x1956)*(x1958))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x1957)*(x1958)))+(((x1952)*(x1958)))+(((IkReal(-1.00000000000000))*(x1964)*(x1967)))+(((IkReal(-1.00000000000000))*(x1947)*(x1951)))+(((x1954)*(x1969)))+(((new_r21)*(x1970)))+(((IkReal(0.995371682851684))*(x1950)))+(((x1957)*(x1960)))+(x1979)+(((IkReal(0.999149271799077))*(x1984)))+(((x1947)*(x1948)))+(((IkReal(-1.00000000000000))*(x1954)*(x1968))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8750,6 +9046,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -8815,7 +9115,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x2008)*(x2019)))+(((IkReal(-1.000000
 evalcond[9]=((((IkReal(-1.00000000000000))*(cj2)*(x2020)))+(((IkReal(0.0959047211377687))*(new_r01)*(x1993)))+(x2023)+(((IkReal(-1.00000000000000))*(x1993)*(x2013)))+(((IkReal(-1.00000000000000))*(x2003)*(x2012)))+(((IkReal(-1.00000000000000))*(x2003)*(x2018)))+(((IkReal(-1.00000000000000))*(x2000)*(x2008)))+(((new_r21)*(x1999)))+(((x1997)*(x2010)))+(((IkReal(-1.00000000000000))*(x2000)*(x2017)))+(((IkReal(-1.00000000000000))*(x1994)*(x2010)))+(((IkReal(-0.0961000154891044))*(x1996))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(cj2)*(x2023)))+(((x2002)*(x2004)))+(((IkReal(0.995371682851684))*(x2005)))+(((IkReal(-1.00000000000000))*(x2004)*(x2009)))+(((x2015)*(x2019)))+(x2020)+(((IkReal(-1.00000000000000))*(x2014)*(x2019)))+(((x2006)*(x2009)))+(((IkReal(-1.00000000000000))*(x1995)*(x2014)))+(((IkReal(-0.993348889555023))*(new_r00)*(x1993)))+(((IkReal(0.0634253154725807))*(new_r10)*(x1993)))+(((new_r20)*(x2016))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x1993)*(x1997)))+(((IkReal(-1.00000000000000))*(x2010)*(x2013)))+(((x2000)*(x2015)))+(((IkReal(-1.00000000000000))*(x2003)*(x2004)))+(x2025)+(((new_r21)*(x2016)))+(((IkReal(0.995371682851684))*(x1996)))+(((IkReal(0.999149271799077))*(x2030)))+(((x1993)*(x1994)))+(((IkReal(-1.00000000000000))*(x2000)*(x2014)))+(((x2003)*(x2006)))+(((x1998)*(x2004))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8903,6 +9203,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -8920,7 +9224,7 @@ IkReal x2039=((IkReal(0.0637202329192957))*(cj4));
 IkReal x2040=((IkReal(0.0637202329192957))*(sj4));
 evalcond[0]=((((IkReal(-1.00000000000000))*(new_r00)*(x2039)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2037)))+(((sj2)*(IKsin(j1))))+(((IkReal(-1.00000000000000))*(new_r10)*(x2038)))+(((new_r10)*(x2040))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(sj2)*(IKcos(j1))))+(((IkReal(-1.00000000000000))*(new_r01)*(x2037)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2039)))+(((IkReal(-1.00000000000000))*(new_r11)*(x2038)))+(((new_r11)*(x2040))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8931,17 +9235,17 @@ IkReal dummyeval[1];
 IkReal gconst11;
 gconst11=IKsign(((cj1)*(sj2)));
 dummyeval[0]=((IkReal(5.91473676321026e+15))*(cj1)*(sj2));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -8958,21 +9262,21 @@ evalcond[3]=((IkReal(0.0637202329192957))+(x2042)+(((IkReal(-1.00000000000000))*
 evalcond[4]=((IkReal(-1.00000000000000))+(((IkReal(-1.00000000000000))*(new_r02)*(x2041)))+(((IkReal(-1.00000000000000))*(new_r12)*(x2044)))+(((IkReal(0.0637202329192957))*(x2043)))+(((IkReal(-0.0637202329192957))*(x2042))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x2041)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2046)))+(((IkReal(-1.00000000000000))*(new_r10)*(x2044)))+(((new_r10)*(x2045))));
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r11)*(x2044)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2046)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2041)))+(((new_r11)*(x2045))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst12;
 gconst12=IKsign((((sj1)*(sj1))+((cj1)*(cj1))));
 dummyeval[0]=(((sj1)*(sj1))+((cj1)*(cj1)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst13;
 gconst13=IKsign(((((IkReal(-0.0637202329192957))*((cj1)*(cj1))))+(((IkReal(-0.0637202329192957))*((sj1)*(sj1))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((sj1)*(sj1))))+(((IkReal(-1.00000000000000))*((cj1)*(cj1)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -9008,6 +9312,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -9076,7 +9384,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x2067)*(x2088)))+(((IkReal(-1.000000
 evalcond[9]=((((IkReal(-1.00000000000000))*(new_r21)*(x2093)))+(((IkReal(-1.00000000000000))*(sj4)*(x2055)*(x2065)))+(x2057)+(((x2063)*(x2091)))+(((x2062)*(x2081)))+(((new_r21)*(x2084)))+(((IkReal(-1.00000000000000))*(x2061)*(x2078)))+(((IkReal(-1.00000000000000))*(x2070)*(x2088)))+(((IkReal(-1.00000000000000))*(x2069)*(x2091)))+(((IkReal(-1.00000000000000))*(x2056)))+(((IkReal(-0.00612351537051366))*(x2054)*(x2070)))+(((IkReal(-0.0634253154725807))*(sj4)*(x2081))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x2067)*(x2083)))+(((IkReal(0.993348889555023))*(x2054)*(x2071)))+(((IkReal(0.995371682851684))*(x2090)))+(((IkReal(-1.00000000000000))*(x2071)*(x2077)))+(x2056)+(((new_r20)*(x2073)))+(((IkReal(-1.00000000000000))*(x2061)*(x2074)))+(((IkReal(-1.00000000000000))*(x2062)*(x2082)))+(((IkReal(0.0634253154725807))*(new_r00)*(x2076)))+(((IkReal(-1.00000000000000))*(x2057)))+(((IkReal(0.0634253154725807))*(x2054)*(x2067)))+(((x2064)*(x2077))));
 evalcond[11]=((x2094)+(((IkReal(-1.00000000000000))*(x2070)*(x2083)))+(((IkReal(-1.00000000000000))*(x2069)*(x2077)))+(((IkReal(-1.00000000000000))*(x2061)*(x2081)))+(((x2063)*(x2077)))+(((IkReal(-1.00000000000000))*(x2062)*(x2078)))+(((new_r21)*(x2073)))+(((IkReal(0.995371682851684))*(new_r21)*(x2055)))+(((IkReal(0.0634253154725807))*(new_r01)*(x2076)))+(((IkReal(0.0634253154725807))*(x2054)*(x2070)))+(((x2065)*(x2076))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9157,6 +9465,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -9225,7 +9537,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x2119)*(x2139)))+(((new_r20)*(x2132)
 evalcond[9]=((((IkReal(-1.00000000000000))*(x2118)*(x2136)))+(((new_r21)*(x2132)))+(((IkReal(-1.00000000000000))*(x2109)*(x2126)))+(((IkReal(-1.00000000000000))*(x2117)*(x2139)))+(((IkReal(-0.00612351537051366))*(x2102)*(x2118)))+(((IkReal(-1.00000000000000))*(x2104)))+(((IkReal(-0.0634253154725807))*(sj4)*(x2129)))+(x2105)+(((x2110)*(x2129)))+(((IkReal(-1.00000000000000))*(sj4)*(x2103)*(x2113)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2141)))+(((x2111)*(x2139))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x2109)*(x2122)))+(((IkReal(0.993348889555023))*(x2102)*(x2119)))+(((IkReal(-1.00000000000000))*(x2119)*(x2125)))+(((IkReal(-1.00000000000000))*(x2105)))+(((x2112)*(x2125)))+(x2104)+(((IkReal(0.0634253154725807))*(new_r00)*(x2124)))+(((IkReal(0.0634253154725807))*(x2102)*(x2115)))+(((IkReal(-1.00000000000000))*(x2115)*(x2131)))+(((new_r20)*(x2121)))+(((IkReal(0.995371682851684))*(x2138)))+(((IkReal(-1.00000000000000))*(x2110)*(x2130))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x2117)*(x2125)))+(((IkReal(-1.00000000000000))*(x2118)*(x2131)))+(((IkReal(-1.00000000000000))*(x2109)*(x2129)))+(((IkReal(0.0634253154725807))*(new_r01)*(x2124)))+(((x2113)*(x2124)))+(x2142)+(((IkReal(0.0634253154725807))*(x2102)*(x2118)))+(((new_r21)*(x2121)))+(((x2111)*(x2125)))+(((IkReal(0.995371682851684))*(new_r21)*(x2103)))+(((IkReal(-1.00000000000000))*(x2110)*(x2126))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9293,21 +9605,21 @@ evalcond[3]=((IkReal(-0.0637202329192957))+(((IkReal(-1.00000000000000))*(x2149)
 evalcond[4]=((IkReal(1.00000000000000))+(((IkReal(0.0637202329192957))*(x2149)))+(((IkReal(-1.00000000000000))*(new_r12)*(x2150)))+(((IkReal(-1.00000000000000))*(new_r02)*(x2147)))+(((IkReal(-0.0637202329192957))*(x2148))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x2152)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2147)))+(((IkReal(-1.00000000000000))*(new_r10)*(x2150)))+(((new_r10)*(x2151))));
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x2152)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2147)))+(((IkReal(-1.00000000000000))*(new_r11)*(x2150)))+(((new_r11)*(x2151))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst14;
 gconst14=IKsign(((((IkReal(-1.00000000000000))*((sj1)*(sj1))))+(((IkReal(-1.00000000000000))*((cj1)*(cj1))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((sj1)*(sj1))))+(((IkReal(-1.00000000000000))*((cj1)*(cj1)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst15;
 gconst15=IKsign(((((IkReal(-0.0637202329192957))*((cj1)*(cj1))))+(((IkReal(-0.0637202329192957))*((sj1)*(sj1))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((sj1)*(sj1))))+(((IkReal(-1.00000000000000))*((cj1)*(cj1)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -9343,6 +9655,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -9411,7 +9727,7 @@ evalcond[8]=((((IkReal(-0.0961000154891044))*(x2196)))+(((IkReal(-1.000000000000
 evalcond[9]=((x2200)+(((IkReal(-1.00000000000000))*(x2175)*(x2197)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2199)))+(((x2168)*(x2187)))+(((x2169)*(x2197)))+(((IkReal(-0.00612351537051366))*(x2160)*(x2176)))+(((IkReal(-1.00000000000000))*(sj4)*(x2161)*(x2171)))+(((new_r21)*(x2190)))+(((IkReal(-1.00000000000000))*(x2176)*(x2194)))+(((IkReal(-0.0634253154725807))*(sj4)*(x2187)))+(((IkReal(-1.00000000000000))*(x2167)*(x2184))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x2173)*(x2189)))+(x2200)+(((IkReal(0.995371682851684))*(x2196)))+(((IkReal(0.993348889555023))*(x2160)*(x2177)))+(((new_r20)*(x2179)))+(((IkReal(-1.00000000000000))*(x2168)*(x2188)))+(((IkReal(0.0634253154725807))*(x2160)*(x2173)))+(((IkReal(-1.00000000000000))*(x2177)*(x2183)))+(((x2170)*(x2183)))+(((IkReal(0.0634253154725807))*(new_r00)*(x2182)))+(((IkReal(-1.00000000000000))*(x2167)*(x2180))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x2175)*(x2183)))+(x2164)+(((x2169)*(x2183)))+(((IkReal(-1.00000000000000))*(x2168)*(x2184)))+(((IkReal(0.0634253154725807))*(x2160)*(x2176)))+(((IkReal(-1.00000000000000))*(x2176)*(x2189)))+(((IkReal(-1.00000000000000))*(x2165)))+(((IkReal(0.0634253154725807))*(new_r01)*(x2182)))+(((new_r21)*(x2179)))+(((IkReal(0.995371682851684))*(new_r21)*(x2161)))+(((IkReal(-1.00000000000000))*(x2167)*(x2187)))+(((x2171)*(x2182))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9493,6 +9809,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -9561,7 +9881,7 @@ evalcond[8]=((x2214)+(((IkReal(-1.00000000000000))*(x2222)*(x2243)))+(((IkReal(-
 evalcond[9]=((x2249)+(((IkReal(-1.00000000000000))*(x2225)*(x2243)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2248)))+(((new_r21)*(x2239)))+(((IkReal(-1.00000000000000))*(sj4)*(x2210)*(x2220)))+(((IkReal(-0.0634253154725807))*(sj4)*(x2236)))+(((x2218)*(x2246)))+(((x2217)*(x2236)))+(((IkReal(-0.00612351537051366))*(x2209)*(x2225)))+(((IkReal(-1.00000000000000))*(x2216)*(x2233)))+(((IkReal(-1.00000000000000))*(x2224)*(x2246))));
 evalcond[10]=((((IkReal(0.993348889555023))*(x2209)*(x2226)))+(x2249)+(((IkReal(-1.00000000000000))*(x2222)*(x2238)))+(((IkReal(-1.00000000000000))*(x2226)*(x2232)))+(((new_r20)*(x2228)))+(((IkReal(-1.00000000000000))*(x2217)*(x2237)))+(((IkReal(0.0634253154725807))*(new_r00)*(x2231)))+(((x2219)*(x2232)))+(((IkReal(0.995371682851684))*(x2245)))+(((IkReal(-1.00000000000000))*(x2216)*(x2229)))+(((IkReal(0.0634253154725807))*(x2209)*(x2222))));
 evalcond[11]=((x2213)+(((IkReal(-1.00000000000000))*(x2225)*(x2238)))+(((IkReal(-1.00000000000000))*(x2224)*(x2232)))+(((IkReal(-1.00000000000000))*(x2214)))+(((IkReal(-1.00000000000000))*(x2217)*(x2233)))+(((new_r21)*(x2228)))+(((x2218)*(x2232)))+(((IkReal(0.0634253154725807))*(new_r01)*(x2231)))+(((IkReal(-1.00000000000000))*(x2216)*(x2236)))+(((x2220)*(x2231)))+(((IkReal(0.995371682851684))*(new_r21)*(x2210)))+(((IkReal(0.0634253154725807))*(x2209)*(x2225))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9624,21 +9944,21 @@ evalcond[0]=((IkReal(-3.14159265358979))+(IKfmod(((IkReal(1.57079632679490))+(j1
 evalcond[1]=((((new_r12)*(x2255)))+(((IkReal(-1.00000000000000))*(new_r02)*(x2254)))+(((IkReal(-1.00000000000000))*(new_r02)*(x2257)))+(((IkReal(-1.00000000000000))*(new_r12)*(x2256)))+(((IkReal(-1.00000000000000))*(cj2))));
 evalcond[2]=((sj2)+(((new_r10)*(x2255)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2254)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2257)))+(((IkReal(-1.00000000000000))*(new_r10)*(x2256))));
 evalcond[3]=((((new_r11)*(x2255)))+(((IkReal(-1.00000000000000))*(new_r11)*(x2256)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2254)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2257))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst16;
 gconst16=IKsign(sj2);
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst17;
 gconst17=IKsign(cj2);
 dummyeval[0]=cj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -9653,7 +9973,7 @@ evalcond[3]=((((IkReal(-1.00000000000000))*(new_r11)*(x2260)))+(((IkReal(-1.0000
 evalcond[4]=new_r20;
 evalcond[5]=((IkReal(-0.997967801042053))+(((cj4)*(new_r10)))+(((new_r00)*(sj4))));
 evalcond[6]=((IkReal(-0.0637202329192957))+(((cj4)*(new_r00)))+(((IkReal(-1.00000000000000))*(new_r10)*(sj4))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[1], cj3array[1], sj3array[1];
@@ -9678,6 +9998,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -9736,7 +10060,7 @@ evalcond[8]=((((new_r20)*(x2290)))+(((IkReal(-1.00000000000000))*(x2266)*(x2293)
 evalcond[9]=((IkReal(0.999149271799077))+(((IkReal(-1.00000000000000))*(x2271)*(x2292)))+(((IkReal(-1.00000000000000))*(x2282)*(x2289)))+(((IkReal(-1.00000000000000))*(x2267)*(x2293)))+(((x2265)*(x2289)))+(((IkReal(-1.00000000000000))*(x2286)*(x2292)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2296)))+(((IkReal(-1.00000000000000))*(x2274)*(x2291)))+(((new_r21)*(x2290)))+(((IkReal(-1.00000000000000))*(x2270)*(x2291)))+(((x2273)*(x2293))));
 evalcond[10]=((((new_r20)*(x2294)))+(((new_r20)*(x2295)))+(((x2280)*(x2292)))+(((IkReal(-1.00000000000000))*(x2276)*(x2291)))+(((x2272)*(x2293)))+(((x2277)*(x2289)))+(((IkReal(-1.00000000000000))*(x2268)*(x2291)))+(((x2281)*(x2292)))+(((IkReal(-1.00000000000000))*(x2275)*(x2293)))+(((IkReal(-1.00000000000000))*(x2266)*(x2289))));
 evalcond[11]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2271)*(x2291)))+(((IkReal(-1.00000000000000))*(x2286)*(x2291)))+(((IkReal(-1.00000000000000))*(x2267)*(x2289)))+(((new_r21)*(x2295)))+(((new_r21)*(x2294)))+(((x2282)*(x2293)))+(((x2273)*(x2289)))+(((x2270)*(x2292)))+(((x2274)*(x2292)))+(((IkReal(-1.00000000000000))*(x2265)*(x2293))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9798,7 +10122,7 @@ evalcond[3]=((((IkReal(-1.00000000000000))*(new_r01)*(x2297)))+(((IkReal(-1.0000
 evalcond[4]=new_r20;
 evalcond[5]=((IkReal(0.997967801042053))+(((cj4)*(new_r10)))+(((new_r00)*(sj4))));
 evalcond[6]=((IkReal(0.0637202329192957))+(((cj4)*(new_r00)))+(((IkReal(-1.00000000000000))*(new_r10)*(sj4))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[1], cj3array[1], sj3array[1];
@@ -9823,6 +10147,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -9881,7 +10209,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x2305)*(x2332)))+(((IkReal(-1.000000
 evalcond[9]=((IkReal(0.999149271799077))+(((IkReal(-1.00000000000000))*(x2321)*(x2328)))+(((x2304)*(x2328)))+(((IkReal(-1.00000000000000))*(x2309)*(x2330)))+(((IkReal(-1.00000000000000))*(x2313)*(x2330)))+(((new_r21)*(x2329)))+(((IkReal(-1.00000000000000))*(x2306)*(x2332)))+(((IkReal(-1.00000000000000))*(x2310)*(x2331)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2335)))+(((IkReal(-1.00000000000000))*(x2325)*(x2331)))+(((x2312)*(x2332))));
 evalcond[10]=((((x2316)*(x2328)))+(((x2319)*(x2331)))+(((IkReal(-1.00000000000000))*(x2315)*(x2330)))+(((x2320)*(x2331)))+(((IkReal(-1.00000000000000))*(x2307)*(x2330)))+(((new_r20)*(x2334)))+(((new_r20)*(x2333)))+(((IkReal(-1.00000000000000))*(x2314)*(x2332)))+(((x2311)*(x2332)))+(((IkReal(-1.00000000000000))*(x2305)*(x2328))));
 evalcond[11]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2304)*(x2332)))+(((x2312)*(x2328)))+(((x2313)*(x2331)))+(((x2309)*(x2331)))+(((x2321)*(x2332)))+(((new_r21)*(x2333)))+(((new_r21)*(x2334)))+(((IkReal(-1.00000000000000))*(x2310)*(x2330)))+(((IkReal(-1.00000000000000))*(x2325)*(x2330)))+(((IkReal(-1.00000000000000))*(x2306)*(x2328))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9945,7 +10273,7 @@ evalcond[3]=((IkReal(0.0637202329192957))+(x2337)+(((IkReal(-1.00000000000000))*
 evalcond[4]=((IkReal(-1.00000000000000))+(((IkReal(0.0637202329192957))*(x2338)))+(((IkReal(-1.00000000000000))*(new_r02)*(x2336)))+(((IkReal(-0.0637202329192957))*(x2337)))+(((IkReal(-1.00000000000000))*(new_r12)*(x2339))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x2341)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2336)))+(((IkReal(-1.00000000000000))*(new_r10)*(x2339)))+(((new_r10)*(x2340))));
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x2341)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2336)))+(((IkReal(-1.00000000000000))*(new_r11)*(x2339)))+(((new_r11)*(x2340))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[1], cj3array[1], sj3array[1];
@@ -9970,6 +10298,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -10028,7 +10360,7 @@ evalcond[8]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2346)*
 evalcond[9]=((IkReal(0.999149271799077))+(((IkReal(-1.00000000000000))*(x2355)*(x2371)))+(((x2345)*(x2369)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2376)))+(((IkReal(-1.00000000000000))*(x2351)*(x2371)))+(((IkReal(-1.00000000000000))*(x2364)*(x2369)))+(((IkReal(-1.00000000000000))*(x2348)*(x2373)))+(((x2354)*(x2373)))+(((new_r21)*(x2370)))+(((IkReal(-1.00000000000000))*(x2363)*(x2372)))+(((IkReal(-1.00000000000000))*(x2352)*(x2372))));
 evalcond[10]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(x2349)*(x2371)))+(((IkReal(-1.00000000000000))*(x2357)*(x2371)))+(((IkReal(-1.00000000000000))*(x2356)*(x2373)))+(((x2347)*(x2369)))+(((x2353)*(x2373)))+(((x2361)*(x2372)))+(((new_r20)*(x2375)))+(((new_r20)*(x2374)))+(((x2362)*(x2372)))+(((IkReal(-1.00000000000000))*(x2346)*(x2369))));
 evalcond[11]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2345)*(x2373)))+(((x2364)*(x2373)))+(((x2351)*(x2372)))+(((x2355)*(x2372)))+(((x2354)*(x2369)))+(((IkReal(-1.00000000000000))*(x2348)*(x2369)))+(((new_r21)*(x2374)))+(((new_r21)*(x2375)))+(((IkReal(-1.00000000000000))*(x2363)*(x2371)))+(((IkReal(-1.00000000000000))*(x2352)*(x2371))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10092,7 +10424,7 @@ evalcond[3]=((IkReal(-0.0637202329192957))+(x2378)+(((IkReal(-1.00000000000000))
 evalcond[4]=((IkReal(1.00000000000000))+(((IkReal(0.0637202329192957))*(x2379)))+(((IkReal(-1.00000000000000))*(new_r12)*(x2380)))+(((IkReal(-0.0637202329192957))*(x2378)))+(((IkReal(-1.00000000000000))*(new_r02)*(x2377))));
 evalcond[5]=((((new_r10)*(x2381)))+(((IkReal(-1.00000000000000))*(new_r10)*(x2380)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2377)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2382))));
 evalcond[6]=((((new_r11)*(x2381)))+(((IkReal(-1.00000000000000))*(new_r11)*(x2380)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2377)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2382))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[1], cj3array[1], sj3array[1];
@@ -10117,6 +10449,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -10175,7 +10511,7 @@ evalcond[8]=((IkReal(-0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2402)
 evalcond[9]=((IkReal(0.999149271799077))+(((x2386)*(x2410)))+(((x2395)*(x2414)))+(((IkReal(-1.00000000000000))*(x2396)*(x2412)))+(((IkReal(-1.00000000000000))*(x2405)*(x2410)))+(((IkReal(-1.00000000000000))*(x2404)*(x2413)))+(((IkReal(-1.00000000000000))*(x2389)*(x2414)))+(((IkReal(-1.00000000000000))*(x2393)*(x2413)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2417)))+(((IkReal(-1.00000000000000))*(x2392)*(x2412)))+(((new_r21)*(x2411))));
 evalcond[10]=((IkReal(0.999149271799077))+(((x2388)*(x2410)))+(((IkReal(-1.00000000000000))*(x2387)*(x2410)))+(((IkReal(-1.00000000000000))*(x2390)*(x2412)))+(((IkReal(-1.00000000000000))*(x2397)*(x2414)))+(((new_r20)*(x2416)))+(((new_r20)*(x2415)))+(((x2402)*(x2413)))+(((IkReal(-1.00000000000000))*(x2398)*(x2412)))+(((x2403)*(x2413)))+(((x2394)*(x2414))));
 evalcond[11]=((IkReal(0.0412399401475676))+(((x2405)*(x2414)))+(((x2392)*(x2413)))+(((x2395)*(x2410)))+(((IkReal(-1.00000000000000))*(x2404)*(x2412)))+(((IkReal(-1.00000000000000))*(x2389)*(x2410)))+(((IkReal(-1.00000000000000))*(x2386)*(x2414)))+(((IkReal(-1.00000000000000))*(x2393)*(x2412)))+(((x2396)*(x2413)))+(((new_r21)*(x2415)))+(((new_r21)*(x2416))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10265,6 +10601,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -10331,7 +10671,7 @@ evalcond[11]=((((IkReal(-1.00000000000000))*(x2430)*(x2454)))+(((IkReal(-1.00000
 evalcond[12]=((IkReal(0.999149271799077))+(((IkReal(-1.00000000000000))*(x2428)*(x2454)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2453)))+(((IkReal(-1.00000000000000))*(x2429)*(x2452)))+(((IkReal(-1.00000000000000))*(sj4)*(x2419)*(x2425)))+(((new_r21)*(x2447)))+(((IkReal(-0.00612351537051366))*(x2420)*(x2429)))+(((x2422)*(x2444)))+(((x2423)*(x2454)))+(((IkReal(-1.00000000000000))*(x2421)*(x2442)))+(((IkReal(-0.0634253154725807))*(sj4)*(x2444))));
 evalcond[13]=((((IkReal(0.993348889555023))*(x2420)*(x2430)))+(((IkReal(-1.00000000000000))*(x2427)*(x2446)))+(((IkReal(-1.00000000000000))*(x2430)*(x2441)))+(((IkReal(-1.00000000000000))*(x2421)*(x2434)))+(((IkReal(-1.00000000000000))*(x2422)*(x2445)))+(((x2424)*(x2441)))+(((IkReal(-0.999149271799077))*(cj2)))+(((IkReal(0.0634253154725807))*(x2420)*(x2427)))+(((IkReal(0.0634253154725807))*(new_r00)*(x2440)))+(((new_r20)*(x2439)))+(((new_r20)*(x2437))));
 evalcond[14]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2429)*(x2446)))+(((IkReal(-1.00000000000000))*(x2428)*(x2441)))+(((IkReal(-1.00000000000000))*(x2422)*(x2442)))+(((x2423)*(x2441)))+(((new_r21)*(x2439)))+(((new_r21)*(x2437)))+(((x2425)*(x2440)))+(((IkReal(0.0634253154725807))*(x2420)*(x2429)))+(((IkReal(-1.00000000000000))*(x2421)*(x2444)))+(((IkReal(0.0634253154725807))*(new_r01)*(x2440))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10410,6 +10750,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -10476,7 +10820,7 @@ evalcond[11]=((((IkReal(-1.00000000000000))*(x2462)*(x2486)))+(((IkReal(-1.00000
 evalcond[12]=((IkReal(0.999149271799077))+(((IkReal(-0.00612351537051366))*(x2461)*(x2470)))+(((IkReal(-1.00000000000000))*(x2462)*(x2483)))+(((x2464)*(x2495)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2494)))+(((IkReal(-1.00000000000000))*(x2469)*(x2495)))+(((IkReal(-0.0634253154725807))*(sj4)*(x2485)))+(((IkReal(-1.00000000000000))*(x2470)*(x2493)))+(((x2463)*(x2485)))+(((new_r21)*(x2488)))+(((IkReal(-1.00000000000000))*(sj4)*(x2460)*(x2466))));
 evalcond[13]=((((IkReal(0.0634253154725807))*(new_r00)*(x2481)))+(((x2465)*(x2482)))+(((IkReal(-1.00000000000000))*(x2463)*(x2486)))+(((IkReal(-1.00000000000000))*(x2468)*(x2487)))+(((IkReal(0.993348889555023))*(x2461)*(x2471)))+(((IkReal(-0.999149271799077))*(cj2)))+(((new_r20)*(x2478)))+(((new_r20)*(x2480)))+(((IkReal(-1.00000000000000))*(x2462)*(x2475)))+(((IkReal(0.0634253154725807))*(x2461)*(x2468)))+(((IkReal(-1.00000000000000))*(x2471)*(x2482))));
 evalcond[14]=((IkReal(0.0412399401475676))+(((IkReal(0.0634253154725807))*(new_r01)*(x2481)))+(((IkReal(-1.00000000000000))*(x2463)*(x2483)))+(((IkReal(0.0634253154725807))*(x2461)*(x2470)))+(((IkReal(-1.00000000000000))*(x2462)*(x2485)))+(((x2466)*(x2481)))+(((x2464)*(x2482)))+(((IkReal(-1.00000000000000))*(x2469)*(x2482)))+(((new_r21)*(x2478)))+(((IkReal(-1.00000000000000))*(x2470)*(x2487)))+(((new_r21)*(x2480))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10539,21 +10883,21 @@ evalcond[0]=((IkReal(-3.14159265358979))+(IKfmod(((IkReal(4.71238898038469))+(j1
 evalcond[1]=((((IkReal(-1.00000000000000))*(new_r02)*(x2500)))+(((IkReal(-1.00000000000000))*(new_r02)*(x2503)))+(((new_r12)*(x2501)))+(((IkReal(-1.00000000000000))*(new_r12)*(x2502)))+(((IkReal(-1.00000000000000))*(cj2))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(new_r00)*(x2500)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2503)))+(((IkReal(-1.00000000000000))*(sj2)))+(((new_r10)*(x2501)))+(((IkReal(-1.00000000000000))*(new_r10)*(x2502))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(new_r01)*(x2500)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2503)))+(((new_r11)*(x2501)))+(((IkReal(-1.00000000000000))*(new_r11)*(x2502))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst18;
 gconst18=IKsign(sj2);
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst19;
 gconst19=IKsign(cj2);
 dummyeval[0]=cj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -10568,7 +10912,7 @@ evalcond[3]=((((IkReal(-1.00000000000000))*(new_r01)*(x2507)))+(((IkReal(-1.0000
 evalcond[4]=new_r20;
 evalcond[5]=((IkReal(0.997967801042053))+(((cj4)*(new_r10)))+(((new_r00)*(sj4))));
 evalcond[6]=((IkReal(0.0637202329192957))+(((cj4)*(new_r00)))+(((IkReal(-1.00000000000000))*(new_r10)*(sj4))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[1], cj3array[1], sj3array[1];
@@ -10593,6 +10937,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -10651,7 +10999,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x2522)*(x2538)))+(((x2521)*(x2535)))
 evalcond[9]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(x2528)*(x2535)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2542)))+(((x2511)*(x2535)))+(((IkReal(-1.00000000000000))*(x2520)*(x2537)))+(((new_r21)*(x2536)))+(((IkReal(-1.00000000000000))*(x2513)*(x2539)))+(((x2519)*(x2539)))+(((IkReal(-1.00000000000000))*(x2516)*(x2537)))+(((IkReal(-1.00000000000000))*(x2532)*(x2538)))+(((IkReal(-1.00000000000000))*(x2517)*(x2538))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x2522)*(x2537)))+(((x2526)*(x2538)))+(((x2518)*(x2539)))+(((x2523)*(x2535)))+(((new_r20)*(x2540)))+(((new_r20)*(x2541)))+(((IkReal(-1.00000000000000))*(x2514)*(x2537)))+(((x2527)*(x2538)))+(((IkReal(-1.00000000000000))*(x2521)*(x2539)))+(((IkReal(-1.00000000000000))*(x2512)*(x2535))));
 evalcond[11]=((IkReal(-0.0412399401475676))+(((x2520)*(x2538)))+(((x2516)*(x2538)))+(((IkReal(-1.00000000000000))*(x2511)*(x2539)))+(((IkReal(-1.00000000000000))*(x2513)*(x2535)))+(((x2519)*(x2535)))+(((new_r21)*(x2541)))+(((new_r21)*(x2540)))+(((IkReal(-1.00000000000000))*(x2532)*(x2537)))+(((IkReal(-1.00000000000000))*(x2517)*(x2537)))+(((x2528)*(x2539))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10713,7 +11061,7 @@ evalcond[3]=((((IkReal(-1.00000000000000))*(new_r11)*(x2545)))+(((IkReal(-1.0000
 evalcond[4]=new_r20;
 evalcond[5]=((IkReal(-0.997967801042053))+(((cj4)*(new_r10)))+(((new_r00)*(sj4))));
 evalcond[6]=((IkReal(-0.0637202329192957))+(((cj4)*(new_r00)))+(((IkReal(-1.00000000000000))*(new_r10)*(sj4))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[1], cj3array[1], sj3array[1];
@@ -10738,6 +11086,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -10796,7 +11148,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x2566)*(x2576)))+(((x2560)*(x2574)))
 evalcond[9]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(x2571)*(x2577)))+(((IkReal(-1.00000000000000))*(x2556)*(x2577)))+(((x2550)*(x2574)))+(((x2558)*(x2578)))+(((IkReal(-1.00000000000000))*(x2555)*(x2576)))+(((IkReal(-1.00000000000000))*(x2559)*(x2576)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2581)))+(((IkReal(-1.00000000000000))*(x2567)*(x2574)))+(((IkReal(-1.00000000000000))*(x2552)*(x2578)))+(((new_r21)*(x2575))));
 evalcond[10]=((((new_r20)*(x2579)))+(((new_r20)*(x2580)))+(((x2557)*(x2578)))+(((x2566)*(x2577)))+(((IkReal(-1.00000000000000))*(x2553)*(x2576)))+(((x2565)*(x2577)))+(((IkReal(-1.00000000000000))*(x2560)*(x2578)))+(((x2562)*(x2574)))+(((IkReal(-1.00000000000000))*(x2551)*(x2574)))+(((IkReal(-1.00000000000000))*(x2561)*(x2576))));
 evalcond[11]=((IkReal(-0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2571)*(x2576)))+(((x2567)*(x2578)))+(((IkReal(-1.00000000000000))*(x2550)*(x2578)))+(((IkReal(-1.00000000000000))*(x2556)*(x2576)))+(((x2558)*(x2574)))+(((x2559)*(x2577)))+(((x2555)*(x2577)))+(((new_r21)*(x2580)))+(((IkReal(-1.00000000000000))*(x2552)*(x2574)))+(((new_r21)*(x2579))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10860,7 +11212,7 @@ evalcond[3]=((IkReal(0.0637202329192957))+(x2583)+(((IkReal(-1.00000000000000))*
 evalcond[4]=((IkReal(-1.00000000000000))+(((IkReal(0.0637202329192957))*(x2584)))+(((IkReal(-0.0637202329192957))*(x2583)))+(((IkReal(-1.00000000000000))*(new_r12)*(x2585)))+(((IkReal(-1.00000000000000))*(new_r02)*(x2582))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x2582)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2587)))+(((IkReal(-1.00000000000000))*(new_r10)*(x2585)))+(((new_r10)*(x2586))));
 evalcond[6]=((((new_r11)*(x2586)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2582)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2587)))+(((IkReal(-1.00000000000000))*(new_r11)*(x2585))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[1], cj3array[1], sj3array[1];
@@ -10885,6 +11237,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -10943,7 +11299,7 @@ evalcond[8]=((IkReal(-0.0412399401475676))+(((new_r20)*(x2616)))+(((IkReal(-1.00
 evalcond[9]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(x2609)*(x2618)))+(((IkReal(-1.00000000000000))*(x2597)*(x2617)))+(((IkReal(-1.00000000000000))*(x2610)*(x2615)))+(((new_r21)*(x2616)))+(((x2600)*(x2619)))+(((IkReal(-1.00000000000000))*(x2594)*(x2619)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2622)))+(((x2591)*(x2615)))+(((IkReal(-1.00000000000000))*(x2601)*(x2617)))+(((IkReal(-1.00000000000000))*(x2598)*(x2618))));
 evalcond[10]=((IkReal(0.999149271799077))+(((new_r20)*(x2621)))+(((new_r20)*(x2620)))+(((IkReal(-1.00000000000000))*(x2595)*(x2617)))+(((IkReal(-1.00000000000000))*(x2592)*(x2615)))+(((IkReal(-1.00000000000000))*(x2602)*(x2619)))+(((x2599)*(x2619)))+(((x2608)*(x2618)))+(((IkReal(-1.00000000000000))*(x2603)*(x2617)))+(((x2593)*(x2615)))+(((x2607)*(x2618))));
 evalcond[11]=((IkReal(-0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2609)*(x2617)))+(((x2610)*(x2619)))+(((new_r21)*(x2620)))+(((new_r21)*(x2621)))+(((x2597)*(x2618)))+(((x2601)*(x2618)))+(((IkReal(-1.00000000000000))*(x2591)*(x2619)))+(((x2600)*(x2615)))+(((IkReal(-1.00000000000000))*(x2594)*(x2615)))+(((IkReal(-1.00000000000000))*(x2598)*(x2617))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11007,7 +11363,7 @@ evalcond[3]=((IkReal(-0.0637202329192957))+(((IkReal(-1.00000000000000))*(x2625)
 evalcond[4]=((IkReal(1.00000000000000))+(((IkReal(-0.0637202329192957))*(x2624)))+(((IkReal(0.0637202329192957))*(x2625)))+(((IkReal(-1.00000000000000))*(new_r02)*(x2623)))+(((IkReal(-1.00000000000000))*(new_r12)*(x2626))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(new_r10)*(x2626)))+(((new_r10)*(x2627)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2628)))+(((IkReal(-1.00000000000000))*(new_r00)*(x2623))));
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r11)*(x2626)))+(((new_r11)*(x2627)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2623)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2628))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j3array[1], cj3array[1], sj3array[1];
@@ -11032,6 +11388,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -11090,7 +11450,7 @@ evalcond[8]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2644)*
 evalcond[9]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(x2651)*(x2656)))+(((new_r21)*(x2657)))+(((IkReal(-1.00000000000000))*(x2650)*(x2659)))+(((x2632)*(x2656)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2663)))+(((IkReal(-1.00000000000000))*(x2642)*(x2658)))+(((x2641)*(x2660)))+(((IkReal(-1.00000000000000))*(x2639)*(x2659)))+(((IkReal(-1.00000000000000))*(x2635)*(x2660)))+(((IkReal(-1.00000000000000))*(x2638)*(x2658))));
 evalcond[10]=((IkReal(-0.999149271799077))+(((x2649)*(x2659)))+(((IkReal(-1.00000000000000))*(x2644)*(x2658)))+(((x2648)*(x2659)))+(((new_r20)*(x2662)))+(((new_r20)*(x2661)))+(((IkReal(-1.00000000000000))*(x2643)*(x2660)))+(((x2640)*(x2660)))+(((IkReal(-1.00000000000000))*(x2636)*(x2658)))+(((x2634)*(x2656)))+(((IkReal(-1.00000000000000))*(x2633)*(x2656))));
 evalcond[11]=((IkReal(-0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2635)*(x2656)))+(((IkReal(-1.00000000000000))*(x2650)*(x2658)))+(((x2638)*(x2659)))+(((x2651)*(x2660)))+(((x2642)*(x2659)))+(((IkReal(-1.00000000000000))*(x2632)*(x2660)))+(((IkReal(-1.00000000000000))*(x2639)*(x2658)))+(((x2641)*(x2656)))+(((new_r21)*(x2661)))+(((new_r21)*(x2662))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11180,6 +11540,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -11246,7 +11610,7 @@ evalcond[11]=((((IkReal(-0.00612351537051366))*(x2666)*(x2673)))+(((IkReal(-0.06
 evalcond[12]=((IkReal(-0.999149271799077))+(((x2668)*(x2690)))+(((IkReal(-0.00612351537051366))*(x2666)*(x2675)))+(((IkReal(-1.00000000000000))*(x2674)*(x2700)))+(((IkReal(-0.0634253154725807))*(sj4)*(x2690)))+(((IkReal(-1.00000000000000))*(sj4)*(x2665)*(x2671)))+(((IkReal(-1.00000000000000))*(x2675)*(x2698)))+(((IkReal(-1.00000000000000))*(x2667)*(x2688)))+(((new_r21)*(x2693)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2699)))+(((x2669)*(x2700))));
 evalcond[13]=((((IkReal(0.0634253154725807))*(new_r00)*(x2686)))+(((x2670)*(x2687)))+(((IkReal(-1.00000000000000))*(x2676)*(x2687)))+(((IkReal(0.0634253154725807))*(x2666)*(x2673)))+(((new_r20)*(x2683)))+(((new_r20)*(x2685)))+(((IkReal(0.999149271799077))*(cj2)))+(((IkReal(-1.00000000000000))*(x2667)*(x2680)))+(((IkReal(-1.00000000000000))*(x2668)*(x2691)))+(((IkReal(-1.00000000000000))*(x2673)*(x2692)))+(((IkReal(0.993348889555023))*(x2666)*(x2676))));
 evalcond[14]=((IkReal(-0.0412399401475676))+(((IkReal(0.0634253154725807))*(new_r01)*(x2686)))+(((IkReal(0.0634253154725807))*(x2666)*(x2675)))+(((IkReal(-1.00000000000000))*(x2668)*(x2688)))+(((x2671)*(x2686)))+(((IkReal(-1.00000000000000))*(x2675)*(x2692)))+(((new_r21)*(x2685)))+(((new_r21)*(x2683)))+(((IkReal(-1.00000000000000))*(x2667)*(x2690)))+(((IkReal(-1.00000000000000))*(x2674)*(x2687)))+(((x2669)*(x2687))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11325,6 +11689,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -11391,7 +11759,7 @@ evalcond[11]=((((x2711)*(x2741)))+(((IkReal(-1.00000000000000))*(x2717)*(x2741))
 evalcond[12]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(new_r21)*(x2740)))+(((IkReal(-0.0634253154725807))*(sj4)*(x2731)))+(((IkReal(-1.00000000000000))*(x2708)*(x2729)))+(((x2710)*(x2741)))+(((IkReal(-0.00612351537051366))*(x2707)*(x2716)))+(((x2709)*(x2731)))+(((new_r21)*(x2734)))+(((IkReal(-1.00000000000000))*(x2716)*(x2739)))+(((IkReal(-1.00000000000000))*(x2715)*(x2741)))+(((IkReal(-1.00000000000000))*(sj4)*(x2706)*(x2712))));
 evalcond[13]=((((IkReal(-1.00000000000000))*(x2708)*(x2721)))+(((IkReal(-1.00000000000000))*(x2709)*(x2732)))+(((new_r20)*(x2724)))+(((new_r20)*(x2726)))+(((IkReal(0.999149271799077))*(cj2)))+(((IkReal(-1.00000000000000))*(x2717)*(x2728)))+(((IkReal(0.993348889555023))*(x2707)*(x2717)))+(((IkReal(-1.00000000000000))*(x2714)*(x2733)))+(((IkReal(0.0634253154725807))*(new_r00)*(x2727)))+(((IkReal(0.0634253154725807))*(x2707)*(x2714)))+(((x2711)*(x2728))));
 evalcond[14]=((IkReal(-0.0412399401475676))+(((IkReal(-1.00000000000000))*(x2708)*(x2731)))+(((IkReal(-1.00000000000000))*(x2709)*(x2729)))+(((x2712)*(x2727)))+(((IkReal(-1.00000000000000))*(x2715)*(x2728)))+(((new_r21)*(x2726)))+(((new_r21)*(x2724)))+(((IkReal(-1.00000000000000))*(x2716)*(x2733)))+(((IkReal(0.0634253154725807))*(new_r01)*(x2727)))+(((x2710)*(x2728)))+(((IkReal(0.0634253154725807))*(x2707)*(x2716))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11487,6 +11855,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -11566,7 +11938,7 @@ evalcond[11]=((x2751)+(((new_r20)*(x2789)))+(((IkReal(-1.00000000000000))*(x2753
 evalcond[12]=((((IkReal(-1.00000000000000))*(x2768)*(x2778)))+(((IkReal(-1.00000000000000))*(x2753)*(x2781)))+(((IkReal(-1.00000000000000))*(x2766)*(x2778)))+(((IkReal(0.999149271799077))*(sj1)))+(((IkReal(-1.00000000000000))*(x2758)*(x2776)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2799)))+(((IkReal(-0.0412399401475676))*(x2765)))+(((x2754)*(x2785)))+(((x2755)*(x2798)))+(((IkReal(-1.00000000000000))*(x2759)*(x2786)))+(((IkReal(-0.00612351537051366))*(x2750)*(x2766)))+(((new_r21)*(x2789))));
 evalcond[13]=((((x2769)*(x2776)))+(((IkReal(0.0634253154725807))*(x2750)*(x2757)))+(((IkReal(-1.00000000000000))*(x2757)*(x2788)))+(((x2762)*(x2777)))+(((IkReal(0.995371682851684))*(x2796)))+(((IkReal(0.0412399401475676))*(cj1)))+(((IkReal(-0.999149271799077))*(x2756)))+(((IkReal(0.0634253154725807))*(new_r00)*(x2776)))+(((IkReal(-1.00000000000000))*(x2754)*(x2787)))+(((new_r20)*(x2773)))+(((IkReal(-1.00000000000000))*(x2753)*(x2774)))+(((IkReal(-1.00000000000000))*(new_r10)*(sj4)*(x2777))));
 evalcond[14]=((((IkReal(-1.00000000000000))*(x2753)*(x2785)))+(((IkReal(0.0634253154725807))*(x2750)*(x2766)))+(((IkReal(0.0634253154725807))*(x2750)*(x2768)))+(((IkReal(0.0412399401475676))*(sj1)))+(((new_r21)*(x2773)))+(((x2755)*(x2777)))+(((cj2)*(x2751)))+(((IkReal(-1.00000000000000))*(x2754)*(x2781)))+(((IkReal(0.995371682851684))*(new_r21)*(x2749)))+(((IkReal(-1.00000000000000))*(x2766)*(x2788)))+(((IkReal(-1.00000000000000))*(x2758)*(x2786)))+(((x2759)*(x2776))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11647,6 +12019,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -11726,7 +12102,7 @@ evalcond[11]=((((x2818)*(x2854)))+(((IkReal(-1.00000000000000))*(x2825)*(x2842))
 evalcond[12]=((((IkReal(-1.00000000000000))*(new_r21)*(x2855)))+(((IkReal(-1.00000000000000))*(x2809)*(x2837)))+(((x2811)*(x2854)))+(((IkReal(0.999149271799077))*(sj1)))+(((IkReal(-0.0412399401475676))*(x2821)))+(((new_r21)*(x2845)))+(((IkReal(-0.00612351537051366))*(x2806)*(x2822)))+(((x2810)*(x2841)))+(((IkReal(-1.00000000000000))*(x2822)*(x2834)))+(((IkReal(-1.00000000000000))*(x2814)*(x2832)))+(((IkReal(-1.00000000000000))*(x2824)*(x2834)))+(((IkReal(-1.00000000000000))*(x2815)*(x2842))));
 evalcond[13]=((((IkReal(0.0634253154725807))*(new_r00)*(x2832)))+(((IkReal(-1.00000000000000))*(x2809)*(x2830)))+(((IkReal(-0.999149271799077))*(x2812)))+(((x2825)*(x2832)))+(((IkReal(0.0412399401475676))*(cj1)))+(((IkReal(-1.00000000000000))*(x2813)*(x2844)))+(((IkReal(-1.00000000000000))*(x2810)*(x2843)))+(((IkReal(-1.00000000000000))*(new_r10)*(sj4)*(x2833)))+(((IkReal(0.0634253154725807))*(x2806)*(x2813)))+(((new_r20)*(x2829)))+(((IkReal(0.995371682851684))*(x2852)))+(((x2818)*(x2833))));
 evalcond[14]=((((IkReal(-1.00000000000000))*(x2822)*(x2844)))+(((IkReal(0.0634253154725807))*(x2806)*(x2822)))+(((IkReal(0.0634253154725807))*(x2806)*(x2824)))+(((new_r21)*(x2829)))+(((IkReal(0.0412399401475676))*(sj1)))+(((IkReal(-1.00000000000000))*(x2809)*(x2841)))+(((x2815)*(x2832)))+(((IkReal(-1.00000000000000))*(x2810)*(x2837)))+(((x2811)*(x2833)))+(((IkReal(0.995371682851684))*(new_r21)*(x2805)))+(((IkReal(-1.00000000000000))*(x2814)*(x2842)))+(((cj2)*(x2807))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11807,6 +12183,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 1; ++iij3)
 {
@@ -11886,7 +12266,7 @@ evalcond[11]=((((IkReal(-0.0959047211377687))*(new_r10)*(x2888)))+(((x2866)*(x28
 evalcond[12]=((((IkReal(-0.0412399401475676))*(x2877)))+(((x2867)*(x2910)))+(((x2866)*(x2897)))+(((IkReal(-1.00000000000000))*(x2870)*(x2888)))+(((IkReal(0.999149271799077))*(sj1)))+(((IkReal(-1.00000000000000))*(x2871)*(x2898)))+(((IkReal(-1.00000000000000))*(new_r21)*(x2911)))+(((IkReal(-1.00000000000000))*(x2865)*(x2893)))+(((IkReal(-1.00000000000000))*(x2878)*(x2890)))+(((IkReal(-0.00612351537051366))*(x2862)*(x2878)))+(((new_r21)*(x2901)))+(((IkReal(-1.00000000000000))*(x2880)*(x2890))));
 evalcond[13]=((((IkReal(0.0634253154725807))*(x2862)*(x2869)))+(((IkReal(-1.00000000000000))*(new_r10)*(sj4)*(x2889)))+(((IkReal(-0.999149271799077))*(x2868)))+(((IkReal(0.0412399401475676))*(cj1)))+(((IkReal(-1.00000000000000))*(x2865)*(x2886)))+(((IkReal(0.0634253154725807))*(new_r00)*(x2888)))+(((new_r20)*(x2885)))+(((x2881)*(x2888)))+(((x2874)*(x2889)))+(((IkReal(-1.00000000000000))*(x2869)*(x2900)))+(((IkReal(-1.00000000000000))*(x2866)*(x2899)))+(((IkReal(0.995371682851684))*(x2908))));
 evalcond[14]=((((IkReal(-1.00000000000000))*(x2870)*(x2898)))+(((IkReal(0.0634253154725807))*(x2862)*(x2880)))+(((new_r21)*(x2885)))+(((IkReal(0.0412399401475676))*(sj1)))+(((IkReal(-1.00000000000000))*(x2865)*(x2897)))+(((x2867)*(x2889)))+(((IkReal(0.995371682851684))*(new_r21)*(x2861)))+(((cj2)*(x2863)))+(((IkReal(-1.00000000000000))*(x2878)*(x2900)))+(((IkReal(0.0634253154725807))*(x2862)*(x2878)))+(((x2871)*(x2888)))+(((IkReal(-1.00000000000000))*(x2866)*(x2893))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11993,6 +12373,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 2; ++iij3)
 {
@@ -12008,7 +12392,7 @@ IkReal dummyeval[1];
 IkReal gconst26;
 gconst26=IKsign(((((IkReal(-0.0637202329192957))*((new_r02)*(new_r02))))+(((IkReal(-0.0637202329192957))*((new_r12)*(new_r12))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((new_r02)*(new_r02))))+(((IkReal(-1.00000000000000))*((new_r12)*(new_r12)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
@@ -12023,14 +12407,14 @@ IkReal x2921=(cj2)*(cj2);
 IkReal x2922=(cj3)*(cj3);
 IkReal x2923=((IkReal(36.3290060123561))*(cj3)*(sj3));
 dummyeval[0]=((((x2921)*(x2922)))+(((x2921)*(x2923)))+(((IkReal(329.949169461452))*(x2922)))+(((IkReal(-1.00000000000000))*(x2923)))+(((IkReal(329.949169461452))*(x2920)*(x2921)))+(x2920));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst25;
 gconst25=IKsign((((new_r12)*(new_r12))+((new_r02)*(new_r02))));
 dummyeval[0]=(((new_r12)*(new_r12))+((new_r02)*(new_r02)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -12066,6 +12450,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -12100,7 +12488,7 @@ evalcond[1]=((((IkReal(-1.00000000000000))*(x2945)))+(((IkReal(-0.05485748353599
 evalcond[2]=((((IkReal(-0.0637202329192957))*(x2948)))+(((IkReal(0.0637202329192957))*(x2945)))+(((IkReal(-1.00000000000000))*(cj2)))+(((IkReal(-0.997967801042053))*(x2946)))+(((IkReal(-0.997967801042053))*(x2947))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x2934)*(x2947)))+(((IkReal(-1.00000000000000))*(x2934)*(x2946)))+(((IkReal(0.995371682851684))*(x2941)))+(((IkReal(-1.00000000000000))*(x2943)*(x2945)))+(((IkReal(0.0412399401475676))*(sj2)))+(((IkReal(-1.00000000000000))*(x2942)*(x2946)))+(((IkReal(-1.00000000000000))*(x2942)*(x2947)))+(((IkReal(-0.0961000154891044))*(x2936)))+(((x2944)*(x2948)))+(((x2943)*(x2948)))+(((IkReal(-1.00000000000000))*(x2944)*(x2945))));
 evalcond[4]=((((x2935)*(x2946)))+(((x2935)*(x2947)))+(((IkReal(-1.00000000000000))*(x2940)*(x2946)))+(((IkReal(-1.00000000000000))*(x2940)*(x2947)))+(((IkReal(-0.999149271799077))*(sj2)))+(((IkReal(0.0961000154891044))*(x2941)))+(((x2933)*(x2948)))+(((x2937)*(x2945)))+(((IkReal(0.995371682851684))*(x2936)))+(((IkReal(-1.00000000000000))*(x2933)*(x2945)))+(((IkReal(-1.00000000000000))*(x2937)*(x2948))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -12111,21 +12499,21 @@ IkReal dummyeval[1];
 IkReal gconst27;
 gconst27=IKsign(sj2);
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x2949=((cj2)*(sj2));
 dummyeval[0]=sj2;
 dummyeval[1]=((((IkReal(18.1645030061781))*(sj3)*(x2949)))+(((cj3)*(x2949))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x2950=((cj2)*(sj2));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(cj3)*(x2950)))+(((IkReal(-18.1645030061781))*(sj3)*(x2950))));
 dummyeval[1]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[9];
@@ -12155,21 +12543,21 @@ evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x2952)))+(((IkReal(-1.0000
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x2952)))+(((IkReal(-1.00000000000000))*(new_r01)*(x2961)))+(((new_r11)*(x2964)))+(((IkReal(-1.00000000000000))*(new_r11)*(x2962))));
 evalcond[7]=((((IkReal(0.995371682851684))*(x2959)))+(((IkReal(-1.00000000000000))*(x2953)*(x2956)))+(((IkReal(-1.00000000000000))*(x2953)*(x2957)))+(((IkReal(-0.0961000154891044))*(x2954)))+(((sj3)*(x2967)))+(((IkReal(-1.00000000000000))*(x2955)*(x2956)))+(((IkReal(-1.00000000000000))*(x2955)*(x2957)))+(((IkReal(-1.00000000000000))*(x2951)*(x2958)))+(((x2958)*(x2965)))+(((IkReal(-0.993348889555023))*(sj3)*(x2951))));
 evalcond[8]=((((IkReal(0.995371682851684))*(x2954)))+(((IkReal(0.0961000154891044))*(x2959)))+(((IkReal(-1.00000000000000))*(x2955)*(x2966)))+(((IkReal(-1.00000000000000))*(x2951)*(x2960)))+(((x2955)*(x2963)))+(((x2960)*(x2965)))+(((IkReal(-1.00000000000000))*(cj3)*(x2967)))+(((x2953)*(x2963)))+(((IkReal(-1.00000000000000))*(x2953)*(x2966)))+(((IkReal(0.993348889555023))*(cj3)*(x2951))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst28;
 gconst28=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst29;
 gconst29=IKsign(((((IkReal(-0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(-0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((cj3)*(cj3))))+(((IkReal(-1.00000000000000))*((sj3)*(sj3)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -12206,6 +12594,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -12264,7 +12656,7 @@ evalcond[6]=((((IkReal(-0.0961000154891044))*(x2999)))+(((x2983)*(x2987)))+(((Ik
 evalcond[7]=((((IkReal(-1.00000000000000))*(x2978)*(x2982)))+(x3004)+(((IkReal(-1.00000000000000))*(x2984)*(x2989)))+(((IkReal(-1.00000000000000))*(x2979)*(x2985)))+(((x2988)*(x2989)))+(((IkReal(-1.00000000000000))*(x2978)*(x3001)))+(((IkReal(-0.0961000154891044))*(x2981)))+(((new_r21)*(x2992)))+(((x2983)*(x3000)))+(((IkReal(-1.00000000000000))*(x3003)))+(((IkReal(-1.00000000000000))*(x2980)*(x2985)))+(((IkReal(-1.00000000000000))*(x2983)*(x2990))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x2985)*(x2996)))+(x3003)+(((x2978)*(x2986)))+(((IkReal(-1.00000000000000))*(x2989)*(x2993)))+(((IkReal(-1.00000000000000))*(x3004)))+(((x2987)*(x2989)))+(((IkReal(-1.00000000000000))*(x2985)*(x3002)))+(((IkReal(-1.00000000000000))*(x2983)*(x2994)))+(((new_r20)*(x2997)))+(((x2978)*(x2998)))+(((x2983)*(x2991)))+(((IkReal(0.995371682851684))*(x2999))));
 evalcond[9]=((((x2983)*(x2984)))+(((IkReal(-1.00000000000000))*(x2982)*(x2985)))+(x3012)+(((IkReal(0.995371682851684))*(x2981)))+(((x2989)*(x3000)))+(((new_r21)*(x2997)))+(((x2978)*(x2980)))+(((IkReal(-1.00000000000000))*(x2989)*(x2990)))+(((x2978)*(x2979)))+(((IkReal(-1.00000000000000))*(x2985)*(x3001)))+(((IkReal(-1.00000000000000))*(x2983)*(x2988))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -12346,6 +12738,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -12404,7 +12800,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x3024)*(x3034)))+(((IkReal(-1.000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x3024)*(x3031)))+(((IkReal(-1.00000000000000))*(x3025)*(x3030)))+(((new_r21)*(x3033)))+(((x3024)*(x3041)))+(x3045)+(((IkReal(-1.00000000000000))*(x3021)*(x3026)))+(((IkReal(-1.00000000000000))*(x3020)*(x3026)))+(((IkReal(-1.00000000000000))*(x3019)*(x3023)))+(((IkReal(-1.00000000000000))*(x3044)))+(((IkReal(-1.00000000000000))*(x3019)*(x3042)))+(((x3029)*(x3030)))+(((IkReal(-0.0961000154891044))*(x3022))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x3024)*(x3035)))+(((x3028)*(x3030)))+(((x3019)*(x3027)))+(((IkReal(0.995371682851684))*(x3040)))+(x3044)+(((IkReal(-1.00000000000000))*(x3030)*(x3034)))+(((IkReal(-1.00000000000000))*(x3026)*(x3043)))+(((x3019)*(x3039)))+(((IkReal(-1.00000000000000))*(x3045)))+(((x3024)*(x3032)))+(((IkReal(-1.00000000000000))*(x3026)*(x3037)))+(((new_r20)*(x3038))));
 evalcond[9]=((((new_r21)*(x3038)))+(((x3019)*(x3021)))+(((x3019)*(x3020)))+(x3053)+(((IkReal(-1.00000000000000))*(x3030)*(x3031)))+(((IkReal(-1.00000000000000))*(x3026)*(x3042)))+(((x3030)*(x3041)))+(((IkReal(-1.00000000000000))*(x3024)*(x3029)))+(((IkReal(-1.00000000000000))*(x3023)*(x3026)))+(((x3024)*(x3025)))+(((IkReal(0.995371682851684))*(x3022))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -12479,25 +12875,25 @@ evalcond[3]=((((IkReal(-0.0548574835359933))*(sj3)))+(((IkReal(0.996458924600913
 evalcond[4]=((((IkReal(0.0637202329192957))*(x3054)))+(((IkReal(-0.997967801042053))*(x3055)))+(((IkReal(-0.997967801042053))*(x3057)))+(((IkReal(-0.0637202329192957))*(x3064))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x3054)*(x3060)))+(((IkReal(-1.00000000000000))*(x3055)*(x3059)))+(((IkReal(-1.00000000000000))*(x3055)*(x3058)))+(((sj3)*(x3066)))+(((IkReal(-1.00000000000000))*(x3057)*(x3058)))+(((IkReal(-1.00000000000000))*(x3057)*(x3059)))+(((IkReal(0.995371682851684))*(x3061)))+(((IkReal(-0.0961000154891044))*(x3056)))+(((IkReal(-0.993348889555023))*(sj3)*(x3054)))+(((x3060)*(x3064))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(x3054)*(x3062)))+(((IkReal(-1.00000000000000))*(cj3)*(x3066)))+(((IkReal(0.995371682851684))*(x3056)))+(((IkReal(0.993348889555023))*(cj3)*(x3054)))+(((IkReal(-1.00000000000000))*(x3055)*(x3065)))+(((x3057)*(x3063)))+(((IkReal(0.0961000154891044))*(x3061)))+(((x3055)*(x3063)))+(((IkReal(-1.00000000000000))*(x3057)*(x3065)))+(((x3062)*(x3064))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst30;
 gconst30=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -12512,7 +12908,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(((IkReal(-1.00000000000000))*(x306
 evalcond[4]=((((IkReal(-0.997967801042053))*(x3070)))+(((IkReal(0.0637202329192957))*(x3069)))+(((IkReal(-0.997967801042053))*(x3068)))+(((IkReal(-0.0637202329192957))*(x3067))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(0.0636660242235878))*(x3070)))+(((IkReal(0.0636660242235878))*(x3068)))+(((IkReal(0.997118800177265))*(x3069)))+(((IkReal(0.0412399400149127))*(new_r22)))+(((IkReal(-0.997118800177265))*(x3067))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(0.00262781858332802))*(x3070)))+(((IkReal(0.00262781858332802))*(x3068)))+(((IkReal(-0.0411561322517886))*(x3067)))+(((IkReal(0.0411561322517886))*(x3069)))+(((IkReal(-0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -12537,6 +12933,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -12571,7 +12971,7 @@ evalcond[8]=((((IkReal(-0.997118800177265))*(x3074)))+(((IkReal(0.06366602422358
 evalcond[9]=((((IkReal(-0.997118800177265))*(x3078)))+(((IkReal(0.997118800177265))*(x3079)))+(((IkReal(0.0636660242235878))*(x3077)))+(((IkReal(0.0636660242235878))*(x3076)))+(((IkReal(0.999149271799077))*(x3072)))+(((IkReal(0.0412399400149127))*(new_r21))));
 evalcond[10]=((((IkReal(0.00262781858332802))*(x3075)))+(((IkReal(0.0411561322517886))*(x3080)))+(((IkReal(0.00262781858332802))*(x3081)))+(((IkReal(0.0412399401475676))*(x3071)))+(((IkReal(-1.00000000000000))*(new_r00)*(x3073)))+(((IkReal(-0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(0.00262781858332802))*(x3076)))+(((IkReal(0.00262781858332802))*(x3077)))+(((IkReal(0.0411561322517886))*(x3079)))+(((IkReal(-1.00000000000000))*(new_r01)*(x3073)))+(((IkReal(0.0412399401475676))*(x3072)))+(((IkReal(-0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -12633,7 +13033,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x3082)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(-0.997967801042053))*(x3085)))+(((IkReal(-0.997967801042053))*(x3083)))+(((IkReal(0.0637202329192957))*(x3084)))+(((IkReal(-0.0637202329192957))*(x3082))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(-0.0636660242235878))*(x3085)))+(((IkReal(-0.0636660242235878))*(x3083)))+(((IkReal(-0.997118800177265))*(x3084)))+(((IkReal(0.997118800177265))*(x3082))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(0.0411561322517886))*(x3082)))+(((IkReal(-0.00262781858332802))*(x3083)))+(((IkReal(-0.00262781858332802))*(x3085)))+(((IkReal(-0.0411561322517886))*(x3084)))+(((IkReal(0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -12658,6 +13058,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -12692,7 +13096,7 @@ evalcond[8]=((((IkReal(-0.0412399400149127))*(new_r20)))+(((IkReal(-0.0636660242
 evalcond[9]=((((IkReal(0.997118800177265))*(x3093)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(-0.0636660242235878))*(x3092)))+(((IkReal(-0.0636660242235878))*(x3091)))+(((IkReal(-0.997118800177265))*(x3094)))+(((IkReal(0.999149271799077))*(x3087))));
 evalcond[10]=((((new_r00)*(x3088)))+(((IkReal(-0.00262781858332802))*(x3090)))+(((IkReal(-0.00262781858332802))*(x3096)))+(((IkReal(0.999149270283168))*(new_r20)))+(((IkReal(-0.0411561322517886))*(x3095)))+(((IkReal(0.0412399401475676))*(x3086))));
 evalcond[11]=((((new_r01)*(x3088)))+(((IkReal(-0.00262781858332802))*(x3091)))+(((IkReal(-0.00262781858332802))*(x3092)))+(((IkReal(0.999149270283168))*(new_r21)))+(((IkReal(-0.0411561322517886))*(x3094)))+(((IkReal(0.0412399401475676))*(x3087))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -12783,6 +13187,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -12837,7 +13245,7 @@ evalcond[8]=((((IkReal(0.999149271799077))*(x3101)))+(((new_r20)*(x3116)))+(((Ik
 evalcond[9]=((((IkReal(0.999149271799077))*(x3102)))+(((IkReal(-0.0961000154891044))*(x3106)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x3108)))+(((IkReal(-1.00000000000000))*(x3103)*(x3107)))+(((new_r21)*(x3116)))+(((IkReal(-1.00000000000000))*(x3109)*(x3125)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3108)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x3103)))+(((IkReal(-1.00000000000000))*(x3104)*(x3121)))+(((IkReal(-1.00000000000000))*(x3105)*(x3121)))+(((x3114)*(x3125))));
 evalcond[10]=((((IkReal(0.995371682851684))*(x3117)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3108)))+(((x3112)*(x3118)))+(((IkReal(-1.00000000000000))*(x3110)*(x3111)))+(((x3103)*(x3113)))+(((IkReal(-1.00000000000000))*(x3111)*(x3123)))+(((IkReal(-1.00000000000000))*(x3118)*(x3119)))+(((IkReal(0.0412399401475676))*(x3101)))+(((IkReal(0.0634253154725807))*(new_r10)*(x3108)))+(((IkReal(0.993348889555023))*(new_r10)*(x3103)))+(((new_r20)*(x3122))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x3111)*(x3127)))+(((x3103)*(x3105)))+(((x3103)*(x3104)))+(((IkReal(0.0412399401475676))*(x3102)))+(((new_r21)*(x3122)))+(((IkReal(-1.00000000000000))*(x3107)*(x3121)))+(((IkReal(-1.00000000000000))*(x3108)*(x3114)))+(((IkReal(-1.00000000000000))*(x3118)*(x3120)))+(((x3108)*(x3109)))+(((IkReal(0.995371682851684))*(x3106)))+(((x3115)*(x3118))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -12919,6 +13327,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -12973,7 +13385,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x3148)*(x3156)))+(((IkReal(-0.006123
 evalcond[9]=((((x3149)*(x3160)))+(((IkReal(-1.00000000000000))*(x3144)*(x3160)))+(((IkReal(0.999149271799077))*(x3137)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x3143)))+(((IkReal(-1.00000000000000))*(x3140)*(x3156)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3143)))+(((IkReal(-1.00000000000000))*(x3138)*(x3142)))+(((IkReal(-0.0961000154891044))*(x3141)))+(((IkReal(-1.00000000000000))*(x3139)*(x3156)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x3138)))+(((new_r21)*(x3151))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x3153)*(x3154)))+(((IkReal(-1.00000000000000))*(x3146)*(x3158)))+(((x3147)*(x3153)))+(((new_r20)*(x3157)))+(((IkReal(-1.00000000000000))*(x3145)*(x3146)))+(((IkReal(0.993348889555023))*(new_r10)*(x3138)))+(((IkReal(0.0412399401475676))*(x3136)))+(((IkReal(0.0634253154725807))*(new_r10)*(x3143)))+(((IkReal(0.995371682851684))*(x3152)))+(((x3138)*(x3148)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3143))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x3143)*(x3149)))+(((IkReal(-1.00000000000000))*(x3153)*(x3155)))+(((IkReal(-1.00000000000000))*(x3146)*(x3162)))+(((IkReal(-1.00000000000000))*(x3142)*(x3156)))+(((x3150)*(x3153)))+(((x3138)*(x3139)))+(((x3143)*(x3144)))+(((IkReal(0.0412399401475676))*(x3137)))+(((IkReal(0.995371682851684))*(x3141)))+(((x3138)*(x3140)))+(((new_r21)*(x3157))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -13052,6 +13464,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -13106,7 +13522,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r10)*(x3175)))+(((IkReal(-1.0
 evalcond[9]=((((IkReal(-1.00000000000000))*(x3171)*(x3188)))+(((IkReal(-1.00000000000000))*(x3172)*(x3188)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3175)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x3170)))+(((IkReal(-1.00000000000000))*(x3176)*(x3192)))+(((x3181)*(x3192)))+(((IkReal(0.999149271799077))*(x3169)))+(((new_r21)*(x3183)))+(((IkReal(-1.00000000000000))*(x3170)*(x3174)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x3175)))+(((IkReal(-0.0961000154891044))*(x3173))));
 evalcond[10]=((((IkReal(-0.993348889555023))*(new_r00)*(x3175)))+(((x3170)*(x3180)))+(((IkReal(0.0412399401475676))*(x3168)))+(((new_r20)*(x3189)))+(((IkReal(-1.00000000000000))*(x3185)*(x3186)))+(((IkReal(-1.00000000000000))*(x3178)*(x3190)))+(((IkReal(0.993348889555023))*(new_r10)*(x3170)))+(((IkReal(0.0634253154725807))*(new_r10)*(x3175)))+(((IkReal(0.995371682851684))*(x3184)))+(((IkReal(-1.00000000000000))*(x3177)*(x3178)))+(((x3179)*(x3185))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x3169)))+(((IkReal(-1.00000000000000))*(x3185)*(x3187)))+(((IkReal(-1.00000000000000))*(x3178)*(x3194)))+(((x3182)*(x3185)))+(((x3170)*(x3172)))+(((x3170)*(x3171)))+(((IkReal(-1.00000000000000))*(x3175)*(x3181)))+(((new_r21)*(x3189)))+(((IkReal(-1.00000000000000))*(x3174)*(x3188)))+(((IkReal(0.995371682851684))*(x3173)))+(((x3175)*(x3176))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -13187,21 +13603,21 @@ evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x3209)))+(((IkReal(-1.0000
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x3200)))+(((IkReal(-1.00000000000000))*(new_r01)*(x3209)))+(((IkReal(-1.00000000000000))*(new_r11)*(x3210)))+(((new_r11)*(x3212))));
 evalcond[7]=((((IkReal(-1.00000000000000))*(x3199)*(x3206)))+(((x3206)*(x3213)))+(((IkReal(0.995371682851684))*(x3207)))+(((IkReal(-0.993348889555023))*(sj3)*(x3199)))+(((IkReal(-1.00000000000000))*(x3201)*(x3205)))+(((IkReal(-1.00000000000000))*(x3201)*(x3204)))+(((IkReal(-1.00000000000000))*(x3203)*(x3204)))+(((IkReal(-1.00000000000000))*(x3203)*(x3205)))+(((sj3)*(x3215)))+(((IkReal(-0.0961000154891044))*(x3202))));
 evalcond[8]=((((x3203)*(x3211)))+(((IkReal(-1.00000000000000))*(x3199)*(x3208)))+(((x3208)*(x3213)))+(((IkReal(-1.00000000000000))*(x3201)*(x3214)))+(((IkReal(-1.00000000000000))*(x3203)*(x3214)))+(((IkReal(0.995371682851684))*(x3202)))+(((IkReal(-1.00000000000000))*(cj3)*(x3215)))+(((x3201)*(x3211)))+(((IkReal(0.0961000154891044))*(x3207)))+(((IkReal(0.993348889555023))*(cj3)*(x3199))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst31;
 gconst31=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst32;
 gconst32=IKsign(((((IkReal(0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -13237,6 +13653,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -13295,7 +13715,7 @@ evalcond[6]=((((new_r20)*(x3239)))+(((x3236)*(x3241)))+(x3253)+(((IkReal(-1.0000
 evalcond[7]=((((x3230)*(x3247)))+(x3259)+(((IkReal(-1.00000000000000))*(x3230)*(x3237)))+(((x3235)*(x3236)))+(((IkReal(-1.00000000000000))*(x3225)*(x3229)))+(((IkReal(-1.00000000000000))*(x3231)*(x3236)))+(((IkReal(-0.0961000154891044))*(x3228)))+(((IkReal(-1.00000000000000))*(x3226)*(x3232)))+(((IkReal(-1.00000000000000))*(x3227)*(x3232)))+(((new_r21)*(x3239)))+(((IkReal(-1.00000000000000))*(x3225)*(x3248))));
 evalcond[8]=((((x3225)*(x3233)))+(((IkReal(0.995371682851684))*(x3246)))+(((x3225)*(x3245)))+(((IkReal(-1.00000000000000))*(x3236)*(x3240)))+(((new_r20)*(x3244)))+(((x3234)*(x3236)))+(x3259)+(((IkReal(-1.00000000000000))*(x3232)*(x3249)))+(((IkReal(-1.00000000000000))*(x3232)*(x3243)))+(((IkReal(-1.00000000000000))*(x3230)*(x3241)))+(((x3230)*(x3238))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x3229)*(x3232)))+(((x3236)*(x3247)))+(x3252)+(((IkReal(-1.00000000000000))*(x3230)*(x3235)))+(((IkReal(-1.00000000000000))*(x3236)*(x3237)))+(((new_r21)*(x3244)))+(((IkReal(0.995371682851684))*(x3228)))+(((x3225)*(x3227)))+(((x3225)*(x3226)))+(((IkReal(-1.00000000000000))*(x3232)*(x3248)))+(((x3230)*(x3231)))+(((IkReal(-1.00000000000000))*(x3253))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -13377,6 +13797,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -13435,7 +13859,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x3273)*(x3274)))+(((IkReal(-1.000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x3268)*(x3273)))+(((IkReal(-1.00000000000000))*(x3272)*(x3277)))+(x3300)+(((new_r21)*(x3280)))+(((IkReal(-1.00000000000000))*(x3266)*(x3289)))+(((IkReal(-1.00000000000000))*(x3266)*(x3270)))+(((x3276)*(x3277)))+(((IkReal(-1.00000000000000))*(x3267)*(x3273)))+(((x3271)*(x3288)))+(((IkReal(-1.00000000000000))*(x3271)*(x3278)))+(((IkReal(-0.0961000154891044))*(x3269))));
 evalcond[8]=((((IkReal(0.995371682851684))*(x3287)))+(((IkReal(-1.00000000000000))*(x3273)*(x3284)))+(((IkReal(-1.00000000000000))*(x3273)*(x3290)))+(x3300)+(((IkReal(-1.00000000000000))*(x3271)*(x3282)))+(((IkReal(-1.00000000000000))*(x3277)*(x3281)))+(((x3275)*(x3277)))+(((x3266)*(x3286)))+(((new_r20)*(x3285)))+(((x3266)*(x3274)))+(((x3271)*(x3279))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x3273)*(x3289)))+(((IkReal(-1.00000000000000))*(x3294)))+(((IkReal(0.995371682851684))*(x3269)))+(((new_r21)*(x3285)))+(x3293)+(((IkReal(-1.00000000000000))*(x3270)*(x3273)))+(((IkReal(-1.00000000000000))*(x3271)*(x3276)))+(((IkReal(-1.00000000000000))*(x3277)*(x3278)))+(((x3266)*(x3268)))+(((x3266)*(x3267)))+(((x3271)*(x3272)))+(((x3277)*(x3288))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -13510,25 +13934,25 @@ evalcond[3]=((((IkReal(-0.996458924600913))*(cj3)))+(x3311)+(((IkReal(0.05485748
 evalcond[4]=((((IkReal(0.0637202329192957))*(x3301)))+(((IkReal(-0.0637202329192957))*(x3311)))+(((IkReal(-0.997967801042053))*(x3302)))+(((IkReal(-0.997967801042053))*(x3304))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(0.995371682851684))*(x3308)))+(((IkReal(-1.00000000000000))*(x3304)*(x3305)))+(((IkReal(-1.00000000000000))*(x3304)*(x3306)))+(((sj3)*(x3313)))+(((IkReal(-1.00000000000000))*(x3302)*(x3306)))+(((IkReal(-1.00000000000000))*(x3302)*(x3305)))+(((x3307)*(x3311)))+(((IkReal(-1.00000000000000))*(x3301)*(x3307)))+(((IkReal(-0.0961000154891044))*(x3303)))+(((IkReal(-0.993348889555023))*(sj3)*(x3301))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(0.995371682851684))*(x3303)))+(((x3302)*(x3310)))+(((IkReal(0.0961000154891044))*(x3308)))+(((IkReal(-1.00000000000000))*(x3304)*(x3312)))+(((IkReal(0.993348889555023))*(cj3)*(x3301)))+(((IkReal(-1.00000000000000))*(x3302)*(x3312)))+(((x3304)*(x3310)))+(((IkReal(-1.00000000000000))*(cj3)*(x3313)))+(((IkReal(-1.00000000000000))*(x3301)*(x3309)))+(((x3309)*(x3311))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst33;
 gconst33=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -13543,7 +13967,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x3314)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(0.0637202329192957))*(x3316)))+(((IkReal(-0.0637202329192957))*(x3314)))+(((IkReal(-0.997967801042053))*(x3315)))+(((IkReal(-0.997967801042053))*(x3317))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(0.997118800177265))*(x3316)))+(((IkReal(-0.997118800177265))*(x3314)))+(((IkReal(0.0636660242235878))*(x3315)))+(((IkReal(0.0636660242235878))*(x3317)))+(((IkReal(0.0412399400149127))*(new_r22))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(-0.0411561322517886))*(x3314)))+(((IkReal(0.00262781858332802))*(x3317)))+(((IkReal(0.00262781858332802))*(x3315)))+(((IkReal(-0.999149270283168))*(new_r22)))+(((IkReal(0.0411561322517886))*(x3316))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -13568,6 +13992,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -13602,7 +14030,7 @@ evalcond[8]=((((IkReal(0.999149271799077))*(x3318)))+(((IkReal(-0.99711880017726
 evalcond[9]=((((IkReal(0.999149271799077))*(x3319)))+(((IkReal(-0.997118800177265))*(x3325)))+(((IkReal(0.997118800177265))*(x3326)))+(((IkReal(0.0412399400149127))*(new_r21)))+(((IkReal(0.0636660242235878))*(x3323)))+(((IkReal(0.0636660242235878))*(x3324))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(new_r00)*(x3320)))+(((IkReal(0.0412399401475676))*(x3318)))+(((IkReal(0.00262781858332802))*(x3322)))+(((IkReal(0.00262781858332802))*(x3328)))+(((IkReal(0.0411561322517886))*(x3327)))+(((IkReal(-0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(new_r01)*(x3320)))+(((IkReal(0.0412399401475676))*(x3319)))+(((IkReal(0.00262781858332802))*(x3323)))+(((IkReal(0.00262781858332802))*(x3324)))+(((IkReal(0.0411561322517886))*(x3326)))+(((IkReal(-0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -13664,7 +14092,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(x3329)+(((IkReal(-1.00000000000000
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x3329)))+(((IkReal(-0.997967801042053))*(x3330)))+(((IkReal(-0.997967801042053))*(x3332)))+(((IkReal(0.0637202329192957))*(x3331))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(-0.0636660242235878))*(x3332)))+(((IkReal(-0.0636660242235878))*(x3330)))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(0.997118800177265))*(x3329)))+(((IkReal(-0.997118800177265))*(x3331))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(-0.0411561322517886))*(x3331)))+(((IkReal(0.0411561322517886))*(x3329)))+(((IkReal(0.999149270283168))*(new_r22)))+(((IkReal(-0.00262781858332802))*(x3332)))+(((IkReal(-0.00262781858332802))*(x3330))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -13689,6 +14117,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -13723,7 +14155,7 @@ evalcond[8]=((((IkReal(-0.0636660242235878))*(x3343)))+(((IkReal(-0.063666024223
 evalcond[9]=((((IkReal(-0.0636660242235878))*(x3339)))+(((IkReal(-0.0636660242235878))*(x3338)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(0.999149271799077))*(x3334)))+(((IkReal(-0.997118800177265))*(x3341)))+(((IkReal(0.997118800177265))*(x3340))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x3333)))+(((IkReal(0.999149270283168))*(new_r20)))+(((new_r00)*(x3335)))+(((IkReal(-0.00262781858332802))*(x3337)))+(((IkReal(-0.00262781858332802))*(x3343)))+(((IkReal(-0.0411561322517886))*(x3342))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x3334)))+(((IkReal(0.999149270283168))*(new_r21)))+(((IkReal(-0.00262781858332802))*(x3338)))+(((IkReal(-0.00262781858332802))*(x3339)))+(((IkReal(-0.0411561322517886))*(x3341)))+(((new_r01)*(x3335))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -13814,6 +14246,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -13868,7 +14304,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r10)*(x3355)))+(((IkReal(0.09
 evalcond[9]=((((IkReal(-0.00612351537051366))*(new_r11)*(x3355)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3355)))+(((x3361)*(x3372)))+(((IkReal(0.999149271799077))*(x3349)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x3350)))+(((IkReal(-1.00000000000000))*(x3351)*(x3370)))+(((IkReal(-1.00000000000000))*(x3350)*(x3354)))+(((IkReal(-0.0961000154891044))*(x3353)))+(((new_r21)*(x3364)))+(((IkReal(-1.00000000000000))*(x3356)*(x3372)))+(((IkReal(-1.00000000000000))*(x3352)*(x3370))));
 evalcond[10]=((((IkReal(0.0634253154725807))*(new_r10)*(x3355)))+(((x3350)*(x3360)))+(((IkReal(0.993348889555023))*(new_r10)*(x3350)))+(((IkReal(0.0412399401475676))*(x3348)))+(((new_r20)*(x3369)))+(((x3359)*(x3366)))+(((IkReal(0.995371682851684))*(x3365)))+(((IkReal(-1.00000000000000))*(x3357)*(x3358)))+(((IkReal(-1.00000000000000))*(x3366)*(x3368)))+(((IkReal(-1.00000000000000))*(x3358)*(x3374)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3355))));
 evalcond[11]=((((x3363)*(x3366)))+(((IkReal(0.0412399401475676))*(x3349)))+(((IkReal(0.995371682851684))*(x3353)))+(((IkReal(-1.00000000000000))*(x3354)*(x3370)))+(((new_r21)*(x3369)))+(((IkReal(-1.00000000000000))*(x3355)*(x3361)))+(((x3355)*(x3356)))+(((IkReal(-1.00000000000000))*(x3366)*(x3367)))+(((x3350)*(x3351)))+(((x3350)*(x3352)))+(((IkReal(-1.00000000000000))*(x3358)*(x3362))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -13950,6 +14386,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -14004,7 +14444,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r10)*(x3390)))+(((IkReal(-0.0
 evalcond[9]=((((IkReal(-1.00000000000000))*(x3386)*(x3405)))+(((new_r21)*(x3399)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x3385)))+(((IkReal(-1.00000000000000))*(x3385)*(x3389)))+(((IkReal(-0.0961000154891044))*(x3388)))+(((IkReal(0.999149271799077))*(x3384)))+(((x3396)*(x3407)))+(((IkReal(-1.00000000000000))*(x3387)*(x3405)))+(((IkReal(-1.00000000000000))*(x3391)*(x3407)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3390)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x3390))));
 evalcond[10]=((((IkReal(0.0634253154725807))*(new_r10)*(x3390)))+(((IkReal(-1.00000000000000))*(x3392)*(x3393)))+(((IkReal(0.993348889555023))*(new_r10)*(x3385)))+(((IkReal(-1.00000000000000))*(x3401)*(x3403)))+(((x3394)*(x3401)))+(((IkReal(0.0412399401475676))*(x3383)))+(((new_r20)*(x3404)))+(((IkReal(0.995371682851684))*(x3400)))+(((x3385)*(x3395)))+(((IkReal(-1.00000000000000))*(x3393)*(x3409)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3390))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x3389)*(x3405)))+(((IkReal(-1.00000000000000))*(x3401)*(x3402)))+(((IkReal(0.995371682851684))*(x3388)))+(((x3398)*(x3401)))+(((IkReal(0.0412399401475676))*(x3384)))+(((x3390)*(x3391)))+(((new_r21)*(x3404)))+(((x3385)*(x3387)))+(((x3385)*(x3386)))+(((IkReal(-1.00000000000000))*(x3390)*(x3396)))+(((IkReal(-1.00000000000000))*(x3393)*(x3397))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -14083,6 +14523,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -14137,7 +14581,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x3427)*(x3437)))+(((x3426)*(x3440)))
 evalcond[9]=((((x3428)*(x3439)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3422)))+(((new_r21)*(x3431)))+(((IkReal(-1.00000000000000))*(x3417)*(x3421)))+(((IkReal(-0.0961000154891044))*(x3420)))+(((IkReal(0.999149271799077))*(x3416)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x3422)))+(((IkReal(-1.00000000000000))*(x3418)*(x3437)))+(((IkReal(-1.00000000000000))*(x3419)*(x3437)))+(((IkReal(-1.00000000000000))*(x3423)*(x3439)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x3417))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x3415)))+(((IkReal(0.993348889555023))*(new_r10)*(x3417)))+(((IkReal(0.995371682851684))*(x3432)))+(((IkReal(-1.00000000000000))*(x3424)*(x3425)))+(((IkReal(-1.00000000000000))*(x3433)*(x3435)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3422)))+(((x3417)*(x3427)))+(((new_r20)*(x3436)))+(((x3426)*(x3433)))+(((IkReal(0.0634253154725807))*(new_r10)*(x3422)))+(((IkReal(-1.00000000000000))*(x3425)*(x3441))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x3416)))+(((x3417)*(x3419)))+(((x3417)*(x3418)))+(((IkReal(0.995371682851684))*(x3420)))+(((new_r21)*(x3436)))+(((x3430)*(x3433)))+(((IkReal(-1.00000000000000))*(x3433)*(x3434)))+(((IkReal(-1.00000000000000))*(x3425)*(x3429)))+(((x3422)*(x3423)))+(((IkReal(-1.00000000000000))*(x3422)*(x3428)))+(((IkReal(-1.00000000000000))*(x3421)*(x3437))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -14239,6 +14683,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -14304,7 +14752,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r10)*(x3457)))+(((IkReal(-1.0
 evalcond[9]=((((x3461)*(x3474)))+(((IkReal(-1.00000000000000))*(x3467)*(x3476)))+(((IkReal(-1.00000000000000))*(cj2)*(x3484)))+(((IkReal(-1.00000000000000))*(x3467)*(x3482)))+(((IkReal(-1.00000000000000))*(x3458)*(x3474)))+(x3487)+(((new_r21)*(x3463)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3457)))+(((IkReal(-0.0961000154891044))*(x3460)))+(((IkReal(-1.00000000000000))*(x3464)*(x3472)))+(((IkReal(-1.00000000000000))*(x3457)*(x3477)))+(((IkReal(-1.00000000000000))*(x3464)*(x3481))));
 evalcond[10]=((((x3470)*(x3473)))+(((IkReal(-1.00000000000000))*(cj2)*(x3487)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3457)))+(((x3479)*(x3483)))+(x3484)+(((IkReal(0.995371682851684))*(x3469)))+(((x3466)*(x3468)))+(((IkReal(-1.00000000000000))*(x3459)*(x3478)))+(((IkReal(-1.00000000000000))*(x3468)*(x3473)))+(((new_r20)*(x3480)))+(((IkReal(0.0634253154725807))*(new_r10)*(x3457)))+(((IkReal(-1.00000000000000))*(x3478)*(x3483))));
 evalcond[11]=((((x3457)*(x3458)))+(((x3464)*(x3479)))+(((IkReal(-1.00000000000000))*(x3467)*(x3468)))+(((x3462)*(x3468)))+(((x3467)*(x3470)))+(x3489)+(((IkReal(0.995371682851684))*(x3460)))+(((new_r21)*(x3480)))+(((IkReal(-1.00000000000000))*(x3474)*(x3477)))+(((IkReal(-1.00000000000000))*(x3464)*(x3478)))+(((IkReal(-1.00000000000000))*(x3457)*(x3461)))+(((IkReal(0.999149271799077))*(x3494))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -14391,6 +14839,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -14456,7 +14908,7 @@ evalcond[8]=((((IkReal(0.999149271799077))*(x3506)))+(((IkReal(-1.00000000000000
 evalcond[9]=((((IkReal(0.0959047211377687))*(new_r01)*(x3508)))+(((IkReal(-1.00000000000000))*(x3515)*(x3532)))+(((IkReal(-1.00000000000000))*(x3509)*(x3525)))+(x3538)+(((IkReal(-1.00000000000000))*(x3508)*(x3528)))+(((IkReal(-1.00000000000000))*(cj2)*(x3535)))+(((IkReal(-1.00000000000000))*(x3518)*(x3533)))+(((IkReal(-0.0961000154891044))*(x3511)))+(((x3512)*(x3525)))+(((IkReal(-1.00000000000000))*(x3518)*(x3527)))+(((IkReal(-1.00000000000000))*(x3515)*(x3523)))+(((new_r21)*(x3514))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x3519)*(x3524)))+(((new_r20)*(x3531)))+(((IkReal(-1.00000000000000))*(x3510)*(x3529)))+(((x3517)*(x3519)))+(x3535)+(((IkReal(-0.993348889555023))*(new_r00)*(x3508)))+(((IkReal(-1.00000000000000))*(x3529)*(x3534)))+(((IkReal(-1.00000000000000))*(cj2)*(x3538)))+(((IkReal(0.995371682851684))*(x3520)))+(((IkReal(0.0634253154725807))*(new_r10)*(x3508)))+(((x3530)*(x3534)))+(((x3521)*(x3524))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x3525)*(x3528)))+(((IkReal(-1.00000000000000))*(x3518)*(x3519)))+(((new_r21)*(x3531)))+(x3540)+(((x3515)*(x3530)))+(((x3508)*(x3509)))+(((IkReal(-1.00000000000000))*(x3508)*(x3512)))+(((IkReal(0.995371682851684))*(x3511)))+(((x3518)*(x3521)))+(((x3513)*(x3519)))+(((IkReal(0.999149271799077))*(x3545)))+(((IkReal(-1.00000000000000))*(x3515)*(x3529))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -14538,6 +14990,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -14603,7 +15059,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x3569)*(x3580)))+(((x3563)*(x3579)))
 evalcond[9]=((((IkReal(-1.00000000000000))*(cj2)*(x3581)))+(((IkReal(-1.00000000000000))*(x3561)*(x3578)))+(x3584)+(((IkReal(-1.00000000000000))*(x3561)*(x3569)))+(((IkReal(-1.00000000000000))*(x3555)*(x3571)))+(((IkReal(-1.00000000000000))*(x3554)*(x3574)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3554)))+(((IkReal(-0.0961000154891044))*(x3557)))+(((x3558)*(x3571)))+(((IkReal(-1.00000000000000))*(x3564)*(x3579)))+(((IkReal(-1.00000000000000))*(x3564)*(x3573)))+(((new_r21)*(x3560))));
 evalcond[10]=((((x3563)*(x3565)))+(((IkReal(-1.00000000000000))*(cj2)*(x3584)))+(((IkReal(-1.00000000000000))*(x3556)*(x3575)))+(((IkReal(-1.00000000000000))*(x3565)*(x3570)))+(((x3567)*(x3570)))+(x3581)+(((IkReal(0.0634253154725807))*(new_r10)*(x3554)))+(((IkReal(-1.00000000000000))*(x3575)*(x3580)))+(((new_r20)*(x3577)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3554)))+(((IkReal(0.995371682851684))*(x3566)))+(((x3576)*(x3580))));
 evalcond[11]=((((x3559)*(x3565)))+(((IkReal(0.999149271799077))*(x3591)))+(((IkReal(-1.00000000000000))*(x3561)*(x3575)))+(((new_r21)*(x3577)))+(((IkReal(-1.00000000000000))*(x3554)*(x3558)))+(x3586)+(((IkReal(-1.00000000000000))*(x3571)*(x3574)))+(((IkReal(-1.00000000000000))*(x3564)*(x3565)))+(((IkReal(0.995371682851684))*(x3557)))+(((x3564)*(x3567)))+(((x3561)*(x3576)))+(((x3554)*(x3555))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -14693,6 +15149,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -14713,7 +15173,7 @@ IkReal x3605=((IkReal(0.0549691918704316))*(x3601));
 IkReal x3606=((IkReal(0.0549691918704316))*(x3600));
 evalcond[0]=((((IkReal(-1.00000000000000))*(x3601)*(x3604)))+(((IkReal(-1.00000000000000))*(x3602)*(x3605)))+(((x3600)*(x3603)))+(new_r20)+(((IkReal(-1.00000000000000))*(sj3)*(x3606))));
 evalcond[1]=((((x3600)*(x3604)))+(((x3601)*(x3603)))+(((x3602)*(x3606)))+(new_r21)+(((IkReal(-1.00000000000000))*(sj3)*(x3605))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -14724,14 +15184,14 @@ IkReal dummyeval[1];
 IkReal gconst35;
 gconst35=IKsign(((((IkReal(-0.0637202329192957))*((new_r02)*(new_r02))))+(((IkReal(-0.0637202329192957))*((new_r12)*(new_r12))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((new_r02)*(new_r02))))+(((IkReal(-1.00000000000000))*((new_r12)*(new_r12)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst34;
 gconst34=IKsign((((new_r12)*(new_r12))+((new_r02)*(new_r02))));
 dummyeval[0]=(((new_r12)*(new_r12))+((new_r02)*(new_r02)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -14767,6 +15227,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -14846,7 +15310,7 @@ evalcond[11]=((((IkReal(-1.00000000000000))*(x3633)*(x3662)))+(((x3640)*(x3655))
 evalcond[12]=((((IkReal(-1.00000000000000))*(x3641)*(x3658)))+(((IkReal(-1.00000000000000))*(x3630)*(x3662)))+(((IkReal(0.999149271799077))*(sj1)))+(((new_r21)*(x3624)))+(((IkReal(-0.993348889555023))*(new_r11)*(x3658)))+(((IkReal(-1.00000000000000))*(x3643)*(x3662)))+(((IkReal(-1.00000000000000))*(x3635)*(x3653)))+(((x3617)*(x3655)))+(((x3638)*(x3653)))+(((IkReal(-1.00000000000000))*(x3636)*(x3655)))+(((IkReal(-0.0412399401475676))*(x3616)))+(((IkReal(-0.0961000154891044))*(x3620))));
 evalcond[13]=((((IkReal(-1.00000000000000))*(x3633)*(x3658)))+(((IkReal(0.0412399401475676))*(cj1)))+(((IkReal(0.0634253154725807))*(cj3)*(x3652)))+(((x3631)*(x3659)))+(((IkReal(-1.00000000000000))*(x3631)*(x3656)))+(((new_r20)*(x3642)))+(((IkReal(-0.0959047211377687))*(new_r10)*(x3658)))+(((x3623)*(x3655)))+(((IkReal(-0.00612351537051366))*(sj3)*(x3652)))+(((new_r20)*(x3632)))+(((x3637)*(x3662)))+(((IkReal(-0.999149271799077))*(x3619))));
 evalcond[14]=((((IkReal(0.995371682851684))*(x3620)))+(((IkReal(-1.00000000000000))*(x3630)*(x3658)))+(((new_r21)*(x3642)))+(((IkReal(0.0412399401475676))*(sj1)))+(((IkReal(-1.00000000000000))*(x3635)*(x3655)))+(((IkReal(-1.00000000000000))*(x3643)*(x3658)))+(((x3638)*(x3655)))+(((x3636)*(x3653)))+(((IkReal(0.999149271799077))*(x3616)))+(((new_r11)*(x3615)*(x3631)))+(((x3641)*(x3662)))+(((IkReal(-1.00000000000000))*(x3617)*(x3653))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -14928,6 +15392,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -15007,7 +15475,7 @@ evalcond[11]=((((x3680)*(x3710)))+(((new_r20)*(x3681)))+(((IkReal(-1.00000000000
 evalcond[12]=((((IkReal(-1.00000000000000))*(x3687)*(x3719)))+(((IkReal(-1.00000000000000))*(x3700)*(x3719)))+(((x3695)*(x3710)))+(((IkReal(-1.00000000000000))*(x3692)*(x3710)))+(((IkReal(-0.0412399401475676))*(x3673)))+(((IkReal(0.999149271799077))*(sj1)))+(((IkReal(-1.00000000000000))*(x3693)*(x3712)))+(((x3674)*(x3712)))+(((new_r21)*(x3681)))+(((IkReal(-0.0961000154891044))*(x3677)))+(((IkReal(-1.00000000000000))*(x3698)*(x3715)))+(((IkReal(-0.993348889555023))*(new_r11)*(x3715))));
 evalcond[13]=((((x3680)*(x3712)))+(((x3688)*(x3716)))+(((new_r20)*(x3689)))+(((IkReal(0.0412399401475676))*(cj1)))+(((x3694)*(x3719)))+(((IkReal(0.0634253154725807))*(cj3)*(x3709)))+(((new_r20)*(x3699)))+(((IkReal(-0.00612351537051366))*(sj3)*(x3709)))+(((IkReal(-1.00000000000000))*(x3690)*(x3715)))+(((IkReal(-1.00000000000000))*(x3688)*(x3713)))+(((IkReal(-0.0959047211377687))*(new_r10)*(x3715)))+(((IkReal(-0.999149271799077))*(x3676))));
 evalcond[14]=((((IkReal(-1.00000000000000))*(x3687)*(x3715)))+(((new_r21)*(x3699)))+(((x3698)*(x3719)))+(((IkReal(-1.00000000000000))*(x3700)*(x3715)))+(((x3695)*(x3712)))+(((IkReal(-1.00000000000000))*(x3692)*(x3712)))+(((IkReal(-1.00000000000000))*(x3674)*(x3710)))+(((IkReal(0.0412399401475676))*(sj1)))+(((new_r11)*(x3672)*(x3688)))+(((x3693)*(x3710)))+(((IkReal(0.999149271799077))*(x3673)))+(((IkReal(0.995371682851684))*(x3677))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -15099,6 +15567,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -15133,7 +15605,7 @@ evalcond[1]=((((IkReal(-0.0548574835359933))*(x3739)))+(x3749)+(((IkReal(-1.0000
 evalcond[2]=((((IkReal(0.0637202329192957))*(x3746)))+(((IkReal(-0.0637202329192957))*(x3749)))+(((IkReal(-0.997967801042053))*(x3748)))+(((IkReal(-0.997967801042053))*(x3747)))+(((IkReal(-1.00000000000000))*(cj2))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x3743)*(x3748)))+(((IkReal(-1.00000000000000))*(x3743)*(x3747)))+(((x3744)*(x3749)))+(((IkReal(0.0412399401475676))*(sj2)))+(((IkReal(-1.00000000000000))*(x3745)*(x3746)))+(((IkReal(0.995371682851684))*(x3742)))+(((IkReal(-1.00000000000000))*(x3744)*(x3746)))+(((IkReal(-1.00000000000000))*(x3735)*(x3747)))+(((IkReal(-1.00000000000000))*(x3735)*(x3748)))+(((IkReal(-0.0961000154891044))*(x3737)))+(((x3745)*(x3749))));
 evalcond[4]=((((IkReal(0.0961000154891044))*(x3742)))+(((IkReal(-0.999149271799077))*(sj2)))+(((x3734)*(x3749)))+(((x3736)*(x3748)))+(((x3736)*(x3747)))+(((IkReal(-1.00000000000000))*(x3741)*(x3748)))+(((IkReal(-1.00000000000000))*(x3741)*(x3747)))+(((IkReal(-1.00000000000000))*(x3734)*(x3746)))+(((IkReal(0.995371682851684))*(x3737)))+(((IkReal(-1.00000000000000))*(x3738)*(x3749)))+(((x3738)*(x3746))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -15144,21 +15616,21 @@ IkReal dummyeval[1];
 IkReal gconst27;
 gconst27=IKsign(sj2);
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x3750=((cj2)*(sj2));
 dummyeval[0]=sj2;
 dummyeval[1]=((((cj3)*(x3750)))+(((IkReal(18.1645030061781))*(sj3)*(x3750))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x3751=((cj2)*(sj2));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(cj3)*(x3751)))+(((IkReal(-18.1645030061781))*(sj3)*(x3751))));
 dummyeval[1]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[9];
@@ -15188,21 +15660,21 @@ evalcond[5]=((((new_r10)*(x3765)))+(((IkReal(-1.00000000000000))*(new_r10)*(x376
 evalcond[6]=((((new_r11)*(x3765)))+(((IkReal(-1.00000000000000))*(new_r01)*(x3753)))+(((IkReal(-1.00000000000000))*(new_r11)*(x3763)))+(((IkReal(-1.00000000000000))*(new_r01)*(x3762))));
 evalcond[7]=((((IkReal(-0.0961000154891044))*(x3755)))+(((IkReal(-1.00000000000000))*(x3752)*(x3759)))+(((sj3)*(x3768)))+(((IkReal(-1.00000000000000))*(x3756)*(x3758)))+(((IkReal(-1.00000000000000))*(x3756)*(x3757)))+(((IkReal(-0.993348889555023))*(sj3)*(x3752)))+(((IkReal(-1.00000000000000))*(x3754)*(x3758)))+(((IkReal(-1.00000000000000))*(x3754)*(x3757)))+(((IkReal(0.995371682851684))*(x3760)))+(((x3759)*(x3766))));
 evalcond[8]=((((x3756)*(x3764)))+(((IkReal(-1.00000000000000))*(x3752)*(x3761)))+(((IkReal(0.993348889555023))*(cj3)*(x3752)))+(((IkReal(-1.00000000000000))*(x3754)*(x3767)))+(((IkReal(-1.00000000000000))*(cj3)*(x3768)))+(((x3761)*(x3766)))+(((IkReal(0.995371682851684))*(x3755)))+(((IkReal(0.0961000154891044))*(x3760)))+(((IkReal(-1.00000000000000))*(x3756)*(x3767)))+(((x3754)*(x3764))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst28;
 gconst28=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst29;
 gconst29=IKsign(((((IkReal(-0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(-0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((cj3)*(cj3))))+(((IkReal(-1.00000000000000))*((sj3)*(sj3)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -15239,6 +15711,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -15297,7 +15773,7 @@ evalcond[6]=((((IkReal(-0.0961000154891044))*(x3800)))+(((x3784)*(x3788)))+(((Ik
 evalcond[7]=((((IkReal(-1.00000000000000))*(x3779)*(x3783)))+(((IkReal(-0.0961000154891044))*(x3782)))+(((x3789)*(x3790)))+(((new_r21)*(x3793)))+(((IkReal(-1.00000000000000))*(x3804)))+(((IkReal(-1.00000000000000))*(x3779)*(x3802)))+(((IkReal(-1.00000000000000))*(x3781)*(x3786)))+(x3805)+(((IkReal(-1.00000000000000))*(x3780)*(x3786)))+(((IkReal(-1.00000000000000))*(x3784)*(x3791)))+(((x3784)*(x3801)))+(((IkReal(-1.00000000000000))*(x3785)*(x3790))));
 evalcond[8]=((((IkReal(0.995371682851684))*(x3800)))+(((x3788)*(x3790)))+(((IkReal(-1.00000000000000))*(x3786)*(x3797)))+(((IkReal(-1.00000000000000))*(x3805)))+(((IkReal(-1.00000000000000))*(x3786)*(x3803)))+(((new_r20)*(x3798)))+(((x3779)*(x3799)))+(((x3779)*(x3787)))+(((IkReal(-1.00000000000000))*(x3790)*(x3794)))+(x3804)+(((IkReal(-1.00000000000000))*(x3784)*(x3795)))+(((x3784)*(x3792))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x3784)*(x3789)))+(((x3784)*(x3785)))+(((IkReal(0.995371682851684))*(x3782)))+(((x3790)*(x3801)))+(((new_r21)*(x3798)))+(((IkReal(-1.00000000000000))*(x3786)*(x3802)))+(((x3779)*(x3780)))+(((x3779)*(x3781)))+(((IkReal(-1.00000000000000))*(x3790)*(x3791)))+(x3813)+(((IkReal(-1.00000000000000))*(x3783)*(x3786))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -15379,6 +15855,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -15437,7 +15917,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x3831)*(x3833)))+(((IkReal(-1.000000
 evalcond[7]=((((IkReal(-0.0961000154891044))*(x3823)))+(((new_r21)*(x3834)))+(((IkReal(-1.00000000000000))*(x3822)*(x3827)))+(((IkReal(-1.00000000000000))*(x3821)*(x3827)))+(((IkReal(-1.00000000000000))*(x3820)*(x3843)))+(x3846)+(((IkReal(-1.00000000000000))*(x3845)))+(((x3825)*(x3842)))+(((x3830)*(x3831)))+(((IkReal(-1.00000000000000))*(x3825)*(x3832)))+(((IkReal(-1.00000000000000))*(x3820)*(x3824)))+(((IkReal(-1.00000000000000))*(x3826)*(x3831))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x3831)*(x3835)))+(((IkReal(-1.00000000000000))*(x3827)*(x3844)))+(((x3820)*(x3828)))+(((new_r20)*(x3839)))+(((x3829)*(x3831)))+(((x3825)*(x3833)))+(x3845)+(((IkReal(0.995371682851684))*(x3841)))+(((x3820)*(x3840)))+(((IkReal(-1.00000000000000))*(x3827)*(x3838)))+(((IkReal(-1.00000000000000))*(x3846)))+(((IkReal(-1.00000000000000))*(x3825)*(x3836))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x3831)*(x3832)))+(((IkReal(-1.00000000000000))*(x3824)*(x3827)))+(((IkReal(-1.00000000000000))*(x3827)*(x3843)))+(((x3825)*(x3826)))+(((new_r21)*(x3839)))+(((x3820)*(x3821)))+(((x3820)*(x3822)))+(x3854)+(((x3831)*(x3842)))+(((IkReal(-1.00000000000000))*(x3825)*(x3830)))+(((IkReal(0.995371682851684))*(x3823))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -15512,25 +15992,25 @@ evalcond[3]=((((IkReal(-0.0548574835359933))*(sj3)))+(((IkReal(0.996458924600913
 evalcond[4]=((((IkReal(-0.997967801042053))*(x3856)))+(((IkReal(-0.997967801042053))*(x3858)))+(((IkReal(0.0637202329192957))*(x3855)))+(((IkReal(-0.0637202329192957))*(x3865))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x3858)*(x3859)))+(((sj3)*(x3867)))+(((IkReal(-1.00000000000000))*(x3858)*(x3860)))+(((IkReal(-1.00000000000000))*(x3856)*(x3859)))+(((IkReal(0.995371682851684))*(x3862)))+(((IkReal(-1.00000000000000))*(x3855)*(x3861)))+(((IkReal(-1.00000000000000))*(x3856)*(x3860)))+(((IkReal(-0.0961000154891044))*(x3857)))+(((x3861)*(x3865)))+(((IkReal(-0.993348889555023))*(sj3)*(x3855))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(cj3)*(x3867)))+(((IkReal(0.993348889555023))*(cj3)*(x3855)))+(((IkReal(-1.00000000000000))*(x3858)*(x3866)))+(((x3856)*(x3864)))+(((IkReal(0.995371682851684))*(x3857)))+(((IkReal(-1.00000000000000))*(x3855)*(x3863)))+(((IkReal(-1.00000000000000))*(x3856)*(x3866)))+(((x3863)*(x3865)))+(((x3858)*(x3864)))+(((IkReal(0.0961000154891044))*(x3862))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst30;
 gconst30=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -15545,7 +16025,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(x3868)+(((IkReal(-1.00000000000000
 evalcond[4]=((((IkReal(-0.997967801042053))*(x3869)))+(((IkReal(-0.997967801042053))*(x3871)))+(((IkReal(-0.0637202329192957))*(x3868)))+(((IkReal(0.0637202329192957))*(x3870))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(0.0636660242235878))*(x3869)))+(((IkReal(0.0636660242235878))*(x3871)))+(((IkReal(-0.997118800177265))*(x3868)))+(((IkReal(0.0412399400149127))*(new_r22)))+(((IkReal(0.997118800177265))*(x3870))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(0.0411561322517886))*(x3870)))+(((IkReal(0.00262781858332802))*(x3869)))+(((IkReal(-0.999149270283168))*(new_r22)))+(((IkReal(-0.0411561322517886))*(x3868)))+(((IkReal(0.00262781858332802))*(x3871))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -15570,6 +16050,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -15604,7 +16088,7 @@ evalcond[8]=((((IkReal(-0.997118800177265))*(x3875)))+(((IkReal(0.06366602422358
 evalcond[9]=((((IkReal(-0.997118800177265))*(x3879)))+(((IkReal(0.0636660242235878))*(x3878)))+(((IkReal(0.0636660242235878))*(x3877)))+(((IkReal(0.997118800177265))*(x3880)))+(((IkReal(0.0412399400149127))*(new_r21)))+(((IkReal(0.999149271799077))*(x3873))));
 evalcond[10]=((((IkReal(0.00262781858332802))*(x3882)))+(((IkReal(0.0412399401475676))*(x3872)))+(((IkReal(-1.00000000000000))*(new_r00)*(x3874)))+(((IkReal(-0.999149270283168))*(new_r20)))+(((IkReal(0.00262781858332802))*(x3876)))+(((IkReal(0.0411561322517886))*(x3881))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(new_r01)*(x3874)))+(((IkReal(0.0412399401475676))*(x3873)))+(((IkReal(-0.999149270283168))*(new_r21)))+(((IkReal(0.00262781858332802))*(x3878)))+(((IkReal(0.00262781858332802))*(x3877)))+(((IkReal(0.0411561322517886))*(x3880))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -15666,7 +16150,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(((IkReal(-1.00000000000000))*(x3885
 evalcond[4]=((((IkReal(0.0637202329192957))*(x3885)))+(((IkReal(-0.0637202329192957))*(x3883)))+(((IkReal(-0.997967801042053))*(x3886)))+(((IkReal(-0.997967801042053))*(x3884))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(-0.0636660242235878))*(x3884)))+(((IkReal(-0.0636660242235878))*(x3886)))+(((IkReal(0.997118800177265))*(x3883)))+(((IkReal(-0.997118800177265))*(x3885))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(-0.00262781858332802))*(x3884)))+(((IkReal(-0.00262781858332802))*(x3886)))+(((IkReal(-0.0411561322517886))*(x3885)))+(((IkReal(0.999149270283168))*(new_r22)))+(((IkReal(0.0411561322517886))*(x3883))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -15691,6 +16175,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -15725,7 +16213,7 @@ evalcond[8]=((((IkReal(0.997118800177265))*(x3890)))+(((IkReal(-0.04123994001491
 evalcond[9]=((((IkReal(0.997118800177265))*(x3894)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(-0.997118800177265))*(x3895)))+(((IkReal(0.999149271799077))*(x3888)))+(((IkReal(-0.0636660242235878))*(x3892)))+(((IkReal(-0.0636660242235878))*(x3893))));
 evalcond[10]=((((IkReal(-0.00262781858332802))*(x3891)))+(((IkReal(-0.00262781858332802))*(x3897)))+(((IkReal(0.0412399401475676))*(x3887)))+(((IkReal(-0.0411561322517886))*(x3896)))+(((new_r00)*(x3889)))+(((IkReal(0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(-0.00262781858332802))*(x3892)))+(((IkReal(-0.00262781858332802))*(x3893)))+(((IkReal(0.0412399401475676))*(x3888)))+(((IkReal(-0.0411561322517886))*(x3895)))+(((new_r01)*(x3889)))+(((IkReal(0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -15816,6 +16304,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -15870,7 +16362,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r00)*(x3904)))+(((new_r20)*(x
 evalcond[9]=((((IkReal(-1.00000000000000))*(x3904)*(x3908)))+(((IkReal(-1.00000000000000))*(x3910)*(x3926)))+(((IkReal(-1.00000000000000))*(x3906)*(x3922)))+(((IkReal(0.999149271799077))*(x3903)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3909)))+(((IkReal(-1.00000000000000))*(x3905)*(x3922)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x3904)))+(((IkReal(-0.0961000154891044))*(x3907)))+(((x3915)*(x3926)))+(((new_r21)*(x3917)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x3909))));
 evalcond[10]=((((IkReal(0.993348889555023))*(new_r10)*(x3904)))+(((IkReal(-1.00000000000000))*(x3911)*(x3912)))+(((x3904)*(x3914)))+(((IkReal(0.0412399401475676))*(x3902)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3909)))+(((x3913)*(x3919)))+(((IkReal(-1.00000000000000))*(x3919)*(x3920)))+(((new_r20)*(x3923)))+(((IkReal(0.995371682851684))*(x3918)))+(((IkReal(-1.00000000000000))*(x3912)*(x3924)))+(((IkReal(0.0634253154725807))*(new_r10)*(x3909))));
 evalcond[11]=((((new_r21)*(x3923)))+(((IkReal(0.0412399401475676))*(x3903)))+(((IkReal(-1.00000000000000))*(x3909)*(x3915)))+(((x3904)*(x3905)))+(((x3904)*(x3906)))+(((IkReal(0.995371682851684))*(x3907)))+(((IkReal(-1.00000000000000))*(x3919)*(x3921)))+(((IkReal(-1.00000000000000))*(x3912)*(x3928)))+(((x3909)*(x3910)))+(((IkReal(-1.00000000000000))*(x3908)*(x3922)))+(((x3916)*(x3919))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -15952,6 +16444,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -16006,7 +16502,7 @@ evalcond[8]=((((IkReal(0.999149271799077))*(x3937)))+(((IkReal(0.095904721137768
 evalcond[9]=((((IkReal(0.999149271799077))*(x3938)))+(((x3950)*(x3961)))+(((IkReal(-0.0961000154891044))*(x3942)))+(((IkReal(-1.00000000000000))*(x3945)*(x3961)))+(((IkReal(-1.00000000000000))*(x3940)*(x3957)))+(((IkReal(-1.00000000000000))*(x3941)*(x3957)))+(((new_r21)*(x3952)))+(((IkReal(-1.00000000000000))*(x3939)*(x3943)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3944)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x3944)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x3939))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x3954)*(x3955)))+(((IkReal(0.0412399401475676))*(x3937)))+(((IkReal(0.993348889555023))*(new_r10)*(x3939)))+(((IkReal(0.995371682851684))*(x3953)))+(((IkReal(-1.00000000000000))*(x3946)*(x3947)))+(((new_r20)*(x3958)))+(((x3939)*(x3949)))+(((x3948)*(x3954)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3944)))+(((IkReal(0.0634253154725807))*(new_r10)*(x3944)))+(((IkReal(-1.00000000000000))*(x3947)*(x3959))));
 evalcond[11]=((((IkReal(0.995371682851684))*(x3942)))+(((IkReal(-1.00000000000000))*(x3954)*(x3956)))+(((IkReal(0.0412399401475676))*(x3938)))+(((x3939)*(x3940)))+(((x3939)*(x3941)))+(((new_r21)*(x3958)))+(((IkReal(-1.00000000000000))*(x3947)*(x3963)))+(((IkReal(-1.00000000000000))*(x3943)*(x3957)))+(((IkReal(-1.00000000000000))*(x3944)*(x3950)))+(((x3944)*(x3945)))+(((x3951)*(x3954))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -16085,6 +16581,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -16139,7 +16639,7 @@ evalcond[8]=((((IkReal(-0.0634253154725807))*(sj3)*(x3978)))+(((IkReal(-0.006123
 evalcond[9]=((((IkReal(-0.0959047211377687))*(new_r11)*(x3971)))+(((IkReal(-1.00000000000000))*(x3973)*(x3989)))+(((IkReal(-1.00000000000000))*(x3977)*(x3993)))+(((IkReal(0.0959047211377687))*(new_r01)*(x3976)))+(((IkReal(0.999149271799077))*(x3970)))+(((IkReal(-0.0961000154891044))*(x3974)))+(((IkReal(-1.00000000000000))*(x3971)*(x3975)))+(((new_r21)*(x3984)))+(((IkReal(-1.00000000000000))*(x3972)*(x3989)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x3976)))+(((x3982)*(x3993))));
 evalcond[10]=((((x3971)*(x3981)))+(((IkReal(-0.993348889555023))*(new_r00)*(x3976)))+(((IkReal(0.0634253154725807))*(new_r10)*(x3976)))+(((IkReal(-1.00000000000000))*(x3978)*(x3979)))+(((IkReal(-1.00000000000000))*(x3979)*(x3991)))+(((IkReal(-1.00000000000000))*(x3986)*(x3987)))+(((IkReal(0.995371682851684))*(x3985)))+(((IkReal(0.0412399401475676))*(x3969)))+(((x3980)*(x3986)))+(((new_r20)*(x3990)))+(((IkReal(0.993348889555023))*(new_r10)*(x3971))));
 evalcond[11]=((((x3983)*(x3986)))+(((new_r21)*(x3990)))+(((IkReal(-1.00000000000000))*(x3976)*(x3982)))+(((IkReal(-1.00000000000000))*(x3979)*(x3995)))+(((x3976)*(x3977)))+(((IkReal(-1.00000000000000))*(x3986)*(x3988)))+(((x3971)*(x3973)))+(((x3971)*(x3972)))+(((IkReal(0.0412399401475676))*(x3970)))+(((IkReal(0.995371682851684))*(x3974)))+(((IkReal(-1.00000000000000))*(x3975)*(x3989))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -16220,21 +16720,21 @@ evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x4001)))+(((IkReal(-1.0000
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x4001)))+(((IkReal(-1.00000000000000))*(new_r11)*(x4011)))+(((IkReal(-1.00000000000000))*(new_r01)*(x4010)))+(((new_r11)*(x4013))));
 evalcond[7]=((((IkReal(-0.993348889555023))*(sj3)*(x4000)))+(((IkReal(-1.00000000000000))*(x4002)*(x4006)))+(((IkReal(-1.00000000000000))*(x4002)*(x4005)))+(((IkReal(-1.00000000000000))*(x4000)*(x4007)))+(((IkReal(0.995371682851684))*(x4008)))+(((IkReal(-0.0961000154891044))*(x4003)))+(((x4007)*(x4014)))+(((IkReal(-1.00000000000000))*(x4004)*(x4005)))+(((IkReal(-1.00000000000000))*(x4004)*(x4006)))+(((sj3)*(x4016))));
 evalcond[8]=((((x4004)*(x4012)))+(((IkReal(-1.00000000000000))*(x4002)*(x4015)))+(((x4002)*(x4012)))+(((IkReal(-1.00000000000000))*(x4000)*(x4009)))+(((IkReal(-1.00000000000000))*(cj3)*(x4016)))+(((IkReal(0.995371682851684))*(x4003)))+(((IkReal(0.993348889555023))*(cj3)*(x4000)))+(((x4009)*(x4014)))+(((IkReal(0.0961000154891044))*(x4008)))+(((IkReal(-1.00000000000000))*(x4004)*(x4015))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst31;
 gconst31=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst32;
 gconst32=IKsign(((((IkReal(0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -16270,6 +16770,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -16328,7 +16832,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x4037)*(x4039)))+(((x4037)*(x4042)))
 evalcond[7]=((((IkReal(-0.0961000154891044))*(x4029)))+(((IkReal(-1.00000000000000))*(x4031)*(x4038)))+(((IkReal(-1.00000000000000))*(x4026)*(x4049)))+(((x4036)*(x4037)))+(((IkReal(-1.00000000000000))*(x4026)*(x4030)))+(((IkReal(-1.00000000000000))*(x4027)*(x4033)))+(x4060)+(((IkReal(-1.00000000000000))*(x4028)*(x4033)))+(((new_r21)*(x4040)))+(((x4031)*(x4048)))+(((IkReal(-1.00000000000000))*(x4032)*(x4037))));
 evalcond[8]=((((x4035)*(x4037)))+(((IkReal(-1.00000000000000))*(x4033)*(x4050)))+(((x4026)*(x4034)))+(((new_r20)*(x4045)))+(((IkReal(-1.00000000000000))*(x4033)*(x4044)))+(x4060)+(((x4026)*(x4046)))+(((IkReal(-1.00000000000000))*(x4031)*(x4042)))+(((IkReal(-1.00000000000000))*(x4037)*(x4041)))+(((IkReal(0.995371682851684))*(x4047)))+(((x4031)*(x4039))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x4031)*(x4036)))+(((IkReal(-1.00000000000000))*(x4037)*(x4038)))+(((x4037)*(x4048)))+(((IkReal(-1.00000000000000))*(x4030)*(x4033)))+(((IkReal(-1.00000000000000))*(x4033)*(x4049)))+(((IkReal(0.995371682851684))*(x4029)))+(x4053)+(((IkReal(-1.00000000000000))*(x4054)))+(((new_r21)*(x4045)))+(((x4026)*(x4027)))+(((x4026)*(x4028)))+(((x4031)*(x4032))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -16410,6 +16914,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -16468,7 +16976,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x4067)*(x4085)))+(((new_r20)*(x4081)
 evalcond[7]=((((IkReal(-1.00000000000000))*(x4068)*(x4074)))+(((new_r21)*(x4081)))+(((IkReal(-1.00000000000000))*(x4069)*(x4074)))+(((IkReal(-1.00000000000000))*(x4067)*(x4071)))+(((x4077)*(x4078)))+(((x4072)*(x4089)))+(((IkReal(-1.00000000000000))*(x4067)*(x4090)))+(x4101)+(((IkReal(-0.0961000154891044))*(x4070)))+(((IkReal(-1.00000000000000))*(x4072)*(x4079)))+(((IkReal(-1.00000000000000))*(x4073)*(x4078))));
 evalcond[8]=((((IkReal(0.995371682851684))*(x4088)))+(((new_r20)*(x4086)))+(((x4072)*(x4080)))+(((IkReal(-1.00000000000000))*(x4074)*(x4085)))+(x4101)+(((x4067)*(x4075)))+(((IkReal(-1.00000000000000))*(x4078)*(x4082)))+(((IkReal(-1.00000000000000))*(x4074)*(x4091)))+(((x4067)*(x4087)))+(((IkReal(-1.00000000000000))*(x4072)*(x4083)))+(((x4076)*(x4078))));
 evalcond[9]=((((new_r21)*(x4086)))+(((IkReal(-1.00000000000000))*(x4071)*(x4074)))+(((x4067)*(x4068)))+(((x4067)*(x4069)))+(((IkReal(-1.00000000000000))*(x4095)))+(((x4072)*(x4073)))+(x4094)+(((IkReal(0.995371682851684))*(x4070)))+(((IkReal(-1.00000000000000))*(x4074)*(x4090)))+(((IkReal(-1.00000000000000))*(x4072)*(x4077)))+(((IkReal(-1.00000000000000))*(x4078)*(x4079)))+(((x4078)*(x4089))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -16543,25 +17051,25 @@ evalcond[3]=((((IkReal(-1.00000000000000))*(x4102)))+(((IkReal(-0.99645892460091
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x4112)))+(((IkReal(0.0637202329192957))*(x4102)))+(((IkReal(-0.997967801042053))*(x4105)))+(((IkReal(-0.997967801042053))*(x4103))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((sj3)*(x4114)))+(((x4108)*(x4112)))+(((IkReal(-1.00000000000000))*(x4105)*(x4106)))+(((IkReal(-1.00000000000000))*(x4105)*(x4107)))+(((IkReal(-1.00000000000000))*(x4102)*(x4108)))+(((IkReal(0.995371682851684))*(x4109)))+(((IkReal(-0.993348889555023))*(sj3)*(x4102)))+(((IkReal(-0.0961000154891044))*(x4104)))+(((IkReal(-1.00000000000000))*(x4103)*(x4107)))+(((IkReal(-1.00000000000000))*(x4103)*(x4106))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(-1.00000000000000))*(x4105)*(x4113)))+(((IkReal(-1.00000000000000))*(x4103)*(x4113)))+(((x4103)*(x4111)))+(((IkReal(-1.00000000000000))*(cj3)*(x4114)))+(((IkReal(0.993348889555023))*(cj3)*(x4102)))+(((x4105)*(x4111)))+(((IkReal(0.995371682851684))*(x4104)))+(((IkReal(0.0961000154891044))*(x4109)))+(((IkReal(-1.00000000000000))*(x4102)*(x4110)))+(((x4110)*(x4112))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst33;
 gconst33=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -16576,7 +17084,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x4115)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x4115)))+(((IkReal(-0.997967801042053))*(x4118)))+(((IkReal(-0.997967801042053))*(x4116)))+(((IkReal(0.0637202329192957))*(x4117))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(-0.997118800177265))*(x4115)))+(((IkReal(0.997118800177265))*(x4117)))+(((IkReal(0.0636660242235878))*(x4116)))+(((IkReal(0.0636660242235878))*(x4118)))+(((IkReal(0.0412399400149127))*(new_r22))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(0.00262781858332802))*(x4116)))+(((IkReal(0.00262781858332802))*(x4118)))+(((IkReal(-0.999149270283168))*(new_r22)))+(((IkReal(-0.0411561322517886))*(x4115)))+(((IkReal(0.0411561322517886))*(x4117))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -16601,6 +17109,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -16635,7 +17147,7 @@ evalcond[8]=((((IkReal(-0.997118800177265))*(x4122)))+(((IkReal(0.99711880017726
 evalcond[9]=((((IkReal(-0.997118800177265))*(x4126)))+(((IkReal(0.997118800177265))*(x4127)))+(((IkReal(0.0636660242235878))*(x4125)))+(((IkReal(0.0636660242235878))*(x4124)))+(((IkReal(0.0412399400149127))*(new_r21)))+(((IkReal(0.999149271799077))*(x4120))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(new_r00)*(x4121)))+(((IkReal(0.00262781858332802))*(x4129)))+(((IkReal(0.00262781858332802))*(x4123)))+(((IkReal(0.0412399401475676))*(x4119)))+(((IkReal(-0.999149270283168))*(new_r20)))+(((IkReal(0.0411561322517886))*(x4128))));
 evalcond[11]=((((IkReal(0.00262781858332802))*(x4124)))+(((IkReal(0.00262781858332802))*(x4125)))+(((IkReal(-1.00000000000000))*(new_r01)*(x4121)))+(((IkReal(0.0412399401475676))*(x4120)))+(((IkReal(-0.999149270283168))*(new_r21)))+(((IkReal(0.0411561322517886))*(x4127))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -16697,7 +17209,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(((IkReal(-1.00000000000000))*(x413
 evalcond[4]=((((IkReal(-0.997967801042053))*(x4131)))+(((IkReal(-0.997967801042053))*(x4133)))+(((IkReal(0.0637202329192957))*(x4132)))+(((IkReal(-0.0637202329192957))*(x4130))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(-0.997118800177265))*(x4132)))+(((IkReal(0.997118800177265))*(x4130)))+(((IkReal(-0.0636660242235878))*(x4131)))+(((IkReal(-0.0636660242235878))*(x4133))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(-0.00262781858332802))*(x4133)))+(((IkReal(-0.00262781858332802))*(x4131)))+(((IkReal(0.0411561322517886))*(x4130)))+(((IkReal(-0.0411561322517886))*(x4132)))+(((IkReal(0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -16722,6 +17234,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -16756,7 +17272,7 @@ evalcond[8]=((((IkReal(-0.0412399400149127))*(new_r20)))+(((IkReal(0.99914927179
 evalcond[9]=((((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(0.999149271799077))*(x4135)))+(((IkReal(0.997118800177265))*(x4141)))+(((IkReal(-0.997118800177265))*(x4142)))+(((IkReal(-0.0636660242235878))*(x4140)))+(((IkReal(-0.0636660242235878))*(x4139))));
 evalcond[10]=((((IkReal(-0.00262781858332802))*(x4138)))+(((IkReal(0.0412399401475676))*(x4134)))+(((IkReal(-0.00262781858332802))*(x4144)))+(((new_r00)*(x4136)))+(((IkReal(-0.0411561322517886))*(x4143)))+(((IkReal(0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(-0.00262781858332802))*(x4139)))+(((IkReal(0.0412399401475676))*(x4135)))+(((IkReal(-0.00262781858332802))*(x4140)))+(((new_r01)*(x4136)))+(((IkReal(-0.0411561322517886))*(x4142)))+(((IkReal(0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -16847,6 +17363,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -16901,7 +17421,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x4161)*(x4171)))+(((x4160)*(x4174)))
 evalcond[9]=((((IkReal(-0.0961000154891044))*(x4154)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4156)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x4151)))+(((IkReal(-1.00000000000000))*(x4152)*(x4171)))+(((new_r21)*(x4165)))+(((x4162)*(x4173)))+(((IkReal(-1.00000000000000))*(x4153)*(x4171)))+(((IkReal(-1.00000000000000))*(x4151)*(x4155)))+(((IkReal(0.999149271799077))*(x4150)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x4156)))+(((IkReal(-1.00000000000000))*(x4157)*(x4173))));
 evalcond[10]=((((x4151)*(x4161)))+(((new_r20)*(x4170)))+(((IkReal(0.0412399401475676))*(x4149)))+(((IkReal(-1.00000000000000))*(x4159)*(x4175)))+(((x4160)*(x4167)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4156)))+(((IkReal(0.995371682851684))*(x4166)))+(((IkReal(-1.00000000000000))*(x4158)*(x4159)))+(((IkReal(0.993348889555023))*(new_r10)*(x4151)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4156)))+(((IkReal(-1.00000000000000))*(x4167)*(x4169))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x4159)*(x4163)))+(((IkReal(0.0412399401475676))*(x4150)))+(((x4151)*(x4152)))+(((x4151)*(x4153)))+(((x4156)*(x4157)))+(((IkReal(-1.00000000000000))*(x4155)*(x4171)))+(((IkReal(-1.00000000000000))*(x4167)*(x4168)))+(((IkReal(-1.00000000000000))*(x4156)*(x4162)))+(((IkReal(0.995371682851684))*(x4154)))+(((new_r21)*(x4170)))+(((x4164)*(x4167))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -16983,6 +17503,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -17037,7 +17561,7 @@ evalcond[8]=((((IkReal(-0.0634253154725807))*(sj3)*(x4193)))+(((IkReal(-0.096100
 evalcond[9]=((((IkReal(-1.00000000000000))*(x4188)*(x4206)))+(((IkReal(-1.00000000000000))*(x4187)*(x4206)))+(((IkReal(-1.00000000000000))*(x4192)*(x4208)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x4191)))+(((IkReal(-0.0961000154891044))*(x4189)))+(((IkReal(-1.00000000000000))*(x4186)*(x4190)))+(((new_r21)*(x4200)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4191)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x4186)))+(((x4197)*(x4208)))+(((IkReal(0.999149271799077))*(x4185))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x4194)*(x4210)))+(((x4186)*(x4196)))+(((IkReal(0.0412399401475676))*(x4184)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4191)))+(((IkReal(-1.00000000000000))*(x4193)*(x4194)))+(((IkReal(-1.00000000000000))*(x4202)*(x4204)))+(((new_r20)*(x4205)))+(((IkReal(0.995371682851684))*(x4201)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4191)))+(((IkReal(0.993348889555023))*(new_r10)*(x4186)))+(((x4195)*(x4202))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x4194)*(x4198)))+(((x4199)*(x4202)))+(((IkReal(0.995371682851684))*(x4189)))+(((x4186)*(x4188)))+(((x4186)*(x4187)))+(((IkReal(-1.00000000000000))*(x4190)*(x4206)))+(((x4191)*(x4192)))+(((IkReal(0.0412399401475676))*(x4185)))+(((new_r21)*(x4205)))+(((IkReal(-1.00000000000000))*(x4202)*(x4203)))+(((IkReal(-1.00000000000000))*(x4191)*(x4197))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -17116,6 +17640,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -17170,7 +17698,7 @@ evalcond[8]=((((IkReal(-0.0634253154725807))*(sj3)*(x4225)))+(((IkReal(0.9991492
 evalcond[9]=((((x4229)*(x4240)))+(((IkReal(-1.00000000000000))*(x4218)*(x4222)))+(((IkReal(-0.0961000154891044))*(x4221)))+(((IkReal(0.999149271799077))*(x4217)))+(((IkReal(-1.00000000000000))*(x4224)*(x4240)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x4223)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x4218)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4223)))+(((new_r21)*(x4232)))+(((IkReal(-1.00000000000000))*(x4219)*(x4238)))+(((IkReal(-1.00000000000000))*(x4220)*(x4238))));
 evalcond[10]=((((IkReal(0.995371682851684))*(x4233)))+(((x4218)*(x4228)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4223)))+(((IkReal(0.0412399401475676))*(x4216)))+(((IkReal(0.993348889555023))*(new_r10)*(x4218)))+(((x4227)*(x4234)))+(((new_r20)*(x4237)))+(((IkReal(-1.00000000000000))*(x4226)*(x4242)))+(((IkReal(-1.00000000000000))*(x4234)*(x4236)))+(((IkReal(-1.00000000000000))*(x4225)*(x4226)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4223))));
 evalcond[11]=((((IkReal(0.995371682851684))*(x4221)))+(((x4231)*(x4234)))+(((IkReal(-1.00000000000000))*(x4226)*(x4230)))+(((x4218)*(x4219)))+(((x4218)*(x4220)))+(((IkReal(0.0412399401475676))*(x4217)))+(((IkReal(-1.00000000000000))*(x4223)*(x4229)))+(((IkReal(-1.00000000000000))*(x4222)*(x4238)))+(((x4223)*(x4224)))+(((new_r21)*(x4237)))+(((IkReal(-1.00000000000000))*(x4234)*(x4235))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -17272,6 +17800,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -17337,7 +17869,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x4282)*(x4284)))+(((IkReal(0.9991492
 evalcond[9]=((((IkReal(-1.00000000000000))*(x4265)*(x4282)))+(((IkReal(-0.0961000154891044))*(x4261)))+(((IkReal(-1.00000000000000))*(x4258)*(x4278)))+(((IkReal(-1.00000000000000))*(x4259)*(x4275)))+(((new_r21)*(x4264)))+(((x4262)*(x4275)))+(x4288)+(((IkReal(-1.00000000000000))*(cj2)*(x4285)))+(((IkReal(-1.00000000000000))*(x4268)*(x4277)))+(((IkReal(-1.00000000000000))*(x4265)*(x4273)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4258)))+(((IkReal(-1.00000000000000))*(x4268)*(x4283))));
 evalcond[10]=((((x4280)*(x4284)))+(((x4267)*(x4269)))+(((IkReal(-1.00000000000000))*(x4279)*(x4284)))+(((IkReal(-1.00000000000000))*(x4260)*(x4279)))+(x4285)+(((IkReal(0.0634253154725807))*(new_r10)*(x4258)))+(((IkReal(-1.00000000000000))*(cj2)*(x4288)))+(((new_r20)*(x4281)))+(((IkReal(-1.00000000000000))*(x4269)*(x4274)))+(((x4271)*(x4274)))+(((IkReal(0.995371682851684))*(x4270)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4258))));
 evalcond[11]=((((x4265)*(x4280)))+(((IkReal(-1.00000000000000))*(x4275)*(x4278)))+(((x4258)*(x4259)))+(((x4263)*(x4269)))+(((IkReal(-1.00000000000000))*(x4258)*(x4262)))+(((new_r21)*(x4281)))+(((x4268)*(x4271)))+(x4290)+(((IkReal(0.999149271799077))*(x4295)))+(((IkReal(-1.00000000000000))*(x4268)*(x4269)))+(((IkReal(-1.00000000000000))*(x4265)*(x4279)))+(((IkReal(0.995371682851684))*(x4261))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -17424,6 +17956,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -17489,7 +18025,7 @@ evalcond[8]=((((new_r20)*(x4315)))+(((IkReal(-1.00000000000000))*(x4333)*(x4335)
 evalcond[9]=((((IkReal(0.0959047211377687))*(new_r01)*(x4309)))+(((new_r21)*(x4315)))+(((IkReal(-1.00000000000000))*(x4316)*(x4333)))+(((IkReal(-1.00000000000000))*(x4310)*(x4326)))+(((IkReal(-1.00000000000000))*(x4316)*(x4324)))+(x4339)+(((IkReal(-1.00000000000000))*(cj2)*(x4336)))+(((x4313)*(x4326)))+(((IkReal(-1.00000000000000))*(x4319)*(x4328)))+(((IkReal(-1.00000000000000))*(x4309)*(x4329)))+(((IkReal(-0.0961000154891044))*(x4312)))+(((IkReal(-1.00000000000000))*(x4319)*(x4334))));
 evalcond[10]=((((IkReal(0.0634253154725807))*(new_r10)*(x4309)))+(((IkReal(0.995371682851684))*(x4321)))+(((IkReal(-1.00000000000000))*(x4330)*(x4335)))+(((new_r20)*(x4332)))+(((x4318)*(x4320)))+(((IkReal(-1.00000000000000))*(x4311)*(x4330)))+(((x4331)*(x4335)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4309)))+(((IkReal(-1.00000000000000))*(x4320)*(x4325)))+(((x4322)*(x4325)))+(x4336)+(((IkReal(-1.00000000000000))*(cj2)*(x4339))));
 evalcond[11]=((((new_r21)*(x4332)))+(((IkReal(-1.00000000000000))*(x4316)*(x4330)))+(((x4319)*(x4322)))+(((IkReal(0.999149271799077))*(x4346)))+(((x4314)*(x4320)))+(((x4316)*(x4331)))+(((IkReal(-1.00000000000000))*(x4309)*(x4313)))+(((IkReal(-1.00000000000000))*(x4326)*(x4329)))+(((IkReal(0.995371682851684))*(x4312)))+(x4341)+(((x4309)*(x4310)))+(((IkReal(-1.00000000000000))*(x4319)*(x4320))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -17571,6 +18107,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -17636,7 +18176,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x4379)*(x4381)))+(((IkReal(-1.000000
 evalcond[9]=((((IkReal(-1.00000000000000))*(x4365)*(x4380)))+(((x4359)*(x4372)))+(((new_r21)*(x4361)))+(((IkReal(-1.00000000000000))*(x4362)*(x4370)))+(((IkReal(-1.00000000000000))*(x4362)*(x4379)))+(((IkReal(-1.00000000000000))*(x4355)*(x4375)))+(((IkReal(-1.00000000000000))*(x4365)*(x4374)))+(((IkReal(-1.00000000000000))*(cj2)*(x4382)))+(((IkReal(-0.0961000154891044))*(x4358)))+(x4385)+(((IkReal(0.0959047211377687))*(new_r01)*(x4355)))+(((IkReal(-1.00000000000000))*(x4356)*(x4372))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x4366)*(x4371)))+(((x4368)*(x4371)))+(((x4377)*(x4381)))+(((IkReal(0.995371682851684))*(x4367)))+(((IkReal(-1.00000000000000))*(cj2)*(x4385)))+(x4382)+(((IkReal(0.0634253154725807))*(new_r10)*(x4355)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4355)))+(((IkReal(-1.00000000000000))*(x4357)*(x4376)))+(((new_r20)*(x4378)))+(((IkReal(-1.00000000000000))*(x4376)*(x4381)))+(((x4364)*(x4366))));
 evalcond[11]=((((IkReal(0.995371682851684))*(x4358)))+(((IkReal(-1.00000000000000))*(x4362)*(x4376)))+(((new_r21)*(x4378)))+(((IkReal(-1.00000000000000))*(x4365)*(x4366)))+(((x4362)*(x4377)))+(((x4360)*(x4366)))+(x4387)+(((IkReal(-1.00000000000000))*(x4355)*(x4359)))+(((x4355)*(x4356)))+(((x4365)*(x4368)))+(((IkReal(0.999149271799077))*(x4392)))+(((IkReal(-1.00000000000000))*(x4372)*(x4375))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -17743,6 +18283,10 @@ if( !j3valid[ij3] )
 {
     continue;
 }
+if( !IKjointinlimits(3, j3array[ij3]) )
+{
+    continue;
+}
 _ij3[0] = ij3; _ij3[1] = -1;
 for(int iij3 = ij3+1; iij3 < 2; ++iij3)
 {
@@ -17758,7 +18302,7 @@ IkReal dummyeval[1];
 IkReal gconst26;
 gconst26=IKsign(((((IkReal(-0.0637202329192957))*((new_r02)*(new_r02))))+(((IkReal(-0.0637202329192957))*((new_r12)*(new_r12))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((new_r02)*(new_r02))))+(((IkReal(-1.00000000000000))*((new_r12)*(new_r12)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
@@ -17773,14 +18317,14 @@ IkReal x4402=(cj2)*(cj2);
 IkReal x4403=(cj3)*(cj3);
 IkReal x4404=((IkReal(36.3290060123561))*(cj3)*(sj3));
 dummyeval[0]=((x4401)+(((x4402)*(x4403)))+(((x4402)*(x4404)))+(((IkReal(-1.00000000000000))*(x4404)))+(((IkReal(329.949169461452))*(x4401)*(x4402)))+(((IkReal(329.949169461452))*(x4403))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst25;
 gconst25=IKsign((((new_r12)*(new_r12))+((new_r02)*(new_r02))));
 dummyeval[0]=(((new_r12)*(new_r12))+((new_r02)*(new_r02)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -17816,6 +18360,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -17850,7 +18398,7 @@ evalcond[1]=((((IkReal(0.996458924600913))*(x4420)))+(x4429)+(((IkReal(-1.000000
 evalcond[2]=((((IkReal(0.0637202329192957))*(x4426)))+(((IkReal(-0.0637202329192957))*(x4429)))+(((IkReal(-1.00000000000000))*(cj2)))+(((IkReal(-0.997967801042053))*(x4428)))+(((IkReal(-0.997967801042053))*(x4427))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x4415)*(x4428)))+(((IkReal(-1.00000000000000))*(x4415)*(x4427)))+(((IkReal(-1.00000000000000))*(x4425)*(x4426)))+(((IkReal(-1.00000000000000))*(x4423)*(x4428)))+(((IkReal(-1.00000000000000))*(x4423)*(x4427)))+(((x4425)*(x4429)))+(((IkReal(-0.0961000154891044))*(x4417)))+(((IkReal(0.0412399401475676))*(sj2)))+(((IkReal(0.995371682851684))*(x4422)))+(((IkReal(-1.00000000000000))*(x4424)*(x4426)))+(((x4424)*(x4429))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x4414)*(x4426)))+(((IkReal(-0.999149271799077))*(sj2)))+(((IkReal(0.995371682851684))*(x4417)))+(((x4418)*(x4426)))+(((IkReal(0.0961000154891044))*(x4422)))+(((x4414)*(x4429)))+(((IkReal(-1.00000000000000))*(x4421)*(x4428)))+(((IkReal(-1.00000000000000))*(x4421)*(x4427)))+(((IkReal(-1.00000000000000))*(x4418)*(x4429)))+(((x4416)*(x4427)))+(((x4416)*(x4428))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -17861,21 +18409,21 @@ IkReal dummyeval[1];
 IkReal gconst27;
 gconst27=IKsign(sj2);
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x4430=((cj2)*(sj2));
 dummyeval[0]=sj2;
 dummyeval[1]=((((IkReal(18.1645030061781))*(sj3)*(x4430)))+(((cj3)*(x4430))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x4431=((cj2)*(sj2));
 dummyeval[0]=((((IkReal(-18.1645030061781))*(sj3)*(x4431)))+(((IkReal(-1.00000000000000))*(cj3)*(x4431))));
 dummyeval[1]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[9];
@@ -17905,21 +18453,21 @@ evalcond[5]=((((IkReal(-1.00000000000000))*(new_r10)*(x4443)))+(((IkReal(-1.0000
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r11)*(x4443)))+(((new_r11)*(x4445)))+(((IkReal(-1.00000000000000))*(new_r01)*(x4433)))+(((IkReal(-1.00000000000000))*(new_r01)*(x4442))));
 evalcond[7]=((((sj3)*(x4448)))+(((IkReal(0.995371682851684))*(x4440)))+(((IkReal(-1.00000000000000))*(x4434)*(x4438)))+(((IkReal(-1.00000000000000))*(x4434)*(x4437)))+(((IkReal(-0.993348889555023))*(sj3)*(x4432)))+(((IkReal(-1.00000000000000))*(x4432)*(x4439)))+(((x4439)*(x4446)))+(((IkReal(-1.00000000000000))*(x4436)*(x4438)))+(((IkReal(-1.00000000000000))*(x4436)*(x4437)))+(((IkReal(-0.0961000154891044))*(x4435))));
 evalcond[8]=((((IkReal(0.993348889555023))*(cj3)*(x4432)))+(((IkReal(-1.00000000000000))*(x4432)*(x4441)))+(((x4441)*(x4446)))+(((x4434)*(x4444)))+(((x4436)*(x4444)))+(((IkReal(-1.00000000000000))*(cj3)*(x4448)))+(((IkReal(-1.00000000000000))*(x4436)*(x4447)))+(((IkReal(0.995371682851684))*(x4435)))+(((IkReal(-1.00000000000000))*(x4434)*(x4447)))+(((IkReal(0.0961000154891044))*(x4440))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst28;
 gconst28=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst29;
 gconst29=IKsign(((((IkReal(-0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(-0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((cj3)*(cj3))))+(((IkReal(-1.00000000000000))*((sj3)*(sj3)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -17956,6 +18504,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -18014,7 +18566,7 @@ evalcond[6]=((((x4470)*(x4475)))+(x4493)+(((IkReal(-1.00000000000000))*(x4459)*(
 evalcond[7]=((x4485)+(((new_r21)*(x4473)))+(((x4464)*(x4481)))+(((IkReal(-0.0961000154891044))*(x4462)))+(((IkReal(-1.00000000000000))*(x4459)*(x4482)))+(((IkReal(-1.00000000000000))*(x4459)*(x4463)))+(((IkReal(-1.00000000000000))*(x4464)*(x4471)))+(((IkReal(-1.00000000000000))*(x4460)*(x4466)))+(((IkReal(-1.00000000000000))*(x4461)*(x4466)))+(((x4469)*(x4470)))+(((IkReal(-1.00000000000000))*(x4484)))+(((IkReal(-1.00000000000000))*(x4465)*(x4470))));
 evalcond[8]=((x4484)+(((x4464)*(x4472)))+(((x4459)*(x4479)))+(((new_r20)*(x4478)))+(((IkReal(-1.00000000000000))*(x4470)*(x4474)))+(((x4459)*(x4467)))+(((IkReal(0.995371682851684))*(x4480)))+(((IkReal(-1.00000000000000))*(x4466)*(x4477)))+(((IkReal(-1.00000000000000))*(x4464)*(x4475)))+(((x4468)*(x4470)))+(((IkReal(-1.00000000000000))*(x4466)*(x4483)))+(((IkReal(-1.00000000000000))*(x4485))));
 evalcond[9]=((((x4470)*(x4481)))+(((IkReal(-1.00000000000000))*(x4464)*(x4469)))+(((IkReal(-1.00000000000000))*(x4463)*(x4466)))+(x4493)+(((new_r21)*(x4478)))+(((IkReal(0.995371682851684))*(x4462)))+(((IkReal(-1.00000000000000))*(x4470)*(x4471)))+(((x4459)*(x4461)))+(((x4459)*(x4460)))+(((x4464)*(x4465)))+(((IkReal(-1.00000000000000))*(x4466)*(x4482))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -18096,6 +18648,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -18154,7 +18710,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x4500)*(x4524)))+(((x4511)*(x4516)))
 evalcond[7]=((((IkReal(-1.00000000000000))*(x4500)*(x4523)))+(((IkReal(-1.00000000000000))*(x4525)))+(((x4510)*(x4511)))+(((IkReal(-0.0961000154891044))*(x4503)))+(((IkReal(-1.00000000000000))*(x4506)*(x4511)))+(x4526)+(((IkReal(-1.00000000000000))*(x4505)*(x4512)))+(((new_r21)*(x4514)))+(((IkReal(-1.00000000000000))*(x4501)*(x4507)))+(((IkReal(-1.00000000000000))*(x4500)*(x4504)))+(((x4505)*(x4522)))+(((IkReal(-1.00000000000000))*(x4502)*(x4507))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x4526)))+(x4525)+(((x4505)*(x4513)))+(((IkReal(-1.00000000000000))*(x4507)*(x4524)))+(((IkReal(-1.00000000000000))*(x4505)*(x4516)))+(((x4500)*(x4508)))+(((IkReal(-1.00000000000000))*(x4511)*(x4515)))+(((IkReal(0.995371682851684))*(x4521)))+(((IkReal(-1.00000000000000))*(x4507)*(x4518)))+(((new_r20)*(x4519)))+(((x4500)*(x4520)))+(((x4509)*(x4511))));
 evalcond[9]=((x4534)+(((IkReal(-1.00000000000000))*(x4507)*(x4523)))+(((IkReal(-1.00000000000000))*(x4505)*(x4510)))+(((x4500)*(x4501)))+(((x4500)*(x4502)))+(((new_r21)*(x4519)))+(((IkReal(0.995371682851684))*(x4503)))+(((IkReal(-1.00000000000000))*(x4511)*(x4512)))+(((x4505)*(x4506)))+(((x4511)*(x4522)))+(((IkReal(-1.00000000000000))*(x4504)*(x4507))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -18229,25 +18785,25 @@ evalcond[3]=((((IkReal(-0.0548574835359933))*(sj3)))+(((IkReal(0.996458924600913
 evalcond[4]=((((IkReal(0.0637202329192957))*(x4535)))+(((IkReal(-0.997967801042053))*(x4536)))+(((IkReal(-0.997967801042053))*(x4538)))+(((IkReal(-0.0637202329192957))*(x4545))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x4538)*(x4539)))+(((IkReal(0.995371682851684))*(x4542)))+(((IkReal(-0.0961000154891044))*(x4537)))+(((IkReal(-1.00000000000000))*(x4535)*(x4541)))+(((sj3)*(x4547)))+(((IkReal(-1.00000000000000))*(x4536)*(x4540)))+(((IkReal(-0.993348889555023))*(sj3)*(x4535)))+(((IkReal(-1.00000000000000))*(x4538)*(x4540)))+(((IkReal(-1.00000000000000))*(x4536)*(x4539)))+(((x4541)*(x4545))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(0.993348889555023))*(cj3)*(x4535)))+(((IkReal(-1.00000000000000))*(x4535)*(x4543)))+(((IkReal(-1.00000000000000))*(x4536)*(x4546)))+(((IkReal(-1.00000000000000))*(cj3)*(x4547)))+(((IkReal(-1.00000000000000))*(x4538)*(x4546)))+(((IkReal(0.0961000154891044))*(x4542)))+(((x4536)*(x4544)))+(((x4543)*(x4545)))+(((IkReal(0.995371682851684))*(x4537)))+(((x4538)*(x4544))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst30;
 gconst30=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -18262,7 +18818,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(x4548)+(((IkReal(-1.00000000000000
 evalcond[4]=((((IkReal(-0.997967801042053))*(x4551)))+(((IkReal(0.0637202329192957))*(x4550)))+(((IkReal(-0.997967801042053))*(x4549)))+(((IkReal(-0.0637202329192957))*(x4548))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(0.0636660242235878))*(x4551)))+(((IkReal(0.0636660242235878))*(x4549)))+(((IkReal(0.997118800177265))*(x4550)))+(((IkReal(0.0412399400149127))*(new_r22)))+(((IkReal(-0.997118800177265))*(x4548))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(0.00262781858332802))*(x4551)))+(((IkReal(0.00262781858332802))*(x4549)))+(((IkReal(-0.0411561322517886))*(x4548)))+(((IkReal(0.0411561322517886))*(x4550)))+(((IkReal(-0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -18287,6 +18843,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -18321,7 +18881,7 @@ evalcond[8]=((((IkReal(0.0636660242235878))*(x4556)))+(((IkReal(-0.9971188001772
 evalcond[9]=((((IkReal(0.0636660242235878))*(x4558)))+(((IkReal(0.0636660242235878))*(x4557)))+(((IkReal(-0.997118800177265))*(x4559)))+(((IkReal(0.997118800177265))*(x4560)))+(((IkReal(0.0412399400149127))*(new_r21)))+(((IkReal(0.999149271799077))*(x4553))));
 evalcond[10]=((((IkReal(0.00262781858332802))*(x4556)))+(((IkReal(0.0412399401475676))*(x4552)))+(((IkReal(0.0411561322517886))*(x4561)))+(((IkReal(0.00262781858332802))*(x4562)))+(((IkReal(-0.999149270283168))*(new_r20)))+(((IkReal(-1.00000000000000))*(new_r00)*(x4554))));
 evalcond[11]=((((IkReal(0.00262781858332802))*(x4557)))+(((IkReal(0.00262781858332802))*(x4558)))+(((IkReal(-1.00000000000000))*(new_r01)*(x4554)))+(((IkReal(0.0412399401475676))*(x4553)))+(((IkReal(0.0411561322517886))*(x4560)))+(((IkReal(-0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -18383,7 +18943,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x4563)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x4563)))+(((IkReal(-0.997967801042053))*(x4564)))+(((IkReal(-0.997967801042053))*(x4566)))+(((IkReal(0.0637202329192957))*(x4565))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(0.997118800177265))*(x4563)))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(-0.0636660242235878))*(x4566)))+(((IkReal(-0.0636660242235878))*(x4564)))+(((IkReal(-0.997118800177265))*(x4565))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(-0.00262781858332802))*(x4564)))+(((IkReal(-0.00262781858332802))*(x4566)))+(((IkReal(0.0411561322517886))*(x4563)))+(((IkReal(0.999149270283168))*(new_r22)))+(((IkReal(-0.0411561322517886))*(x4565))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -18408,6 +18968,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -18442,7 +19006,7 @@ evalcond[8]=((((IkReal(0.997118800177265))*(x4570)))+(((IkReal(-0.99711880017726
 evalcond[9]=((((IkReal(0.997118800177265))*(x4574)))+(((IkReal(-0.997118800177265))*(x4575)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(-0.0636660242235878))*(x4572)))+(((IkReal(-0.0636660242235878))*(x4573)))+(((IkReal(0.999149271799077))*(x4568))));
 evalcond[10]=((((IkReal(-0.0411561322517886))*(x4576)))+(((IkReal(-0.00262781858332802))*(x4571)))+(((IkReal(-0.00262781858332802))*(x4577)))+(((IkReal(0.0412399401475676))*(x4567)))+(((new_r00)*(x4569)))+(((IkReal(0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(-0.0411561322517886))*(x4575)))+(((IkReal(-0.00262781858332802))*(x4572)))+(((IkReal(-0.00262781858332802))*(x4573)))+(((IkReal(0.0412399401475676))*(x4568)))+(((new_r01)*(x4569)))+(((IkReal(0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -18533,6 +19097,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -18587,7 +19155,7 @@ evalcond[8]=((((x4593)*(x4607)))+(((IkReal(-0.0961000154891044))*(x4598)))+(((Ik
 evalcond[9]=((((IkReal(-1.00000000000000))*(x4590)*(x4606)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x4584)))+(((IkReal(-0.0961000154891044))*(x4587)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4589)))+(((IkReal(-1.00000000000000))*(x4585)*(x4602)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x4589)))+(((IkReal(0.999149271799077))*(x4583)))+(((IkReal(-1.00000000000000))*(x4586)*(x4602)))+(((IkReal(-1.00000000000000))*(x4584)*(x4588)))+(((x4595)*(x4606)))+(((new_r21)*(x4597))));
 evalcond[10]=((((x4593)*(x4599)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4589)))+(((IkReal(-1.00000000000000))*(x4592)*(x4604)))+(((new_r20)*(x4603)))+(((IkReal(0.993348889555023))*(new_r10)*(x4584)))+(((IkReal(-1.00000000000000))*(x4599)*(x4600)))+(((IkReal(-1.00000000000000))*(x4591)*(x4592)))+(((x4584)*(x4594)))+(((IkReal(0.995371682851684))*(x4598)))+(((IkReal(0.0412399401475676))*(x4582)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4589))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x4592)*(x4608)))+(((IkReal(-1.00000000000000))*(x4589)*(x4595)))+(((new_r21)*(x4603)))+(((IkReal(-1.00000000000000))*(x4599)*(x4601)))+(((x4584)*(x4586)))+(((x4584)*(x4585)))+(((IkReal(-1.00000000000000))*(x4588)*(x4602)))+(((x4589)*(x4590)))+(((IkReal(0.995371682851684))*(x4587)))+(((x4596)*(x4599)))+(((IkReal(0.0412399401475676))*(x4583))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -18669,6 +19237,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -18723,7 +19295,7 @@ evalcond[8]=((((IkReal(0.0959047211377687))*(new_r00)*(x4624)))+(((IkReal(-0.095
 evalcond[9]=((((IkReal(-1.00000000000000))*(x4621)*(x4637)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x4619)))+(((x4630)*(x4641)))+(((IkReal(-1.00000000000000))*(x4620)*(x4637)))+(((new_r21)*(x4632)))+(((IkReal(-1.00000000000000))*(x4619)*(x4623)))+(((IkReal(-0.0961000154891044))*(x4622)))+(((IkReal(0.999149271799077))*(x4618)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4624)))+(((IkReal(-1.00000000000000))*(x4625)*(x4641)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x4624))));
 evalcond[10]=((((new_r20)*(x4638)))+(((IkReal(0.995371682851684))*(x4633)))+(((IkReal(-1.00000000000000))*(x4634)*(x4635)))+(((IkReal(-1.00000000000000))*(x4626)*(x4627)))+(((x4619)*(x4629)))+(((IkReal(0.0412399401475676))*(x4617)))+(((IkReal(0.993348889555023))*(new_r10)*(x4619)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4624)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4624)))+(((IkReal(-1.00000000000000))*(x4627)*(x4639)))+(((x4628)*(x4634))));
 evalcond[11]=((((x4631)*(x4634)))+(((IkReal(-1.00000000000000))*(x4623)*(x4637)))+(((x4624)*(x4625)))+(((IkReal(-1.00000000000000))*(x4634)*(x4636)))+(((IkReal(-1.00000000000000))*(x4624)*(x4630)))+(((x4619)*(x4620)))+(((x4619)*(x4621)))+(((IkReal(0.0412399401475676))*(x4618)))+(((new_r21)*(x4638)))+(((IkReal(-1.00000000000000))*(x4627)*(x4643)))+(((IkReal(0.995371682851684))*(x4622))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -18802,6 +19374,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -18856,7 +19432,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x4661)*(x4669)))+(((IkReal(-0.006123
 evalcond[9]=((((IkReal(0.999149271799077))*(x4650)))+(((x4662)*(x4673)))+(((IkReal(-1.00000000000000))*(x4651)*(x4655)))+(((IkReal(-1.00000000000000))*(x4652)*(x4669)))+(((IkReal(-1.00000000000000))*(x4653)*(x4669)))+(((IkReal(-0.0961000154891044))*(x4654)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x4651)))+(((new_r21)*(x4664)))+(((IkReal(-1.00000000000000))*(x4657)*(x4673)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4656)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x4656))));
 evalcond[10]=((((new_r20)*(x4670)))+(((IkReal(-1.00000000000000))*(x4659)*(x4671)))+(((IkReal(-1.00000000000000))*(x4658)*(x4659)))+(((IkReal(0.0412399401475676))*(x4649)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4656)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4656)))+(((IkReal(0.995371682851684))*(x4665)))+(((IkReal(0.993348889555023))*(new_r10)*(x4651)))+(((x4651)*(x4661)))+(((x4660)*(x4666)))+(((IkReal(-1.00000000000000))*(x4666)*(x4667))));
 evalcond[11]=((((IkReal(0.995371682851684))*(x4654)))+(((IkReal(-1.00000000000000))*(x4656)*(x4662)))+(((IkReal(-1.00000000000000))*(x4659)*(x4675)))+(((x4663)*(x4666)))+(((x4656)*(x4657)))+(((new_r21)*(x4670)))+(((IkReal(0.0412399401475676))*(x4650)))+(((IkReal(-1.00000000000000))*(x4655)*(x4669)))+(((IkReal(-1.00000000000000))*(x4666)*(x4668)))+(((x4651)*(x4652)))+(((x4651)*(x4653))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -18937,21 +19513,21 @@ evalcond[5]=((((IkReal(-1.00000000000000))*(new_r00)*(x4681)))+(((IkReal(-1.0000
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r11)*(x4691)))+(((IkReal(-1.00000000000000))*(new_r01)*(x4681)))+(((new_r11)*(x4693)))+(((IkReal(-1.00000000000000))*(new_r01)*(x4690))));
 evalcond[7]=((((IkReal(-0.993348889555023))*(sj3)*(x4680)))+(((IkReal(-1.00000000000000))*(x4684)*(x4686)))+(((IkReal(-1.00000000000000))*(x4684)*(x4685)))+(((sj3)*(x4696)))+(((IkReal(-1.00000000000000))*(x4682)*(x4686)))+(((IkReal(-1.00000000000000))*(x4682)*(x4685)))+(((IkReal(-1.00000000000000))*(x4680)*(x4687)))+(((IkReal(-0.0961000154891044))*(x4683)))+(((IkReal(0.995371682851684))*(x4688)))+(((x4687)*(x4694))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x4684)*(x4695)))+(((x4682)*(x4692)))+(((IkReal(0.993348889555023))*(cj3)*(x4680)))+(((IkReal(-1.00000000000000))*(x4682)*(x4695)))+(((IkReal(-1.00000000000000))*(x4680)*(x4689)))+(((IkReal(0.0961000154891044))*(x4688)))+(((IkReal(0.995371682851684))*(x4683)))+(((IkReal(-1.00000000000000))*(cj3)*(x4696)))+(((x4689)*(x4694)))+(((x4684)*(x4692))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst31;
 gconst31=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst32;
 gconst32=IKsign(((((IkReal(0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -18987,6 +19563,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -19045,7 +19625,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x4706)*(x4730)))+(((IkReal(-1.000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x4712)*(x4717)))+(((x4711)*(x4728)))+(((IkReal(-0.0961000154891044))*(x4709)))+(((IkReal(-1.00000000000000))*(x4706)*(x4729)))+(((x4716)*(x4717)))+(((IkReal(-1.00000000000000))*(x4711)*(x4718)))+(x4740)+(((IkReal(-1.00000000000000))*(x4707)*(x4713)))+(((IkReal(-1.00000000000000))*(x4708)*(x4713)))+(((new_r21)*(x4720)))+(((IkReal(-1.00000000000000))*(x4706)*(x4710))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x4713)*(x4730)))+(((IkReal(0.995371682851684))*(x4727)))+(x4740)+(((x4715)*(x4717)))+(((IkReal(-1.00000000000000))*(x4717)*(x4721)))+(((x4711)*(x4719)))+(((x4706)*(x4714)))+(((x4706)*(x4726)))+(((IkReal(-1.00000000000000))*(x4711)*(x4722)))+(((new_r20)*(x4725)))+(((IkReal(-1.00000000000000))*(x4713)*(x4724))));
 evalcond[9]=((((IkReal(0.995371682851684))*(x4709)))+(((IkReal(-1.00000000000000))*(x4710)*(x4713)))+(((IkReal(-1.00000000000000))*(x4711)*(x4716)))+(x4733)+(((IkReal(-1.00000000000000))*(x4734)))+(((x4711)*(x4712)))+(((x4706)*(x4707)))+(((x4706)*(x4708)))+(((x4717)*(x4728)))+(((new_r21)*(x4725)))+(((IkReal(-1.00000000000000))*(x4717)*(x4718)))+(((IkReal(-1.00000000000000))*(x4713)*(x4729))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -19127,6 +19707,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -19185,7 +19769,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x4758)*(x4760)))+(((IkReal(-1.000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x4749)*(x4754)))+(((IkReal(-1.00000000000000))*(x4753)*(x4758)))+(((IkReal(-0.0961000154891044))*(x4750)))+(((IkReal(-1.00000000000000))*(x4748)*(x4754)))+(((x4752)*(x4769)))+(x4781)+(((IkReal(-1.00000000000000))*(x4752)*(x4759)))+(((new_r21)*(x4761)))+(((x4757)*(x4758)))+(((IkReal(-1.00000000000000))*(x4747)*(x4770)))+(((IkReal(-1.00000000000000))*(x4747)*(x4751))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x4758)*(x4762)))+(((x4747)*(x4767)))+(((new_r20)*(x4766)))+(((IkReal(-1.00000000000000))*(x4754)*(x4771)))+(((x4756)*(x4758)))+(((IkReal(-1.00000000000000))*(x4752)*(x4763)))+(((IkReal(-1.00000000000000))*(x4754)*(x4765)))+(((x4747)*(x4755)))+(((x4752)*(x4760)))+(x4781)+(((IkReal(0.995371682851684))*(x4768))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x4754)*(x4770)))+(((x4758)*(x4769)))+(x4774)+(((IkReal(-1.00000000000000))*(x4752)*(x4757)))+(((x4747)*(x4748)))+(((x4747)*(x4749)))+(((IkReal(-1.00000000000000))*(x4775)))+(((IkReal(-1.00000000000000))*(x4751)*(x4754)))+(((IkReal(0.995371682851684))*(x4750)))+(((new_r21)*(x4766)))+(((x4752)*(x4753)))+(((IkReal(-1.00000000000000))*(x4758)*(x4759))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -19260,25 +19844,25 @@ evalcond[3]=((((IkReal(-0.996458924600913))*(cj3)))+(x4792)+(((IkReal(0.05485748
 evalcond[4]=((((IkReal(-0.997967801042053))*(x4783)))+(((IkReal(-0.997967801042053))*(x4785)))+(((IkReal(-0.0637202329192957))*(x4792)))+(((IkReal(0.0637202329192957))*(x4782))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(-0.0961000154891044))*(x4784)))+(((IkReal(-0.993348889555023))*(sj3)*(x4782)))+(((IkReal(-1.00000000000000))*(x4783)*(x4787)))+(((IkReal(-1.00000000000000))*(x4783)*(x4786)))+(((sj3)*(x4794)))+(((IkReal(-1.00000000000000))*(x4782)*(x4788)))+(((IkReal(0.995371682851684))*(x4789)))+(((x4788)*(x4792)))+(((IkReal(-1.00000000000000))*(x4785)*(x4787)))+(((IkReal(-1.00000000000000))*(x4785)*(x4786))));
 evalcond[6]=((IkReal(0.999149271799077))+(((x4790)*(x4792)))+(((x4783)*(x4791)))+(((IkReal(0.993348889555023))*(cj3)*(x4782)))+(((IkReal(0.0961000154891044))*(x4789)))+(((IkReal(-1.00000000000000))*(x4785)*(x4793)))+(((IkReal(0.995371682851684))*(x4784)))+(((IkReal(-1.00000000000000))*(cj3)*(x4794)))+(((IkReal(-1.00000000000000))*(x4782)*(x4790)))+(((IkReal(-1.00000000000000))*(x4783)*(x4793)))+(((x4785)*(x4791))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst33;
 gconst33=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -19293,7 +19877,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x4795)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(0.0637202329192957))*(x4797)))+(((IkReal(-0.0637202329192957))*(x4795)))+(((IkReal(-0.997967801042053))*(x4798)))+(((IkReal(-0.997967801042053))*(x4796))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(0.0636660242235878))*(x4798)))+(((IkReal(0.0636660242235878))*(x4796)))+(((IkReal(0.0412399400149127))*(new_r22)))+(((IkReal(0.997118800177265))*(x4797)))+(((IkReal(-0.997118800177265))*(x4795))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(0.0411561322517886))*(x4797)))+(((IkReal(0.00262781858332802))*(x4796)))+(((IkReal(0.00262781858332802))*(x4798)))+(((IkReal(-0.0411561322517886))*(x4795)))+(((IkReal(-0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -19318,6 +19902,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -19352,7 +19940,7 @@ evalcond[8]=((((IkReal(0.997118800177265))*(x4808)))+(((IkReal(0.063666024223587
 evalcond[9]=((((IkReal(0.999149271799077))*(x4800)))+(((IkReal(0.997118800177265))*(x4807)))+(((IkReal(0.0636660242235878))*(x4804)))+(((IkReal(0.0636660242235878))*(x4805)))+(((IkReal(0.0412399400149127))*(new_r21)))+(((IkReal(-0.997118800177265))*(x4806))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x4799)))+(((IkReal(-1.00000000000000))*(new_r00)*(x4801)))+(((IkReal(-0.999149270283168))*(new_r20)))+(((IkReal(0.0411561322517886))*(x4808)))+(((IkReal(0.00262781858332802))*(x4803)))+(((IkReal(0.00262781858332802))*(x4809))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x4800)))+(((IkReal(-1.00000000000000))*(new_r01)*(x4801)))+(((IkReal(-0.999149270283168))*(new_r21)))+(((IkReal(0.0411561322517886))*(x4807)))+(((IkReal(0.00262781858332802))*(x4804)))+(((IkReal(0.00262781858332802))*(x4805))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -19414,7 +20002,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(((IkReal(-1.00000000000000))*(x481
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x4810)))+(((IkReal(-0.997967801042053))*(x4811)))+(((IkReal(-0.997967801042053))*(x4813)))+(((IkReal(0.0637202329192957))*(x4812))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(0.997118800177265))*(x4810)))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(-0.997118800177265))*(x4812)))+(((IkReal(-0.0636660242235878))*(x4813)))+(((IkReal(-0.0636660242235878))*(x4811))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(0.0411561322517886))*(x4810)))+(((IkReal(-0.0411561322517886))*(x4812)))+(((IkReal(-0.00262781858332802))*(x4811)))+(((IkReal(-0.00262781858332802))*(x4813)))+(((IkReal(0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -19439,6 +20027,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -19473,7 +20065,7 @@ evalcond[8]=((((IkReal(0.997118800177265))*(x4817)))+(((IkReal(-0.99711880017726
 evalcond[9]=((((IkReal(0.997118800177265))*(x4821)))+(((IkReal(-0.997118800177265))*(x4822)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(0.999149271799077))*(x4815)))+(((IkReal(-0.0636660242235878))*(x4819)))+(((IkReal(-0.0636660242235878))*(x4820))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x4814)))+(((IkReal(-0.0411561322517886))*(x4823)))+(((new_r00)*(x4816)))+(((IkReal(-0.00262781858332802))*(x4818)))+(((IkReal(-0.00262781858332802))*(x4824)))+(((IkReal(0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x4815)))+(((IkReal(-0.0411561322517886))*(x4822)))+(((new_r01)*(x4816)))+(((IkReal(-0.00262781858332802))*(x4819)))+(((IkReal(-0.00262781858332802))*(x4820)))+(((IkReal(0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -19564,6 +20156,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -19618,7 +20214,7 @@ evalcond[8]=((((x4840)*(x4854)))+(((IkReal(-0.0959047211377687))*(new_r10)*(x483
 evalcond[9]=((((IkReal(-1.00000000000000))*(x4833)*(x4851)))+(((IkReal(-1.00000000000000))*(x4831)*(x4835)))+(((IkReal(-0.0961000154891044))*(x4834)))+(((new_r21)*(x4845)))+(((IkReal(-1.00000000000000))*(x4832)*(x4851)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x4831)))+(((IkReal(-1.00000000000000))*(x4837)*(x4853)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x4836)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4836)))+(((x4842)*(x4853)))+(((IkReal(0.999149271799077))*(x4830))));
 evalcond[10]=((((new_r20)*(x4850)))+(((IkReal(0.993348889555023))*(new_r10)*(x4831)))+(((x4831)*(x4841)))+(((IkReal(-1.00000000000000))*(x4847)*(x4849)))+(((x4840)*(x4847)))+(((IkReal(0.995371682851684))*(x4846)))+(((IkReal(0.0412399401475676))*(x4829)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4836)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4836)))+(((IkReal(-1.00000000000000))*(x4839)*(x4855)))+(((IkReal(-1.00000000000000))*(x4838)*(x4839))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x4836)*(x4842)))+(((IkReal(-1.00000000000000))*(x4847)*(x4848)))+(((x4836)*(x4837)))+(((IkReal(-1.00000000000000))*(x4839)*(x4843)))+(((IkReal(-1.00000000000000))*(x4835)*(x4851)))+(((x4844)*(x4847)))+(((new_r21)*(x4850)))+(((IkReal(0.995371682851684))*(x4834)))+(((x4831)*(x4833)))+(((x4831)*(x4832)))+(((IkReal(0.0412399401475676))*(x4830))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -19700,6 +20296,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -19754,7 +20354,7 @@ evalcond[8]=((((IkReal(-0.0634253154725807))*(sj3)*(x4873)))+(((new_r20)*(x4880)
 evalcond[9]=((((IkReal(-0.0961000154891044))*(x4869)))+(((IkReal(-1.00000000000000))*(x4867)*(x4886)))+(((IkReal(-1.00000000000000))*(x4868)*(x4886)))+(((IkReal(-1.00000000000000))*(x4866)*(x4870)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x4866)))+(((IkReal(-1.00000000000000))*(x4872)*(x4888)))+(((new_r21)*(x4880)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x4871)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4871)))+(((x4877)*(x4888)))+(((IkReal(0.999149271799077))*(x4865))));
 evalcond[10]=((((new_r20)*(x4885)))+(((x4875)*(x4882)))+(((IkReal(-1.00000000000000))*(x4882)*(x4884)))+(((IkReal(0.993348889555023))*(new_r10)*(x4866)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4871)))+(((IkReal(0.995371682851684))*(x4881)))+(((x4866)*(x4876)))+(((IkReal(0.0412399401475676))*(x4864)))+(((IkReal(-1.00000000000000))*(x4873)*(x4874)))+(((IkReal(-1.00000000000000))*(x4874)*(x4890)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4871))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x4882)*(x4883)))+(((new_r21)*(x4885)))+(((x4879)*(x4882)))+(((IkReal(-1.00000000000000))*(x4874)*(x4878)))+(((IkReal(-1.00000000000000))*(x4871)*(x4877)))+(((x4866)*(x4867)))+(((x4866)*(x4868)))+(((IkReal(0.995371682851684))*(x4869)))+(((x4871)*(x4872)))+(((IkReal(-1.00000000000000))*(x4870)*(x4886)))+(((IkReal(0.0412399401475676))*(x4865))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -19833,6 +20433,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -19887,7 +20491,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r10)*(x4903)))+(((IkReal(-0.0
 evalcond[9]=((((IkReal(-1.00000000000000))*(x4898)*(x4902)))+(((IkReal(-0.0961000154891044))*(x4901)))+(((IkReal(-1.00000000000000))*(x4899)*(x4918)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x4898)))+(((IkReal(-1.00000000000000))*(x4900)*(x4918)))+(((x4909)*(x4920)))+(((IkReal(0.999149271799077))*(x4897)))+(((IkReal(-1.00000000000000))*(x4904)*(x4920)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4903)))+(((new_r21)*(x4912)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x4903))));
 evalcond[10]=((((IkReal(0.993348889555023))*(new_r10)*(x4898)))+(((IkReal(-1.00000000000000))*(x4905)*(x4906)))+(((IkReal(0.995371682851684))*(x4913)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4903)))+(((x4907)*(x4914)))+(((new_r20)*(x4917)))+(((x4898)*(x4908)))+(((IkReal(0.0412399401475676))*(x4896)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4903)))+(((IkReal(-1.00000000000000))*(x4906)*(x4922)))+(((IkReal(-1.00000000000000))*(x4914)*(x4916))));
 evalcond[11]=((((x4911)*(x4914)))+(((IkReal(-1.00000000000000))*(x4902)*(x4918)))+(((IkReal(-1.00000000000000))*(x4903)*(x4909)))+(((x4903)*(x4904)))+(((IkReal(-1.00000000000000))*(x4906)*(x4910)))+(((IkReal(0.995371682851684))*(x4901)))+(((x4898)*(x4900)))+(((IkReal(0.0412399401475676))*(x4897)))+(((new_r21)*(x4917)))+(((IkReal(-1.00000000000000))*(x4914)*(x4915)))+(((x4898)*(x4899))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -19989,6 +20593,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -20054,7 +20662,7 @@ evalcond[8]=((((IkReal(0.0959047211377687))*(new_r00)*(x4938)))+(((IkReal(-1.000
 evalcond[9]=((x4968)+(((new_r21)*(x4944)))+(((IkReal(0.0959047211377687))*(new_r01)*(x4938)))+(((IkReal(-1.00000000000000))*(x4939)*(x4955)))+(((IkReal(-0.0961000154891044))*(x4941)))+(((IkReal(-1.00000000000000))*(x4938)*(x4958)))+(((x4942)*(x4955)))+(((IkReal(-1.00000000000000))*(x4948)*(x4957)))+(((IkReal(-1.00000000000000))*(x4945)*(x4962)))+(((IkReal(-1.00000000000000))*(x4945)*(x4953)))+(((IkReal(-1.00000000000000))*(x4948)*(x4963)))+(((IkReal(-1.00000000000000))*(cj2)*(x4965))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x4940)*(x4959)))+(x4965)+(((IkReal(-1.00000000000000))*(x4959)*(x4964)))+(((new_r20)*(x4961)))+(((IkReal(0.995371682851684))*(x4950)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4938)))+(((x4947)*(x4949)))+(((IkReal(-1.00000000000000))*(x4949)*(x4954)))+(((x4960)*(x4964)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4938)))+(((x4951)*(x4954)))+(((IkReal(-1.00000000000000))*(cj2)*(x4968))));
 evalcond[11]=((x4970)+(((IkReal(-1.00000000000000))*(x4938)*(x4942)))+(((x4938)*(x4939)))+(((IkReal(0.999149271799077))*(x4975)))+(((new_r21)*(x4961)))+(((x4943)*(x4949)))+(((IkReal(-1.00000000000000))*(x4955)*(x4958)))+(((IkReal(-1.00000000000000))*(x4948)*(x4949)))+(((IkReal(0.995371682851684))*(x4941)))+(((IkReal(-1.00000000000000))*(x4945)*(x4959)))+(((x4945)*(x4960)))+(((x4948)*(x4951))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -20141,6 +20749,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -20206,7 +20818,7 @@ evalcond[8]=((((IkReal(-0.0961000154891044))*(x5001)))+(((IkReal(0.9991492717990
 evalcond[9]=((((IkReal(-0.0961000154891044))*(x4992)))+(((IkReal(-1.00000000000000))*(cj2)*(x5016)))+(x5019)+(((IkReal(0.0959047211377687))*(new_r01)*(x4989)))+(((IkReal(-1.00000000000000))*(x4990)*(x5006)))+(((x4993)*(x5006)))+(((IkReal(-1.00000000000000))*(x4999)*(x5008)))+(((new_r21)*(x4995)))+(((IkReal(-1.00000000000000))*(x4996)*(x5013)))+(((IkReal(-1.00000000000000))*(x4996)*(x5004)))+(((IkReal(-1.00000000000000))*(x4989)*(x5009)))+(((IkReal(-1.00000000000000))*(x4999)*(x5014))));
 evalcond[10]=((((new_r20)*(x5012)))+(((x5011)*(x5015)))+(((x5002)*(x5005)))+(((IkReal(-1.00000000000000))*(x4991)*(x5010)))+(((IkReal(-0.993348889555023))*(new_r00)*(x4989)))+(((IkReal(-1.00000000000000))*(cj2)*(x5019)))+(x5016)+(((IkReal(0.995371682851684))*(x5001)))+(((IkReal(-1.00000000000000))*(x5000)*(x5005)))+(((IkReal(-1.00000000000000))*(x5010)*(x5015)))+(((IkReal(0.0634253154725807))*(new_r10)*(x4989)))+(((x4998)*(x5000))));
 evalcond[11]=((((x4999)*(x5002)))+(((IkReal(0.999149271799077))*(x5026)))+(((IkReal(-1.00000000000000))*(x5006)*(x5009)))+(((IkReal(0.995371682851684))*(x4992)))+(((x4989)*(x4990)))+(((x4994)*(x5000)))+(x5021)+(((new_r21)*(x5012)))+(((IkReal(-1.00000000000000))*(x4999)*(x5000)))+(((x4996)*(x5011)))+(((IkReal(-1.00000000000000))*(x4996)*(x5010)))+(((IkReal(-1.00000000000000))*(x4989)*(x4993))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -20288,6 +20900,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -20353,7 +20969,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x5059)*(x5061)))+(((IkReal(-0.006123
 evalcond[9]=((((IkReal(-1.00000000000000))*(x5035)*(x5055)))+(((IkReal(-0.0961000154891044))*(x5038)))+(((IkReal(-1.00000000000000))*(x5036)*(x5052)))+(x5065)+(((IkReal(0.0959047211377687))*(new_r01)*(x5035)))+(((IkReal(-1.00000000000000))*(cj2)*(x5062)))+(((IkReal(-1.00000000000000))*(x5045)*(x5060)))+(((x5039)*(x5052)))+(((new_r21)*(x5041)))+(((IkReal(-1.00000000000000))*(x5042)*(x5050)))+(((IkReal(-1.00000000000000))*(x5042)*(x5059)))+(((IkReal(-1.00000000000000))*(x5045)*(x5054))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x5056)*(x5061)))+(((x5048)*(x5051)))+(((IkReal(0.0634253154725807))*(new_r10)*(x5035)))+(x5062)+(((new_r20)*(x5058)))+(((IkReal(-1.00000000000000))*(cj2)*(x5065)))+(((IkReal(0.995371682851684))*(x5047)))+(((x5044)*(x5046)))+(((IkReal(-1.00000000000000))*(x5037)*(x5056)))+(((x5057)*(x5061)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5035)))+(((IkReal(-1.00000000000000))*(x5046)*(x5051))));
 evalcond[11]=((((x5040)*(x5046)))+(((x5035)*(x5036)))+(((IkReal(0.995371682851684))*(x5038)))+(((new_r21)*(x5058)))+(x5067)+(((IkReal(-1.00000000000000))*(x5035)*(x5039)))+(((IkReal(-1.00000000000000))*(x5052)*(x5055)))+(((x5045)*(x5048)))+(((IkReal(-1.00000000000000))*(x5045)*(x5046)))+(((IkReal(0.999149271799077))*(x5072)))+(((x5042)*(x5057)))+(((IkReal(-1.00000000000000))*(x5042)*(x5056))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -20443,6 +21059,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -20463,7 +21083,7 @@ IkReal x5086=((IkReal(0.0549691918704316))*(x5082));
 IkReal x5087=((IkReal(0.0549691918704316))*(x5081));
 evalcond[0]=((((IkReal(-1.00000000000000))*(sj3)*(x5087)))+(((IkReal(-1.00000000000000))*(x5082)*(x5085)))+(((IkReal(-1.00000000000000))*(x5083)*(x5086)))+(new_r20)+(((x5081)*(x5084))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(sj3)*(x5086)))+(((x5082)*(x5084)))+(((x5083)*(x5087)))+(new_r21)+(((x5081)*(x5085))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -20474,14 +21094,14 @@ IkReal dummyeval[1];
 IkReal gconst35;
 gconst35=IKsign(((((IkReal(-0.0637202329192957))*((new_r02)*(new_r02))))+(((IkReal(-0.0637202329192957))*((new_r12)*(new_r12))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((new_r02)*(new_r02))))+(((IkReal(-1.00000000000000))*((new_r12)*(new_r12)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst34;
 gconst34=IKsign((((new_r12)*(new_r12))+((new_r02)*(new_r02))));
 dummyeval[0]=(((new_r12)*(new_r12))+((new_r02)*(new_r02)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -20517,6 +21137,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -20596,7 +21220,7 @@ evalcond[11]=((((IkReal(-1.00000000000000))*(new_r20)*(x5131)))+(((IkReal(-0.006
 evalcond[12]=((((IkReal(-1.00000000000000))*(x5111)*(x5143)))+(((IkReal(-0.0961000154891044))*(x5101)))+(((x5119)*(x5134)))+(((IkReal(0.999149271799077))*(sj1)))+(((IkReal(-0.993348889555023))*(new_r11)*(x5139)))+(((IkReal(-1.00000000000000))*(x5116)*(x5134)))+(((IkReal(-1.00000000000000))*(x5122)*(x5139)))+(((x5098)*(x5136)))+(((IkReal(-0.0412399401475676))*(x5097)))+(((IkReal(-1.00000000000000))*(x5117)*(x5136)))+(((IkReal(-1.00000000000000))*(x5124)*(x5143)))+(((new_r21)*(x5105))));
 evalcond[13]=((((IkReal(-1.00000000000000))*(x5114)*(x5139)))+(((new_r20)*(x5113)))+(((IkReal(-1.00000000000000))*(x5112)*(x5137)))+(((IkReal(0.0412399401475676))*(cj1)))+(((x5104)*(x5136)))+(((x5112)*(x5140)))+(((x5118)*(x5143)))+(((IkReal(0.0634253154725807))*(cj3)*(x5133)))+(((new_r20)*(x5123)))+(((IkReal(-0.999149271799077))*(x5100)))+(((IkReal(-0.00612351537051366))*(sj3)*(x5133)))+(((IkReal(-0.0959047211377687))*(new_r10)*(x5139))));
 evalcond[14]=((((IkReal(0.999149271799077))*(x5097)))+(((x5119)*(x5136)))+(((IkReal(-1.00000000000000))*(x5124)*(x5139)))+(((IkReal(0.0412399401475676))*(sj1)))+(((IkReal(0.995371682851684))*(x5101)))+(((IkReal(-1.00000000000000))*(x5116)*(x5136)))+(((new_r11)*(x5096)*(x5112)))+(((new_r21)*(x5123)))+(((IkReal(-1.00000000000000))*(x5098)*(x5134)))+(((IkReal(-1.00000000000000))*(x5111)*(x5139)))+(((x5122)*(x5143)))+(((x5117)*(x5134))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -20678,6 +21302,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -20757,7 +21385,7 @@ evalcond[11]=((((x5161)*(x5191)))+(((IkReal(-0.993348889555023))*(new_r10)*(x519
 evalcond[12]=((((IkReal(-1.00000000000000))*(x5168)*(x5200)))+(((x5176)*(x5191)))+(((IkReal(-1.00000000000000))*(x5179)*(x5196)))+(((IkReal(0.999149271799077))*(sj1)))+(((new_r21)*(x5162)))+(((IkReal(-1.00000000000000))*(x5174)*(x5193)))+(((IkReal(-0.0961000154891044))*(x5158)))+(((IkReal(-1.00000000000000))*(x5173)*(x5191)))+(((IkReal(-0.0412399401475676))*(x5154)))+(((IkReal(-1.00000000000000))*(x5181)*(x5200)))+(((IkReal(-0.993348889555023))*(new_r11)*(x5196)))+(((x5155)*(x5193))));
 evalcond[13]=((((x5161)*(x5193)))+(((IkReal(-0.0959047211377687))*(new_r10)*(x5196)))+(((x5175)*(x5200)))+(((IkReal(0.0412399401475676))*(cj1)))+(((IkReal(-0.00612351537051366))*(sj3)*(x5190)))+(((new_r20)*(x5180)))+(((x5169)*(x5197)))+(((IkReal(-1.00000000000000))*(x5169)*(x5194)))+(((IkReal(-0.999149271799077))*(x5157)))+(((IkReal(-1.00000000000000))*(x5171)*(x5196)))+(((IkReal(0.0634253154725807))*(cj3)*(x5190)))+(((new_r20)*(x5170))));
 evalcond[14]=((((IkReal(0.995371682851684))*(x5158)))+(((x5174)*(x5191)))+(((new_r21)*(x5180)))+(((new_r11)*(x5153)*(x5169)))+(((x5176)*(x5193)))+(((IkReal(-1.00000000000000))*(x5181)*(x5196)))+(((IkReal(0.0412399401475676))*(sj1)))+(((IkReal(0.999149271799077))*(x5154)))+(((x5179)*(x5200)))+(((IkReal(-1.00000000000000))*(x5173)*(x5193)))+(((IkReal(-1.00000000000000))*(x5168)*(x5196)))+(((IkReal(-1.00000000000000))*(x5155)*(x5191))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  || IKabs(evalcond[12]) > 0.000001  || IKabs(evalcond[13]) > 0.000001  || IKabs(evalcond[14]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[12]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[13]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[14]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -20849,6 +21477,10 @@ if( !j4valid[ij4] )
 {
     continue;
 }
+if( !IKjointinlimits(4, j4array[ij4]) )
+{
+    continue;
+}
 _ij4[0] = ij4; _ij4[1] = -1;
 for(int iij4 = ij4+1; iij4 < 1; ++iij4)
 {
@@ -20883,7 +21515,7 @@ evalcond[1]=((((IkReal(0.996458924600913))*(x5221)))+(x5230)+(((IkReal(-0.054857
 evalcond[2]=((((IkReal(-0.997967801042053))*(x5228)))+(((IkReal(-0.997967801042053))*(x5229)))+(((IkReal(0.0637202329192957))*(x5227)))+(((IkReal(-0.0637202329192957))*(x5230)))+(((IkReal(-1.00000000000000))*(cj2))));
 evalcond[3]=((((IkReal(-0.0961000154891044))*(x5218)))+(((IkReal(0.0412399401475676))*(sj2)))+(((IkReal(-1.00000000000000))*(x5216)*(x5229)))+(((IkReal(-1.00000000000000))*(x5216)*(x5228)))+(((x5225)*(x5230)))+(((IkReal(-1.00000000000000))*(x5224)*(x5229)))+(((IkReal(-1.00000000000000))*(x5224)*(x5228)))+(((x5226)*(x5230)))+(((IkReal(-1.00000000000000))*(x5226)*(x5227)))+(((IkReal(-1.00000000000000))*(x5225)*(x5227)))+(((IkReal(0.995371682851684))*(x5223))));
 evalcond[4]=((((x5217)*(x5228)))+(((x5217)*(x5229)))+(((IkReal(0.995371682851684))*(x5218)))+(((IkReal(-1.00000000000000))*(x5219)*(x5230)))+(((IkReal(-1.00000000000000))*(x5215)*(x5227)))+(((IkReal(-0.999149271799077))*(sj2)))+(((IkReal(-1.00000000000000))*(x5222)*(x5228)))+(((IkReal(-1.00000000000000))*(x5222)*(x5229)))+(((x5219)*(x5227)))+(((IkReal(0.0961000154891044))*(x5223)))+(((x5215)*(x5230))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -20894,21 +21526,21 @@ IkReal dummyeval[1];
 IkReal gconst27;
 gconst27=IKsign(sj2);
 dummyeval[0]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x5231=((cj2)*(sj2));
 dummyeval[0]=sj2;
 dummyeval[1]=((((cj3)*(x5231)))+(((IkReal(18.1645030061781))*(sj3)*(x5231))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 IkReal x5232=((cj2)*(sj2));
 dummyeval[0]=((((IkReal(-18.1645030061781))*(sj3)*(x5232)))+(((IkReal(-1.00000000000000))*(cj3)*(x5232))));
 dummyeval[1]=sj2;
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[9];
@@ -20938,21 +21570,21 @@ evalcond[5]=((((new_r10)*(x5246)))+(((IkReal(-1.00000000000000))*(new_r00)*(x524
 evalcond[6]=((((new_r11)*(x5246)))+(((IkReal(-1.00000000000000))*(new_r11)*(x5244)))+(((IkReal(-1.00000000000000))*(new_r01)*(x5243)))+(((IkReal(-1.00000000000000))*(new_r01)*(x5234))));
 evalcond[7]=((((sj3)*(x5249)))+(((x5240)*(x5247)))+(((IkReal(-1.00000000000000))*(x5235)*(x5239)))+(((IkReal(-1.00000000000000))*(x5235)*(x5238)))+(((IkReal(-0.0961000154891044))*(x5236)))+(((IkReal(-0.993348889555023))*(sj3)*(x5233)))+(((IkReal(0.995371682851684))*(x5241)))+(((IkReal(-1.00000000000000))*(x5233)*(x5240)))+(((IkReal(-1.00000000000000))*(x5237)*(x5238)))+(((IkReal(-1.00000000000000))*(x5237)*(x5239))));
 evalcond[8]=((((IkReal(0.0961000154891044))*(x5241)))+(((IkReal(-1.00000000000000))*(x5235)*(x5248)))+(((x5237)*(x5245)))+(((x5235)*(x5245)))+(((IkReal(0.995371682851684))*(x5236)))+(((IkReal(0.993348889555023))*(cj3)*(x5233)))+(((IkReal(-1.00000000000000))*(cj3)*(x5249)))+(((x5242)*(x5247)))+(((IkReal(-1.00000000000000))*(x5237)*(x5248)))+(((IkReal(-1.00000000000000))*(x5233)*(x5242))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst28;
 gconst28=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst29;
 gconst29=IKsign(((((IkReal(-0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(-0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*((cj3)*(cj3))))+(((IkReal(-1.00000000000000))*((sj3)*(sj3)))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -20989,6 +21621,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -21047,7 +21683,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x5260)*(x5284)))+(((IkReal(-1.000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x5260)*(x5283)))+(((IkReal(-0.0961000154891044))*(x5263)))+(((IkReal(-1.00000000000000))*(x5265)*(x5272)))+(x5286)+(((IkReal(-1.00000000000000))*(x5285)))+(((IkReal(-1.00000000000000))*(x5266)*(x5271)))+(((new_r21)*(x5274)))+(((IkReal(-1.00000000000000))*(x5262)*(x5267)))+(((x5270)*(x5271)))+(((IkReal(-1.00000000000000))*(x5261)*(x5267)))+(((x5265)*(x5282)))+(((IkReal(-1.00000000000000))*(x5260)*(x5264))));
 evalcond[8]=((((x5260)*(x5268)))+(((IkReal(-1.00000000000000))*(x5265)*(x5276)))+(x5285)+(((IkReal(-1.00000000000000))*(x5286)))+(((new_r20)*(x5279)))+(((IkReal(-1.00000000000000))*(x5271)*(x5275)))+(((x5269)*(x5271)))+(((IkReal(0.995371682851684))*(x5281)))+(((x5265)*(x5273)))+(((IkReal(-1.00000000000000))*(x5267)*(x5278)))+(((IkReal(-1.00000000000000))*(x5267)*(x5284)))+(((x5260)*(x5280))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x5264)*(x5267)))+(((IkReal(0.995371682851684))*(x5263)))+(((x5260)*(x5262)))+(((x5260)*(x5261)))+(((IkReal(-1.00000000000000))*(x5265)*(x5270)))+(x5294)+(((IkReal(-1.00000000000000))*(x5271)*(x5272)))+(((x5265)*(x5266)))+(((new_r21)*(x5279)))+(((x5271)*(x5282)))+(((IkReal(-1.00000000000000))*(x5267)*(x5283))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -21129,6 +21765,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -21187,7 +21827,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x5306)*(x5316)))+(((IkReal(-1.000000
 evalcond[7]=((((IkReal(-1.00000000000000))*(x5306)*(x5313)))+(((IkReal(-1.00000000000000))*(x5303)*(x5308)))+(x5327)+(((IkReal(-1.00000000000000))*(x5301)*(x5305)))+(((x5311)*(x5312)))+(((x5306)*(x5323)))+(((IkReal(-1.00000000000000))*(x5302)*(x5308)))+(((new_r21)*(x5315)))+(((IkReal(-1.00000000000000))*(x5326)))+(((IkReal(-1.00000000000000))*(x5307)*(x5312)))+(((IkReal(-1.00000000000000))*(x5301)*(x5324)))+(((IkReal(-0.0961000154891044))*(x5304))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x5306)*(x5317)))+(((IkReal(-1.00000000000000))*(x5308)*(x5325)))+(((x5301)*(x5309)))+(((IkReal(-1.00000000000000))*(x5312)*(x5316)))+(x5326)+(((new_r20)*(x5320)))+(((IkReal(0.995371682851684))*(x5322)))+(((x5301)*(x5321)))+(((x5310)*(x5312)))+(((IkReal(-1.00000000000000))*(x5308)*(x5319)))+(((IkReal(-1.00000000000000))*(x5327)))+(((x5306)*(x5314))));
 evalcond[9]=((((IkReal(-1.00000000000000))*(x5306)*(x5311)))+(((IkReal(-1.00000000000000))*(x5308)*(x5324)))+(((x5301)*(x5303)))+(((x5301)*(x5302)))+(((IkReal(-1.00000000000000))*(x5312)*(x5313)))+(((x5306)*(x5307)))+(((IkReal(-1.00000000000000))*(x5305)*(x5308)))+(((x5312)*(x5323)))+(x5335)+(((IkReal(0.995371682851684))*(x5304)))+(((new_r21)*(x5320))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -21262,25 +21902,25 @@ evalcond[3]=((((IkReal(-0.0548574835359933))*(sj3)))+(((IkReal(0.996458924600913
 evalcond[4]=((((IkReal(0.0637202329192957))*(x5336)))+(((IkReal(-0.0637202329192957))*(x5346)))+(((IkReal(-0.997967801042053))*(x5339)))+(((IkReal(-0.997967801042053))*(x5337))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-1.00000000000000))*(x5336)*(x5342)))+(((IkReal(-0.993348889555023))*(sj3)*(x5336)))+(((x5342)*(x5346)))+(((IkReal(-1.00000000000000))*(x5339)*(x5341)))+(((IkReal(-1.00000000000000))*(x5339)*(x5340)))+(((IkReal(-0.0961000154891044))*(x5338)))+(((sj3)*(x5348)))+(((IkReal(0.995371682851684))*(x5343)))+(((IkReal(-1.00000000000000))*(x5337)*(x5340)))+(((IkReal(-1.00000000000000))*(x5337)*(x5341))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(-1.00000000000000))*(x5336)*(x5344)))+(((IkReal(0.995371682851684))*(x5338)))+(((x5337)*(x5345)))+(((IkReal(-1.00000000000000))*(x5339)*(x5347)))+(((IkReal(-1.00000000000000))*(cj3)*(x5348)))+(((IkReal(0.0961000154891044))*(x5343)))+(((IkReal(0.993348889555023))*(cj3)*(x5336)))+(((x5339)*(x5345)))+(((x5344)*(x5346)))+(((IkReal(-1.00000000000000))*(x5337)*(x5347))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst30;
 gconst30=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -21295,7 +21935,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(x5349)+(((IkReal(-1.00000000000000
 evalcond[4]=((((IkReal(-0.997967801042053))*(x5350)))+(((IkReal(-0.997967801042053))*(x5352)))+(((IkReal(-0.0637202329192957))*(x5349)))+(((IkReal(0.0637202329192957))*(x5351))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(0.997118800177265))*(x5351)))+(((IkReal(0.0636660242235878))*(x5352)))+(((IkReal(0.0636660242235878))*(x5350)))+(((IkReal(-0.997118800177265))*(x5349)))+(((IkReal(0.0412399400149127))*(new_r22))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(0.0411561322517886))*(x5351)))+(((IkReal(0.00262781858332802))*(x5352)))+(((IkReal(0.00262781858332802))*(x5350)))+(((IkReal(-0.0411561322517886))*(x5349)))+(((IkReal(-0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -21320,6 +21960,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -21354,7 +21998,7 @@ evalcond[8]=((((IkReal(0.0636660242235878))*(x5363)))+(((IkReal(0.06366602422358
 evalcond[9]=((((IkReal(0.0636660242235878))*(x5359)))+(((IkReal(0.0636660242235878))*(x5358)))+(((IkReal(0.997118800177265))*(x5361)))+(((IkReal(0.0412399400149127))*(new_r21)))+(((IkReal(0.999149271799077))*(x5354)))+(((IkReal(-0.997118800177265))*(x5360))));
 evalcond[10]=((((IkReal(0.00262781858332802))*(x5357)))+(((IkReal(0.0411561322517886))*(x5362)))+(((IkReal(-1.00000000000000))*(new_r00)*(x5355)))+(((IkReal(0.0412399401475676))*(x5353)))+(((IkReal(0.00262781858332802))*(x5363)))+(((IkReal(-0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(0.00262781858332802))*(x5359)))+(((IkReal(0.00262781858332802))*(x5358)))+(((IkReal(0.0411561322517886))*(x5361)))+(((IkReal(-1.00000000000000))*(new_r01)*(x5355)))+(((IkReal(0.0412399401475676))*(x5354)))+(((IkReal(-0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -21416,7 +22060,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x5364)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(0.0637202329192957))*(x5366)))+(((IkReal(-0.0637202329192957))*(x5364)))+(((IkReal(-0.997967801042053))*(x5367)))+(((IkReal(-0.997967801042053))*(x5365))));
 evalcond[5]=((IkReal(0.0412399401475676))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(-0.0636660242235878))*(x5367)))+(((IkReal(-0.0636660242235878))*(x5365)))+(((IkReal(0.997118800177265))*(x5364)))+(((IkReal(-0.997118800177265))*(x5366))));
 evalcond[6]=((IkReal(-0.999149271799077))+(((IkReal(-0.00262781858332802))*(x5367)))+(((IkReal(-0.00262781858332802))*(x5365)))+(((IkReal(0.0411561322517886))*(x5364)))+(((IkReal(0.999149270283168))*(new_r22)))+(((IkReal(-0.0411561322517886))*(x5366))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -21441,6 +22085,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -21475,7 +22123,7 @@ evalcond[8]=((((IkReal(-0.0636660242235878))*(x5378)))+(((IkReal(-0.063666024223
 evalcond[9]=((((IkReal(-0.0636660242235878))*(x5374)))+(((IkReal(-0.0636660242235878))*(x5373)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(-0.997118800177265))*(x5376)))+(((IkReal(0.999149271799077))*(x5369)))+(((IkReal(0.997118800177265))*(x5375))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x5368)))+(((IkReal(-0.0411561322517886))*(x5377)))+(((IkReal(-0.00262781858332802))*(x5372)))+(((IkReal(-0.00262781858332802))*(x5378)))+(((new_r00)*(x5370)))+(((IkReal(0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(0.0412399401475676))*(x5369)))+(((IkReal(-0.0411561322517886))*(x5376)))+(((new_r01)*(x5370)))+(((IkReal(-0.00262781858332802))*(x5373)))+(((IkReal(-0.00262781858332802))*(x5374)))+(((IkReal(0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -21566,6 +22214,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -21620,7 +22272,7 @@ evalcond[8]=((((IkReal(0.0959047211377687))*(new_r00)*(x5390)))+(((IkReal(0.9991
 evalcond[9]=((((IkReal(-1.00000000000000))*(x5391)*(x5407)))+(((IkReal(0.0959047211377687))*(new_r01)*(x5390)))+(((IkReal(0.999149271799077))*(x5384)))+(((IkReal(-1.00000000000000))*(x5385)*(x5389)))+(((IkReal(-0.0961000154891044))*(x5388)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x5390)))+(((IkReal(-1.00000000000000))*(x5386)*(x5403)))+(((IkReal(-1.00000000000000))*(x5387)*(x5403)))+(((x5396)*(x5407)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x5385)))+(((new_r21)*(x5398))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x5400)*(x5401)))+(((IkReal(-1.00000000000000))*(x5392)*(x5393)))+(((IkReal(0.995371682851684))*(x5399)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5390)))+(((IkReal(0.993348889555023))*(new_r10)*(x5385)))+(((x5385)*(x5395)))+(((IkReal(0.0634253154725807))*(new_r10)*(x5390)))+(((x5394)*(x5400)))+(((new_r20)*(x5404)))+(((IkReal(0.0412399401475676))*(x5383)))+(((IkReal(-1.00000000000000))*(x5393)*(x5405))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x5400)*(x5402)))+(((IkReal(-1.00000000000000))*(x5389)*(x5403)))+(((new_r21)*(x5404)))+(((IkReal(0.995371682851684))*(x5388)))+(((x5385)*(x5387)))+(((x5385)*(x5386)))+(((IkReal(-1.00000000000000))*(x5390)*(x5396)))+(((IkReal(0.0412399401475676))*(x5384)))+(((IkReal(-1.00000000000000))*(x5393)*(x5409)))+(((x5390)*(x5391)))+(((x5397)*(x5400))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -21702,6 +22354,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -21756,7 +22412,7 @@ evalcond[8]=((((IkReal(-1.00000000000000))*(x5436)*(x5443)))+(((IkReal(-0.096100
 evalcond[9]=((((IkReal(-1.00000000000000))*(x5421)*(x5438)))+(((IkReal(0.0959047211377687))*(new_r01)*(x5425)))+(((new_r21)*(x5433)))+(((IkReal(-0.0961000154891044))*(x5423)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x5425)))+(((x5431)*(x5442)))+(((IkReal(-1.00000000000000))*(x5426)*(x5442)))+(((IkReal(0.999149271799077))*(x5419)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x5420)))+(((IkReal(-1.00000000000000))*(x5422)*(x5438)))+(((IkReal(-1.00000000000000))*(x5420)*(x5424))));
 evalcond[10]=((((IkReal(0.0412399401475676))*(x5418)))+(((IkReal(-1.00000000000000))*(x5427)*(x5428)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5425)))+(((IkReal(-1.00000000000000))*(x5435)*(x5436)))+(((x5429)*(x5435)))+(((IkReal(0.993348889555023))*(new_r10)*(x5420)))+(((IkReal(-1.00000000000000))*(x5428)*(x5440)))+(((new_r20)*(x5439)))+(((IkReal(0.0634253154725807))*(new_r10)*(x5425)))+(((IkReal(0.995371682851684))*(x5434)))+(((x5420)*(x5430))));
 evalcond[11]=((((IkReal(0.995371682851684))*(x5423)))+(((IkReal(-1.00000000000000))*(x5424)*(x5438)))+(((IkReal(-1.00000000000000))*(x5425)*(x5431)))+(((new_r21)*(x5439)))+(((IkReal(0.0412399401475676))*(x5419)))+(((x5420)*(x5422)))+(((x5420)*(x5421)))+(((IkReal(-1.00000000000000))*(x5435)*(x5437)))+(((x5425)*(x5426)))+(((IkReal(-1.00000000000000))*(x5428)*(x5444)))+(((x5432)*(x5435))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -21835,6 +22491,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -21889,7 +22549,7 @@ evalcond[8]=((((IkReal(0.999149271799077))*(x5450)))+(((IkReal(-0.09590472113776
 evalcond[9]=((((IkReal(0.999149271799077))*(x5451)))+(((IkReal(-1.00000000000000))*(x5452)*(x5456)))+(((IkReal(0.0959047211377687))*(new_r01)*(x5457)))+(((x5463)*(x5474)))+(((IkReal(-1.00000000000000))*(x5454)*(x5470)))+(((IkReal(-1.00000000000000))*(x5453)*(x5470)))+(((IkReal(-0.0961000154891044))*(x5455)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x5457)))+(((IkReal(-1.00000000000000))*(x5458)*(x5474)))+(((new_r21)*(x5465)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x5452))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x5467)*(x5468)))+(((IkReal(-1.00000000000000))*(x5459)*(x5460)))+(((IkReal(0.995371682851684))*(x5466)))+(((x5461)*(x5467)))+(((IkReal(-1.00000000000000))*(x5460)*(x5472)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5457)))+(((x5452)*(x5462)))+(((new_r20)*(x5471)))+(((IkReal(0.993348889555023))*(new_r10)*(x5452)))+(((IkReal(0.0634253154725807))*(new_r10)*(x5457)))+(((IkReal(0.0412399401475676))*(x5450))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x5467)*(x5469)))+(((new_r21)*(x5471)))+(((IkReal(0.995371682851684))*(x5455)))+(((IkReal(-1.00000000000000))*(x5460)*(x5476)))+(((IkReal(-1.00000000000000))*(x5457)*(x5463)))+(((IkReal(-1.00000000000000))*(x5456)*(x5470)))+(((x5452)*(x5453)))+(((x5452)*(x5454)))+(((IkReal(0.0412399401475676))*(x5451)))+(((x5457)*(x5458)))+(((x5464)*(x5467))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -21970,21 +22630,21 @@ evalcond[5]=((((IkReal(-1.00000000000000))*(new_r10)*(x5492)))+(((IkReal(-1.0000
 evalcond[6]=((((IkReal(-1.00000000000000))*(new_r01)*(x5491)))+(((new_r11)*(x5494)))+(((IkReal(-1.00000000000000))*(new_r01)*(x5482)))+(((IkReal(-1.00000000000000))*(new_r11)*(x5492))));
 evalcond[7]=((((IkReal(-1.00000000000000))*(x5481)*(x5488)))+(((IkReal(-1.00000000000000))*(x5483)*(x5486)))+(((IkReal(-1.00000000000000))*(x5483)*(x5487)))+(((IkReal(-1.00000000000000))*(x5485)*(x5486)))+(((IkReal(-1.00000000000000))*(x5485)*(x5487)))+(((IkReal(0.995371682851684))*(x5489)))+(((x5488)*(x5495)))+(((IkReal(-0.0961000154891044))*(x5484)))+(((sj3)*(x5497)))+(((IkReal(-0.993348889555023))*(sj3)*(x5481))));
 evalcond[8]=((((IkReal(-1.00000000000000))*(x5481)*(x5490)))+(((x5483)*(x5493)))+(((IkReal(0.995371682851684))*(x5484)))+(((IkReal(-1.00000000000000))*(x5485)*(x5496)))+(((IkReal(0.0961000154891044))*(x5489)))+(((IkReal(0.993348889555023))*(cj3)*(x5481)))+(((IkReal(-1.00000000000000))*(cj3)*(x5497)))+(((x5490)*(x5495)))+(((x5485)*(x5493)))+(((IkReal(-1.00000000000000))*(x5483)*(x5496))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  && IKabs(evalcond[7]) < 0.0000010000000000  && IKabs(evalcond[8]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[7]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[8]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst31;
 gconst31=IKsign((((sj3)*(sj3))+((cj3)*(cj3))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst32;
 gconst32=IKsign(((((IkReal(0.0637202329192957))*((sj3)*(sj3))))+(((IkReal(0.0637202329192957))*((cj3)*(cj3))))));
 dummyeval[0]=(((sj3)*(sj3))+((cj3)*(cj3)));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 continue;
 
@@ -22020,6 +22680,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -22078,7 +22742,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x5534)))+(((x5512)*(x5516)))+(x5535)
 evalcond[7]=((((new_r21)*(x5521)))+(x5541)+(((IkReal(-1.00000000000000))*(x5512)*(x5519)))+(((IkReal(-1.00000000000000))*(x5513)*(x5518)))+(((IkReal(-0.0961000154891044))*(x5510)))+(((IkReal(-1.00000000000000))*(x5507)*(x5511)))+(((IkReal(-1.00000000000000))*(x5507)*(x5530)))+(((IkReal(-1.00000000000000))*(x5508)*(x5514)))+(((x5512)*(x5529)))+(((x5517)*(x5518)))+(((IkReal(-1.00000000000000))*(x5509)*(x5514))));
 evalcond[8]=((x5541)+(((x5507)*(x5527)))+(((IkReal(-1.00000000000000))*(x5514)*(x5531)))+(((IkReal(-1.00000000000000))*(x5514)*(x5525)))+(((IkReal(0.995371682851684))*(x5528)))+(((IkReal(-1.00000000000000))*(x5512)*(x5523)))+(((x5507)*(x5515)))+(((x5512)*(x5520)))+(((x5516)*(x5518)))+(((new_r20)*(x5526)))+(((IkReal(-1.00000000000000))*(x5518)*(x5522))));
 evalcond[9]=((((new_r21)*(x5526)))+(((IkReal(-1.00000000000000))*(x5535)))+(((x5512)*(x5513)))+(x5534)+(((IkReal(-1.00000000000000))*(x5512)*(x5517)))+(((IkReal(-1.00000000000000))*(x5511)*(x5514)))+(((IkReal(-1.00000000000000))*(x5514)*(x5530)))+(((x5518)*(x5529)))+(((IkReal(0.995371682851684))*(x5510)))+(((x5507)*(x5509)))+(((x5507)*(x5508)))+(((IkReal(-1.00000000000000))*(x5518)*(x5519))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -22160,6 +22824,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -22218,7 +22886,7 @@ evalcond[6]=((((IkReal(-1.00000000000000))*(x5555)*(x5556)))+(x5576)+(((IkReal(-
 evalcond[7]=((x5582)+(((IkReal(-1.00000000000000))*(x5550)*(x5555)))+(((new_r21)*(x5562)))+(((IkReal(-1.00000000000000))*(x5549)*(x5555)))+(((IkReal(-0.0961000154891044))*(x5551)))+(((x5553)*(x5570)))+(((IkReal(-1.00000000000000))*(x5548)*(x5552)))+(((IkReal(-1.00000000000000))*(x5553)*(x5560)))+(((IkReal(-1.00000000000000))*(x5548)*(x5571)))+(((IkReal(-1.00000000000000))*(x5554)*(x5559)))+(((x5558)*(x5559))));
 evalcond[8]=((x5582)+(((x5553)*(x5561)))+(((IkReal(-1.00000000000000))*(x5555)*(x5566)))+(((x5548)*(x5568)))+(((IkReal(-1.00000000000000))*(x5555)*(x5572)))+(((IkReal(-1.00000000000000))*(x5553)*(x5564)))+(((x5548)*(x5556)))+(((new_r20)*(x5567)))+(((x5557)*(x5559)))+(((IkReal(-1.00000000000000))*(x5559)*(x5563)))+(((IkReal(0.995371682851684))*(x5569))));
 evalcond[9]=((x5575)+(((IkReal(0.995371682851684))*(x5551)))+(((IkReal(-1.00000000000000))*(x5552)*(x5555)))+(((IkReal(-1.00000000000000))*(x5553)*(x5558)))+(((new_r21)*(x5567)))+(((IkReal(-1.00000000000000))*(x5555)*(x5571)))+(((IkReal(-1.00000000000000))*(x5576)))+(((x5553)*(x5554)))+(((x5548)*(x5550)))+(((x5548)*(x5549)))+(((IkReal(-1.00000000000000))*(x5559)*(x5560)))+(((x5559)*(x5570))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -22293,25 +22961,25 @@ evalcond[3]=((x5593)+(((IkReal(-0.996458924600913))*(cj3)))+(((IkReal(-1.0000000
 evalcond[4]=((((IkReal(-0.0637202329192957))*(x5593)))+(((IkReal(-0.997967801042053))*(x5586)))+(((IkReal(-0.997967801042053))*(x5584)))+(((IkReal(0.0637202329192957))*(x5583))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(-1.00000000000000))*(x5586)*(x5588)))+(((IkReal(-1.00000000000000))*(x5586)*(x5587)))+(((IkReal(-0.993348889555023))*(sj3)*(x5583)))+(((IkReal(-0.0961000154891044))*(x5585)))+(((sj3)*(x5595)))+(((IkReal(-1.00000000000000))*(x5584)*(x5588)))+(((IkReal(-1.00000000000000))*(x5584)*(x5587)))+(((IkReal(-1.00000000000000))*(x5583)*(x5589)))+(((x5589)*(x5593)))+(((IkReal(0.995371682851684))*(x5590))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(0.995371682851684))*(x5585)))+(((IkReal(-1.00000000000000))*(x5586)*(x5594)))+(((x5586)*(x5592)))+(((x5584)*(x5592)))+(((IkReal(0.0961000154891044))*(x5590)))+(((IkReal(0.993348889555023))*(cj3)*(x5583)))+(((IkReal(-1.00000000000000))*(x5584)*(x5594)))+(((x5591)*(x5593)))+(((IkReal(-1.00000000000000))*(x5583)*(x5591)))+(((IkReal(-1.00000000000000))*(cj3)*(x5595))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 IkReal gconst33;
 gconst33=IKsign(((((IkReal(0.998488050977633))*(cj3)))+(((IkReal(-0.0549691918704316))*(sj3)))));
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[1];
 dummyeval[0]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal dummyeval[2];
 dummyeval[0]=(((sj3)*(sj3))+(((IkReal(-18.1094505778424))*(cj3)*(sj3)))+(((IkReal(-1.00000000000000))*((cj3)*(cj3)))));
 dummyeval[1]=((((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(18.1645030061781))*(cj3))));
-if( IKabs(dummyeval[0]) < 0.0000010000000000  || IKabs(dummyeval[1]) < 0.0000010000000000  )
+if( IKabs(dummyeval[0]) < IKFAST_SINGULAR_THRESH  || IKabs(dummyeval[1]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal evalcond[7];
@@ -22326,7 +22994,7 @@ evalcond[3]=((IkReal(6.98836889303039e-11))+(x5596)+(((IkReal(-1.00000000000000)
 evalcond[4]=((((IkReal(0.0637202329192957))*(x5598)))+(((IkReal(-0.0637202329192957))*(x5596)))+(((IkReal(-0.997967801042053))*(x5599)))+(((IkReal(-0.997967801042053))*(x5597))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(-0.997118800177265))*(x5596)))+(((IkReal(0.997118800177265))*(x5598)))+(((IkReal(0.0636660242235878))*(x5597)))+(((IkReal(0.0636660242235878))*(x5599)))+(((IkReal(0.0412399400149127))*(new_r22))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(-0.0411561322517886))*(x5596)))+(((IkReal(0.0411561322517886))*(x5598)))+(((IkReal(-0.999149270283168))*(new_r22)))+(((IkReal(0.00262781858332802))*(x5597)))+(((IkReal(0.00262781858332802))*(x5599))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -22351,6 +23019,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -22385,7 +23057,7 @@ evalcond[8]=((((IkReal(0.997118800177265))*(x5609)))+(((IkReal(0.063666024223587
 evalcond[9]=((((IkReal(0.997118800177265))*(x5608)))+(((IkReal(0.0636660242235878))*(x5605)))+(((IkReal(0.0636660242235878))*(x5606)))+(((IkReal(0.999149271799077))*(x5601)))+(((IkReal(-0.997118800177265))*(x5607)))+(((IkReal(0.0412399400149127))*(new_r21))));
 evalcond[10]=((((IkReal(0.00262781858332802))*(x5604)))+(((IkReal(0.00262781858332802))*(x5610)))+(((IkReal(-1.00000000000000))*(new_r00)*(x5602)))+(((IkReal(0.0412399401475676))*(x5600)))+(((IkReal(0.0411561322517886))*(x5609)))+(((IkReal(-0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(0.00262781858332802))*(x5605)))+(((IkReal(0.00262781858332802))*(x5606)))+(((IkReal(0.0412399401475676))*(x5601)))+(((IkReal(0.0411561322517886))*(x5608)))+(((IkReal(-0.999149270283168))*(new_r21)))+(((IkReal(-1.00000000000000))*(new_r01)*(x5602))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -22447,7 +23119,7 @@ evalcond[3]=((IkReal(-6.98836889303039e-11))+(((IkReal(-1.00000000000000))*(x561
 evalcond[4]=((((IkReal(0.0637202329192957))*(x5613)))+(((IkReal(-0.997967801042053))*(x5612)))+(((IkReal(-0.997967801042053))*(x5614)))+(((IkReal(-0.0637202329192957))*(x5611))));
 evalcond[5]=((IkReal(-0.0412399401475676))+(((IkReal(0.997118800177265))*(x5611)))+(((IkReal(-0.0412399400149127))*(new_r22)))+(((IkReal(-0.997118800177265))*(x5613)))+(((IkReal(-0.0636660242235878))*(x5612)))+(((IkReal(-0.0636660242235878))*(x5614))));
 evalcond[6]=((IkReal(0.999149271799077))+(((IkReal(0.0411561322517886))*(x5611)))+(((IkReal(-0.00262781858332802))*(x5612)))+(((IkReal(-0.00262781858332802))*(x5614)))+(((IkReal(-0.0411561322517886))*(x5613)))+(((IkReal(0.999149270283168))*(new_r22))));
-if( IKabs(evalcond[0]) < 0.0000010000000000  && IKabs(evalcond[1]) < 0.0000010000000000  && IKabs(evalcond[2]) < 0.0000010000000000  && IKabs(evalcond[3]) < 0.0000010000000000  && IKabs(evalcond[4]) < 0.0000010000000000  && IKabs(evalcond[5]) < 0.0000010000000000  && IKabs(evalcond[6]) < 0.0000010000000000  )
+if( IKabs(evalcond[0]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[1]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[2]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[3]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[4]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[5]) < IKFAST_SINGULAR_THRESH  && IKabs(evalcond[6]) < IKFAST_SINGULAR_THRESH  )
 {
 {
 IkReal j1array[1], cj1array[1], sj1array[1];
@@ -22472,6 +23144,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -22506,7 +23182,7 @@ evalcond[8]=((((IkReal(0.997118800177265))*(x5618)))+(((IkReal(0.999149271799077
 evalcond[9]=((((IkReal(0.997118800177265))*(x5622)))+(((IkReal(0.999149271799077))*(x5616)))+(((IkReal(-0.0412399400149127))*(new_r21)))+(((IkReal(-0.997118800177265))*(x5623)))+(((IkReal(-0.0636660242235878))*(x5621)))+(((IkReal(-0.0636660242235878))*(x5620))));
 evalcond[10]=((((IkReal(-0.00262781858332802))*(x5625)))+(((IkReal(0.0412399401475676))*(x5615)))+(((IkReal(-0.00262781858332802))*(x5619)))+(((IkReal(-0.0411561322517886))*(x5624)))+(((new_r00)*(x5617)))+(((IkReal(0.999149270283168))*(new_r20))));
 evalcond[11]=((((IkReal(-0.00262781858332802))*(x5621)))+(((IkReal(-0.00262781858332802))*(x5620)))+(((IkReal(0.0412399401475676))*(x5616)))+(((IkReal(-0.0411561322517886))*(x5623)))+(((new_r01)*(x5617)))+(((IkReal(0.999149270283168))*(new_r21))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -22597,6 +23273,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -22651,7 +23331,7 @@ evalcond[8]=((((IkReal(-0.0959047211377687))*(new_r10)*(x5632)))+(((IkReal(-1.00
 evalcond[9]=((((IkReal(-1.00000000000000))*(x5633)*(x5652)))+(((IkReal(-1.00000000000000))*(x5632)*(x5636)))+(((new_r21)*(x5646)))+(((IkReal(-0.0961000154891044))*(x5635)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x5637)))+(((IkReal(-1.00000000000000))*(x5634)*(x5652)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x5632)))+(((IkReal(-1.00000000000000))*(x5638)*(x5654)))+(((x5643)*(x5654)))+(((IkReal(0.999149271799077))*(x5631)))+(((IkReal(0.0959047211377687))*(new_r01)*(x5637))));
 evalcond[10]=((((IkReal(0.995371682851684))*(x5647)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5637)))+(((IkReal(0.993348889555023))*(new_r10)*(x5632)))+(((x5641)*(x5648)))+(((IkReal(0.0634253154725807))*(new_r10)*(x5637)))+(((IkReal(-1.00000000000000))*(x5648)*(x5650)))+(((IkReal(-1.00000000000000))*(x5640)*(x5656)))+(((new_r20)*(x5651)))+(((IkReal(0.0412399401475676))*(x5630)))+(((IkReal(-1.00000000000000))*(x5639)*(x5640)))+(((x5632)*(x5642))));
 evalcond[11]=((((new_r21)*(x5651)))+(((x5645)*(x5648)))+(((IkReal(-1.00000000000000))*(x5648)*(x5649)))+(((x5632)*(x5633)))+(((x5632)*(x5634)))+(((IkReal(-1.00000000000000))*(x5640)*(x5644)))+(((IkReal(0.0412399401475676))*(x5631)))+(((IkReal(-1.00000000000000))*(x5636)*(x5652)))+(((x5637)*(x5638)))+(((IkReal(0.995371682851684))*(x5635)))+(((IkReal(-1.00000000000000))*(x5637)*(x5643))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -22733,6 +23413,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -22787,7 +23471,7 @@ evalcond[8]=((((IkReal(-0.0961000154891044))*(x5682)))+(((IkReal(-0.063425315472
 evalcond[9]=((((IkReal(-1.00000000000000))*(x5673)*(x5689)))+(((IkReal(-1.00000000000000))*(x5669)*(x5687)))+(((IkReal(-1.00000000000000))*(x5667)*(x5671)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x5667)))+(((IkReal(0.999149271799077))*(x5666)))+(((IkReal(0.0959047211377687))*(new_r01)*(x5672)))+(((IkReal(-0.0961000154891044))*(x5670)))+(((x5678)*(x5689)))+(((IkReal(-1.00000000000000))*(x5668)*(x5687)))+(((new_r21)*(x5681)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x5672))));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x5683)*(x5685)))+(((IkReal(0.993348889555023))*(new_r10)*(x5667)))+(((x5667)*(x5677)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5672)))+(((IkReal(-1.00000000000000))*(x5675)*(x5691)))+(((IkReal(0.0634253154725807))*(new_r10)*(x5672)))+(((IkReal(0.0412399401475676))*(x5665)))+(((IkReal(0.995371682851684))*(x5682)))+(((IkReal(-1.00000000000000))*(x5674)*(x5675)))+(((new_r20)*(x5686)))+(((x5676)*(x5683))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x5672)*(x5678)))+(((IkReal(-1.00000000000000))*(x5671)*(x5687)))+(((x5680)*(x5683)))+(((IkReal(-1.00000000000000))*(x5683)*(x5684)))+(((IkReal(0.995371682851684))*(x5670)))+(((x5667)*(x5669)))+(((x5667)*(x5668)))+(((x5672)*(x5673)))+(((IkReal(0.0412399401475676))*(x5666)))+(((new_r21)*(x5686)))+(((IkReal(-1.00000000000000))*(x5675)*(x5679))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -22866,6 +23550,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -22920,7 +23608,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r10)*(x5704)))+(((IkReal(-1.0
 evalcond[9]=((((new_r21)*(x5713)))+(((IkReal(-1.00000000000000))*(x5705)*(x5721)))+(((IkReal(-0.00612351537051366))*(new_r11)*(x5704)))+(((IkReal(0.0959047211377687))*(new_r01)*(x5704)))+(((IkReal(-1.00000000000000))*(x5701)*(x5719)))+(((IkReal(-1.00000000000000))*(x5700)*(x5719)))+(((IkReal(-1.00000000000000))*(x5699)*(x5703)))+(((IkReal(0.999149271799077))*(x5698)))+(((IkReal(-0.0961000154891044))*(x5702)))+(((x5710)*(x5721)))+(((IkReal(-0.0959047211377687))*(new_r11)*(x5699))));
 evalcond[10]=((((IkReal(0.995371682851684))*(x5714)))+(((IkReal(-1.00000000000000))*(x5715)*(x5717)))+(((IkReal(-1.00000000000000))*(x5707)*(x5723)))+(((IkReal(0.993348889555023))*(new_r10)*(x5699)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5704)))+(((IkReal(-1.00000000000000))*(x5706)*(x5707)))+(((IkReal(0.0412399401475676))*(x5697)))+(((IkReal(0.0634253154725807))*(new_r10)*(x5704)))+(((x5699)*(x5709)))+(((x5708)*(x5715)))+(((new_r20)*(x5718))));
 evalcond[11]=((((IkReal(0.995371682851684))*(x5702)))+(((new_r21)*(x5718)))+(((IkReal(-1.00000000000000))*(x5715)*(x5716)))+(((x5712)*(x5715)))+(((IkReal(-1.00000000000000))*(x5707)*(x5711)))+(((IkReal(-1.00000000000000))*(x5703)*(x5719)))+(((IkReal(-1.00000000000000))*(x5704)*(x5710)))+(((IkReal(0.0412399401475676))*(x5698)))+(((x5699)*(x5701)))+(((x5699)*(x5700)))+(((x5704)*(x5705))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -23022,6 +23710,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -23087,7 +23779,7 @@ evalcond[8]=((((new_r20)*(x5745)))+(((IkReal(-0.0961000154891044))*(x5751)))+(((
 evalcond[9]=((((IkReal(-1.00000000000000))*(x5749)*(x5758)))+(((IkReal(-1.00000000000000))*(x5749)*(x5764)))+(((IkReal(-1.00000000000000))*(cj2)*(x5766)))+(((IkReal(-1.00000000000000))*(x5740)*(x5756)))+(((IkReal(-1.00000000000000))*(x5746)*(x5763)))+(((IkReal(0.0959047211377687))*(new_r01)*(x5739)))+(((IkReal(-0.0961000154891044))*(x5742)))+(((x5743)*(x5756)))+(((IkReal(-1.00000000000000))*(x5746)*(x5754)))+(((IkReal(-1.00000000000000))*(x5739)*(x5759)))+(((new_r21)*(x5745)))+(x5769));
 evalcond[10]=((((IkReal(0.0634253154725807))*(new_r10)*(x5739)))+(((IkReal(-1.00000000000000))*(cj2)*(x5769)))+(((x5748)*(x5750)))+(((IkReal(-1.00000000000000))*(x5760)*(x5765)))+(((x5752)*(x5755)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5739)))+(((new_r20)*(x5762)))+(((x5761)*(x5765)))+(((IkReal(0.995371682851684))*(x5751)))+(((IkReal(-1.00000000000000))*(x5750)*(x5755)))+(x5766)+(((IkReal(-1.00000000000000))*(x5741)*(x5760))));
 evalcond[11]=((((IkReal(-1.00000000000000))*(x5749)*(x5750)))+(((IkReal(-1.00000000000000))*(x5746)*(x5760)))+(((x5744)*(x5750)))+(((x5746)*(x5761)))+(((x5749)*(x5752)))+(((IkReal(-1.00000000000000))*(x5739)*(x5743)))+(((IkReal(0.995371682851684))*(x5742)))+(((IkReal(-1.00000000000000))*(x5756)*(x5759)))+(((IkReal(0.999149271799077))*(x5776)))+(((new_r21)*(x5762)))+(((x5739)*(x5740)))+(x5771));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -23174,6 +23866,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -23239,7 +23935,7 @@ evalcond[8]=((((IkReal(0.999149271799077))*(x5788)))+(((IkReal(-1.00000000000000
 evalcond[9]=((((x5794)*(x5807)))+(((IkReal(-1.00000000000000))*(x5797)*(x5805)))+(((IkReal(-1.00000000000000))*(x5800)*(x5809)))+(((new_r21)*(x5796)))+(((IkReal(-0.0961000154891044))*(x5793)))+(((IkReal(-1.00000000000000))*(x5800)*(x5815)))+(((IkReal(-1.00000000000000))*(x5797)*(x5814)))+(((IkReal(-1.00000000000000))*(cj2)*(x5817)))+(((IkReal(0.0959047211377687))*(new_r01)*(x5790)))+(((IkReal(-1.00000000000000))*(x5791)*(x5807)))+(x5820)+(((IkReal(-1.00000000000000))*(x5790)*(x5810))));
 evalcond[10]=((((new_r20)*(x5813)))+(((IkReal(0.995371682851684))*(x5802)))+(((IkReal(-1.00000000000000))*(x5811)*(x5816)))+(((x5799)*(x5801)))+(((IkReal(0.0634253154725807))*(new_r10)*(x5790)))+(((IkReal(-1.00000000000000))*(cj2)*(x5820)))+(((IkReal(-1.00000000000000))*(x5792)*(x5811)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5790)))+(((x5812)*(x5816)))+(x5817)+(((IkReal(-1.00000000000000))*(x5801)*(x5806)))+(((x5803)*(x5806))));
 evalcond[11]=((((x5800)*(x5803)))+(((x5797)*(x5812)))+(((IkReal(-1.00000000000000))*(x5800)*(x5801)))+(((x5795)*(x5801)))+(((IkReal(-1.00000000000000))*(x5797)*(x5811)))+(((new_r21)*(x5813)))+(((IkReal(-1.00000000000000))*(x5790)*(x5794)))+(((IkReal(0.999149271799077))*(x5827)))+(((IkReal(0.995371682851684))*(x5793)))+(((x5790)*(x5791)))+(((IkReal(-1.00000000000000))*(x5807)*(x5810)))+(x5822));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -23321,6 +24017,10 @@ if( !j1valid[ij1] )
 {
     continue;
 }
+if( !IKjointinlimits(1, j1array[ij1]) )
+{
+    continue;
+}
 _ij1[0] = ij1; _ij1[1] = -1;
 for(int iij1 = ij1+1; iij1 < 1; ++iij1)
 {
@@ -23386,7 +24086,7 @@ evalcond[8]=((((IkReal(-0.00612351537051366))*(new_r10)*(x5836)))+(((new_r20)*(x
 evalcond[9]=((((x5840)*(x5853)))+(((IkReal(-1.00000000000000))*(x5837)*(x5853)))+(((IkReal(-1.00000000000000))*(x5846)*(x5861)))+(((new_r21)*(x5842)))+(((IkReal(-1.00000000000000))*(cj2)*(x5863)))+(((IkReal(-1.00000000000000))*(x5846)*(x5855)))+(((IkReal(0.0959047211377687))*(new_r01)*(x5836)))+(((IkReal(-1.00000000000000))*(x5843)*(x5860)))+(((IkReal(-0.0961000154891044))*(x5839)))+(((IkReal(-1.00000000000000))*(x5836)*(x5856)))+(((IkReal(-1.00000000000000))*(x5843)*(x5851)))+(x5866));
 evalcond[10]=((((IkReal(-1.00000000000000))*(x5847)*(x5852)))+(((x5845)*(x5847)))+(((IkReal(0.995371682851684))*(x5848)))+(((IkReal(0.0634253154725807))*(new_r10)*(x5836)))+(((IkReal(-1.00000000000000))*(cj2)*(x5866)))+(((x5858)*(x5862)))+(((IkReal(-1.00000000000000))*(x5857)*(x5862)))+(((new_r20)*(x5859)))+(((IkReal(-0.993348889555023))*(new_r00)*(x5836)))+(((IkReal(-1.00000000000000))*(x5838)*(x5857)))+(x5863)+(((x5849)*(x5852))));
 evalcond[11]=((((IkReal(0.999149271799077))*(x5873)))+(((IkReal(-1.00000000000000))*(x5853)*(x5856)))+(((x5843)*(x5858)))+(((x5846)*(x5849)))+(((IkReal(0.995371682851684))*(x5839)))+(((x5841)*(x5847)))+(((x5836)*(x5837)))+(((IkReal(-1.00000000000000))*(x5846)*(x5847)))+(((IkReal(-1.00000000000000))*(x5836)*(x5840)))+(((IkReal(-1.00000000000000))*(x5843)*(x5857)))+(((new_r21)*(x5859)))+(x5868));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  || IKabs(evalcond[6]) > 0.000001  || IKabs(evalcond[7]) > 0.000001  || IKabs(evalcond[8]) > 0.000001  || IKabs(evalcond[9]) > 0.000001  || IKabs(evalcond[10]) > 0.000001  || IKabs(evalcond[11]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[6]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[7]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[8]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[9]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[10]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[11]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -23461,6 +24161,16 @@ IKSolver solver;
 return solver.ComputeIk(eetrans,eerot,pfree,solutions);
 }
 
+/// same as ComputeIk(), but with -DIKFAST_PRUNE_JOINT_LIMITS branches are dropped as soon as a joint
+/// is solved outside of [lower, upper]. Arrays of GetNumJoints() values, NULL for no limits.
+IKFAST_API bool ComputeIkInLimits(const IkReal* eetrans, const IkReal* eerot, const IkReal* pfree,
+                                  const IkReal* lower, const IkReal* upper, IkSolutionListBase<IkReal>& solutions) {
+IKSolver solver;
+solver.ikjointlower = lower;
+solver.ikjointupper = upper;
+return solver.ComputeIk(eetrans,eerot,pfree,solutions);
+}
+
 IKFAST_API const char* GetKinematicsHash() { return "<robot:genericrobot - clam (4ff3a953ba6c44cad21705cf51f44c6b)>"; }
 
 IKFAST_API const char* GetIkFastVersion() { return IKFAST_STRINGIZE(IKFAST_VERSION); }
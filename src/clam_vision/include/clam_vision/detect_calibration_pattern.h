@@ -59,7 +59,8 @@ void convertCVtoEigen(cv::Mat& tvec, cv::Mat& R, Eigen::Vector3f& translation, E
 class PatternDetector
 {
   public:
-    PatternDetector() { }
+    PatternDetector() : tracking(false), track_pyramid_levels(1), track_iterations(10),
+                        track_max_reprojection_error(1.5) { }
   
     static object_pts_t calcChessboardCorners(cv::Size boardSize,
                                           float squareSize,
@@ -67,6 +68,15 @@ class PatternDetector
                                           cv::Point3f offset = cv::Point3f());
                                           
     int detectPattern(cv::Mat& image_in, Eigen::Vector3f& translation, Eigen::Quaternionf& orientation, cv::Mat& image_out);
+
+    // Same as detectPattern, but starts from the last pose: the corners are predicted by
+    // projecting the pattern with the previous pose, refined in a small ROI on a downscaled
+    // image and then at full resolution with a few iterations. Full detection is only run
+    // when there is no previous pose or the track is lost.
+    int trackPattern(cv::Mat& image_in, Eigen::Vector3f& translation, Eigen::Quaternionf& orientation, cv::Mat& image_out);
+
+    // Forget the last pose, the next trackPattern() does a full detection
+    void resetTracking() { tracking = false; }
     
     void setCameraMatrices(cv::Mat K_, cv::Mat D_);
     
@@ -82,6 +92,19 @@ class PatternDetector
     cv::Size grid_size;
     float square_size;
     object_pts_t ideal_points;
+
+    // Tracking state
+    bool tracking;
+    observation_pts_t last_observation_points;
+
+    // Tracking parameters
+    int track_pyramid_levels; // how many times the ROI is downscaled for the coarse search
+    int track_iterations; // cornerSubPix iteration budget per level
+    double track_max_reprojection_error; // RMS pixels, above this the track is considered lost
+
+  private:
+    bool refineTrackedPoints(cv::Mat& image_in, observation_pts_t& points);
+    double reprojectionError(const observation_pts_t& observation_points);
 };
 
 #endif
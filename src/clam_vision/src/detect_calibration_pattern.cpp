@@ -29,6 +29,9 @@
 
 #include <clam_vision/detect_calibration_pattern.h>
 
+#include <algorithm>
+#include <cmath>
+
 void PatternDetector::setCameraMatrices(cv::Mat K_, cv::Mat D_)
 {
   K = K_;
@@ -114,11 +117,137 @@ int PatternDetector::detectPattern(cv::Mat& image_in, Eigen::Vector3f& translati
     cv::drawChessboardCorners(image_out, grid_size, cv::Mat(observation_points), found);
     
     convertCVtoEigen(tvec, R, translation, orientation);
+
+    last_observation_points = observation_points;
   }
+
+  tracking = found;
   
   return found;
 }
 
+int PatternDetector::trackPattern(cv::Mat& image_in, Eigen::Vector3f& translation, Eigen::Quaternionf& orientation, cv::Mat& image_out)
+{
+  if (!tracking || rvec.empty() || tvec.empty())
+    return detectPattern(image_in, translation, orientation, image_out);
+
+  // Predict where the corners are now by projecting the pattern with the last pose
+  observation_pts_t observation_points;
+  cv::projectPoints(cv::Mat(ideal_points), rvec, tvec, K, D, observation_points);
+
+  if (!refineTrackedPoints(image_in, observation_points))
+  {
+    // Lost it, start over
+    tracking = false;
+    return detectPattern(image_in, translation, orientation, image_out);
+  }
+
+  // The last pose is a good starting point, so the solver only has to iterate a little
+  cv::Mat last_rvec = rvec.clone();
+  cv::Mat last_tvec = tvec.clone();
+  cv::solvePnP(cv::Mat(ideal_points), cv::Mat(observation_points), K, D,
+               rvec, tvec, true);
+
+  if (reprojectionError(observation_points) > track_max_reprojection_error)
+  {
+    // Corners latched on to something else, go back to full detection
+    rvec = last_rvec;
+    tvec = last_tvec;
+    tracking = false;
+    return detectPattern(image_in, translation, orientation, image_out);
+  }
+
+  translation.setZero();
+  orientation.setIdentity();
+
+  cv::Rodrigues(rvec, R);
+
+  cv::drawChessboardCorners(image_out, grid_size, cv::Mat(observation_points), true);
+
+  convertCVtoEigen(tvec, R, translation, orientation);
+
+  last_observation_points = observation_points;
+
+  return true;
+}
+
+bool PatternDetector::refineTrackedPoints(cv::Mat& image_in, observation_pts_t& points)
+{
+  cv::Rect image_rect(0, 0, image_in.cols, image_in.rows);
+
+  // The whole pattern has to stay in view
+  for (size_t i = 0; i < points.size(); i++)
+  {
+    if (!image_rect.contains(points[i]))
+      return false;
+  }
+
+  // Search region: bounding box of the prediction padded by one grid cell
+  float dx = points[1].x - points[0].x;
+  float dy = points[1].y - points[0].y;
+  int cell = std::max(4, cvRound(std::sqrt(dx*dx + dy*dy)));
+
+  cv::Rect bounds = cv::boundingRect(cv::Mat(points));
+  cv::Rect roi(bounds.x - cell, bounds.y - cell, bounds.width + 2*cell, bounds.height + 2*cell);
+  roi &= image_rect;
+
+  // Coarse pass on the downscaled ROI
+  const float scale = 1 << track_pyramid_levels;
+  cv::Mat small = image_in(roi);
+  for (int level = 0; level < track_pyramid_levels; level++)
+  {
+    cv::Mat down;
+    cv::pyrDown(small, down);
+    small = down;
+  }
+
+  observation_pts_t small_points(points.size());
+  for (size_t i = 0; i < points.size(); i++)
+    small_points[i] = (points[i] - cv::Point2f(roi.x, roi.y)) * (1.0 / scale);
+
+  if (pattern_type == CHESSBOARD)
+  {
+    // Keep the window well under a cell so it can't jump to the neighbouring corner
+    int win = std::max(2, cvRound(cell / (3 * scale)));
+    cv::cornerSubPix(small, small_points, cv::Size(win, win), cv::Size(-1,-1),
+      cv::TermCriteria(cv::TermCriteria::MAX_ITER + cv::TermCriteria::EPS, track_iterations, 0.05));
+  }
+  else
+  {
+    // Circle centers have no corner to refine, re-find the grid but only inside the small ROI
+    int flags = (pattern_type == ASYMMETRIC_CIRCLES_GRID) ?
+      cv::CALIB_CB_ASYMMETRIC_GRID | cv::CALIB_CB_CLUSTERING : cv::CALIB_CB_SYMMETRIC_GRID;
+    if (!cv::findCirclesGrid(small, grid_size, small_points, flags))
+      return false;
+  }
+
+  for (size_t i = 0; i < points.size(); i++)
+    points[i] = small_points[i] * scale + cv::Point2f(roi.x, roi.y);
+
+  // Fine pass at full resolution, a few iterations are plenty this close to the answer
+  if (pattern_type == CHESSBOARD)
+  {
+    cv::cornerSubPix(image_in, points, cv::Size(5,5), cv::Size(-1,-1),
+      cv::TermCriteria(cv::TermCriteria::MAX_ITER + cv::TermCriteria::EPS, track_iterations, 0.01));
+  }
+
+  return true;
+}
+
+double PatternDetector::reprojectionError(const observation_pts_t& observation_points)
+{
+  observation_pts_t projected;
+  cv::projectPoints(cv::Mat(ideal_points), rvec, tvec, K, D, projected);
+
+  double sum = 0;
+  for (size_t i = 0; i < projected.size(); i++)
+  {
+    cv::Point2f d = projected[i] - observation_points[i];
+    sum += d.x*d.x + d.y*d.y;
+  }
+  return std::sqrt(sum / projected.size());
+}
+
 void convertCVtoEigen(cv::Mat& tvec, cv::Mat& R, Eigen::Vector3f& translation, Eigen::Quaternionf& orientation)
 {
   // This assumes that cv::Mats are stored as doubles. Is there a way to check this?
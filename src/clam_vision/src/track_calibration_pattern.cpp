@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2011, Willow Garage, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Willow Garage, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+  Tracks a calibration pattern that stays fixed on the table and reports how
+  far the camera has moved since the first observation. Uses the tracking mode
+  of PatternDetector so it keeps up with the camera frame rate.
+*/
+
+#include <ros/ros.h>
+#include <image_transport/image_transport.h>
+
+#include <cv_bridge/cv_bridge.h>
+#include <image_geometry/pinhole_camera_model.h>
+#include <tf/transform_broadcaster.h>
+#include <tf/transform_datatypes.h>
+
+#include <sensor_msgs/Image.h>
+#include <sensor_msgs/CameraInfo.h>
+#include <geometry_msgs/PoseStamped.h>
+
+#include <clam_vision/detect_calibration_pattern.h>
+
+class TrackCalibrationPattern
+{
+    // Nodes and publishers/subscribers
+    ros::NodeHandle nh_;
+    image_transport::ImageTransport it_;
+    image_transport::Publisher pub_;
+    ros::Publisher pose_pub_;
+
+    // Image and camera info subscribers;
+    ros::Subscriber image_sub_;
+    ros::Subscriber info_sub_;
+
+    // Structures for interacting with ROS messages
+    cv_bridge::CvImagePtr input_bridge_;
+    cv_bridge::CvImagePtr output_bridge_;
+    tf::TransformBroadcaster tf_broadcaster_;
+    image_geometry::PinholeCameraModel cam_model_;
+
+    PatternDetector pattern_detector_;
+
+    // Pose of the pattern the first time we saw it
+    bool have_reference_;
+    Eigen::Vector3f reference_translation_;
+    Eigen::Quaternionf reference_orientation_;
+
+    // Parameters
+    std::string target_frame;
+    int checkerboard_width;
+    int checkerboard_height;
+    double checkerboard_grid;
+    double max_translation_drift;
+    double max_rotation_drift;
+
+public:
+  TrackCalibrationPattern()
+    : nh_("~"), it_(nh_), have_reference_(false)
+  {
+    // Load parameters from the server.
+    nh_.param<std::string>("target_frame", target_frame, "/calibration_pattern");
+
+    nh_.param<int>("checkerboard_width", checkerboard_width, 6);
+    nh_.param<int>("checkerboard_height", checkerboard_height, 7);
+    nh_.param<double>("checkerboard_grid", checkerboard_grid, 0.027);
+
+    nh_.param<double>("max_translation_drift", max_translation_drift, 0.005);
+    nh_.param<double>("max_rotation_drift", max_rotation_drift, 0.01);
+
+    nh_.param<int>("track_pyramid_levels", pattern_detector_.track_pyramid_levels, 1);
+    nh_.param<int>("track_iterations", pattern_detector_.track_iterations, 10);
+    nh_.param<double>("track_max_reprojection_error", pattern_detector_.track_max_reprojection_error, 1.5);
+
+    // Set pattern detector sizes
+    pattern_detector_.setPattern(cv::Size(checkerboard_width, checkerboard_height), checkerboard_grid, CHESSBOARD);
+
+    // Create subscriptions
+    info_sub_ = nh_.subscribe("/camera/rgb/camera_info", 1, &TrackCalibrationPattern::infoCallback, this);
+
+    // Also publishers
+    pub_ = it_.advertise("calibration_pattern_out", 1);
+    pose_pub_ = nh_.advertise<geometry_msgs::PoseStamped>("pattern_pose", 1);
+
+    ROS_INFO("[track pattern] Initialized.");
+  }
+
+  void infoCallback(const sensor_msgs::CameraInfoConstPtr& info_msg)
+  {
+    cam_model_.fromCameraInfo(info_msg);
+    pattern_detector_.setCameraMatrices(cam_model_.intrinsicMatrix(), cam_model_.distortionCoeffs());
+
+    // Only need this once
+    info_sub_.shutdown();
+    image_sub_ = nh_.subscribe("/camera/rgb/image_mono", 1, &TrackCalibrationPattern::imageCallback, this);
+
+    ROS_INFO("[track pattern] Got image info!");
+  }
+
+  void imageCallback(const sensor_msgs::ImageConstPtr& image_msg)
+  {
+    try
+    {
+      input_bridge_ = cv_bridge::toCvCopy(image_msg, "mono8");
+      output_bridge_ = cv_bridge::toCvCopy(image_msg, "bgr8");
+    }
+    catch (cv_bridge::Exception& ex)
+    {
+      ROS_ERROR("[track pattern] Failed to convert image");
+      return;
+    }
+
+    Eigen::Vector3f translation;
+    Eigen::Quaternionf orientation;
+
+    if (!pattern_detector_.trackPattern(input_bridge_->image, translation, orientation, output_bridge_->image))
+    {
+      ROS_INFO_THROTTLE(5, "[track pattern] Couldn't detect checkerboard, make sure it's visible in the image.");
+      return;
+    }
+
+    tf::Transform target_transform;
+    target_transform.setOrigin( tf::Vector3(translation.x(), translation.y(), translation.z()) );
+    target_transform.setRotation( tf::Quaternion(orientation.x(), orientation.y(), orientation.z(), orientation.w()) );
+    tf_broadcaster_.sendTransform(tf::StampedTransform(target_transform, image_msg->header.stamp, image_msg->header.frame_id, target_frame));
+
+    geometry_msgs::PoseStamped pose;
+    pose.header = image_msg->header;
+    tf::poseTFToMsg(target_transform, pose.pose);
+    pose_pub_.publish(pose);
+
+    // Publish tracking image
+    pub_.publish(output_bridge_->toImageMsg());
+
+    checkDrift(translation, orientation);
+  }
+
+  // The pattern doesn't move, so any change in its pose is the camera moving
+  void checkDrift(const Eigen::Vector3f& translation, const Eigen::Quaternionf& orientation)
+  {
+    if (!have_reference_)
+    {
+      reference_translation_ = translation;
+      reference_orientation_ = orientation;
+      have_reference_ = true;
+      return;
+    }
+
+    double translation_drift = (translation - reference_translation_).norm();
+    double rotation_drift = reference_orientation_.angularDistance(orientation);
+
+    if (translation_drift > max_translation_drift || rotation_drift > max_rotation_drift)
+    {
+      ROS_WARN_THROTTLE(1, "[track pattern] Camera has moved %f m, %f rad since it was calibrated",
+                        translation_drift, rotation_drift);
+    }
+  }
+};
+
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "track_calibration_pattern");
+
+  TrackCalibrationPattern tracker;
+  ros::spin();
+}
@@ -0,0 +1,151 @@
+#ifndef BUS_METRICS_H__
+#define BUS_METRICS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <map>
+
+namespace dynamixel_hardware_interface
+{
+
+// Durations in microseconds in a log-linear histogram, as in HdrHistogram:
+// four buckets per power of two, so a percentile is never more than 25% above
+// the real value. Covers up to about 4 seconds, longer durations go in the
+// last bucket.
+class LatencyHistogram
+{
+public:
+    static const int SUB_BUCKETS = 4;
+    static const int NUM_BUCKETS = SUB_BUCKETS * 21;
+
+    LatencyHistogram();
+
+    void record(uint32_t us);
+
+    uint64_t count() const { return count_; }
+    uint32_t max() const { return max_; }
+    uint64_t bucket(int index) const { return buckets_[index]; }
+
+    // Upper bound of the bucket holding the given fraction (0..1) of the
+    // durations, e.g. percentile(0.99) >= the 99th percentile
+    uint32_t percentile(double fraction) const;
+
+    static int bucketIndex(uint32_t us);
+    // Durations in bucket index are below this
+    static uint32_t bucketUpperBound(int index);
+
+private:
+    uint64_t buckets_[NUM_BUCKETS];
+    uint64_t count_;
+    uint32_t max_;
+};
+
+// Transaction counters of a single servo or of a whole bus
+typedef struct TransactionMetricsStruct
+{
+    enum Instruction { PING, READ, WRITE, SYNC_WRITE, OTHER, NUM_INSTRUCTIONS };
+
+    enum Outcome
+    {
+        OK,
+        SERVO_ERROR,    // answered, with error bits set
+        TIMEOUT,        // no valid response in time
+        WRITE_FAILED,   // the request couldn't be sent
+        QUARANTINED,    // not sent, the servo isn't answering lately
+        NUM_OUTCOMES
+    };
+
+    TransactionMetricsStruct();
+
+    uint64_t transactions[NUM_INSTRUCTIONS];
+    uint64_t outcomes[NUM_OUTCOMES];
+
+    // from sending a request to receiving its response
+    LatencyHistogram rtt;
+
+    uint64_t total() const;
+
+    static Instruction classify(uint8_t instruction);
+
+} TransactionMetrics;
+
+// A copy of the metrics of a bus at some point in time
+typedef struct BusMetricsSnapshotStruct
+{
+    BusMetricsSnapshotStruct()
+        : timestamp(0.0), tx_bytes(0), rx_bytes(0), discarded_bytes(0),
+          corrupt_packets(0), busy_sec(0.0), wire_sec(0.0) {}
+
+    // monotonic clock
+    double timestamp;
+
+    TransactionMetrics bus;
+    std::map<int, TransactionMetrics> servos;
+
+    uint64_t tx_bytes;
+    uint64_t rx_bytes;
+    // received but not part of a response: noise, echoes, late responses
+    uint64_t discarded_bytes;
+    // packets with a bad checksum
+    uint64_t corrupt_packets;
+
+    // time spent in transactions, including waiting for responses
+    double busy_sec;
+    // time the bytes sent and received took on the wire at the baud rate
+    double wire_sec;
+
+    // Fraction of the time since previous spent transferring bytes and
+    // waiting for responses respectively
+    double utilization(const BusMetricsSnapshotStruct& previous) const;
+    double occupancy(const BusMetricsSnapshotStruct& previous) const;
+
+} BusMetricsSnapshot;
+
+// Metrics of one bus, kept by DynamixelIO. There is a single writer (whoever
+// holds the serial port), recording costs a few atomic increments and never
+// blocks. snapshot() can be called from any thread without locking; counters
+// updated while it runs may be off by the transaction in flight.
+class BusMetricsRecorder
+{
+public:
+    static const int MAX_SERVO_ID = 253;
+
+    BusMetricsRecorder();
+    ~BusMetricsRecorder();
+
+    void setByteTime(double byte_time_ms) { byte_time_ms_ = byte_time_ms; }
+
+    void recordTransaction(int servo_id,
+                           uint8_t instruction,
+                           TransactionMetrics::Outcome outcome,
+                           size_t tx_bytes,
+                           double elapsed_us);
+
+    void recordReceived(size_t n_bytes);
+    void recordDiscarded(size_t n_bytes);
+    void recordCorruptPacket();
+
+    BusMetricsSnapshot snapshot() const;
+
+private:
+    double byte_time_ms_;
+
+    TransactionMetrics bus_;
+    // allocated on a servo's first transaction, never freed until destruction
+    TransactionMetrics* servos_[MAX_SERVO_ID + 1];
+
+    uint64_t tx_bytes_;
+    uint64_t rx_bytes_;
+    uint64_t discarded_bytes_;
+    uint64_t corrupt_packets_;
+    uint64_t busy_us_;
+
+    // Not copyable
+    BusMetricsRecorder(const BusMetricsRecorder&);
+    void operator=(const BusMetricsRecorder&);
+};
+
+}
+
+#endif // BUS_METRICS_H__
@@ -0,0 +1,135 @@
+/*
+  Copyright (c) 2013, Dave Coleman
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  * Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+  * Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+  * Neither the name of the <organization> nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY Dave Coleman ''AS IS'' AND ANY
+  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL Dave Coleman BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+  Cartesian velocity (servoing) controller
+
+  Takes end effector twists on ~command and turns them into joint motion at
+  the servo update rate, without going through planning or a trajectory.
+  Every cycle the Jacobian of the URDF chain is computed at the commanded
+  joint positions, joint velocities are solved with damped least squares,
+  joints near their limits are pushed back in the null space, and the
+  resulting position/velocity targets go out as one sync write per port.
+
+  A command is applied on the next cycle, and the arm holds position once
+  commands stop arriving for longer than command_timeout.
+*/
+
+#ifndef DYNAMIXEL_HARDWARE_INTERFACE_CARTESIAN_VELOCITY_CONTROLLER_H
+#define DYNAMIXEL_HARDWARE_INTERFACE_CARTESIAN_VELOCITY_CONTROLLER_H
+
+#include <vector>
+#include <string>
+
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <dynamixel_hardware_interface/single_joint_controller.h>
+#include <dynamixel_hardware_interface/multi_joint_controller.h>
+
+#include <ros/ros.h>
+#include <geometry_msgs/TwistStamped.h>
+
+#include <kdl/chain.hpp>
+#include <kdl/chainfksolverpos_recursive.hpp>
+#include <kdl/chainjnttojacsolver.hpp>
+
+#include <Eigen/Core>
+
+namespace controller
+{
+
+class CartesianVelocityController : public MultiJointController
+{
+public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  CartesianVelocityController();
+  virtual ~CartesianVelocityController();
+
+  bool initialize(std::string name, std::vector<boost::shared_ptr<controller::SingleJointController> > deps);
+
+  void start();
+  void stop();
+
+  void processCommand(const geometry_msgs::TwistStampedConstPtr& msg);
+  void servoLoop();
+
+private:
+  // Solve one cycle: joint velocities for the twist at the commanded positions
+  void solveJointVelocities(const Eigen::Matrix<double, 6, 1>& twist, bool twist_in_tip_frame);
+
+  // Send positions_ / joint_velocities_ to every port
+  void sendCommands();
+
+  // Hold the arm where it is now
+  void holdPosition();
+
+  KDL::Chain chain_;
+  boost::scoped_ptr<KDL::ChainJntToJacSolver> jac_solver_;
+  boost::scoped_ptr<KDL::ChainFkSolverPos_recursive> fk_solver_;
+  std::string base_link_;
+  std::string tip_link_;
+
+  // Index in joint_names_ of each joint of the chain, in chain order, and back
+  std::vector<int> chain_to_joint_;
+  std::vector<int> joint_to_chain_;
+
+  // Per chain joint
+  std::vector<double> min_positions_;
+  std::vector<double> max_positions_;
+  std::vector<double> max_velocities_;
+
+  double servo_rate_;
+  double command_timeout_;
+  double damping_;
+  double limit_margin_;
+  double limit_gain_;
+
+  // Latest command, written by the subscriber and read by the servo thread
+  boost::mutex command_mutex_;
+  Eigen::Matrix<double, 6, 1> command_twist_;
+  bool command_in_tip_frame_;
+  ros::Time command_stamp_;
+
+  // Servo thread state, in chain order. positions_ are the commanded positions,
+  // integrated every cycle so the servo lag doesn't feed back into the solve.
+  bool servoing_;
+  KDL::JntArray positions_;
+  KDL::Jacobian jacobian_;
+  Eigen::VectorXd joint_velocities_;
+
+  ros::Subscriber command_sub_;
+
+  boost::thread* servo_thread_;
+  boost::mutex terminate_mutex_;
+  bool terminate_;
+};
+
+}
+
+#endif  // DYNAMIXEL_HARDWARE_INTERFACE_CARTESIAN_VELOCITY_CONTROLLER_H
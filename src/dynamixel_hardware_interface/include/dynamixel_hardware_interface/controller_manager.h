@@ -32,6 +32,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <boost/thread.hpp>
 
@@ -45,6 +46,7 @@
 #include <dynamixel_hardware_interface/StopController.h>
 #include <dynamixel_hardware_interface/RestartController.h>
 #include <dynamixel_hardware_interface/ListControllers.h>
+#include <dynamixel_hardware_interface/SetJointParameters.h>
 
 namespace dynamixel_controller_manager
 {
@@ -60,6 +62,13 @@ public:
   bool stopController(std::string name);
   bool restartController(std::string name);
 
+  // Change the motors of the given controllers (or joints), all controllers if
+  // the list is empty, with one sync write per serial port
+  bool setTorqueEnable(const std::vector<std::string>& controllers, bool torque_enable);
+  bool setTorqueLimit(const std::vector<std::string>& controllers, double torque_limit);
+  bool setComplianceMargin(const std::vector<std::string>& controllers, int margin);
+  bool setComplianceSlope(const std::vector<std::string>& controllers, int slope);
+
 private:
   ros::NodeHandle nh_;
   ros::NodeHandle private_nh_;
@@ -73,6 +82,7 @@ private:
   ros::ServiceServer stop_controller_server_;
   ros::ServiceServer restart_controller_server_;
   ros::ServiceServer list_controllers_server_;
+  ros::ServiceServer set_joint_parameters_server_;
 
   std::map<std::string, dynamixel_hardware_interface::SerialProxy*> serial_proxies_;
 
@@ -96,6 +106,18 @@ private:
   void publishDiagnosticInformation();
   void checkDeps();
 
+  typedef std::map<dynamixel_hardware_interface::DynamixelIO*, std::vector<int> > MotorsByPort;
+
+  // Finds the motors of the given controllers, grouped by serial port, and
+  // optionally the controllers themselves
+  bool findMotors(const std::vector<std::string>& controllers, MotorsByPort& motors,
+                  std::vector<boost::shared_ptr<controller::SingleJointController> >* found = NULL);
+
+  // Sync writes the same value(s) to all motors, one packet per serial port
+  bool setMultiValue(const MotorsByPort& motors,
+                     const std::vector<int>& values,
+                     bool (dynamixel_hardware_interface::DynamixelIO::*setter)(std::vector<std::vector<int> >));
+
   bool startControllerSrv(dynamixel_hardware_interface::StartController::Request& req,
                           dynamixel_hardware_interface::StartController::Response& res);
 
@@ -108,6 +130,9 @@ private:
   bool listControllersSrv(dynamixel_hardware_interface::ListControllers::Request& req,
                           dynamixel_hardware_interface::ListControllers::Response& res);
 
+  bool setJointParametersSrv(dynamixel_hardware_interface::SetJointParameters::Request& req,
+                             dynamixel_hardware_interface::SetJointParameters::Response& res);
+
 };
 
 }
@@ -38,6 +38,8 @@
 
 #include <clam/gearbox/flexiport/port.h>
 
+#include <dynamixel_hardware_interface/bus_metrics.h>
+
 namespace dynamixel_hardware_interface
 {
 
@@ -86,19 +88,122 @@ typedef struct DynamixelStatusStruct
 
 } DynamixelStatus;
 
+// Response time statistics of a single servo, used to size its timeouts
+typedef struct ServoTimingStruct
+{
+    ServoTimingStruct()
+        : has_sample(false), srtt_ms(0.0), rttvar_ms(0.0),
+          consecutive_timeouts(0), quarantined_until_sec(0.0), quarantine_sec(0.0) {}
+    
+    bool   has_sample;
+    // smoothed latency and its mean deviation, not counting the time to
+    // transfer the response itself
+    double srtt_ms;
+    double rttvar_ms;
+    
+    int    consecutive_timeouts;
+    // requests fail without touching the bus until then
+    double quarantined_until_sec;
+    double quarantine_sec;
+
+} ServoTiming;
+
+
+// Collects register reads for one or more servos so that DynamixelIO::readBatch
+// can merge them into as few READ_DATA transactions as possible, one per servo
+// unless the registers are far apart, and scatter the results back.
+class DynamixelReadBatch
+{
+public:
+    // Registers closer than this are read together with whatever lies between
+    // them, which is cheaper than the overhead of another transaction
+    static const int MAX_GAP = 8;
+    
+    // A contiguous range of registers read in one transaction
+    typedef struct RangeStruct
+    {
+        int servo_id;
+        int address;
+        int size;
+    } Range;
+    
+    // Reads the 8-bit register at address into value
+    void addByte(int servo_id, int address, uint8_t* value);
+    void addFlag(int servo_id, int address, bool* value);
+    
+    // Reads the 16-bit register starting at address (low byte first) into value
+    void addWord(int servo_id, int address, uint16_t* value);
+    
+    // Like addWord, for registers holding a 10-bit magnitude and a direction
+    // bit, like speed and load
+    void addSignedWord(int servo_id, int address, int16_t* value);
+    
+    void clear() { fields_.clear(); }
+    bool empty() const { return fields_.empty(); }
+    
+    // The reads needed to get all fields, sorted by servo and address
+    std::vector<Range> getRanges() const;
+
+private:
+    friend class DynamixelIO;
+    
+    enum FieldType { BYTE, FLAG, WORD, SIGNED_WORD };
+    
+    typedef struct FieldStruct
+    {
+        int servo_id;
+        int address;
+        FieldType type;
+        void* value;
+    } Field;
+    
+    std::vector<Field> fields_;
+    
+    void add(int servo_id, int address, FieldType type, void* value);
+    
+    // Fills in the fields covered by range from a READ_DATA response
+    void scatter(const Range& range, const std::vector<uint8_t>& response);
+};
 
 class DynamixelIO
 {
 public:
     DynamixelIO(std::string device, std::string baud);
+    
+    // Talks to the motors over an already created port, taking ownership of it.
+    // Mostly useful for testing with a simulated bus.
+    explicit DynamixelIO(flexiport::Port* port, std::string baud="1000000");
+    
     ~DynamixelIO();
 
     long long unsigned int read_error_count;
     long long unsigned int read_count;
     double last_reset_sec;
     
+    // Bytes thrown away while looking for a response: line noise, echoes of
+    // our own requests, late responses to earlier requests, corrupt packets.
+    long long unsigned int discarded_byte_count;
+    
+    // How long to wait for a response of response_length bytes from servo_id
+    double getResponseTimeout(int servo_id, size_t response_length);
+    
+    // True while servo_id is skipped after failing to answer repeatedly
+    bool isQuarantined(int servo_id);
+    
+    // Transaction counts, errors, round trip times and traffic of the bus
+    // and each servo on it. Doesn't lock, safe to call from any thread.
+    BusMetricsSnapshot getMetrics() const { return metrics_.snapshot(); }
+    
     const DynamixelData* getCachedParameters(int servo_id);
     
+    // Refreshes the cached parameters and reads the fields in batch along
+    // with them, in a single transaction if they are close enough
+    const DynamixelData* getCachedParameters(int servo_id, const DynamixelReadBatch& batch);
+    
+    // Reads all fields in batch, returns false if any of the reads failed.
+    // Fields of failed reads are left untouched.
+    bool readBatch(DynamixelReadBatch& batch);
+    
     bool ping(int servo_id);
     bool resetOverloadError(int servo_id);
     
@@ -197,6 +302,8 @@ protected:
     }
     
     bool updateCachedParameters(int servo_id, DynamixelData* data);
+    void addCachedParameters(DynamixelReadBatch& batch, int servo_id, DynamixelData* data);
+    bool readBatch(DynamixelReadBatch& batch, bool check_errors);
     void checkForErrors(int servo_id, uint8_t error_code, std::string command_failed);
 
     bool read(int servo_id,
@@ -216,10 +323,51 @@ private:
     flexiport::Port* port_;
     pthread_mutex_t serial_mutex_;
     
-    bool waitForBytes(ssize_t n_bytes, uint16_t timeout_ms);
+    // Bytes received but not yet parsed into a response packet
+    std::vector<uint8_t> rx_buffer_;
+    
+    // The last packet written, to recognise its echo on half-duplex adapters
+    std::vector<uint8_t> last_request_;
+    
+    // Whether the adapter echoes what is written. Decided by the first
+    // response: an echoing adapter sends the request back before it.
+    enum EchoMode { ECHO_UNKNOWN, ECHO_NONE, ECHO_ALWAYS };
+    EchoMode echo_mode_;
+    
+    // True from a write until its echo has been skipped, unless the adapter
+    // is known not to echo
+    bool echo_pending_;
+    
+    // Time to send one byte (start, 8 data and stop bits) at the current baud rate
+    double byte_time_ms_;
+    std::map<int, ServoTiming> timing_;
+    
+    BusMetricsRecorder metrics_;
+    
+    void init(std::string baud);
+    
+    bool waitForBytes(ssize_t n_bytes, double timeout_ms);
+    
+    // Sends packet and waits for the response_length byte response, unless
+    // the servo is quarantined. Updates the servo's response time statistics.
+    bool transaction(const uint8_t* packet,
+                     size_t count,
+                     size_t response_length,
+                     std::vector<uint8_t>& response);
     
     bool writePacket(const void* const buffer, size_t count);
-    bool readResponse(std::vector<uint8_t>& response);
+    bool readResponse(std::vector<uint8_t>& response, double timeout_ms);
+    
+    double responseTimeout(const ServoTiming& timing, size_t response_length);
+    void updateTiming(ServoTiming& timing, bool success, double latency_ms);
+    
+    // Reads whatever the port has into rx_buffer_, returns the number of bytes read.
+    ssize_t receiveBytes();
+    
+    // Extracts the first valid response to last_request_ from rx_buffer_,
+    // discarding anything in front of it. Returns false if rx_buffer_ doesn't
+    // hold a complete response yet.
+    bool parseResponse(std::vector<uint8_t>& response);
 };
 
 }
@@ -51,8 +51,7 @@ public:
                     std::string port_namespace,
                     dynamixel_hardware_interface::DynamixelIO* dxl_io);
     
-    bool processTorqueEnable(dynamixel_hardware_interface::TorqueEnable::Request& req,
-                             dynamixel_hardware_interface::TorqueEnable::Request& res);
+    void prepareTorqueEnable();
     
     std::vector<std::vector<int> > getRawMotorCommands(double position, double velocity);
     
@@ -45,6 +45,13 @@ public:
 private:
   void getUniqueErrorLogPath(std::string &log_path);
 
+  // Command every joint to stay where it currently is
+  void holdCurrentPosition();
+
+  // True once every joint is within its goal constraint of goal_positions and
+  // slower than stopped_velocity_tolerance_, going by the latest joint states
+  bool isSettled(const std::vector<double>& goal_positions);
+
   int update_rate_;
   int state_update_rate_;
   std::vector<Segment> trajectory_;
@@ -81,6 +81,7 @@ private:
 
     ros::Publisher motor_states_pub_;
     ros::Publisher diagnostics_pub_;
+    ros::Publisher bus_metrics_pub_;
 
     boost::thread* feedback_thread_;
     boost::thread* diagnostics_thread_;
@@ -93,9 +94,10 @@ private:
     std::vector<int> motors_;
     std::map<int, const DynamixelData*> motor_static_info_;
 
-    void fillMotorParameters(const DynamixelData* motor_data);
+    void fillMotorParameters(const DynamixelData* motor_data, float voltage);
     bool findMotors();
     void updateMotorStates();
+    void publishBusMetrics(const BusMetricsSnapshot& metrics, const BusMetricsSnapshot& last_metrics);
     void publishDiagnosticInformation();
     
     diagnostic_updater::FrequencyStatus freq_status_;
@@ -267,6 +267,8 @@ public:
   std::string getPortNamespace() { return port_namespace_; }
   std::vector<int> getMotorIDs() { return motor_ids_; }
   double getMaxVelocity() { return max_velocity_; }
+  double getMinAngle() { return min_angle_radians_; }
+  double getMaxAngle() { return max_angle_radians_; }
 
   virtual void start()
   {
@@ -294,9 +296,14 @@ public:
     set_compliance_slope_srv_.shutdown();
   }
 
+  // Called before torque is turned on, so the motors don't jump to whatever
+  // goal they had when it was turned off
+  virtual void prepareTorqueEnable() {}
+
   virtual bool processTorqueEnable(dynamixel_hardware_interface::TorqueEnable::Request& req,
                                    dynamixel_hardware_interface::TorqueEnable::Request& res)
   {
+    if (req.torque_enable) { prepareTorqueEnable(); }
     return setTorqueEnable( req.torque_enable );    
   }
 
@@ -0,0 +1,210 @@
+#include <time.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <map>
+
+#include <dynamixel_hardware_interface/dynamixel_const.h>
+#include <dynamixel_hardware_interface/bus_metrics.h>
+
+namespace dynamixel_hardware_interface
+{
+
+// Only one thread records at a time, the atomic increments make sure
+// readers on other threads never see a torn or stale counter
+static inline void increment(uint64_t& counter, uint64_t n = 1)
+{
+    __sync_fetch_and_add(&counter, n);
+}
+
+LatencyHistogram::LatencyHistogram()
+{
+    memset(buckets_, 0, sizeof(buckets_));
+    count_ = 0;
+    max_ = 0;
+}
+
+int LatencyHistogram::bucketIndex(uint32_t us)
+{
+    // the first power of two is linear, one microsecond per bucket
+    if (us < (uint32_t) SUB_BUCKETS) { return us; }
+
+    int msb = 31 - __builtin_clz(us);
+    int sub = (us >> (msb - 2)) & (SUB_BUCKETS - 1);
+    int index = (msb - 1) * SUB_BUCKETS + sub;
+
+    return index < NUM_BUCKETS ? index : NUM_BUCKETS - 1;
+}
+
+uint32_t LatencyHistogram::bucketUpperBound(int index)
+{
+    ++index;
+    if (index < SUB_BUCKETS) { return index; }
+
+    int msb = index / SUB_BUCKETS + 1;
+    int sub = index % SUB_BUCKETS;
+
+    return (SUB_BUCKETS + sub) << (msb - 2);
+}
+
+void LatencyHistogram::record(uint32_t us)
+{
+    increment(buckets_[bucketIndex(us)]);
+    increment(count_);
+
+    // single writer, no need to loop on compare and swap
+    if (us > max_) { max_ = us; }
+}
+
+uint32_t LatencyHistogram::percentile(double fraction) const
+{
+    uint64_t count = count_;
+    if (count == 0) { return 0; }
+
+    double wanted = fraction * count;
+    uint64_t cumulative = 0;
+
+    for (int i = 0; i < NUM_BUCKETS - 1; ++i)
+    {
+        cumulative += buckets_[i];
+
+        if (cumulative >= wanted)
+        {
+            uint32_t bound = bucketUpperBound(i);
+            return bound < max_ ? bound : max_;
+        }
+    }
+
+    return max_;
+}
+
+TransactionMetricsStruct::TransactionMetricsStruct()
+{
+    memset(transactions, 0, sizeof(transactions));
+    memset(outcomes, 0, sizeof(outcomes));
+}
+
+uint64_t TransactionMetricsStruct::total() const
+{
+    uint64_t sum = 0;
+    for (int i = 0; i < NUM_INSTRUCTIONS; ++i) { sum += transactions[i]; }
+    return sum;
+}
+
+TransactionMetrics::Instruction TransactionMetricsStruct::classify(uint8_t instruction)
+{
+    switch (instruction)
+    {
+        case DXL_PING:          return PING;
+        case DXL_READ_DATA:     return READ;
+        case DXL_WRITE_DATA:    return WRITE;
+        case DXL_SYNC_WRITE:    return SYNC_WRITE;
+        default:                return OTHER;
+    }
+}
+
+double BusMetricsSnapshotStruct::utilization(const BusMetricsSnapshotStruct& previous) const
+{
+    double interval = timestamp - previous.timestamp;
+    return interval > 0 ? (wire_sec - previous.wire_sec) / interval : 0.0;
+}
+
+double BusMetricsSnapshotStruct::occupancy(const BusMetricsSnapshotStruct& previous) const
+{
+    double interval = timestamp - previous.timestamp;
+    return interval > 0 ? (busy_sec - previous.busy_sec) / interval : 0.0;
+}
+
+BusMetricsRecorder::BusMetricsRecorder()
+    : byte_time_ms_(0.0),
+      tx_bytes_(0),
+      rx_bytes_(0),
+      discarded_bytes_(0),
+      corrupt_packets_(0),
+      busy_us_(0)
+{
+    for (int i = 0; i <= MAX_SERVO_ID; ++i) { servos_[i] = NULL; }
+}
+
+BusMetricsRecorder::~BusMetricsRecorder()
+{
+    for (int i = 0; i <= MAX_SERVO_ID; ++i) { delete servos_[i]; }
+}
+
+void BusMetricsRecorder::recordTransaction(int servo_id,
+                                           uint8_t instruction,
+                                           TransactionMetrics::Outcome outcome,
+                                           size_t tx_bytes,
+                                           double elapsed_us)
+{
+    TransactionMetrics::Instruction type = TransactionMetrics::classify(instruction);
+    bool answered = outcome == TransactionMetrics::OK || outcome == TransactionMetrics::SERVO_ERROR;
+
+    increment(bus_.transactions[type]);
+    increment(bus_.outcomes[outcome]);
+    if (answered) { bus_.rtt.record((uint32_t) elapsed_us); }
+
+    increment(tx_bytes_, tx_bytes);
+    increment(busy_us_, (uint64_t) elapsed_us);
+
+    // broadcasts only count towards the bus
+    if (servo_id < 0 || servo_id > MAX_SERVO_ID) { return; }
+
+    TransactionMetrics* servo = servos_[servo_id];
+
+    if (servo == NULL)
+    {
+        servo = new TransactionMetrics();
+
+        // make sure readers never see the pointer before the object
+        __sync_synchronize();
+        servos_[servo_id] = servo;
+    }
+
+    increment(servo->transactions[type]);
+    increment(servo->outcomes[outcome]);
+    if (answered) { servo->rtt.record((uint32_t) elapsed_us); }
+}
+
+void BusMetricsRecorder::recordReceived(size_t n_bytes)
+{
+    increment(rx_bytes_, n_bytes);
+}
+
+void BusMetricsRecorder::recordDiscarded(size_t n_bytes)
+{
+    increment(discarded_bytes_, n_bytes);
+}
+
+void BusMetricsRecorder::recordCorruptPacket()
+{
+    increment(corrupt_packets_);
+}
+
+BusMetricsSnapshot BusMetricsRecorder::snapshot() const
+{
+    BusMetricsSnapshot snapshot;
+
+    struct timespec ts_now;
+    clock_gettime(CLOCK_MONOTONIC, &ts_now);
+    snapshot.timestamp = ts_now.tv_sec + ts_now.tv_nsec / 1.0e9;
+
+    snapshot.bus = bus_;
+
+    for (int i = 0; i <= MAX_SERVO_ID; ++i)
+    {
+        const TransactionMetrics* servo = servos_[i];
+        if (servo != NULL) { snapshot.servos[i] = *servo; }
+    }
+
+    snapshot.tx_bytes = tx_bytes_;
+    snapshot.rx_bytes = rx_bytes_;
+    snapshot.discarded_bytes = discarded_bytes_;
+    snapshot.corrupt_packets = corrupt_packets_;
+    snapshot.busy_sec = busy_us_ / 1.0e6;
+    snapshot.wire_sec = (snapshot.tx_bytes + snapshot.rx_bytes) * byte_time_ms_ / 1.0e3;
+
+    return snapshot;
+}
+
+}
@@ -0,0 +1,395 @@
+/*
+  Copyright (c) 2013, Dave Coleman
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are met:
+  * Redistributions of source code must retain the above copyright
+  notice, this list of conditions and the following disclaimer.
+  * Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+  * Neither the name of the <organization> nor the
+  names of its contributors may be used to endorse or promote products
+  derived from this software without specific prior written permission.
+
+  THIS SOFTWARE IS PROVIDED BY Dave Coleman ''AS IS'' AND ANY
+  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+  WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL Dave Coleman BE LIABLE FOR ANY
+  DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+  ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+  (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// Standard
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Dynamixel Low Level
+#include <dynamixel_hardware_interface/dynamixel_io.h>
+
+// Dynamixel Controllers
+#include <dynamixel_hardware_interface/single_joint_controller.h>
+#include <dynamixel_hardware_interface/multi_joint_controller.h>
+#include <dynamixel_hardware_interface/cartesian_velocity_controller.h>
+
+// Messages
+#include <geometry_msgs/TwistStamped.h>
+
+// ROS
+#include <ros/ros.h>
+#include <pluginlib/class_list_macros.h>
+
+// Kinematics
+#include <kdl_parser/kdl_parser.hpp>
+#include <kdl/tree.hpp>
+
+#include <Eigen/Dense>
+
+PLUGINLIB_DECLARE_CLASS(dynamixel_hardware_interface,
+                        CartesianVelocityController,
+                        controller::CartesianVelocityController,
+                        controller::MultiJointController)
+
+namespace controller
+{
+
+CartesianVelocityController::CartesianVelocityController()
+{
+  terminate_ = false;
+  servoing_ = false;
+  servo_thread_ = NULL;
+  command_in_tip_frame_ = false;
+  command_twist_.setZero();
+}
+
+CartesianVelocityController::~CartesianVelocityController()
+{
+}
+
+bool CartesianVelocityController::initialize(std::string name,
+                                             std::vector<boost::shared_ptr<controller::SingleJointController> > deps)
+{
+  // Load the multi joint controller that this class inherits from. This loads the list of joint_names_
+  if (!MultiJointController::initialize(name, deps))
+  {
+    return false;
+  }
+
+  c_nh_.param<std::string>("base_link", base_link_, "base_link");
+  c_nh_.param<std::string>("tip_link", tip_link_, "gripper_roll_link");
+  c_nh_.param<double>("servo_rate", servo_rate_, 50.0); // same as the port update_rate
+  c_nh_.param<double>("command_timeout", command_timeout_, 0.1);
+  c_nh_.param<double>("damping", damping_, 0.05);
+  c_nh_.param<double>("joint_limit_margin", limit_margin_, 0.2);
+  c_nh_.param<double>("joint_limit_gain", limit_gain_, 0.5);
+
+  // Kinematic chain from the URDF
+  std::string robot_description;
+  if (!nh_.getParam("/robot_description", robot_description))
+  {
+    ROS_ERROR("%s: robot_description is not on the parameter server", name_.c_str());
+    return false;
+  }
+
+  KDL::Tree tree;
+  if (!kdl_parser::treeFromString(robot_description, tree))
+  {
+    ROS_ERROR("%s: unable to parse robot_description into a KDL tree", name_.c_str());
+    return false;
+  }
+
+  if (!tree.getChain(base_link_, tip_link_, chain_))
+  {
+    ROS_ERROR("%s: no chain from %s to %s in robot_description", name_.c_str(), base_link_.c_str(), tip_link_.c_str());
+    return false;
+  }
+
+  // Match up the chain's joints with the joints this controller drives
+  joint_to_chain_.assign(num_joints_, -1);
+
+  for (unsigned int i = 0; i < chain_.getNrOfSegments(); ++i)
+  {
+    const KDL::Joint& joint = chain_.getSegment(i).getJoint();
+    if (joint.getType() == KDL::Joint::None)
+    {
+      continue;
+    }
+
+    std::map<std::string, int>::const_iterator idx_it = joint_to_idx_.find(joint.getName());
+    if (idx_it == joint_to_idx_.end())
+    {
+      ROS_ERROR("%s: joint %s of the chain is not one of the controller's dependencies",
+                name_.c_str(), joint.getName().c_str());
+      return false;
+    }
+
+    joint_to_chain_[idx_it->second] = chain_to_joint_.size();
+    chain_to_joint_.push_back(idx_it->second);
+
+    boost::shared_ptr<controller::SingleJointController> joint_controller = joint_to_controller_[joint.getName()];
+    min_positions_.push_back(joint_controller->getMinAngle());
+    max_positions_.push_back(joint_controller->getMaxAngle());
+    max_velocities_.push_back(joint_controller->getMaxVelocity());
+  }
+
+  unsigned int num_chain_joints = chain_to_joint_.size();
+  positions_.resize(num_chain_joints);
+  jacobian_.resize(num_chain_joints);
+  joint_velocities_ = Eigen::VectorXd::Zero(num_chain_joints);
+
+  jac_solver_.reset(new KDL::ChainJntToJacSolver(chain_));
+  fk_solver_.reset(new KDL::ChainFkSolverPos_recursive(chain_));
+
+  ROS_INFO("%s: servoing %s relative to %s with %d joints at %.0f Hz", name_.c_str(),
+           tip_link_.c_str(), base_link_.c_str(), num_chain_joints, servo_rate_);
+
+  return true;
+}
+
+void CartesianVelocityController::start()
+{
+  command_sub_ = c_nh_.subscribe("command", 1, &CartesianVelocityController::processCommand, this,
+                                 ros::TransportHints().tcpNoDelay());
+
+  {
+    boost::mutex::scoped_lock terminate_lock(terminate_mutex_);
+    terminate_ = false;
+  }
+
+  servo_thread_ = new boost::thread(boost::bind(&CartesianVelocityController::servoLoop, this));
+}
+
+void CartesianVelocityController::stop()
+{
+  {
+    boost::mutex::scoped_lock terminate_lock(terminate_mutex_);
+    terminate_ = true;
+  }
+
+  // Not started, or stopped already
+  if (servo_thread_ != NULL)
+  {
+    servo_thread_->join();
+    delete servo_thread_;
+    servo_thread_ = NULL;
+  }
+
+  command_sub_.shutdown();
+}
+
+// Only stores the command, the servo thread picks it up on its next cycle
+void CartesianVelocityController::processCommand(const geometry_msgs::TwistStampedConstPtr& msg)
+{
+  bool in_tip_frame;
+  if (msg->header.frame_id.empty() || msg->header.frame_id == base_link_)
+  {
+    in_tip_frame = false;
+  }
+  else if (msg->header.frame_id == tip_link_)
+  {
+    in_tip_frame = true;
+  }
+  else
+  {
+    ROS_WARN_THROTTLE(1, "%s: ignoring twist in frame %s, only %s and %s are supported", name_.c_str(),
+                      msg->header.frame_id.c_str(), base_link_.c_str(), tip_link_.c_str());
+    return;
+  }
+
+  boost::mutex::scoped_lock command_lock(command_mutex_);
+  command_twist_ << msg->twist.linear.x, msg->twist.linear.y, msg->twist.linear.z,
+    msg->twist.angular.x, msg->twist.angular.y, msg->twist.angular.z;
+  command_in_tip_frame_ = in_tip_frame;
+  command_stamp_ = ros::Time::now();
+}
+
+void CartesianVelocityController::servoLoop()
+{
+  ros::Rate rate(servo_rate_);
+  const double dt = 1.0 / servo_rate_;
+
+  Eigen::Matrix<double, 6, 1> twist;
+  bool in_tip_frame;
+  ros::Time stamp;
+
+  while (nh_.ok())
+  {
+    {
+      boost::mutex::scoped_lock terminate_lock(terminate_mutex_);
+      if (terminate_) { break; }
+    }
+
+    {
+      boost::mutex::scoped_lock command_lock(command_mutex_);
+      twist = command_twist_;
+      in_tip_frame = command_in_tip_frame_;
+      stamp = command_stamp_;
+    }
+
+    bool have_command = !stamp.isZero() && (ros::Time::now() - stamp).toSec() < command_timeout_;
+
+    if (have_command)
+    {
+      // Start from where the arm really is, after that integrate our own commands
+      if (!servoing_)
+      {
+        for (size_t c = 0; c < chain_to_joint_.size(); ++c)
+        {
+          positions_(c) = joint_states_[joint_names_[chain_to_joint_[c]]]->position;
+        }
+        servoing_ = true;
+      }
+
+      solveJointVelocities(twist, in_tip_frame);
+
+      for (size_t c = 0; c < chain_to_joint_.size(); ++c)
+      {
+        positions_(c) += joint_velocities_[c] * dt;
+      }
+
+      sendCommands();
+    }
+    else if (servoing_)
+    {
+      holdPosition();
+      servoing_ = false;
+    }
+
+    rate.sleep();
+  }
+}
+
+void CartesianVelocityController::solveJointVelocities(const Eigen::Matrix<double, 6, 1>& twist,
+                                                       bool twist_in_tip_frame)
+{
+  const int n = chain_to_joint_.size();
+  const double dt = 1.0 / servo_rate_;
+
+  jac_solver_->JntToJac(positions_, jacobian_);
+  const Eigen::Matrix<double, 6, Eigen::Dynamic>& J = jacobian_.data;
+
+  // The Jacobian is expressed in the base frame
+  Eigen::Matrix<double, 6, 1> xdot = twist;
+  if (twist_in_tip_frame)
+  {
+    KDL::Frame tip;
+    fk_solver_->JntToCart(positions_, tip);
+    Eigen::Matrix3d R;
+    for (int r = 0; r < 3; ++r)
+      for (int c = 0; c < 3; ++c)
+        R(r, c) = tip.M(r, c);
+
+    xdot.head<3>() = R * twist.head<3>();
+    xdot.tail<3>() = R * twist.tail<3>();
+  }
+
+  // Damped least squares: qdot = J^T (J J^T + lambda^2 I)^-1 xdot
+  Eigen::Matrix<double, 6, 6> JJt = J * J.transpose();
+  JJt.diagonal().array() += damping_ * damping_;
+  Eigen::MatrixXd J_pinv = J.transpose() * JJt.ldlt().solve(Eigen::Matrix<double, 6, 6>::Identity());
+
+  joint_velocities_ = J_pinv * xdot;
+
+  // Push joints that are within limit_margin_ of a limit back towards the middle,
+  // through the null space so the end effector motion is not disturbed
+  Eigen::VectorXd avoidance = Eigen::VectorXd::Zero(n);
+  bool near_limit = false;
+  for (int c = 0; c < n; ++c)
+  {
+    double to_min = positions_(c) - min_positions_[c];
+    double to_max = max_positions_[c] - positions_(c);
+
+    if (to_min < limit_margin_)
+    {
+      avoidance[c] = limit_gain_ * max_velocities_[c] * (limit_margin_ - to_min) / limit_margin_;
+      near_limit = true;
+    }
+    else if (to_max < limit_margin_)
+    {
+      avoidance[c] = -limit_gain_ * max_velocities_[c] * (limit_margin_ - to_max) / limit_margin_;
+      near_limit = true;
+    }
+  }
+
+  if (near_limit)
+  {
+    joint_velocities_ += (Eigen::MatrixXd::Identity(n, n) - J_pinv * J) * avoidance;
+  }
+
+  // Slow everything down together if any joint is over its speed, so the direction is kept
+  double scale = 1.0;
+  for (int c = 0; c < n; ++c)
+  {
+    double speed = std::abs(joint_velocities_[c]);
+    if (speed > max_velocities_[c])
+    {
+      scale = std::min(scale, max_velocities_[c] / speed);
+    }
+  }
+  joint_velocities_ *= scale;
+
+  // Never step over a limit, joints that would just stop there
+  for (int c = 0; c < n; ++c)
+  {
+    double next = positions_(c) + joint_velocities_[c] * dt;
+    if (next < min_positions_[c])
+    {
+      joint_velocities_[c] = std::min(0.0, (min_positions_[c] - positions_(c)) / dt);
+    }
+    else if (next > max_positions_[c])
+    {
+      joint_velocities_[c] = std::max(0.0, (max_positions_[c] - positions_(c)) / dt);
+    }
+  }
+}
+
+void CartesianVelocityController::sendCommands()
+{
+  // One sync write per port with every motor of every joint on it
+  for (std::map<std::string, std::vector<std::string> >::const_iterator port_it = port_to_joints_.begin();
+       port_it != port_to_joints_.end(); ++port_it)
+  {
+    std::vector<std::vector<int> > port_motor_commands;
+
+    for (std::vector<std::string>::const_iterator joint_it = port_it->second.begin();
+         joint_it != port_it->second.end(); ++joint_it)
+    {
+      int c = joint_to_chain_[joint_to_idx_[*joint_it]];
+      if (c < 0)
+      {
+        continue; // not part of the chain, leave it alone
+      }
+
+      // Reach the new position by the end of this cycle
+      std::vector<std::vector<int> > joint_motor_commands =
+        joint_to_controller_[*joint_it]->getRawMotorCommands(positions_(c), std::abs(joint_velocities_[c]));
+
+      port_motor_commands.insert(port_motor_commands.end(), joint_motor_commands.begin(), joint_motor_commands.end());
+    }
+
+    if (!port_motor_commands.empty())
+    {
+      port_to_io_[port_it->first]->setMultiPositionVelocity(port_motor_commands);
+    }
+  }
+}
+
+void CartesianVelocityController::holdPosition()
+{
+  for (size_t c = 0; c < chain_to_joint_.size(); ++c)
+  {
+    positions_(c) = joint_states_[joint_names_[chain_to_joint_[c]]]->position;
+  }
+  joint_velocities_.setZero();
+
+  sendCommands();
+}
+
+}
@@ -45,6 +45,7 @@
 #include <dynamixel_hardware_interface/StopController.h>
 #include <dynamixel_hardware_interface/RestartController.h>
 #include <dynamixel_hardware_interface/ListControllers.h>
+#include <dynamixel_hardware_interface/SetJointParameters.h>
 
 namespace dynamixel_controller_manager
 {
@@ -144,6 +145,9 @@ ControllerManager::ControllerManager() : nh_(ros::NodeHandle()), private_nh_(ros
   list_controllers_server_ = nh_.advertiseService(manager_namespace_ + "/list_controllers",
                                                   &ControllerManager::listControllersSrv, this);
 
+  set_joint_parameters_server_ = nh_.advertiseService(manager_namespace_ + "/set_joint_parameters",
+                                                      &ControllerManager::setJointParametersSrv, this);
+
   if (diagnostics_rate_ > 0)
   {
     terminate_diagnostics_ = false;
@@ -433,6 +437,119 @@ bool ControllerManager::restartController(std::string name)
   return false;
 }
 
+bool ControllerManager::setTorqueEnable(const std::vector<std::string>& controllers, bool torque_enable)
+{
+  MotorsByPort motors;
+  std::vector<boost::shared_ptr<controller::SingleJointController> > found;
+  if (!findMotors(controllers, motors, &found)) { return false; }
+
+  // Same as each controller's torque_enable service: hold the current
+  // position, or stop, before the motors get their torque back
+  if (torque_enable)
+  {
+    for (size_t i = 0; i < found.size(); ++i)
+    {
+      found[i]->prepareTorqueEnable();
+    }
+  }
+
+  std::vector<int> values(1, torque_enable);
+  return setMultiValue(motors, values, &dynamixel_hardware_interface::DynamixelIO::setMultiTorqueEnabled);
+}
+
+bool ControllerManager::setTorqueLimit(const std::vector<std::string>& controllers, double torque_limit)
+{
+  if (torque_limit < 0)
+  {
+    ROS_WARN("Torque limit is below minimum (%f < %f)", torque_limit, 0.0);
+    torque_limit = 0.0;
+  }
+  else if (torque_limit > 1.0)
+  {
+    ROS_WARN("Torque limit is above maximum (%f > %f)", torque_limit, 1.0);
+    torque_limit = 1.0;
+  }
+
+  MotorsByPort motors;
+  if (!findMotors(controllers, motors)) { return false; }
+
+  std::vector<int> values(1, torque_limit * dynamixel_hardware_interface::DXL_MAX_TORQUE_ENCODER);
+  return setMultiValue(motors, values, &dynamixel_hardware_interface::DynamixelIO::setMultiTorqueLimit);
+}
+
+bool ControllerManager::setComplianceMargin(const std::vector<std::string>& controllers, int margin)
+{
+  MotorsByPort motors;
+  if (!findMotors(controllers, motors)) { return false; }
+
+  // same margin clockwise and counterclockwise
+  std::vector<int> values(2, margin);
+  return setMultiValue(motors, values, &dynamixel_hardware_interface::DynamixelIO::setMultiComplianceMargins);
+}
+
+bool ControllerManager::setComplianceSlope(const std::vector<std::string>& controllers, int slope)
+{
+  MotorsByPort motors;
+  if (!findMotors(controllers, motors)) { return false; }
+
+  std::vector<int> values(2, slope);
+  return setMultiValue(motors, values, &dynamixel_hardware_interface::DynamixelIO::setMultiComplianceSlopes);
+}
+
+bool ControllerManager::findMotors(const std::vector<std::string>& controllers, MotorsByPort& motors,
+                                   std::vector<boost::shared_ptr<controller::SingleJointController> >* found)
+{
+  boost::mutex::scoped_lock c_guard(controllers_lock_);
+
+  std::map<std::string, boost::shared_ptr<controller::SingleJointController> >::iterator it;
+  std::set<std::string> wanted(controllers.begin(), controllers.end());
+
+  for (it = sj_controllers_.begin(); it != sj_controllers_.end(); ++it)
+  {
+    boost::shared_ptr<controller::SingleJointController> sjc = it->second;
+
+    if (!wanted.empty() && !wanted.erase(it->first) && !wanted.erase(sjc->getJointName())) { continue; }
+
+    std::vector<int> motor_ids = sjc->getMotorIDs();
+    std::vector<int>& port_motors = motors[sjc->getPort()];
+    port_motors.insert(port_motors.end(), motor_ids.begin(), motor_ids.end());
+    if (found) { found->push_back(sjc); }
+  }
+
+  if (!wanted.empty())
+  {
+    ROS_ERROR("Controller or joint %s is not running", wanted.begin()->c_str());
+    return false;
+  }
+
+  return true;
+}
+
+bool ControllerManager::setMultiValue(const MotorsByPort& motors,
+                                      const std::vector<int>& values,
+                                      bool (dynamixel_hardware_interface::DynamixelIO::*setter)(std::vector<std::vector<int> >))
+{
+  bool success = true;
+  MotorsByPort::const_iterator it;
+
+  for (it = motors.begin(); it != motors.end(); ++it)
+  {
+    std::vector<std::vector<int> > mcv;
+
+    for (size_t i = 0; i < it->second.size(); ++i)
+    {
+      std::vector<int> motor_values;
+      motor_values.push_back(it->second[i]);
+      motor_values.insert(motor_values.end(), values.begin(), values.end());
+      mcv.push_back(motor_values);
+    }
+
+    success &= (it->first->*setter)(mcv);
+  }
+
+  return success;
+}
+
 void ControllerManager::publishDiagnosticInformation()
 {
   diagnostic_msgs::DiagnosticArray diag_msg;
@@ -681,6 +798,42 @@ bool ControllerManager::restartControllerSrv(dynamixel_hardware_interface::Resta
   return true;
 }
 
+bool ControllerManager::setJointParametersSrv(dynamixel_hardware_interface::SetJointParameters::Request& req,
+                                              dynamixel_hardware_interface::SetJointParameters::Response& res)
+{
+  ROS_DEBUG("Set joint parameters service called for %zu controllers", req.controllers.size());
+
+  res.success = true;
+
+  // relax before lowering limits and raise limits before enabling torque
+  if (req.set_torque_enable && !req.torque_enable)
+  {
+    res.success &= setTorqueEnable(req.controllers, false);
+  }
+
+  if (req.set_torque_limit)
+  {
+    res.success &= setTorqueLimit(req.controllers, req.torque_limit);
+  }
+
+  if (req.set_compliance_margin)
+  {
+    res.success &= setComplianceMargin(req.controllers, req.compliance_margin);
+  }
+
+  if (req.set_compliance_slope)
+  {
+    res.success &= setComplianceSlope(req.controllers, req.compliance_slope);
+  }
+
+  if (req.set_torque_enable && req.torque_enable)
+  {
+    res.success &= setTorqueEnable(req.controllers, true);
+  }
+
+  return res.success;
+}
+
 bool ControllerManager::listControllersSrv(dynamixel_hardware_interface::ListControllers::Request& req,
                                            dynamixel_hardware_interface::ListControllers::Response& res)
 {
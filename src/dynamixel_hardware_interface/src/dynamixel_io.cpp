@@ -25,11 +25,14 @@
     SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <math.h>
 #include <time.h>
 #include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 
+#include <algorithm>
 #include <sstream>
 #include <map>
 #include <set>
@@ -46,6 +49,28 @@
 namespace dynamixel_hardware_interface
 {
 
+// Response timeouts are derived from each servo's measured latency as in TCP
+// (RFC 6298): smoothed latency plus four times its mean deviation, plus the
+// time to transfer request and response at the current baud rate.
+static const double MAX_TIMEOUT_MS = 50.0;
+
+// Allows for USB scheduling, the latency timer of USB-serial adapters and
+// the servo's return delay on top of whatever has been measured so far
+static const double MIN_LATENCY_MS = 2.0;
+
+// Servos that miss this many responses in a row are skipped for a while,
+// then probed again with a single request, backing off exponentially
+static const int    QUARANTINE_AFTER_TIMEOUTS = 3;
+static const double MIN_QUARANTINE_SEC = 0.5;
+static const double MAX_QUARANTINE_SEC = 8.0;
+
+static double monotonicSec()
+{
+    struct timespec ts_now;
+    clock_gettime(CLOCK_MONOTONIC, &ts_now);
+    return ts_now.tv_sec + ts_now.tv_nsec / 1.0e9;
+}
+
 DynamixelIO::DynamixelIO(std::string device="/dev/ttyUSB0",
                          std::string baud="1000000")
 {
@@ -56,12 +81,31 @@ DynamixelIO::DynamixelIO(std::string device="/dev/ttyUSB0",
     options["device"] = device;
     options["baud"] = baud;
     
+    port_ = flexiport::CreatePort(options);
+    init(baud);
+}
+
+DynamixelIO::DynamixelIO(flexiport::Port* port, std::string baud)
+{
+    port_ = port;
+    init(baud);
+}
+
+void DynamixelIO::init(std::string baud)
+{
+    // start, 8 data and stop bits per byte
+    byte_time_ms_ = 10 * 1.0e3 / atof(baud.c_str());
+    metrics_.setByteTime(byte_time_ms_);
+    
     read_count = 0;
     read_error_count = 0;
     last_reset_sec = 0.0;
+    discarded_byte_count = 0;
+    
+    echo_mode_ = ECHO_UNKNOWN;
+    echo_pending_ = false;
 
     pthread_mutex_init(&serial_mutex_, NULL);
-    port_ = flexiport::CreatePort(options);
     
     // 100 microseconds = 0.1 milliseconds
     flexiport::Timeout t(0, 100);
@@ -88,6 +132,16 @@ const DynamixelData* DynamixelIO::getCachedParameters(int servo_id)
     return dd;
 }
 
+const DynamixelData* DynamixelIO::getCachedParameters(int servo_id, const DynamixelReadBatch& batch)
+{
+    DynamixelData* dd = findCachedParameters(servo_id);
+    
+    DynamixelReadBatch all(batch);
+    addCachedParameters(all, servo_id, dd);
+    if (!readBatch(all, false)) { return NULL; }
+    return dd;
+}
+
 bool DynamixelIO::ping(int servo_id)
 {
     // Instruction, checksum
@@ -103,10 +157,7 @@ bool DynamixelIO::ping(int servo_id)
 
     std::vector<uint8_t> response;
 
-    pthread_mutex_lock(&serial_mutex_);
-    bool success = writePacket(packet, packet_length);
-    if (success) { success = readResponse(response); }
-    pthread_mutex_unlock(&serial_mutex_);
+    bool success = transaction(packet, packet_length, 6, response);
     
     if (success)
     {
@@ -1396,43 +1447,172 @@ bool DynamixelIO::setMultiValues(std::vector<std::map<std::string, int> > value_
 
 bool DynamixelIO::updateCachedParameters(int servo_id, DynamixelData* data)
 {
+    DynamixelReadBatch batch;
+    addCachedParameters(batch, servo_id, data);
+    
+    // errors are not checked here, checkForErrors() refreshes the cache itself
+    return readBatch(batch, false);
+}
+
+void DynamixelIO::addCachedParameters(DynamixelReadBatch& batch, int servo_id, DynamixelData* data)
+{
+    batch.addWord(servo_id, DXL_MODEL_NUMBER_L, &data->model_number);
+    batch.addByte(servo_id, DXL_FIRMWARE_VERSION, &data->firmware_version);
+    batch.addByte(servo_id, DXL_ID, &data->id);
+    batch.addByte(servo_id, DXL_BAUD_RATE, &data->baud_rate);
+    batch.addByte(servo_id, DXL_RETURN_DELAY_TIME, &data->return_delay_time);
+    batch.addWord(servo_id, DXL_CW_ANGLE_LIMIT_L, &data->cw_angle_limit);
+    batch.addWord(servo_id, DXL_CCW_ANGLE_LIMIT_L, &data->ccw_angle_limit);
+    batch.addByte(servo_id, DXL_DRIVE_MODE, &data->drive_mode);
+    batch.addByte(servo_id, DXL_LIMIT_TEMPERATURE, &data->temperature_limit);
+    batch.addByte(servo_id, DXL_DOWN_LIMIT_VOLTAGE, &data->voltage_limit_low);
+    batch.addByte(servo_id, DXL_UP_LIMIT_VOLTAGE, &data->voltage_limit_high);
+    batch.addWord(servo_id, DXL_MAX_TORQUE_L, &data->max_torque);
+    batch.addByte(servo_id, DXL_RETURN_LEVEL, &data->return_level);
+    batch.addByte(servo_id, DXL_ALARM_LED, &data->alarm_led);
+    batch.addByte(servo_id, DXL_ALARM_SHUTDOWN, &data->alarm_shutdown);
+    batch.addFlag(servo_id, DXL_TORQUE_ENABLE, &data->torque_enabled);
+    batch.addByte(servo_id, DXL_LED, &data->led);
+    batch.addByte(servo_id, DXL_CW_COMPLIANCE_MARGIN, &data->cw_compliance_margin);
+    batch.addByte(servo_id, DXL_CCW_COMPLIANCE_MARGIN, &data->ccw_compliance_margin);
+    batch.addByte(servo_id, DXL_CW_COMPLIANCE_SLOPE, &data->cw_compliance_slope);
+    batch.addByte(servo_id, DXL_CCW_COMPLIANCE_SLOPE, &data->ccw_compliance_slope);
+    batch.addWord(servo_id, DXL_GOAL_POSITION_L, &data->target_position);
+    batch.addSignedWord(servo_id, DXL_GOAL_SPEED_L, &data->target_velocity);
+}
+
+bool DynamixelIO::readBatch(DynamixelReadBatch& batch)
+{
+    return readBatch(batch, true);
+}
+
+bool DynamixelIO::readBatch(DynamixelReadBatch& batch, bool check_errors)
+{
+    std::vector<DynamixelReadBatch::Range> ranges = batch.getRanges();
     std::vector<uint8_t> response;
-    if (read(servo_id, DXL_MODEL_NUMBER_L, 34, response))
-    {
-        uint8_t byte_num = 5;
-        
-        data->model_number = response[byte_num+0] + (response[byte_num+1] << 8);
-        data->firmware_version = response[byte_num+2];
-        data->id = response[byte_num+3];
-        data->baud_rate = response[byte_num+4];
-        data->return_delay_time = response[byte_num+5];
-        data->cw_angle_limit = response[byte_num+6] + (response[byte_num+7] << 8);
-        data->ccw_angle_limit = response[byte_num+8] + (response[byte_num+9] << 8);
-        data->drive_mode = response[byte_num+10];
-        data->temperature_limit = response[byte_num+11];
-        data->voltage_limit_low = response[byte_num+12];
-        data->voltage_limit_high = response[byte_num+13];
-        data->max_torque = response[byte_num+14] + (response[byte_num+15] << 8);
-        data->return_level = response[byte_num+16];
-        data->alarm_led = response[byte_num+17];
-        data->alarm_shutdown = response[byte_num+18];
-        data->torque_enabled = response[byte_num+24];
-        data->led = response[byte_num+25];
-        data->cw_compliance_margin = response[byte_num+26];
-        data->ccw_compliance_margin = response[byte_num+27];
-        data->cw_compliance_slope = response[byte_num+28];
-        data->ccw_compliance_slope = response[byte_num+29];
-        data->target_position = response[byte_num+30] + (response[byte_num+31] << 8);
-        
-        int16_t target_velocity = response[byte_num+32] + (response[byte_num+33] << 8);
-        int direction = (target_velocity & (1 << 10)) == 0 ? 1 : -1;
-        target_velocity = direction * (target_velocity & DXL_MAX_VELOCITY_ENCODER);
-        data->target_velocity = target_velocity;
+    bool success = true;
+    
+    for (size_t i = 0; i < ranges.size(); ++i)
+    {
+        const DynamixelReadBatch::Range& range = ranges[i];
         
-        return true;
+        if (!read(range.servo_id, range.address, range.size, response))
+        {
+            success = false;
+            continue;
+        }
+        
+        if (check_errors) { checkForErrors(range.servo_id, response[4], "readBatch"); }
+        batch.scatter(range, response);
     }
+    
+    return success;
+}
 
-    return false;
+void DynamixelReadBatch::addByte(int servo_id, int address, uint8_t* value)
+{
+    add(servo_id, address, BYTE, value);
+}
+
+void DynamixelReadBatch::addFlag(int servo_id, int address, bool* value)
+{
+    add(servo_id, address, FLAG, value);
+}
+
+void DynamixelReadBatch::addWord(int servo_id, int address, uint16_t* value)
+{
+    add(servo_id, address, WORD, value);
+}
+
+void DynamixelReadBatch::addSignedWord(int servo_id, int address, int16_t* value)
+{
+    add(servo_id, address, SIGNED_WORD, value);
+}
+
+void DynamixelReadBatch::add(int servo_id, int address, FieldType type, void* value)
+{
+    Field field;
+    field.servo_id = servo_id;
+    field.address = address;
+    field.type = type;
+    field.value = value;
+    fields_.push_back(field);
+}
+
+static bool compareRanges(const DynamixelReadBatch::Range& a, const DynamixelReadBatch::Range& b)
+{
+    return a.servo_id < b.servo_id || (a.servo_id == b.servo_id && a.address < b.address);
+}
+
+std::vector<DynamixelReadBatch::Range> DynamixelReadBatch::getRanges() const
+{
+    std::vector<Range> fields(fields_.size());
+    
+    for (size_t i = 0; i < fields_.size(); ++i)
+    {
+        fields[i].servo_id = fields_[i].servo_id;
+        fields[i].address = fields_[i].address;
+        fields[i].size = (fields_[i].type == WORD || fields_[i].type == SIGNED_WORD) ? 2 : 1;
+    }
+    
+    std::sort(fields.begin(), fields.end(), compareRanges);
+    
+    std::vector<Range> ranges;
+    
+    for (size_t i = 0; i < fields.size(); ++i)
+    {
+        if (!ranges.empty())
+        {
+            Range& last = ranges.back();
+            int end = last.address + last.size;
+            
+            if (last.servo_id == fields[i].servo_id && fields[i].address <= end + MAX_GAP)
+            {
+                last.size = std::max(end, fields[i].address + fields[i].size) - last.address;
+                continue;
+            }
+        }
+        
+        ranges.push_back(fields[i]);
+    }
+    
+    return ranges;
+}
+
+void DynamixelReadBatch::scatter(const Range& range, const std::vector<uint8_t>& response)
+{
+    // packet: FF  FF  ID LENGTH ERROR PARAM_1 ... CHECKSUM
+    const int byte_num = 5;
+    
+    for (size_t i = 0; i < fields_.size(); ++i)
+    {
+        const Field& field = fields_[i];
+        int offset = field.address - range.address;
+        
+        if (field.servo_id != range.servo_id || offset < 0 || offset >= range.size) { continue; }
+        
+        uint8_t low = response[byte_num + offset];
+        uint16_t word = (field.type == WORD || field.type == SIGNED_WORD) ? low + (response[byte_num + offset + 1] << 8) : low;
+        
+        switch (field.type)
+        {
+            case BYTE:
+                *static_cast<uint8_t*>(field.value) = low;
+                break;
+            case FLAG:
+                *static_cast<bool*>(field.value) = low;
+                break;
+            case WORD:
+                *static_cast<uint16_t*>(field.value) = word;
+                break;
+            case SIGNED_WORD:
+            {
+                int direction = (word & (1 << 10)) == 0 ? 1 : -1;
+                *static_cast<int16_t*>(field.value) = direction * (word & DXL_MAX_VELOCITY_ENCODER);
+                break;
+            }
+        }
+    }
 }
 
 void DynamixelIO::checkForErrors(int servo_id, uint8_t error_code, std::string command_failed)
@@ -1505,10 +1685,14 @@ bool DynamixelIO::read(int servo_id,
     // packet: FF  FF  ID LENGTH INSTRUCTION PARAM_1 ... CHECKSUM
     uint8_t packet[8] = { 0xFF, 0xFF, servo_id, length, DXL_READ_DATA, address, size, checksum };
 
-    pthread_mutex_lock(&serial_mutex_);
-    bool success = writePacket(packet, 8);
-    if (success) { success = readResponse(response); }
-    pthread_mutex_unlock(&serial_mutex_);
+    bool success = transaction(packet, 8, 6 + size, response);
+
+    // header, id, length, error, data, checksum
+    if (success && response.size() != (size_t) (6 + size))
+    {
+        response.clear();
+        return false;
+    }
 
     return success;
 }
@@ -1551,10 +1735,7 @@ bool DynamixelIO::write(int servo_id,
 
     packet[packetLength-1] = checksum;
 
-    pthread_mutex_lock(&serial_mutex_);
-    bool success = writePacket(packet, packetLength);
-    if (success) { success = readResponse(response); }
-    pthread_mutex_unlock(&serial_mutex_);
+    bool success = transaction(packet, packetLength, 6, response);
 
     return success;
 }
@@ -1608,13 +1789,17 @@ bool DynamixelIO::syncWrite(int address,
     packet[packet_length-1] = checksum;
 
     pthread_mutex_lock(&serial_mutex_);
+    double start_sec = monotonicSec();
     bool success = writePacket(packet, packet_length);
+    metrics_.recordTransaction(DXL_BROADCAST, DXL_SYNC_WRITE,
+                               success ? TransactionMetrics::OK : TransactionMetrics::WRITE_FAILED,
+                               packet_length, (monotonicSec() - start_sec) * 1.0e6);
     pthread_mutex_unlock(&serial_mutex_);
 
     return success;
 }
 
-bool DynamixelIO::waitForBytes(ssize_t n_bytes, uint16_t timeout_ms)
+bool DynamixelIO::waitForBytes(ssize_t n_bytes, double timeout_ms)
 {
     struct timespec ts_now;
     clock_gettime(CLOCK_REALTIME, &ts_now);
@@ -1628,7 +1813,7 @@ bool DynamixelIO::waitForBytes(ssize_t n_bytes, uint16_t timeout_ms)
 
         if (current_time_ms - start_time_ms > timeout_ms)
         {
-            //printf("waitForBytes timed out trying to read %zd bytes in less than %dms\n", n_bytes, timeout_ms);
+            //printf("waitForBytes timed out trying to read %zd bytes in less than %.1fms\n", n_bytes, timeout_ms);
             return false;
         }
     }
@@ -1636,81 +1821,278 @@ bool DynamixelIO::waitForBytes(ssize_t n_bytes, uint16_t timeout_ms)
     return true;
 }
 
-bool DynamixelIO::writePacket(const void* const buffer, size_t count)
+double DynamixelIO::getResponseTimeout(int servo_id, size_t response_length)
 {
-    port_->Flush();
-    return (port_->Write(buffer, count) == (ssize_t) count);
+    pthread_mutex_lock(&serial_mutex_);
+    double timeout_ms = responseTimeout(timing_[servo_id], response_length);
+    pthread_mutex_unlock(&serial_mutex_);
+    
+    return timeout_ms;
 }
 
-bool DynamixelIO::readResponse(std::vector<uint8_t>& response)
+bool DynamixelIO::isQuarantined(int servo_id)
 {
-    struct timespec ts_now;
-    clock_gettime(CLOCK_REALTIME, &ts_now);
-    double current_time_sec = ts_now.tv_sec + ts_now.tv_nsec / 1.0e9;
+    pthread_mutex_lock(&serial_mutex_);
+    bool quarantined = timing_[servo_id].quarantined_until_sec > monotonicSec();
+    pthread_mutex_unlock(&serial_mutex_);
     
-    if (current_time_sec - last_reset_sec > 20)
+    return quarantined;
+}
+
+double DynamixelIO::responseTimeout(const ServoTiming& timing, size_t response_length)
+{
+    // nothing to go by until the servo has answered once
+    if (!timing.has_sample) { return MAX_TIMEOUT_MS; }
+    
+    double latency_ms = std::max(timing.srtt_ms + 4 * timing.rttvar_ms, MIN_LATENCY_MS);
+    double timeout_ms = latency_ms + response_length * byte_time_ms_;
+    
+    // back off after each timeout in case the servo got slower
+    for (int i = 0; i < timing.consecutive_timeouts && timeout_ms < MAX_TIMEOUT_MS; ++i)
     {
-        read_count = 0;
-        read_error_count = 0;
-        last_reset_sec = current_time_sec;
+        timeout_ms *= 2;
     }
     
-    ++read_count;
+    return std::min(timeout_ms, MAX_TIMEOUT_MS);
+}
+
+void DynamixelIO::updateTiming(ServoTiming& timing, bool success, double latency_ms)
+{
+    if (success)
+    {
+        if (!timing.has_sample)
+        {
+            timing.srtt_ms = latency_ms;
+            timing.rttvar_ms = latency_ms / 2;
+            timing.has_sample = true;
+        }
+        else
+        {
+            timing.rttvar_ms = 0.75 * timing.rttvar_ms + 0.25 * fabs(timing.srtt_ms - latency_ms);
+            timing.srtt_ms = 0.875 * timing.srtt_ms + 0.125 * latency_ms;
+        }
+        
+        timing.consecutive_timeouts = 0;
+        timing.quarantine_sec = 0.0;
+        timing.quarantined_until_sec = 0.0;
+    }
+    else if (++timing.consecutive_timeouts >= QUARANTINE_AFTER_TIMEOUTS)
+    {
+        // a failed probe doubles the time until the next one
+        timing.quarantine_sec = (timing.quarantine_sec == 0.0) ? MIN_QUARANTINE_SEC
+                                                               : std::min(2 * timing.quarantine_sec, MAX_QUARANTINE_SEC);
+        timing.quarantined_until_sec = monotonicSec() + timing.quarantine_sec;
+    }
+}
+
+bool DynamixelIO::transaction(const uint8_t* packet,
+                              size_t count,
+                              size_t response_length,
+                              std::vector<uint8_t>& response)
+{
+    int servo_id = packet[2];
+    response.clear();
     
-    static const uint16_t timeout_ms = 50;
+    pthread_mutex_lock(&serial_mutex_);
     
-    uint8_t buffer[1024];
-    response.clear();
-
-    // wait until we receive the header bytes and read them
-    if (!waitForBytes(4, timeout_ms) || port_->Read(buffer, 4) != 4)
+    ServoTiming& timing = timing_[servo_id];
+    
+    if (timing.quarantined_until_sec > monotonicSec())
     {
-        ++read_error_count;
+        metrics_.recordTransaction(servo_id, packet[4], TransactionMetrics::QUARANTINED, 0, 0.0);
+        pthread_mutex_unlock(&serial_mutex_);
         return false;
     }
     
-    if (buffer[0] == 0xFF && buffer[1] == 0xFF)
+    double timeout_ms = responseTimeout(timing, response_length);
+    
+    double start_sec = monotonicSec();
+    bool success = writePacket(packet, count);
+    TransactionMetrics::Outcome outcome = TransactionMetrics::WRITE_FAILED;
+    
+    if (success)
     {
-        response.push_back(buffer[0]);  // 0xFF
-        response.push_back(buffer[1]);  // 0xFF
-        response.push_back(buffer[2]);  // ID
-        uint8_t n_bytes = buffer[3];    // Length
-        response.push_back(n_bytes);
+        success = readResponse(response, timeout_ms + count * byte_time_ms_);
         
-        // wait for and read the rest of response bytes
-        if (!waitForBytes(n_bytes, timeout_ms) || port_->Read(buffer, n_bytes) != n_bytes)
+        // latency is whatever the transfer time at this baud rate doesn't explain
+        double elapsed_ms = (monotonicSec() - start_sec) * 1.0e3;
+        double latency_ms = std::max(elapsed_ms - (count + response_length) * byte_time_ms_, 0.0);
+        updateTiming(timing, success, latency_ms);
+        
+        if (!success)                    { outcome = TransactionMetrics::TIMEOUT; }
+        else if (response[4] != 0)       { outcome = TransactionMetrics::SERVO_ERROR; }
+        else                             { outcome = TransactionMetrics::OK; }
+    }
+    
+    metrics_.recordTransaction(servo_id, packet[4], outcome, count, (monotonicSec() - start_sec) * 1.0e6);
+    
+    pthread_mutex_unlock(&serial_mutex_);
+    
+    return success;
+}
+
+bool DynamixelIO::writePacket(const void* const buffer, size_t count)
+{
+    // Whatever arrived before the request can't be its response. Drop it
+    // here rather than flushing the port, so it is counted like any other noise.
+    receiveBytes();
+    discarded_byte_count += rx_buffer_.size();
+    metrics_.recordDiscarded(rx_buffer_.size());
+    rx_buffer_.clear();
+    
+    const uint8_t* bytes = static_cast<const uint8_t*>(buffer);
+    last_request_.assign(bytes, bytes + count);
+    echo_pending_ = (echo_mode_ != ECHO_NONE);
+    
+    return (port_->Write(buffer, count) == (ssize_t) count);
+}
+
+ssize_t DynamixelIO::receiveBytes()
+{
+    ssize_t n_bytes = port_->BytesAvailable();
+    if (n_bytes <= 0) { return 0; }
+    
+    size_t old_size = rx_buffer_.size();
+    rx_buffer_.resize(old_size + n_bytes);
+    
+    ssize_t n_read = port_->Read(&rx_buffer_[old_size], n_bytes);
+    rx_buffer_.resize(old_size + (n_read > 0 ? n_read : 0));
+    if (n_read > 0) { metrics_.recordReceived(n_read); }
+    
+    return n_read;
+}
+
+bool DynamixelIO::parseResponse(std::vector<uint8_t>& response)
+{
+    // Where to start looking next time if no response is found. Stays at the
+    // first incomplete packet, which may still turn out to be the response.
+    size_t keep_from = rx_buffer_.size();
+    size_t start = 0;
+    bool found = false;
+    
+    for (; start + 1 < rx_buffer_.size(); ++start)
+    {
+        // packet: FF  FF  ID LENGTH ERROR PARAM_1 ... CHECKSUM
+        if (rx_buffer_[start] != 0xFF || rx_buffer_[start+1] != 0xFF) { continue; }
+        
+        if (start + 4 > rx_buffer_.size())
         {
-            ++read_error_count;
-            response.clear();
-            return false;
+            keep_from = std::min(keep_from, start);
+            continue;
         }
         
-        for (int i = 0; i < n_bytes; ++i)
+        // 0xFF is not a valid id, error and checksum take at least 2 bytes
+        uint8_t length = rx_buffer_[start+3];
+        if (rx_buffer_[start+2] == 0xFF || length < 2) { continue; }
+        
+        size_t packet_length = 4 + length;
+        if (start + packet_length > rx_buffer_.size())
         {
-            response.push_back(buffer[i]);
+            // either a response still coming in, or noise that looked like a
+            // header; keep looking in case a whole response follows it
+            keep_from = std::min(keep_from, start);
+            continue;
         }
-
-        // verify checksum
-        uint8_t checksum = 0xFF;
+        
         uint32_t sum = 0;
-
-        for (uint32_t i = 2; i < response.size() - 1; ++i)
+        for (size_t i = start + 2; i < start + packet_length - 1; ++i)
+        {
+            sum += rx_buffer_[i];
+        }
+        
+        uint8_t checksum = 0xFF - (sum % 256);
+        
+        // what looked like a header was data or a corrupt packet
+        if (checksum != rx_buffer_[start + packet_length - 1])
+        {
+            metrics_.recordCorruptPacket();
+            continue;
+        }
+        
+        // A response can look just like the request (e.g. a ping answered
+        // with error bits set to 0x01), so a copy of the request is only taken
+        // for an echo once per request, and never if the adapter doesn't echo.
+        // Until that is known, a lone copy is taken for an echo: a phantom
+        // response is worse than a missed one.
+        bool is_echo = echo_pending_ && packet_length == last_request_.size() &&
+                       std::equal(last_request_.begin(), last_request_.end(), rx_buffer_.begin() + start);
+        bool is_ours = last_request_.size() > 2 && rx_buffer_[start+2] == last_request_[2];
+        
+        if (is_echo)
+        {
+            echo_pending_ = false;
+        }
+        else if (is_ours && echo_mode_ == ECHO_UNKNOWN)
+        {
+            // the echo, if any, comes before the response
+            echo_mode_ = echo_pending_ ? ECHO_NONE : ECHO_ALWAYS;
+        }
+        
+        if (is_echo || !is_ours)
         {
-            sum += response[i];
+            // a valid packet, so nothing before its end can be the response
+            start += packet_length - 1;
+            keep_from = rx_buffer_.size();
+            continue;
         }
+        
+        response.assign(rx_buffer_.begin() + start, rx_buffer_.begin() + start + packet_length);
+        keep_from = start + packet_length;
+        found = true;
+        break;
+    }
+    
+    if (!found)
+    {
+        // a trailing 0xFF may be the start of a header
+        if (keep_from == rx_buffer_.size() && !rx_buffer_.empty() && rx_buffer_.back() == 0xFF)
+        {
+            --keep_from;
+        }
+    }
+    
+    discarded_byte_count += keep_from - response.size();
+    metrics_.recordDiscarded(keep_from - response.size());
+    rx_buffer_.erase(rx_buffer_.begin(), rx_buffer_.begin() + keep_from);
+    
+    return found;
+}
 
-        checksum -= sum % 256;
+bool DynamixelIO::readResponse(std::vector<uint8_t>& response, double timeout_ms)
+{
+    struct timespec ts_now;
+    clock_gettime(CLOCK_REALTIME, &ts_now);
+    double current_time_sec = ts_now.tv_sec + ts_now.tv_nsec / 1.0e9;
+    
+    if (current_time_sec - last_reset_sec > 20)
+    {
+        read_count = 0;
+        read_error_count = 0;
+        last_reset_sec = current_time_sec;
+    }
+    
+    ++read_count;
+    
+    double deadline_ms = current_time_sec * 1.0e3 + timeout_ms;
+    
+    response.clear();
+    
+    // keep reading until a whole response is in, skipping over anything else
+    // on the line instead of giving up on the first unexpected byte
+    while (true)
+    {
+        receiveBytes();
+        if (parseResponse(response)) { return true; }
         
-        if (checksum != response.back())
+        clock_gettime(CLOCK_REALTIME, &ts_now);
+        double remaining_ms = deadline_ms - (ts_now.tv_sec * 1.0e3 + ts_now.tv_nsec / 1.0e6);
+        
+        if (remaining_ms <= 0 || !waitForBytes(1, remaining_ms))
         {
             ++read_error_count;
             return false;
         }
-
-        return true;
     }
-
-    return false;
 }
 
 }
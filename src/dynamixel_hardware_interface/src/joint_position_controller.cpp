@@ -82,16 +82,13 @@ bool JointPositionController::initialize(std::string name,
   return true;
 }
 
-bool JointPositionController::processTorqueEnable(dynamixel_hardware_interface::TorqueEnable::Request& req,
-                                                  dynamixel_hardware_interface::TorqueEnable::Request& res)
+void JointPositionController::prepareTorqueEnable()
 {
   // set target position to current joint position
   // so the motor won't go crazy once torque is enabled again
   std_msgs::Float64 position;
   position.data = joint_state_.position;
   processCommand(boost::make_shared<const std_msgs::Float64>(position));
-
-  return SingleJointController::processTorqueEnable(req, res);
 }
 
 std::vector<std::vector<int> > JointPositionController::getRawMotorCommands(double position, double velocity)
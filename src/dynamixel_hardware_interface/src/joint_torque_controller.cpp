@@ -75,11 +75,9 @@ bool JointTorqueController::initialize(std::string name,
     return true;
 }
 
-bool JointTorqueController::processTorqueEnable(dynamixel_hardware_interface::TorqueEnable::Request& req,
-                                                  dynamixel_hardware_interface::TorqueEnable::Request& res)
+void JointTorqueController::prepareTorqueEnable()
 {
     setVelocity(0.0);
-    return SingleJointController::processTorqueEnable(req, res);
 }
 
 std::vector<std::vector<int> > JointTorqueController::getRawMotorCommands(double position, double velocity)
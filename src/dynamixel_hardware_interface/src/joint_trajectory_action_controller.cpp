@@ -428,6 +428,22 @@ void JointTrajectoryActionController::processTrajectory(const trajectory_msgs::J
       continue;
     }
 
+    // Where each joint starts this segment from, and the velocity it is commanded to move at
+    std::vector<double> start_positions(num_joints_);
+    std::vector<double> commanded_velocities(num_joints_);
+
+    for (size_t j = 0; j < num_joints_; ++j)
+    {
+      if (traj_seg != 0)
+      {
+        start_positions[j] = trajectory[traj_seg-1].positions[j];
+      }
+      else
+      {
+        start_positions[j] = joint_states_[joint_names_[j]]->position;
+      }
+    }
+
     // List of every port, and that port's corresponding commands for every motor
     std::map<std::string, std::vector<std::vector<int> > > multi_port_commands;
 
@@ -452,15 +468,7 @@ void JointTrajectoryActionController::processTrajectory(const trajectory_msgs::J
         int joint_idx = joint_to_idx_[*joint_it];
 
         // Get start position of this joint
-        double start_position;
-        if (traj_seg != 0)
-        {
-          start_position = trajectory[traj_seg-1].positions[joint_idx];
-        }
-        else
-        {
-          start_position = joint_states_[*joint_it]->position;
-        }
+        double start_position = start_positions[joint_idx];
 
         // Calculate desired values
         double desired_position = trajectory[traj_seg].positions[joint_idx];
@@ -489,6 +497,8 @@ void JointTrajectoryActionController::processTrajectory(const trajectory_msgs::J
           return;
         }
 
+        commanded_velocities[joint_idx] = desired_velocity;
+
         // Generate raw motor commands
         std::vector<std::vector<int> > joint_motor_commands =
           joint_to_controller_[*joint_it]->getRawMotorCommands(desired_position, desired_velocity);
@@ -521,37 +531,7 @@ void JointTrajectoryActionController::processTrajectory(const trajectory_msgs::J
         traj_result.error_code = control_msgs::FollowJointTrajectoryResult::SUCCESSFUL;
         error_msg = "New trajectory received. Aborting old trajectory.";
 
-        std::map<std::string, std::vector<std::vector<int> > > multi_port_commands;
-
-        std::map<std::string, std::vector<std::string> >::const_iterator port_it;
-        std::vector<std::string>::const_iterator joint_it;
-
-        for (port_it = port_to_joints_.begin(); port_it != port_to_joints_.end(); ++port_it)
-        {
-          std::vector<std::vector<int> > port_motor_commands;
-
-          for (joint_it = port_it->second.begin(); joint_it != port_it->second.end(); ++joint_it)
-          {
-            std::string joint = *joint_it;
-
-            double desired_position = joint_states_[joint]->position;
-            double desired_velocity = joint_states_[joint]->velocity;
-
-            std::vector<std::vector<int> > joint_motor_commands = joint_to_controller_[joint]->getRawMotorCommands(desired_position, desired_velocity);
-            for (size_t i = 0; i < joint_motor_commands.size(); ++i)
-            {
-              port_motor_commands.push_back(joint_motor_commands[i]);
-            }
-
-            multi_port_commands[port_it->first] = port_motor_commands;
-          }
-        }
-
-        std::map<std::string, std::vector<std::vector<int> > >::const_iterator multi_port_commands_it;
-        for (multi_port_commands_it = multi_port_commands.begin(); multi_port_commands_it != multi_port_commands.end(); ++multi_port_commands_it)
-        {
-          port_to_io_[multi_port_commands_it->first]->setMultiPositionVelocity(multi_port_commands_it->second);
-        }
+        holdCurrentPosition();
 
         action_server_->setPreempted(traj_result, error_msg);
         ROS_WARN("%s", error_msg.c_str());
@@ -560,27 +540,51 @@ void JointTrajectoryActionController::processTrajectory(const trajectory_msgs::J
 
       rate.sleep();
       time = ros::Time::now();
-    }
 
-    // -----------------------------------------------------------------------------------------
-    // Verifies trajectory constraints
-    for (size_t j = 0; j < joint_names_.size(); ++j)
-    {
-      if (trajectory_constraints_[j] > 0.0 && feedback_msg_.error.positions[j] > trajectory_constraints_[j])
+      // ---------------------------------------------------------------------------------------
+      // Verifies trajectory constraints against where each joint should be by now. The motors
+      // move at constant velocity from the start of the segment until they reach its end point.
+      double elapsed = time.toSec() - (seg_end_times[traj_seg].toSec() - durations[traj_seg]);
+      if (elapsed < 0.0)
+      {
+        elapsed = 0.0;
+      }
+
+      for (size_t j = 0; j < num_joints_; ++j)
       {
-        traj_result.error_code = control_msgs::FollowJointTrajectoryResult::PATH_TOLERANCE_VIOLATED;
-        error_msg = "Unsatisfied position constraint for " + joint_names_[j] +
-          " trajectory point " + boost::lexical_cast<std::string>(traj_seg) +
-          ", " + boost::lexical_cast<std::string>(feedback_msg_.error.positions[j]) +
-          " is larger than " + boost::lexical_cast<std::string>(trajectory_constraints_[j]);
-        ROS_ERROR("%s", error_msg.c_str());
-        if (is_action)
+        if (trajectory_constraints_[j] <= 0.0)
         {
-          action_server_->setAborted(traj_result, error_msg);
+          continue;
+        }
+
+        double distance = trajectory[traj_seg].positions[j] - start_positions[j];
+        double travelled = std::min<double>(commanded_velocities[j] * elapsed, std::abs(distance));
+        double reference = start_positions[j] + (distance < 0.0 ? -travelled : travelled);
+        double error = joint_states_[joint_names_[j]]->position - reference;
+
+        if (std::abs(error) > trajectory_constraints_[j])
+        {
+          traj_result.error_code = control_msgs::FollowJointTrajectoryResult::PATH_TOLERANCE_VIOLATED;
+          error_msg = "Unsatisfied position constraint for " + joint_names_[j] +
+            " trajectory point " + boost::lexical_cast<std::string>(traj_seg) +
+            ", " + boost::lexical_cast<std::string>(std::abs(error)) +
+            " is larger than " + boost::lexical_cast<std::string>(trajectory_constraints_[j]);
+          ROS_ERROR("%s", error_msg.c_str());
+
+          holdCurrentPosition();
+
+          if (is_action)
+          {
+            action_server_->setAborted(traj_result, error_msg);
+          }
+          return;
         }
-        return;
       }
+    }
 
+    // Save the error at the end of the segment
+    for (size_t j = 0; j < joint_names_.size(); ++j)
+    {
       // Save to file
       if( USE_ERROR_OUTPUT_LOG )
       {
@@ -600,19 +604,37 @@ void JointTrajectoryActionController::processTrajectory(const trajectory_msgs::J
 
   } // end of the main loop
 
-  // let motors roll for specified amount of time
-  ros::Duration(goal_time_constraint_).sleep();
+  // Let the motors roll until they settle within the goal constraints, for at most the goal time
+  ros::Time settle_deadline = ros::Time::now() + ros::Duration(goal_time_constraint_);
+  while (!isSettled(last_segment->positions) && ros::Time::now() < settle_deadline)
+  {
+    if (is_action && action_server_->isPreemptRequested())
+    {
+      traj_result.error_code = control_msgs::FollowJointTrajectoryResult::SUCCESSFUL;
+      error_msg = "New trajectory received. Aborting old trajectory.";
+
+      holdCurrentPosition();
+
+      action_server_->setPreempted(traj_result, error_msg);
+      ROS_WARN("%s", error_msg.c_str());
+      return;
+    }
+
+    rate.sleep();
+  }
 
   // Check if all motors are within their goal constraints
   bool aborted_at_end = false;
   for (size_t i = 0; i < num_joints_; ++i)
   {
-    if (goal_constraints_[i] > 0 && std::abs(feedback_msg_.error.positions[i]) > goal_constraints_[i])
+    double goal_error = joint_states_[joint_names_[i]]->position - last_segment->positions[i];
+
+    if (goal_constraints_[i] > 0 && std::abs(goal_error) > goal_constraints_[i])
     {
       traj_result.error_code = control_msgs::FollowJointTrajectoryResult::GOAL_TOLERANCE_VIOLATED;
       error_msg = "Aborting at end because " + joint_names_[i] +
         " joint wound up outside the goal constraints. The position error " +
-        boost::lexical_cast<std::string>(fabs(feedback_msg_.error.positions[i])) +
+        boost::lexical_cast<std::string>(std::abs(goal_error)) +
         " is larger than the goal constraints " + boost::lexical_cast<std::string>(goal_constraints_[i]);
       ROS_ERROR("%s", error_msg.c_str());
       if (is_action)
@@ -626,9 +648,9 @@ void JointTrajectoryActionController::processTrajectory(const trajectory_msgs::J
     if( USE_ERROR_OUTPUT_LOG )
     {
       if(!i) // no comma before first item
-        error_log_string = boost::lexical_cast<std::string>(feedback_msg_.error.positions[i]);
+        error_log_string = boost::lexical_cast<std::string>(goal_error);
       else
-        error_log_string += "," + boost::lexical_cast<std::string>(feedback_msg_.error.positions[i]);
+        error_log_string += "," + boost::lexical_cast<std::string>(goal_error);
     }
 
   }
@@ -656,6 +678,61 @@ void JointTrajectoryActionController::processTrajectory(const trajectory_msgs::J
 }
 
 
+void JointTrajectoryActionController::holdCurrentPosition()
+{
+  std::map<std::string, std::vector<std::vector<int> > > multi_port_commands;
+
+  std::map<std::string, std::vector<std::string> >::const_iterator port_it;
+  std::vector<std::string>::const_iterator joint_it;
+
+  for (port_it = port_to_joints_.begin(); port_it != port_to_joints_.end(); ++port_it)
+  {
+    std::vector<std::vector<int> > port_motor_commands;
+
+    for (joint_it = port_it->second.begin(); joint_it != port_it->second.end(); ++joint_it)
+    {
+      std::string joint = *joint_it;
+
+      double desired_position = joint_states_[joint]->position;
+      double desired_velocity = joint_states_[joint]->velocity;
+
+      std::vector<std::vector<int> > joint_motor_commands = joint_to_controller_[joint]->getRawMotorCommands(desired_position, desired_velocity);
+      for (size_t i = 0; i < joint_motor_commands.size(); ++i)
+      {
+        port_motor_commands.push_back(joint_motor_commands[i]);
+      }
+
+      multi_port_commands[port_it->first] = port_motor_commands;
+    }
+  }
+
+  std::map<std::string, std::vector<std::vector<int> > >::const_iterator multi_port_commands_it;
+  for (multi_port_commands_it = multi_port_commands.begin(); multi_port_commands_it != multi_port_commands.end(); ++multi_port_commands_it)
+  {
+    port_to_io_[multi_port_commands_it->first]->setMultiPositionVelocity(multi_port_commands_it->second);
+  }
+}
+
+bool JointTrajectoryActionController::isSettled(const std::vector<double>& goal_positions)
+{
+  for (size_t j = 0; j < num_joints_; ++j)
+  {
+    const dynamixel_hardware_interface::JointState* state = joint_states_[joint_names_[j]];
+
+    if (goal_constraints_[j] > 0.0 && std::abs(state->position - goal_positions[j]) > goal_constraints_[j])
+    {
+      return false;
+    }
+
+    if (std::abs(state->velocity) > stopped_velocity_tolerance_)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 void JointTrajectoryActionController::getUniqueErrorLogPath(std::string &error_log_path)
 {
   // Get the location of the dynamixel package within ros
@@ -19,6 +19,7 @@
 #include <dynamixel_hardware_interface/serial_proxy.h>
 #include <dynamixel_hardware_interface/MotorState.h>
 #include <dynamixel_hardware_interface/MotorStateList.h>
+#include <dynamixel_hardware_interface/BusMetrics.h>
 
 #include <ros/ros.h>
 #include <diagnostic_updater/DiagnosticStatusWrapper.h>
@@ -51,6 +52,7 @@ SerialProxy::SerialProxy(std::string port_name,
   current_state_ = MotorStateListPtr(new MotorStateList);
 
   motor_states_pub_ = nh_.advertise<MotorStateList>("motor_states/" + port_namespace_, 1000);
+  bus_metrics_pub_ = nh_.advertise<BusMetrics>("bus_metrics/" + port_namespace_, 10);
   diagnostics_pub_ = nh_.advertise<diagnostic_msgs::DiagnosticArray>("/diagnostics", 1000);
 }
 
@@ -121,14 +123,11 @@ DynamixelIO* SerialProxy::getSerialPort()
   return dxl_io_;
 }
 
-void SerialProxy::fillMotorParameters(const DynamixelData* motor_data)
+void SerialProxy::fillMotorParameters(const DynamixelData* motor_data, float voltage)
 {
   int motor_id = motor_data->id;
   int model_number = motor_data->model_number;
 
-  float voltage;
-  dxl_io_->getVoltage(motor_id, voltage);
-
   std::stringstream ss;
   ss << "dynamixel/" << port_namespace_ << "/" << motor_id << "/";
   std::string prefix = ss.str();
@@ -173,7 +172,12 @@ bool SerialProxy::findMotors()
     {
       const DynamixelData* motor_data;
 
-      if ((motor_data = dxl_io_->getCachedParameters(motor_id)) == NULL)
+      // read the voltage along with the parameters, in the same transaction
+      uint8_t voltage;
+      DynamixelReadBatch batch;
+      batch.addByte(motor_id, DXL_PRESENT_VOLTAGE, &voltage);
+
+      if ((motor_data = dxl_io_->getCachedParameters(motor_id, batch)) == NULL)
       {
         ROS_ERROR("Unable to retrieve cached paramaters for motor %d on port %s after successfull ping", motor_id, port_namespace_.c_str());
         continue;
@@ -181,7 +185,7 @@ bool SerialProxy::findMotors()
 
       counts[motor_data->model_number] += 1;
       motor_static_info_[motor_id] = motor_data;
-      fillMotorParameters(motor_data);
+      fillMotorParameters(motor_data, voltage / 10.0);
 
       motors_.push_back(motor_id);
       val[motors_.size()-1] = motor_id;
@@ -295,11 +299,50 @@ void SerialProxy::updateMotorStates()
   }
 }
 
+void SerialProxy::publishBusMetrics(const BusMetricsSnapshot& metrics, const BusMetricsSnapshot& last_metrics)
+{
+  BusMetrics msg;
+
+  msg.timestamp = metrics.timestamp;
+  msg.transactions = metrics.bus.total();
+  msg.servo_errors = metrics.bus.outcomes[TransactionMetrics::SERVO_ERROR];
+  msg.timeouts = metrics.bus.outcomes[TransactionMetrics::TIMEOUT];
+  msg.write_failures = metrics.bus.outcomes[TransactionMetrics::WRITE_FAILED];
+  msg.quarantined = metrics.bus.outcomes[TransactionMetrics::QUARANTINED];
+  msg.tx_bytes = metrics.tx_bytes;
+  msg.rx_bytes = metrics.rx_bytes;
+  msg.discarded_bytes = metrics.discarded_bytes;
+  msg.corrupt_packets = metrics.corrupt_packets;
+  msg.utilization = metrics.utilization(last_metrics);
+  msg.occupancy = metrics.occupancy(last_metrics);
+  msg.rtt_p50 = metrics.bus.rtt.percentile(0.5);
+  msg.rtt_p99 = metrics.bus.rtt.percentile(0.99);
+  msg.rtt_max = metrics.bus.rtt.max();
+
+  std::map<int, TransactionMetrics>::const_iterator it;
+  for (it = metrics.servos.begin(); it != metrics.servos.end(); ++it)
+  {
+    ServoMetrics servo;
+    servo.id = it->first;
+    servo.transactions = it->second.total();
+    servo.servo_errors = it->second.outcomes[TransactionMetrics::SERVO_ERROR];
+    servo.timeouts = it->second.outcomes[TransactionMetrics::TIMEOUT];
+    servo.quarantined = it->second.outcomes[TransactionMetrics::QUARANTINED];
+    servo.rtt_p50 = it->second.rtt.percentile(0.5);
+    servo.rtt_p99 = it->second.rtt.percentile(0.99);
+    servo.rtt_max = it->second.rtt.max();
+    msg.servos.push_back(servo);
+  }
+
+  bus_metrics_pub_.publish(msg);
+}
+
 void SerialProxy::publishDiagnosticInformation()
 {
   diagnostic_msgs::DiagnosticArray diag_msg;
   diagnostic_updater::DiagnosticStatusWrapper bus_status;
   ros::Rate rate(diagnostics_rate_);
+  BusMetricsSnapshot last_metrics = dxl_io_->getMetrics();
 
   while (nh_.ok())
   {
@@ -310,6 +353,11 @@ void SerialProxy::publishDiagnosticInformation()
 
     double error_rate = dxl_io_->read_error_count / (double) dxl_io_->read_count;
 
+    BusMetricsSnapshot metrics = dxl_io_->getMetrics();
+    double utilization = metrics.utilization(last_metrics);
+    publishBusMetrics(metrics, last_metrics);
+    last_metrics = metrics;
+
     bus_status.clear();
     bus_status.name = "Dynamixel Serial Bus (" + port_namespace_ + ")";
     bus_status.hardware_id = "Dynamixel Serial Bus on port " + port_name_;
@@ -317,6 +365,11 @@ void SerialProxy::publishDiagnosticInformation()
     bus_status.add("Min Motor ID", min_motor_id_);
     bus_status.add("Max Motor ID", max_motor_id_);
     bus_status.addf("Error Rate", "%0.5f", error_rate);
+    bus_status.addf("Utilization", "%0.1f%%", utilization * 100.0);
+    bus_status.addf("Round Trip Time (p50/p99/max)", "%u/%u/%u us",
+                    metrics.bus.rtt.percentile(0.5), metrics.bus.rtt.percentile(0.99), metrics.bus.rtt.max());
+    bus_status.addf("Timeouts", "%llu", (unsigned long long) metrics.bus.outcomes[TransactionMetrics::TIMEOUT]);
+    bus_status.addf("Corrupt Packets", "%llu", (unsigned long long) metrics.corrupt_packets);
     bus_status.summary(bus_status.OK, "OK");
 
     freq_status_.run(bus_status);
@@ -371,6 +424,10 @@ void SerialProxy::publishDiagnosticInformation()
       motor_status.addf("Voltage", "%0.1f", motor_state.voltage / 10.0);
       motor_status.addf("Temperature", "%d", motor_state.temperature);
 
+      const TransactionMetrics& motor_metrics = metrics.servos[motor_id];
+      motor_status.addf("Round Trip Time (p99)", "%u us", motor_metrics.rtt.percentile(0.99));
+      motor_status.addf("Timeouts", "%llu", (unsigned long long) motor_metrics.outcomes[TransactionMetrics::TIMEOUT]);
+
       motor_status.summary(motor_status.OK, "OK");
 
       if (motor_state.temperature >= error_level_temp_)
@@ -0,0 +1,477 @@
+// Tests DynamixelIO against a simulated bus which echoes requests, adds line
+// noise and corrupts responses, the way cheap half-duplex adapters do.
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <deque>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <clam/gearbox/flexiport/port.h>
+
+#include <dynamixel_hardware_interface/dynamixel_const.h>
+#include <dynamixel_hardware_interface/dynamixel_io.h>
+
+using namespace dynamixel_hardware_interface;
+
+namespace
+{
+
+uint8_t checksum(const std::vector<uint8_t>& packet)
+{
+    uint32_t sum = 0;
+    for (size_t i = 2; i < packet.size(); ++i) { sum += packet[i]; }
+    return 0xFF - (sum % 256);
+}
+
+// A single motor on a bus full of faults. Every response can be preceded by
+// an echo of the request, some noise, and a corrupt copy of itself.
+class FaultyPort : public flexiport::Port
+{
+public:
+    FaultyPort(uint8_t servo_id)
+        : echo(false),
+          corrupt_first(false),
+          stale_response(false),
+          silent(false),
+          error_bits(0),
+          writes(0),
+          servo_id_(servo_id),
+          open_(true)
+    {
+        memset(control_table_, 0, sizeof(control_table_));
+        control_table_[DXL_ID] = servo_id;
+    }
+
+    bool echo;
+    bool corrupt_first;
+    bool stale_response;
+    bool silent;
+    uint8_t error_bits;
+    int writes;
+    std::vector<uint8_t> noise;
+
+    void setRegister(int address, uint8_t value) { control_table_[address] = value; }
+
+    void Open() { open_ = true; }
+    void Close() { open_ = false; }
+    bool IsOpen() const { return open_; }
+
+    ssize_t Read(void* const buffer, size_t count)
+    {
+        size_t n = std::min(count, rx_.size());
+        for (size_t i = 0; i < n; ++i)
+        {
+            static_cast<uint8_t*>(buffer)[i] = rx_.front();
+            rx_.pop_front();
+        }
+        return n;
+    }
+
+    ssize_t ReadFull(void* const buffer, size_t count) { return Read(buffer, count); }
+    ssize_t BytesAvailable() { return rx_.size(); }
+    ssize_t BytesAvailableWait() { return rx_.size(); }
+
+    ssize_t Write(const void* const buffer, size_t count)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(buffer);
+        std::vector<uint8_t> request(bytes, bytes + count);
+        ++writes;
+
+        if (echo) { queue(request); }
+        queue(noise);
+
+        if (silent || request[2] != servo_id_) { return count; }
+
+        std::vector<uint8_t> params;
+        if (request[4] == DXL_READ_DATA)
+        {
+            params.assign(control_table_ + request[5], control_table_ + request[5] + request[6]);
+        }
+        else if (request[4] == DXL_WRITE_DATA)
+        {
+            std::copy(request.begin() + 6, request.end() - 1, control_table_ + request[5]);
+        }
+
+        std::vector<uint8_t> response;
+        response.push_back(0xFF);
+        response.push_back(0xFF);
+        response.push_back(servo_id_);
+        response.push_back(params.size() + 2);
+        response.push_back(error_bits);
+        response.insert(response.end(), params.begin(), params.end());
+        response.push_back(checksum(response));
+
+        if (stale_response)
+        {
+            // a late answer from another motor to an earlier request
+            std::vector<uint8_t> stale(response);
+            stale[2] = servo_id_ + 1;
+            stale.back() = checksum(std::vector<uint8_t>(stale.begin(), stale.end() - 1));
+            queue(stale);
+        }
+
+        if (corrupt_first)
+        {
+            std::vector<uint8_t> corrupt(response);
+            corrupt[corrupt.size() - 2] ^= 0x10;
+            queue(corrupt);
+        }
+
+        queue(response);
+        return count;
+    }
+
+    void Flush() { rx_.clear(); }
+    void Drain() {}
+    void SetTimeout(flexiport::Timeout timeout) { _timeout = timeout; }
+    void SetCanRead(bool canRead) { _canRead = canRead; }
+    void SetCanWrite(bool canWrite) { _canWrite = canWrite; }
+
+private:
+    void CheckPort(bool read) {}
+
+    void queue(const std::vector<uint8_t>& bytes) { rx_.insert(rx_.end(), bytes.begin(), bytes.end()); }
+
+    uint8_t servo_id_;
+    bool open_;
+    uint8_t control_table_[DXL_PUNCH_H + 1];
+    std::deque<uint8_t> rx_;
+};
+
+class DynamixelIOTest : public ::testing::Test
+{
+protected:
+    DynamixelIOTest()
+        : port(new FaultyPort(1)),
+          dxl_io(port)
+    {
+        port->setRegister(DXL_PRESENT_POSITION_L, 0x34);
+        port->setRegister(DXL_PRESENT_POSITION_H, 0x02);
+    }
+
+    FaultyPort* port;
+    DynamixelIO dxl_io;
+};
+
+}
+
+TEST_F(DynamixelIOTest, cleanBus)
+{
+    uint16_t position = 0;
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+    EXPECT_EQ(0x0234, position);
+    EXPECT_EQ(0u, dxl_io.read_error_count);
+    EXPECT_EQ(0u, dxl_io.discarded_byte_count);
+}
+
+TEST_F(DynamixelIOTest, skipsEcho)
+{
+    port->echo = true;
+
+    uint16_t position = 0;
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+    EXPECT_EQ(0x0234, position);
+    EXPECT_TRUE(dxl_io.ping(1));
+    EXPECT_EQ(0u, dxl_io.read_error_count);
+}
+
+TEST_F(DynamixelIOTest, pingResponseLikeRequestWithoutEcho)
+{
+    // an input voltage error makes the ping response byte for byte the same
+    // as the ping, which must not be taken for an echo on this adapter
+    uint16_t position = 0;
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+    
+    port->error_bits = DXL_INPUT_VOLTAGE_ERROR;
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(dxl_io.ping(1));
+    }
+    EXPECT_EQ(0u, dxl_io.read_error_count);
+    EXPECT_EQ(0u, dxl_io.discarded_byte_count);
+}
+
+TEST_F(DynamixelIOTest, pingResponseLikeRequestWithEcho)
+{
+    port->echo = true;
+    port->error_bits = DXL_INPUT_VOLTAGE_ERROR;
+    
+    // the first copy is the echo, the second the response, every time
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_TRUE(dxl_io.ping(1));
+    }
+    EXPECT_EQ(0u, dxl_io.read_error_count);
+    
+    uint16_t position = 0;
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+    EXPECT_EQ(0x0234, position);
+}
+
+TEST_F(DynamixelIOTest, resyncsAfterNoise)
+{
+    // stray bytes, including partial headers
+    uint8_t noise[] = { 0x00, 0xFF, 0x13, 0xFF, 0xFF, 0xFF, 0x01, 0xFF };
+    port->noise.assign(noise, noise + sizeof(noise));
+
+    for (int i = 0; i < 10; ++i)
+    {
+        uint16_t position = 0;
+        ASSERT_TRUE(dxl_io.getPosition(1, position));
+        EXPECT_EQ(0x0234, position);
+    }
+
+    EXPECT_EQ(0u, dxl_io.read_error_count);
+    EXPECT_EQ(10 * sizeof(noise), dxl_io.discarded_byte_count);
+}
+
+TEST_F(DynamixelIOTest, skipsCorruptAndStalePackets)
+{
+    port->echo = true;
+    port->corrupt_first = true;
+    port->stale_response = true;
+
+    uint16_t position = 0;
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+    EXPECT_EQ(0x0234, position);
+
+    EXPECT_TRUE(dxl_io.setPosition(1, 100));
+    ASSERT_TRUE(dxl_io.getTargetPosition(1, position));
+    EXPECT_EQ(100, position);
+    EXPECT_EQ(0u, dxl_io.read_error_count);
+}
+
+TEST_F(DynamixelIOTest, recoversAfterTimeout)
+{
+    port->silent = true;
+
+    uint16_t position = 0;
+    EXPECT_FALSE(dxl_io.getPosition(1, position));
+    EXPECT_EQ(1u, dxl_io.read_error_count);
+
+    // left over noise must not break the next transaction
+    uint8_t noise[] = { 0xFF, 0xFF, 0x01 };
+    port->noise.assign(noise, noise + sizeof(noise));
+    port->silent = false;
+
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+    EXPECT_EQ(0x0234, position);
+}
+
+TEST_F(DynamixelIOTest, timeoutAdaptsToServo)
+{
+    EXPECT_DOUBLE_EQ(50.0, dxl_io.getResponseTimeout(1, 8));
+
+    uint16_t position = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(dxl_io.getPosition(1, position));
+    }
+
+    // the simulated servo answers at once, so only the floor is left
+    EXPECT_LT(dxl_io.getResponseTimeout(1, 8), 5.0);
+    EXPECT_GE(dxl_io.getResponseTimeout(1, 8), 2.0);
+}
+
+TEST_F(DynamixelIOTest, silentServoIsQuarantined)
+{
+    uint16_t position = 0;
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+
+    port->silent = true;
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_FALSE(dxl_io.getPosition(1, position));
+    }
+    EXPECT_TRUE(dxl_io.isQuarantined(1));
+
+    // requests fail straight away without going on the bus
+    int writes = port->writes;
+    EXPECT_FALSE(dxl_io.getPosition(1, position));
+    EXPECT_EQ(writes, port->writes);
+
+    // the servo is probed again once the quarantine is over
+    port->silent = false;
+    struct timespec wait = { 0, 600000000 };
+    nanosleep(&wait, NULL);
+
+    EXPECT_FALSE(dxl_io.isQuarantined(1));
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+    EXPECT_EQ(0x0234, position);
+}
+
+TEST_F(DynamixelIOTest, failedProbeBacksOff)
+{
+    uint16_t position = 0;
+    port->silent = true;
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_FALSE(dxl_io.getPosition(1, position));
+    }
+
+    struct timespec wait = { 0, 600000000 };
+    nanosleep(&wait, NULL);
+
+    // the probe fails, the next one is a second away
+    EXPECT_FALSE(dxl_io.getPosition(1, position));
+    nanosleep(&wait, NULL);
+    EXPECT_TRUE(dxl_io.isQuarantined(1));
+}
+
+TEST(DynamixelReadBatch, mergesNearbyRegisters)
+{
+    uint8_t byte_value;
+    uint16_t word_value;
+    DynamixelReadBatch batch;
+
+    batch.addWord(2, DXL_PRESENT_POSITION_L, &word_value);
+    batch.addByte(1, DXL_PRESENT_TEMPERATURE, &byte_value);
+    batch.addWord(1, DXL_CW_ANGLE_LIMIT_L, &word_value);
+    batch.addByte(1, DXL_PRESENT_VOLTAGE, &byte_value);
+    batch.addWord(1, DXL_CCW_ANGLE_LIMIT_L, &word_value);
+    batch.addByte(1, DXL_DOWN_LIMIT_VOLTAGE, &byte_value);
+
+    std::vector<DynamixelReadBatch::Range> ranges = batch.getRanges();
+    ASSERT_EQ(3u, ranges.size());
+
+    // angle and voltage limits are close, present voltage and temperature too
+    EXPECT_EQ(1, ranges[0].servo_id);
+    EXPECT_EQ(DXL_CW_ANGLE_LIMIT_L, ranges[0].address);
+    EXPECT_EQ(DXL_DOWN_LIMIT_VOLTAGE + 1 - DXL_CW_ANGLE_LIMIT_L, ranges[0].size);
+    EXPECT_EQ(1, ranges[1].servo_id);
+    EXPECT_EQ(DXL_PRESENT_VOLTAGE, ranges[1].address);
+    EXPECT_EQ(2, ranges[1].size);
+    EXPECT_EQ(2, ranges[2].servo_id);
+    EXPECT_EQ(DXL_PRESENT_POSITION_L, ranges[2].address);
+    EXPECT_EQ(2, ranges[2].size);
+}
+
+TEST_F(DynamixelIOTest, readBatchScattersResults)
+{
+    port->setRegister(DXL_CW_ANGLE_LIMIT_L, 0x10);
+    port->setRegister(DXL_CCW_ANGLE_LIMIT_L, 0xFF);
+    port->setRegister(DXL_CCW_ANGLE_LIMIT_H, 0x03);
+    port->setRegister(DXL_TORQUE_ENABLE, 1);
+    port->setRegister(DXL_PRESENT_SPEED_L, 0x20);
+    port->setRegister(DXL_PRESENT_SPEED_H, 0x04);
+    port->setRegister(DXL_PRESENT_VOLTAGE, 120);
+
+    uint16_t cw_angle = 0, ccw_angle = 0, position = 0;
+    int16_t velocity = 0;
+    bool torque_enabled = false;
+    uint8_t voltage = 0;
+
+    DynamixelReadBatch batch;
+    batch.addWord(1, DXL_CW_ANGLE_LIMIT_L, &cw_angle);
+    batch.addWord(1, DXL_CCW_ANGLE_LIMIT_L, &ccw_angle);
+    batch.addFlag(1, DXL_TORQUE_ENABLE, &torque_enabled);
+    batch.addWord(1, DXL_PRESENT_POSITION_L, &position);
+    batch.addSignedWord(1, DXL_PRESENT_SPEED_L, &velocity);
+    batch.addByte(1, DXL_PRESENT_VOLTAGE, &voltage);
+
+    // angle limits, torque enable, and position to voltage
+    int writes = port->writes;
+    ASSERT_TRUE(dxl_io.readBatch(batch));
+    EXPECT_EQ(writes + 3, port->writes);
+
+    EXPECT_EQ(0x10, cw_angle);
+    EXPECT_EQ(0x3FF, ccw_angle);
+    EXPECT_TRUE(torque_enabled);
+    EXPECT_EQ(0x0234, position);
+    EXPECT_EQ(-0x20, velocity);
+    EXPECT_EQ(120, voltage);
+}
+
+TEST_F(DynamixelIOTest, cachedParametersWithExtraFields)
+{
+    port->setRegister(DXL_MODEL_NUMBER_L, 12);
+    port->setRegister(DXL_PRESENT_VOLTAGE, 120);
+
+    uint8_t voltage = 0;
+    DynamixelReadBatch batch;
+    batch.addByte(1, DXL_PRESENT_VOLTAGE, &voltage);
+
+    int writes = port->writes;
+    const DynamixelData* data = dxl_io.getCachedParameters(1, batch);
+    ASSERT_TRUE(data != NULL);
+    EXPECT_EQ(writes + 1, port->writes);
+
+    EXPECT_EQ(12, data->model_number);
+    EXPECT_EQ(1, data->id);
+    EXPECT_EQ(120, voltage);
+}
+
+TEST(LatencyHistogram, logLinearBuckets)
+{
+    // one bucket per microsecond up to 4, then four per power of two
+    EXPECT_EQ(0, LatencyHistogram::bucketIndex(0));
+    EXPECT_EQ(3, LatencyHistogram::bucketIndex(3));
+    EXPECT_EQ(4, LatencyHistogram::bucketIndex(4));
+    EXPECT_EQ(8, LatencyHistogram::bucketIndex(8));
+    EXPECT_EQ(8, LatencyHistogram::bucketIndex(9));
+    EXPECT_EQ(LatencyHistogram::NUM_BUCKETS - 1, LatencyHistogram::bucketIndex(0xFFFFFFFF));
+
+    for (uint32_t us = 1; us < 100000; us = us * 3 / 2 + 1)
+    {
+        int index = LatencyHistogram::bucketIndex(us);
+        EXPECT_LT(us, LatencyHistogram::bucketUpperBound(index));
+        EXPECT_LE(LatencyHistogram::bucketUpperBound(index), us * 1.25 + 1.0);
+        if (index > 0) { EXPECT_GE(us, LatencyHistogram::bucketUpperBound(index - 1)); }
+    }
+
+    LatencyHistogram histogram;
+    for (int i = 0; i < 99; ++i) { histogram.record(100); }
+    histogram.record(5000);
+
+    EXPECT_EQ(100u, histogram.count());
+    EXPECT_EQ(5000u, histogram.max());
+    EXPECT_EQ(112u, histogram.percentile(0.5));
+    EXPECT_EQ(112u, histogram.percentile(0.99));
+    EXPECT_EQ(5000u, histogram.percentile(1.0));
+}
+
+TEST_F(DynamixelIOTest, metricsCountTransactions)
+{
+    uint16_t position = 0;
+    ASSERT_TRUE(dxl_io.ping(1));
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+    ASSERT_TRUE(dxl_io.setPosition(1, 100));
+
+    port->corrupt_first = true;
+    ASSERT_TRUE(dxl_io.getPosition(1, position));
+
+    port->silent = true;
+    EXPECT_FALSE(dxl_io.getPosition(1, position));
+    EXPECT_FALSE(dxl_io.getPosition(2, position));
+
+    BusMetricsSnapshot metrics = dxl_io.getMetrics();
+
+    // ping also refreshes the cached parameters
+    EXPECT_EQ(7u, metrics.bus.total());
+    EXPECT_EQ(1u, metrics.bus.transactions[TransactionMetrics::PING]);
+    EXPECT_EQ(5u, metrics.bus.transactions[TransactionMetrics::READ]);
+    EXPECT_EQ(1u, metrics.bus.transactions[TransactionMetrics::WRITE]);
+    EXPECT_EQ(5u, metrics.bus.outcomes[TransactionMetrics::OK]);
+    EXPECT_EQ(2u, metrics.bus.outcomes[TransactionMetrics::TIMEOUT]);
+    EXPECT_EQ(5u, metrics.bus.rtt.count());
+    EXPECT_EQ(1u, metrics.corrupt_packets);
+    EXPECT_GT(metrics.tx_bytes, 0u);
+    EXPECT_GT(metrics.rx_bytes, 0u);
+    EXPECT_GT(metrics.wire_sec, 0.0);
+
+    ASSERT_EQ(2u, metrics.servos.size());
+    EXPECT_EQ(6u, metrics.servos[1].total());
+    EXPECT_EQ(1u, metrics.servos[1].outcomes[TransactionMetrics::TIMEOUT]);
+    EXPECT_EQ(1u, metrics.servos[2].total());
+    EXPECT_EQ(0u, metrics.servos[2].rtt.count());
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,541 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#include "scanfilter.h"
+
+#include <gbxutilacfr/exceptions.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace gbxscanacfr {
+
+namespace {
+
+// Hokuyo ranges below this are error codes
+const int32_t HOKUYO_MIN_RANGE_MM = 20;
+
+const uint32_t KEEP = 0xFFFFFFFF;
+
+//
+// Input adaptors for the first stage: range in metres, plus whatever the format
+// itself says is an error
+//
+
+class MillimetreInput
+{
+public:
+    MillimetreInput( const uint32_t* ranges ) : ranges_(ranges) {}
+
+    float range( unsigned int i ) const { return (float)(int32_t)ranges_[i] * 0.001f; }
+    bool ok( unsigned int i ) const { return (int32_t)ranges_[i] >= HOKUYO_MIN_RANGE_MM; }
+
+#ifdef __SSE2__
+    void load( unsigned int i, __m128& range, __m128& ok ) const
+    {
+        __m128i r = _mm_loadu_si128( (const __m128i*)(ranges_ + i) );
+        range = _mm_mul_ps( _mm_cvtepi32_ps( r ), _mm_set1_ps( 0.001f ) );
+        // signed, like the scalar path
+        ok = _mm_castsi128_ps( _mm_cmpgt_epi32( r, _mm_set1_epi32( HOKUYO_MIN_RANGE_MM - 1 ) ) );
+    }
+#endif
+
+private:
+    const uint32_t* ranges_;
+};
+
+class MetreInput
+{
+public:
+    MetreInput( const float* ranges ) : ranges_(ranges) {}
+
+    float range( unsigned int i ) const { return ranges_[i]; }
+    bool ok( unsigned int ) const { return true; }
+
+#ifdef __SSE2__
+    void load( unsigned int i, __m128& range, __m128& ok ) const
+    {
+        range = _mm_loadu_ps( ranges_ + i );
+        ok = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+    }
+#endif
+
+private:
+    const float* ranges_;
+};
+
+class NoIntensities
+{
+public:
+    float intensity( unsigned int ) const { return numeric_limits<float>::infinity(); }
+#ifdef __SSE2__
+    __m128 load( unsigned int ) const { return _mm_set1_ps( numeric_limits<float>::infinity() ); }
+#endif
+};
+
+class Uint32Intensities
+{
+public:
+    Uint32Intensities( const uint32_t* intensities ) : intensities_(intensities) {}
+
+    float intensity( unsigned int i ) const { return (float)(int32_t)intensities_[i]; }
+#ifdef __SSE2__
+    __m128 load( unsigned int i ) const
+    { return _mm_cvtepi32_ps( _mm_loadu_si128( (const __m128i*)(intensities_ + i) ) ); }
+#endif
+
+private:
+    const uint32_t* intensities_;
+};
+
+class ByteIntensities
+{
+public:
+    ByteIntensities( const unsigned char* intensities ) : intensities_(intensities) {}
+
+    float intensity( unsigned int i ) const { return (float)intensities_[i]; }
+#ifdef __SSE2__
+    __m128 load( unsigned int i ) const
+    {
+        int32_t four;
+        memcpy( &four, intensities_ + i, 4 );
+        __m128i zero = _mm_setzero_si128();
+        __m128i wide = _mm_unpacklo_epi16( _mm_unpacklo_epi8( _mm_cvtsi32_si128( four ), zero ), zero );
+        return _mm_cvtepi32_ps( wide );
+    }
+#endif
+
+private:
+    const unsigned char* intensities_;
+};
+
+//
+// Outputs for the last stage
+//
+
+class MillimetreOutput
+{
+public:
+    MillimetreOutput( uint32_t* ranges, uint32_t* intensities, float rejectedRange ) :
+        ranges_(ranges), intensities_(intensities),
+        rejected_((uint32_t)( rejectedRange * 1000.0f + 0.5f )) {}
+
+    void store( unsigned int i, float range, bool keep )
+    {
+        ranges_[i] = keep ? (uint32_t)( range * 1000.0f + 0.5f ) : rejected_;
+        if ( intensities_ && !keep )
+            intensities_[i] = 0;
+    }
+
+#ifdef __SSE2__
+    void store( unsigned int i, __m128 range, __m128 keep )
+    {
+        __m128i mm = _mm_cvttps_epi32( _mm_add_ps( _mm_mul_ps( range, _mm_set1_ps( 1000.0f ) ), _mm_set1_ps( 0.5f ) ) );
+        __m128i k = _mm_castps_si128( keep );
+        mm = _mm_or_si128( _mm_and_si128( k, mm ), _mm_andnot_si128( k, _mm_set1_epi32( rejected_ ) ) );
+        _mm_storeu_si128( (__m128i*)(ranges_ + i), mm );
+        if ( intensities_ )
+        {
+            __m128i in = _mm_loadu_si128( (const __m128i*)(intensities_ + i) );
+            _mm_storeu_si128( (__m128i*)(intensities_ + i), _mm_and_si128( in, k ) );
+        }
+    }
+#endif
+
+private:
+    uint32_t* ranges_;
+    uint32_t* intensities_;
+    uint32_t rejected_;
+};
+
+class MetreOutput
+{
+public:
+    MetreOutput( float* ranges, unsigned char* intensities, float rejectedRange ) :
+        ranges_(ranges), intensities_(intensities), rejected_(rejectedRange) {}
+
+    void store( unsigned int i, float range, bool keep )
+    {
+        ranges_[i] = keep ? range : rejected_;
+        if ( intensities_ && !keep )
+            intensities_[i] = 0;
+    }
+
+#ifdef __SSE2__
+    void store( unsigned int i, __m128 range, __m128 keep )
+    {
+        __m128 out = _mm_or_ps( _mm_and_ps( keep, range ), _mm_andnot_ps( keep, _mm_set1_ps( rejected_ ) ) );
+        _mm_storeu_ps( ranges_ + i, out );
+        if ( intensities_ )
+        {
+            int bits = _mm_movemask_ps( keep );
+            for ( int k = 0; k < 4; ++k )
+                if ( !( bits & ( 1 << k ) ) )
+                    intensities_[i+k] = 0;
+        }
+    }
+#endif
+
+private:
+    float* ranges_;
+    unsigned char* intensities_;
+    float rejected_;
+};
+
+#ifdef __SSE2__
+const unsigned int BIT_COUNT[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+inline __m128
+select( __m128 mask, __m128 a, __m128 b )
+{ return _mm_or_ps( _mm_and_ps( mask, a ), _mm_andnot_ps( mask, b ) ); }
+
+inline __m128
+medianOf3( __m128 a, __m128 b, __m128 c )
+{ return _mm_max_ps( _mm_min_ps( a, b ), _mm_min_ps( _mm_max_ps( a, b ), c ) ); }
+
+inline __m128
+loadKeep( const uint32_t* keep )
+{ return _mm_castsi128_ps( _mm_loadu_si128( (const __m128i*)keep ) ); }
+#endif
+
+inline float
+medianOf3( float a, float b, float c )
+{ return max( min( a, b ), min( max( a, b ), c ) ); }
+
+}
+
+//////////////////////////////////////////////////////////////////////
+
+ScanFilterConfig::ScanFilterConfig() :
+    minRange(0.02),
+    maxRange(numeric_limits<double>::infinity()),
+    minIntensity(0.0),
+    medianWindow(0),
+    shadowAngle(0.0),
+    shadowWindow(1),
+    rejectedRange(0.0)
+{
+}
+
+bool
+ScanFilterConfig::isValid() const
+{
+    if ( minRange < 0.0 || maxRange < minRange ) return false;
+    if ( minIntensity < 0.0 ) return false;
+    if ( medianWindow != 0 && medianWindow != 3 && medianWindow != 5 ) return false;
+    if ( shadowAngle < 0.0 || shadowAngle >= M_PI/2 ) return false;
+    if ( shadowAngle > 0.0 && shadowWindow == 0 ) return false;
+    if ( rejectedRange < 0.0 ) return false;
+    return true;
+}
+
+std::string
+ScanFilterConfig::toString() const
+{
+    std::stringstream ss;
+    ss << "Scan filter config: minRange=" << minRange << ", maxRange=" << maxRange
+       << ", minIntensity=" << minIntensity << ", medianWindow=" << medianWindow
+       << ", shadowAngle=" << shadowAngle << ", shadowWindow=" << shadowWindow
+       << ", rejectedRange=" << rejectedRange;
+    return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+ScanFilter::ScanFilter( const ScanGeometry& geometry, const ScanFilterConfig& config ) :
+    config_(config),
+    size_(geometry.size()),
+    range_(geometry.size()),
+    keep_(geometry.size()),
+    tanShadowAngle_(0.0f),
+    filtered_(0)
+{
+    if ( !config_.isValid() )
+    {
+        std::stringstream ss;
+        ss << "ScanFilter: invalid config: " << config_.toString();
+        throw gbxutilacfr::Exception( ERROR_INFO, ss.str() );
+    }
+
+    if ( config_.medianWindow > 0 )
+        medianRange_.resize( size_ );
+
+    if ( config_.shadowAngle > 0.0 )
+    {
+        shadowCos_.resize( config_.shadowWindow + 1 );
+        shadowSin_.resize( config_.shadowWindow + 1 );
+        for ( unsigned int k = 1; k <= config_.shadowWindow; ++k )
+        {
+            shadowCos_[k] = (float)cos( k * geometry.angleIncrement() );
+            shadowSin_[k] = (float)fabs( sin( k * geometry.angleIncrement() ) );
+        }
+        tanShadowAngle_ = (float)tan( config_.shadowAngle );
+    }
+}
+
+unsigned int
+ScanFilter::filter( uint32_t* ranges, uint32_t* intensities, uint8_t* valid )
+{
+    if ( intensities && config_.minIntensity > 0.0 )
+        loadAndLimit( MillimetreInput(ranges), Uint32Intensities(intensities) );
+    else
+        loadAndLimit( MillimetreInput(ranges), NoIntensities() );
+
+    if ( config_.medianWindow == 3 )
+        median3();
+    else if ( config_.medianWindow == 5 )
+        median5();
+
+    MillimetreOutput output( ranges, intensities, (float)config_.rejectedRange );
+    return shadowAndStore( output, valid );
+}
+
+unsigned int
+ScanFilter::filter( float* ranges, unsigned char* intensities, uint8_t* valid )
+{
+    if ( intensities && config_.minIntensity > 0.0 )
+        loadAndLimit( MetreInput(ranges), ByteIntensities(intensities) );
+    else
+        loadAndLimit( MetreInput(ranges), NoIntensities() );
+
+    if ( config_.medianWindow == 3 )
+        median3();
+    else if ( config_.medianWindow == 5 )
+        median5();
+
+    MetreOutput output( ranges, intensities, (float)config_.rejectedRange );
+    return shadowAndStore( output, valid );
+}
+
+template<class Ranges, class Intensities>
+void
+ScanFilter::loadAndLimit( const Ranges& ranges, const Intensities& intensities )
+{
+    const float minRange = (float)config_.minRange;
+    const float maxRange = (float)config_.maxRange;
+    const float minIntensity = (float)config_.minIntensity;
+    unsigned int i = 0;
+
+#ifdef __SSE2__
+    const __m128 lo = _mm_set1_ps( minRange );
+    const __m128 hi = _mm_set1_ps( maxRange );
+    const __m128 lowest = _mm_set1_ps( minIntensity );
+    for ( ; i + 4 <= size_; i += 4 )
+    {
+        __m128 r, ok;
+        ranges.load( i, r, ok );
+        // NaN compares false, so it is rejected too
+        ok = _mm_and_ps( ok, _mm_and_ps( _mm_cmpge_ps( r, lo ), _mm_cmple_ps( r, hi ) ) );
+        ok = _mm_and_ps( ok, _mm_cmpge_ps( intensities.load( i ), lowest ) );
+        _mm_storeu_ps( &range_[i], r );
+        _mm_storeu_si128( (__m128i*)&keep_[i], _mm_castps_si128( ok ) );
+    }
+#endif
+
+    for ( ; i < size_; ++i )
+    {
+        float r = ranges.range( i );
+        bool ok = ranges.ok( i ) && r >= minRange && r <= maxRange &&
+                  intensities.intensity( i ) >= minIntensity;
+        range_[i] = r;
+        keep_[i] = ok ? KEEP : 0;
+    }
+    filtered_ = &range_[0];
+}
+
+// Rejected neighbours (and the ends of the scan) are replaced by the reading itself,
+// so they don't pull the median.
+
+void
+ScanFilter::median3()
+{
+    const float* r = &range_[0];
+    float* m = &medianRange_[0];
+    filtered_ = m;
+    if ( size_ < 3 )
+    {
+        copy( r, r + size_, m );
+        return;
+    }
+
+    m[0] = r[0];
+    unsigned int i = 1;
+
+#ifdef __SSE2__
+    for ( ; i + 4 <= size_ - 1; i += 4 )
+    {
+        __m128 b = _mm_loadu_ps( r + i );
+        __m128 a = select( loadKeep( &keep_[i-1] ), _mm_loadu_ps( r + i - 1 ), b );
+        __m128 c = select( loadKeep( &keep_[i+1] ), _mm_loadu_ps( r + i + 1 ), b );
+        _mm_storeu_ps( m + i, medianOf3( a, b, c ) );
+    }
+#endif
+
+    for ( ; i < size_ - 1; ++i )
+    {
+        float b = r[i];
+        float a = keep_[i-1] ? r[i-1] : b;
+        float c = keep_[i+1] ? r[i+1] : b;
+        m[i] = medianOf3( a, b, c );
+    }
+    m[size_-1] = r[size_-1];
+}
+
+void
+ScanFilter::median5()
+{
+    const float* r = &range_[0];
+    float* m = &medianRange_[0];
+    filtered_ = m;
+
+    // median of 5 = medianOf3( e, max(min(a,b), min(c,d)), min(max(a,b), max(c,d)) )
+    unsigned int i = 0;
+
+    // the first two, and everything if the scan is tiny
+    for ( ; i < 2 && i < size_; ++i )
+    {
+        float e = r[i];
+        float n[4];
+        for ( int k = 0; k < 4; ++k )
+        {
+            int j = (int)i + ( k < 2 ? k - 2 : k - 1 );
+            n[k] = ( j >= 0 && j < (int)size_ && keep_[j] ) ? r[j] : e;
+        }
+        m[i] = medianOf3( e, max( min( n[0], n[1] ), min( n[2], n[3] ) ),
+                             min( max( n[0], n[1] ), max( n[2], n[3] ) ) );
+    }
+
+#ifdef __SSE2__
+    for ( ; i + 4 + 2 <= size_; i += 4 )
+    {
+        __m128 e = _mm_loadu_ps( r + i );
+        __m128 a = select( loadKeep( &keep_[i-2] ), _mm_loadu_ps( r + i - 2 ), e );
+        __m128 b = select( loadKeep( &keep_[i-1] ), _mm_loadu_ps( r + i - 1 ), e );
+        __m128 c = select( loadKeep( &keep_[i+1] ), _mm_loadu_ps( r + i + 1 ), e );
+        __m128 d = select( loadKeep( &keep_[i+2] ), _mm_loadu_ps( r + i + 2 ), e );
+        __m128 f = _mm_max_ps( _mm_min_ps( a, b ), _mm_min_ps( c, d ) );
+        __m128 g = _mm_min_ps( _mm_max_ps( a, b ), _mm_max_ps( c, d ) );
+        _mm_storeu_ps( m + i, medianOf3( e, f, g ) );
+    }
+#endif
+
+    for ( ; i < size_; ++i )
+    {
+        float e = r[i];
+        float n[4];
+        for ( int k = 0; k < 4; ++k )
+        {
+            int j = (int)i + ( k < 2 ? k - 2 : k - 1 );
+            n[k] = ( j < (int)size_ && keep_[j] ) ? r[j] : e;
+        }
+        m[i] = medianOf3( e, max( min( n[0], n[1] ), min( n[2], n[3] ) ),
+                             min( max( n[0], n[1] ), max( n[2], n[3] ) ) );
+    }
+}
+
+template<class Output>
+unsigned int
+ScanFilter::shadowAndStore( Output& output, uint8_t* valid )
+{
+    const float* r = filtered_;
+    const unsigned int window = config_.shadowAngle > 0.0 ? config_.shadowWindow : 0;
+    unsigned int count = 0;
+    unsigned int i = 0;
+
+#ifdef __SSE2__
+    // the first readings don't have all their neighbours
+    for ( ; i < window && i < size_; ++i )
+        count += storeOne( output, i, valid );
+
+    const __m128 tanAngle = _mm_set1_ps( tanShadowAngle_ );
+    const __m128 absMask = _mm_castsi128_ps( _mm_set1_epi32( 0x7FFFFFFF ) );
+    for ( ; i + 4 + window <= size_; i += 4 )
+    {
+        __m128 ri = _mm_loadu_ps( r + i );
+        __m128 shadow = _mm_setzero_ps();
+        for ( unsigned int k = 1; k <= window; ++k )
+        {
+            const __m128 c = _mm_set1_ps( shadowCos_[k] );
+            const __m128 s = _mm_set1_ps( shadowSin_[k] );
+            for ( int side = -1; side <= 1; side += 2 )
+            {
+                unsigned int j = i + side * (int)k;
+                __m128 rj = _mm_loadu_ps( r + j );
+                __m128 along = _mm_and_ps( _mm_sub_ps( _mm_mul_ps( c, rj ), ri ), absMask );
+                __m128 hit = _mm_cmplt_ps( _mm_mul_ps( s, rj ), _mm_mul_ps( along, tanAngle ) );
+                hit = _mm_and_ps( hit, _mm_cmplt_ps( rj, ri ) );
+                hit = _mm_and_ps( hit, loadKeep( &keep_[j] ) );
+                shadow = _mm_or_ps( shadow, hit );
+            }
+        }
+        __m128 keep = _mm_andnot_ps( shadow, loadKeep( &keep_[i] ) );
+        output.store( i, ri, keep );
+
+        int bits = _mm_movemask_ps( keep );
+        count += BIT_COUNT[bits];
+        if ( valid )
+        {
+            valid[i]   = bits & 1;
+            valid[i+1] = (bits >> 1) & 1;
+            valid[i+2] = (bits >> 2) & 1;
+            valid[i+3] = (bits >> 3) & 1;
+        }
+    }
+#endif
+
+    // the last readings, or everything without SSE2
+    for ( ; i < size_; ++i )
+        count += storeOne( output, i, valid );
+
+    return count;
+}
+
+template<class Output>
+unsigned int
+ScanFilter::storeOne( Output& output, unsigned int i, uint8_t* valid )
+{
+    const float* r = filtered_;
+    const unsigned int window = config_.shadowAngle > 0.0 ? config_.shadowWindow : 0;
+
+    // Reading i is a shadow of neighbour j when j is kept and closer, and the line
+    // through both is within shadowAngle of the ray of i:
+    // perpendicular distance < distance along the ray * tan(shadowAngle)
+    float ri = r[i];
+    bool keep = keep_[i] != 0;
+    for ( unsigned int k = 1; keep && k <= window; ++k )
+    {
+        for ( int side = -1; side <= 1; side += 2 )
+        {
+            int j = (int)i + side * (int)k;
+            if ( j < 0 || j >= (int)size_ || !keep_[j] )
+                continue;
+            float rj = r[j];
+            float along = fabs( shadowCos_[k] * rj - ri );
+            if ( shadowSin_[k] * rj < along * tanShadowAngle_ && rj < ri )
+                keep = false;
+        }
+    }
+
+    output.store( i, ri, keep );
+    if ( valid )
+        valid[i] = keep;
+    return keep ? 1 : 0;
+}
+
+} // namespace
@@ -0,0 +1,122 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#ifndef GBXSCANACFR_SCANFILTER_H
+#define GBXSCANACFR_SCANFILTER_H
+
+#include <gbxscanacfr/scangeometry.h>
+
+#include <string>
+#include <vector>
+
+namespace gbxscanacfr {
+
+//! ScanFilter configuration. Every stage but the range limits can be turned off.
+class GBXSCANACFR_EXPORT ScanFilterConfig
+{
+public:
+    ScanFilterConfig();
+
+    //! Readings outside [minRange, maxRange] are rejected [m].
+    //! With millimetre ranges, Hokuyo error codes (below 20mm) are always rejected.
+    double minRange;
+    double maxRange;
+
+    //! Readings with a lower intensity are rejected. 0 turns the stage off.
+    double minIntensity;
+
+    //! Median filter window: 0 (off), 3 or 5 readings.
+    unsigned int medianWindow;
+
+    //! Shadow (veiling) points: a reading is rejected when a closer neighbour, up to
+    //! shadowWindow readings away, lies on a line that makes an angle below shadowAngle
+    //! with the ray of the reading. These are the mixed readings on the edge of an
+    //! object [rad]. 0 turns the stage off.
+    double shadowAngle;
+    unsigned int shadowWindow;
+
+    //! What rejected readings are overwritten with [m]. Their intensities become 0.
+    double rejectedRange;
+
+    bool isValid() const;
+    std::string toString() const;
+};
+
+//!
+//! @brief A chain of range cleanup stages, run in place on a whole scan.
+//!
+//! The stages, in order:
+//! -# range limits, Hokuyo error codes and the intensity threshold, all in one pass
+//! -# median filter
+//! -# shadow point removal, in the same pass that writes the result back
+//!
+//! The median and the shadow test only look at readings that survived the first
+//! stage, and the shadow test sees the median filtered ranges.
+//!
+//! Works on hokuyo_aist::ScanData ranges and intensities (uint32_t, millimetres) and on
+//! gbxsickacfr::Data ones (float metres, unsigned char), for scans of the geometry it
+//! was built with. To filter a ScanData in place, build it on your own buffers
+//! (ScanData(ranges_buffer, length, intensities_buffer, length)).
+//!
+//! All working memory is allocated in the constructor: filter() doesn't allocate, and
+//! uses SSE2 when the compiler targets it. A ScanFilter is not thread-safe, use one
+//! per thread.
+//!
+class GBXSCANACFR_EXPORT ScanFilter
+{
+public:
+    //! Throws gbxutilacfr::Exception if the config is not valid.
+    ScanFilter( const ScanGeometry& geometry, const ScanFilterConfig& config );
+
+    //! Filters ScanData style ranges (and intensities, may be NULL) in place.
+    //! @p valid, if not NULL, gets 1 for every kept reading and 0 for every rejected one.
+    //! All arrays hold size() values. Returns the number of kept readings.
+    unsigned int filter( uint32_t* ranges, uint32_t* intensities=0, uint8_t* valid=0 );
+
+    //! As above for gbxsickacfr::Data style ranges and intensities.
+    unsigned int filter( float* ranges, unsigned char* intensities=0, uint8_t* valid=0 );
+
+    unsigned int size() const { return size_; }
+    const ScanFilterConfig& config() const { return config_; }
+
+private:
+    // First stage: converts to float metres into range_, sets keep_
+    template<class Ranges, class Intensities>
+    void loadAndLimit( const Ranges& ranges, const Intensities& intensities );
+
+    void median3();
+    void median5();
+
+    // Last stage: shadow test on filtered_ and write back
+    template<class Output>
+    unsigned int shadowAndStore( Output& output, uint8_t* valid );
+    template<class Output>
+    unsigned int storeOne( Output& output, unsigned int i, uint8_t* valid );
+
+    ScanFilterConfig config_;
+    unsigned int size_;
+
+    // per reading, all size_ long
+    std::vector<float> range_;          // input in metres
+    std::vector<float> medianRange_;    // median filtered, when the median is on
+    std::vector<uint32_t> keep_;        // ~0 for kept readings, 0 for rejected ones
+
+    // shadow test constants, for neighbours 1..shadowWindow away
+    std::vector<float> shadowCos_;
+    std::vector<float> shadowSin_;
+    float tanShadowAngle_;
+
+    // where the shadow test reads from: medianRange_ or range_
+    const float* filtered_;
+};
+
+} // namespace
+
+#endif
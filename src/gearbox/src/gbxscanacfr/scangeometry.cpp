@@ -0,0 +1,331 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#include "scangeometry.h"
+
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace gbxscanacfr {
+
+namespace {
+
+// Integer millimetres. Values are read as signed so that the SIMD and scalar paths
+// agree on the (nonsense) values above 2^31: both see them as negative, i.e. errors.
+class MillimetreRanges
+{
+public:
+    MillimetreRanges( const uint32_t* ranges ) : ranges_(ranges) {}
+
+    float at( unsigned int i ) const
+    { return (float)(int32_t)ranges_[i] * 0.001f; }
+
+#ifdef __SSE2__
+    __m128 load( unsigned int i ) const
+    {
+        __m128i r = _mm_loadu_si128( (const __m128i*)(ranges_ + i) );
+        return _mm_mul_ps( _mm_cvtepi32_ps( r ), _mm_set1_ps( 0.001f ) );
+    }
+#endif
+
+private:
+    const uint32_t* ranges_;
+};
+
+// Float metres
+class MetreRanges
+{
+public:
+    MetreRanges( const float* ranges ) : ranges_(ranges) {}
+
+    float at( unsigned int i ) const
+    { return ranges_[i]; }
+
+#ifdef __SSE2__
+    __m128 load( unsigned int i ) const
+    { return _mm_loadu_ps( ranges_ + i ); }
+#endif
+
+private:
+    const float* ranges_;
+};
+
+#ifdef __SSE2__
+// Number of set bits in a 4-bit movemask
+const unsigned int BIT_COUNT[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+#endif
+
+//
+// The one kernel behind every projection: out[k][i] = r[i] * dir[k][i] + offset[k]
+// for k < Dims, with r[i] forced to 0 outside [minRange, maxRange].
+// Dims == 0 only computes the mask.
+//
+template<int Dims, class Ranges>
+unsigned int
+projectRanges( const Ranges& ranges, unsigned int size, float minRange, float maxRange,
+               const float* const* dir, const float* offset, float* const* out, uint8_t* valid )
+{
+    unsigned int count = 0;
+    unsigned int i = 0;
+
+#ifdef __SSE2__
+    const __m128 lo = _mm_set1_ps( minRange );
+    const __m128 hi = _mm_set1_ps( maxRange );
+    __m128 off[Dims > 0 ? Dims : 1];
+    for ( int k = 0; k < Dims; ++k )
+        off[k] = _mm_set1_ps( offset[k] );
+
+    for ( ; i + 4 <= size; i += 4 )
+    {
+        __m128 r = ranges.load( i );
+        // NaN compares false, so it is an error step as well
+        __m128 good = _mm_and_ps( _mm_cmpge_ps( r, lo ), _mm_cmple_ps( r, hi ) );
+        r = _mm_and_ps( r, good );
+
+        for ( int k = 0; k < Dims; ++k )
+        {
+            __m128 p = _mm_add_ps( _mm_mul_ps( r, _mm_loadu_ps( dir[k] + i ) ), off[k] );
+            _mm_storeu_ps( out[k] + i, p );
+        }
+
+        int bits = _mm_movemask_ps( good );
+        count += BIT_COUNT[bits];
+        if ( valid )
+        {
+            valid[i]   = bits & 1;
+            valid[i+1] = (bits >> 1) & 1;
+            valid[i+2] = (bits >> 2) & 1;
+            valid[i+3] = (bits >> 3) & 1;
+        }
+    }
+#endif
+
+    // the tail, or everything without SSE2
+    for ( ; i < size; ++i )
+    {
+        float r = ranges.at( i );
+        bool good = r >= minRange && r <= maxRange;
+        if ( !good )
+            r = 0.0f;
+
+        for ( int k = 0; k < Dims; ++k )
+            out[k][i] = r * dir[k][i] + offset[k];
+
+        count += good;
+        if ( valid )
+            valid[i] = good;
+    }
+
+    return count;
+}
+
+}
+
+//////////////////////////////////////////////////////////////////////
+
+MountTransform::MountTransform()
+{
+    for ( int i = 0; i < 9; ++i )
+        rotation[i] = ( i % 4 == 0 ) ? 1.0 : 0.0;
+    translation[0] = translation[1] = translation[2] = 0.0;
+}
+
+MountTransform::MountTransform( double x, double y, double z, double roll, double pitch, double yaw )
+{
+    const double cr = cos(roll),  sr = sin(roll);
+    const double cp = cos(pitch), sp = sin(pitch);
+    const double cy = cos(yaw),   sy = sin(yaw);
+
+    // Rz(yaw) * Ry(pitch) * Rx(roll)
+    rotation[0] = cy*cp;  rotation[1] = cy*sp*sr - sy*cr;  rotation[2] = cy*sp*cr + sy*sr;
+    rotation[3] = sy*cp;  rotation[4] = sy*sp*sr + cy*cr;  rotation[5] = sy*sp*cr - cy*sr;
+    rotation[6] = -sp;    rotation[7] = cp*sr;             rotation[8] = cp*cr;
+
+    translation[0] = x;
+    translation[1] = y;
+    translation[2] = z;
+}
+
+std::string
+MountTransform::toString() const
+{
+    std::stringstream ss;
+    ss << "translation=[" << translation[0] << ", " << translation[1] << ", " << translation[2]
+       << "] rotation=[";
+    for ( int i = 0; i < 9; ++i )
+        ss << rotation[i] << ( i == 8 ? "]" : ( i % 3 == 2 ? "; " : ", " ) );
+    return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+ScanGeometry::ScanGeometry() :
+    startAngle_(0.0),
+    angleIncrement_(0.0),
+    size_(0),
+    minRange_(0.02),
+    maxRange_(numeric_limits<double>::infinity())
+{
+}
+
+ScanGeometry::ScanGeometry( double startAngle, double angleIncrement, unsigned int numberOfSamples ) :
+    startAngle_(startAngle),
+    angleIncrement_(angleIncrement),
+    size_(numberOfSamples),
+    minRange_(0.02),
+    maxRange_(numeric_limits<double>::infinity())
+{
+    computeTables();
+}
+
+ScanGeometry
+ScanGeometry::fromSteps( int firstStep, int lastStep, unsigned int clusterCount,
+                         int frontStep, double resolution )
+{
+    if ( clusterCount == 0 )
+        clusterCount = 1;
+    // same count as Sensor::get_ranges()
+    unsigned int numSteps = 0;
+    if ( lastStep >= firstStep )
+        numSteps = ( lastStep - firstStep + 1 ) / clusterCount;
+
+    return ScanGeometry( ( firstStep - frontStep ) * resolution, clusterCount * resolution, numSteps );
+}
+
+ScanGeometry
+ScanGeometry::fromFieldOfView( double startAngle, double fieldOfView, unsigned int numberOfSamples )
+{
+    double angleIncrement = numberOfSamples > 1 ? fieldOfView / ( numberOfSamples - 1 ) : 0.0;
+    return ScanGeometry( startAngle, angleIncrement, numberOfSamples );
+}
+
+void
+ScanGeometry::setRangeLimits( double minRange, double maxRange )
+{
+    minRange_ = minRange;
+    maxRange_ = maxRange;
+}
+
+void
+ScanGeometry::setMount( const MountTransform& mount )
+{
+    mount_ = mount;
+    computeMountTables();
+}
+
+void
+ScanGeometry::computeTables()
+{
+    cos_.resize( size_ );
+    sin_.resize( size_ );
+    // computed in double from the index, so the last reading is as accurate as the first
+    for ( unsigned int i = 0; i < size_; ++i )
+    {
+        double a = angle( i );
+        cos_[i] = (float)cos( a );
+        sin_[i] = (float)sin( a );
+    }
+    computeMountTables();
+}
+
+void
+ScanGeometry::computeMountTables()
+{
+    const double* R = mount_.rotation;
+    dirX_.resize( size_ );
+    dirY_.resize( size_ );
+    dirZ_.resize( size_ );
+    for ( unsigned int i = 0; i < size_; ++i )
+    {
+        double a = angle( i );
+        double c = cos( a );
+        double s = sin( a );
+        dirX_[i] = (float)( R[0]*c + R[1]*s );
+        dirY_[i] = (float)( R[3]*c + R[4]*s );
+        dirZ_[i] = (float)( R[6]*c + R[7]*s );
+    }
+}
+
+unsigned int
+ScanGeometry::project( const uint32_t* ranges, float* x, float* y, uint8_t* valid ) const
+{
+    const float* dir[2] = { cosTable(), sinTable() };
+    const float offset[2] = { 0.0f, 0.0f };
+    float* out[2] = { x, y };
+    return projectRanges<2>( MillimetreRanges(ranges), size_, (float)minRange_, (float)maxRange_,
+                             dir, offset, out, valid );
+}
+
+unsigned int
+ScanGeometry::project( const float* ranges, float* x, float* y, uint8_t* valid ) const
+{
+    const float* dir[2] = { cosTable(), sinTable() };
+    const float offset[2] = { 0.0f, 0.0f };
+    float* out[2] = { x, y };
+    return projectRanges<2>( MetreRanges(ranges), size_, (float)minRange_, (float)maxRange_,
+                             dir, offset, out, valid );
+}
+
+unsigned int
+ScanGeometry::project3d( const uint32_t* ranges, float* x, float* y, float* z, uint8_t* valid ) const
+{
+    if ( size_ == 0 )
+        return 0;
+    const float* dir[3] = { &dirX_[0], &dirY_[0], &dirZ_[0] };
+    const float offset[3] = { (float)mount_.translation[0], (float)mount_.translation[1], (float)mount_.translation[2] };
+    float* out[3] = { x, y, z };
+    return projectRanges<3>( MillimetreRanges(ranges), size_, (float)minRange_, (float)maxRange_,
+                             dir, offset, out, valid );
+}
+
+unsigned int
+ScanGeometry::project3d( const float* ranges, float* x, float* y, float* z, uint8_t* valid ) const
+{
+    if ( size_ == 0 )
+        return 0;
+    const float* dir[3] = { &dirX_[0], &dirY_[0], &dirZ_[0] };
+    const float offset[3] = { (float)mount_.translation[0], (float)mount_.translation[1], (float)mount_.translation[2] };
+    float* out[3] = { x, y, z };
+    return projectRanges<3>( MetreRanges(ranges), size_, (float)minRange_, (float)maxRange_,
+                             dir, offset, out, valid );
+}
+
+unsigned int
+ScanGeometry::errorMask( const uint32_t* ranges, uint8_t* valid ) const
+{
+    return projectRanges<0>( MillimetreRanges(ranges), size_, (float)minRange_, (float)maxRange_,
+                             0, 0, 0, valid );
+}
+
+unsigned int
+ScanGeometry::errorMask( const float* ranges, uint8_t* valid ) const
+{
+    return projectRanges<0>( MetreRanges(ranges), size_, (float)minRange_, (float)maxRange_,
+                             0, 0, 0, valid );
+}
+
+std::string
+ScanGeometry::toString() const
+{
+    std::stringstream ss;
+    ss << "ScanGeometry: size=" << size_ << ", startAngle=" << startAngle_
+       << ", angleIncrement=" << angleIncrement_ << ", minRange=" << minRange_
+       << ", maxRange=" << maxRange_ << ", mount: " << mount_.toString();
+    return ss.str();
+}
+
+} // namespace
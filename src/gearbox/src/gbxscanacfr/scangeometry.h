@@ -0,0 +1,159 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#ifndef GBXSCANACFR_SCANGEOMETRY_H
+#define GBXSCANACFR_SCANGEOMETRY_H
+
+#if defined (WIN32)
+    typedef unsigned char           uint8_t;
+    typedef unsigned int            uint32_t;
+    #if defined (GBXSCANACFR_STATIC)
+        #define GBXSCANACFR_EXPORT
+    #elif defined (GBXSCANACFR_EXPORTS)
+        #define GBXSCANACFR_EXPORT       __declspec (dllexport)
+    #else
+        #define GBXSCANACFR_EXPORT       __declspec (dllimport)
+    #endif
+#else
+    #include <stdint.h>
+    #define GBXSCANACFR_EXPORT
+#endif
+
+#include <string>
+#include <vector>
+
+namespace gbxscanacfr {
+
+//! Rigid transform from the sensor frame to the frame points should come out in
+//! (e.g. the vehicle frame). Angles are in radians, applied roll, then pitch, then yaw
+//! (i.e. R = Rz(yaw) * Ry(pitch) * Rx(roll)), translation in metres.
+class GBXSCANACFR_EXPORT MountTransform
+{
+public:
+    //! Identity
+    MountTransform();
+    MountTransform( double x, double y, double z, double roll, double pitch, double yaw );
+
+    //! Row-major 3x3 rotation
+    double rotation[9];
+    double translation[3];
+
+    std::string toString() const;
+};
+
+//!
+//! @brief Precomputed geometry of a laser scan, for turning ranges into points.
+//!
+//! A scan is @c size() readings at angles startAngle + i*angleIncrement (sensor frame,
+//! counter-clockwise from the x axis). The cosine and sine of every reading is computed
+//! once, when the geometry is built, so projecting a scan is a multiply (and add)
+//! per coordinate. Build one per sensor configuration and reuse it for every scan.
+//!
+//! Projection writes structure-of-arrays output (separate x, y[, z] arrays of size()
+//! floats) and uses SSE2 when the compiler targets it, with a scalar fallback that gives
+//! the same results.
+//!
+//! Readings outside the range limits (see setRangeLimits()) are error steps: they are
+//! projected as a zero range, i.e. onto the sensor origin, cleared in the optional
+//! validity mask, and not counted in the return value. NaN ranges are error steps too.
+//!
+//! Two range formats are handled directly:
+//! - integer millimetres, as in hokuyo_aist::ScanData::ranges(). The default minimum
+//!   range of 20mm makes the Hokuyo error codes (values below 20) error steps.
+//! - float metres, as in gbxsickacfr::Data::ranges.
+//!
+//! Output is always in metres.
+//!
+class GBXSCANACFR_EXPORT ScanGeometry
+{
+public:
+    //! Empty geometry, size() is 0
+    ScanGeometry();
+
+    //! @p numberOfSamples readings starting at @p startAngle, @p angleIncrement apart [rad]
+    ScanGeometry( double startAngle, double angleIncrement, unsigned int numberOfSamples );
+
+    //! Geometry of a Hokuyo scan read with Sensor::get_ranges(data, firstStep, lastStep, clusterCount).
+    //! @p frontStep and @p resolution come from hokuyo_aist::SensorInfo (front_step, resolution).
+    //! Each reading is at the angle of the first step of its cluster, as
+    //! Sensor::step_to_angle() gives for that step.
+    static ScanGeometry fromSteps( int firstStep, int lastStep, unsigned int clusterCount,
+                                   int frontStep, double resolution );
+
+    //! Geometry of a scan described like gbxsickacfr::Config: @p numberOfSamples readings
+    //! spread evenly over @p fieldOfView, the first one at @p startAngle.
+    static ScanGeometry fromFieldOfView( double startAngle, double fieldOfView, unsigned int numberOfSamples );
+
+    //! Ranges below @p minRange or above @p maxRange [m] are error steps.
+    //! Defaults are 0.02 and infinity.
+    void setRangeLimits( double minRange, double maxRange );
+    double minRange() const { return minRange_; }
+    double maxRange() const { return maxRange_; }
+
+    //! Transform applied by the 3D projections. Defaults to identity.
+    void setMount( const MountTransform& mount );
+    const MountTransform& mount() const { return mount_; }
+
+    //! Number of readings in a scan
+    unsigned int size() const { return size_; }
+    double startAngle() const { return startAngle_; }
+    double angleIncrement() const { return angleIncrement_; }
+    //! Angle of reading @p i [rad]
+    double angle( unsigned int i ) const { return startAngle_ + i * angleIncrement_; }
+
+    //! The tables, size() values each
+    const float* cosTable() const { return size_ ? &cos_[0] : 0; }
+    const float* sinTable() const { return size_ ? &sin_[0] : 0; }
+
+    //! Projects a scan into the sensor plane. All arrays hold size() values, @p valid
+    //! (1 for a good reading, 0 for an error step) may be NULL.
+    //! Returns the number of good readings.
+    unsigned int project( const uint32_t* ranges, float* x, float* y, uint8_t* valid=0 ) const;
+    //! As above, with ranges in metres
+    unsigned int project( const float* ranges, float* x, float* y, uint8_t* valid=0 ) const;
+
+    //! Projects a scan into 3D through the mount transform. Error steps come out at the
+    //! sensor origin in the output frame.
+    unsigned int project3d( const uint32_t* ranges, float* x, float* y, float* z, uint8_t* valid=0 ) const;
+    //! As above, with ranges in metres
+    unsigned int project3d( const float* ranges, float* x, float* y, float* z, uint8_t* valid=0 ) const;
+
+    //! Only the validity mask, no projection. Returns the number of good readings.
+    unsigned int errorMask( const uint32_t* ranges, uint8_t* valid ) const;
+    //! As above, with ranges in metres
+    unsigned int errorMask( const float* ranges, uint8_t* valid ) const;
+
+    std::string toString() const;
+
+private:
+    void computeTables();
+    void computeMountTables();
+
+    double startAngle_;
+    double angleIncrement_;
+    unsigned int size_;
+
+    double minRange_;
+    double maxRange_;
+
+    MountTransform mount_;
+
+    // cos and sin of every reading
+    std::vector<float> cos_;
+    std::vector<float> sin_;
+    // direction of every reading in the mount frame, i.e. rotation * (cos, sin, 0)
+    std::vector<float> dirX_;
+    std::vector<float> dirY_;
+    std::vector<float> dirZ_;
+};
+
+} // namespace
+
+#endif
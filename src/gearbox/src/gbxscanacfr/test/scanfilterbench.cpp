@@ -0,0 +1,198 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+//
+// Per-scan cost of cleaning up a 1080 step scan: ScanFilter with every stage on,
+// against doing the same one stage at a time with temporaries, nth_element medians
+// and atan2 for the shadow angle, the way it is done downstream today.
+//
+// Usage: scanfilterbench [number of scans]
+//
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <sys/time.h>
+#include <gbxscanacfr/scanfilter.h>
+
+using namespace std;
+using namespace gbxscanacfr;
+
+namespace {
+
+const unsigned int SIZE = 1080;
+
+double
+now()
+{
+    timeval tv;
+    gettimeofday( &tv, 0 );
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+void
+report( const char* name, double seconds, int numScans, unsigned long checksum )
+{
+    cout << setw(36) << left << name
+         << setw(10) << right << fixed << setprecision(2) << seconds / numScans * 1e6 << " us/scan"
+         << setw(12) << setprecision(0) << numScans / seconds << " scans/s"
+         << "   (kept " << checksum / numScans << ")" << endl;
+}
+
+// One stage at a time
+unsigned int
+adHocFilter( const ScanGeometry& g, const ScanFilterConfig& c, uint32_t* ranges, uint32_t* intensities )
+{
+    vector<float> r( SIZE );
+    vector<bool> keep( SIZE );
+    for ( unsigned int i = 0; i < SIZE; ++i )
+    {
+        r[i] = ranges[i] * 0.001f;
+        keep[i] = ranges[i] >= 20;
+    }
+    for ( unsigned int i = 0; i < SIZE; ++i )
+        if ( r[i] < c.minRange || r[i] > c.maxRange )
+            keep[i] = false;
+    for ( unsigned int i = 0; i < SIZE; ++i )
+        if ( intensities[i] < c.minIntensity )
+            keep[i] = false;
+
+    vector<float> m( r );
+    int half = c.medianWindow / 2;
+    for ( int i = 0; i < (int)SIZE; ++i )
+    {
+        vector<float> w;
+        for ( int j = i - half; j <= i + half; ++j )
+            w.push_back( ( j >= 0 && j < (int)SIZE && keep[j] ) ? r[j] : r[i] );
+        nth_element( w.begin(), w.begin() + half, w.end() );
+        m[i] = w[half];
+    }
+
+    vector<bool> out( keep );
+    for ( int i = 0; i < (int)SIZE; ++i )
+    {
+        for ( int j = i - (int)c.shadowWindow; keep[i] && j <= i + (int)c.shadowWindow; ++j )
+        {
+            if ( j == i || j < 0 || j >= (int)SIZE || !keep[j] || m[j] >= m[i] )
+                continue;
+            double dtheta = ( j - i ) * g.angleIncrement();
+            if ( atan2( fabs( m[j] * sin( dtheta ) ), fabs( m[j] * cos( dtheta ) - m[i] ) ) < c.shadowAngle )
+                out[i] = false;
+        }
+    }
+
+    unsigned int count = 0;
+    for ( unsigned int i = 0; i < SIZE; ++i )
+    {
+        ranges[i] = out[i] ? (uint32_t)( m[i] * 1000.0f + 0.5f ) : 0;
+        if ( !out[i] )
+            intensities[i] = 0;
+        count += out[i];
+    }
+    return count;
+}
+
+}
+
+int main( int argc, char **argv )
+{
+    int numScans = 20000;
+    if ( argc > 1 )
+        numScans = atoi( argv[1] );
+    if ( numScans <= 0 )
+    {
+        cout << "Usage: scanfilterbench [number of scans]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    ScanGeometry geometry = ScanGeometry::fromSteps( 0, SIZE - 1, 1, 540, 2.0 * M_PI / 1440 );
+
+    ScanFilterConfig config;
+    config.minRange = 0.1;
+    config.maxRange = 30.0;
+    config.minIntensity = 100;
+    config.medianWindow = 5;
+    config.shadowAngle = 10.0 * M_PI / 180.0;
+    config.shadowWindow = 2;
+    ScanFilter filter( geometry, config );
+
+    ScanFilterConfig limitsOnly;
+    limitsOnly.minRange = 0.1;
+    limitsOnly.maxRange = 30.0;
+    limitsOnly.minIntensity = 100;
+    ScanFilter limitsFilter( geometry, limitsOnly );
+
+    // a room with some clutter
+    vector<uint32_t> scanRanges( SIZE ), scanIntensities( SIZE );
+    unsigned int r = 3000;
+    for ( unsigned int i = 0; i < SIZE; ++i )
+    {
+        if ( rand() % 40 == 0 )
+            r = 500 + rand() % 20000;
+        r += rand() % 21 - 10;
+        scanRanges[i] = ( rand() % 50 == 0 ) ? 1 : r;
+        scanIntensities[i] = rand() % 3000;
+    }
+
+    vector<uint32_t> ranges( SIZE ), intensities( SIZE );
+    vector<uint8_t> valid( SIZE );
+    unsigned long checksum;
+    double elapsed;
+
+    cout << SIZE << " step scans, " << numScans << " scans" << endl;
+#ifdef __SSE2__
+    cout << "SSE2 kernels" << endl;
+#else
+    cout << "scalar kernels" << endl;
+#endif
+
+    // the copy back into the buffers is part of every variant, so it's not subtracted
+
+    checksum = 0;
+    elapsed = 0.0;
+    for ( int s = 0; s < numScans; ++s )
+    {
+        ranges = scanRanges;
+        intensities = scanIntensities;
+        double start = now();
+        checksum += adHocFilter( geometry, config, &ranges[0], &intensities[0] );
+        elapsed += now() - start;
+    }
+    report( "one stage at a time", elapsed, numScans, checksum );
+
+    checksum = 0;
+    elapsed = 0.0;
+    for ( int s = 0; s < numScans; ++s )
+    {
+        ranges = scanRanges;
+        intensities = scanIntensities;
+        double start = now();
+        checksum += filter.filter( &ranges[0], &intensities[0], &valid[0] );
+        elapsed += now() - start;
+    }
+    report( "ScanFilter, all stages", elapsed, numScans, checksum );
+
+    checksum = 0;
+    elapsed = 0.0;
+    for ( int s = 0; s < numScans; ++s )
+    {
+        ranges = scanRanges;
+        intensities = scanIntensities;
+        double start = now();
+        checksum += limitsFilter.filter( &ranges[0], &intensities[0], &valid[0] );
+        elapsed += now() - start;
+    }
+    report( "ScanFilter, limits and intensity", elapsed, numScans, checksum );
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,267 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <gbxscanacfr/scanfilter.h>
+#include <gbxutilacfr/exceptions.h>
+
+using namespace std;
+using namespace gbxscanacfr;
+
+namespace {
+
+int failures = 0;
+
+void
+check( bool ok, const char* what, unsigned int i=0 )
+{
+    if ( !ok )
+    {
+        cout << "failed: " << what << " (reading " << i << ")" << endl;
+        ++failures;
+    }
+}
+
+//
+// Straightforward version of the chain, one stage at a time, to compare against
+//
+void
+referenceFilter( const ScanGeometry& g, const ScanFilterConfig& c,
+                 vector<float>& r, vector<bool> keep, vector<bool>& out )
+{
+    const int n = r.size();
+
+    // median, rejected neighbours and the ends replaced by the reading itself
+    vector<float> m( r );
+    int half = c.medianWindow / 2;
+    for ( int i = 0; half > 0 && i < n; ++i )
+    {
+        vector<float> w;
+        for ( int j = i - half; j <= i + half; ++j )
+            w.push_back( ( j >= 0 && j < n && keep[j] ) ? r[j] : r[i] );
+        sort( w.begin(), w.end() );
+        m[i] = w[half];
+    }
+
+    // shadows
+    out = keep;
+    for ( int i = 0; c.shadowAngle > 0.0 && i < n; ++i )
+    {
+        if ( !keep[i] )
+            continue;
+        for ( int j = i - (int)c.shadowWindow; j <= i + (int)c.shadowWindow; ++j )
+        {
+            if ( j == i || j < 0 || j >= n || !keep[j] || m[j] >= m[i] )
+                continue;
+            double dtheta = ( j - i ) * g.angleIncrement();
+            double perp = fabs( m[j] * sin( dtheta ) );
+            double along = fabs( m[j] * cos( dtheta ) - m[i] );
+            if ( atan2( perp, along ) < c.shadowAngle )
+                out[i] = false;
+        }
+    }
+    r = m;
+}
+
+// Hokuyo style: mm with error codes, uint32 intensities
+void
+testMillimetres( unsigned int size, const ScanFilterConfig& config )
+{
+    ScanGeometry g = ScanGeometry::fromSteps( 0, size - 1, 1, size / 2, 2.0 * M_PI / 1440 );
+    ScanFilter filter( g, config );
+
+    vector<uint32_t> ranges( size ), intensities( size );
+    unsigned int r = 3000;
+    for ( unsigned int i = 0; i < size; ++i )
+    {
+        // piecewise smooth, with steps (for shadows), spikes and error codes
+        if ( rand() % 40 == 0 )
+            r = 500 + rand() % 20000;
+        r += rand() % 21 - 10;
+        ranges[i] = r;
+        if ( rand() % 30 == 0 )
+            ranges[i] = rand() % 20;
+        else if ( rand() % 30 == 0 )
+            ranges[i] = r + 1000 + rand() % 3000;
+        intensities[i] = rand() % 4000;
+    }
+
+    vector<float> expectedRange( size );
+    vector<bool> keep( size ), expectedKeep;
+    for ( unsigned int i = 0; i < size; ++i )
+    {
+        expectedRange[i] = (float)ranges[i] * 0.001f;
+        keep[i] = ranges[i] >= 20 && expectedRange[i] >= (float)config.minRange &&
+                  expectedRange[i] <= (float)config.maxRange &&
+                  intensities[i] >= config.minIntensity;
+    }
+    referenceFilter( g, config, expectedRange, keep, expectedKeep );
+
+    vector<uint32_t> inputIntensities( intensities );
+    vector<uint8_t> valid( size );
+    unsigned int count = filter.filter( &ranges[0], &intensities[0], &valid[0] );
+
+    unsigned int expectedCount = 0;
+    for ( unsigned int i = 0; i < size; ++i )
+    {
+        expectedCount += expectedKeep[i];
+        check( valid[i] == expectedKeep[i], "mm keep", i );
+        if ( expectedKeep[i] )
+        {
+            check( ranges[i] == (uint32_t)( expectedRange[i] * 1000.0f + 0.5f ), "mm range", i );
+            check( intensities[i] == inputIntensities[i], "mm intensity", i );
+        }
+        else
+        {
+            check( ranges[i] == (uint32_t)( config.rejectedRange * 1000 + 0.5 ), "mm rejected range", i );
+            check( intensities[i] == 0, "mm rejected intensity", i );
+        }
+    }
+    check( count == expectedCount, "mm count" );
+}
+
+// SICK style: float metres with NaNs, byte intensities
+void
+testMetres( unsigned int size, const ScanFilterConfig& config )
+{
+    ScanGeometry g = ScanGeometry::fromFieldOfView( -M_PI/2, M_PI, size );
+    ScanFilter filter( g, config );
+
+    vector<float> ranges( size );
+    vector<unsigned char> intensities( size );
+    float r = 4.0f;
+    for ( unsigned int i = 0; i < size; ++i )
+    {
+        if ( rand() % 30 == 0 )
+            r = 0.2f + ( rand() % 7000 ) * 0.001f;
+        ranges[i] = r + ( rand() % 21 - 10 ) * 0.001f;
+        if ( rand() % 40 == 0 )
+            ranges[i] = numeric_limits<float>::quiet_NaN();
+        intensities[i] = rand() % 256;
+    }
+
+    vector<float> expectedRange( ranges );
+    vector<bool> keep( size ), expectedKeep;
+    for ( unsigned int i = 0; i < size; ++i )
+        keep[i] = ranges[i] >= (float)config.minRange && ranges[i] <= (float)config.maxRange &&
+                  intensities[i] >= config.minIntensity;
+    referenceFilter( g, config, expectedRange, keep, expectedKeep );
+
+    vector<unsigned char> inputIntensities( intensities );
+    vector<uint8_t> valid( size );
+    unsigned int count = filter.filter( &ranges[0], &intensities[0], &valid[0] );
+
+    unsigned int expectedCount = 0;
+    for ( unsigned int i = 0; i < size; ++i )
+    {
+        expectedCount += expectedKeep[i];
+        check( valid[i] == expectedKeep[i], "m keep", i );
+        if ( expectedKeep[i] )
+        {
+            check( ranges[i] == expectedRange[i], "m range", i );
+            check( intensities[i] == inputIntensities[i], "m intensity", i );
+        }
+        else
+        {
+            check( ranges[i] == (float)config.rejectedRange, "m rejected range", i );
+            check( intensities[i] == 0, "m rejected intensity", i );
+        }
+    }
+    check( count == expectedCount, "m count" );
+}
+
+// A box in front of a wall, with one mixed reading on each edge
+void
+testShadowScene()
+{
+    const unsigned int size = 41;
+    ScanGeometry g = ScanGeometry::fromFieldOfView( -0.2, 0.4, size );
+    ScanFilterConfig config;
+    config.shadowAngle = 10.0 * M_PI / 180.0;
+    config.shadowWindow = 1;
+    ScanFilter filter( g, config );
+
+    vector<float> ranges( size, 4.0f );
+    for ( unsigned int i = 15; i <= 25; ++i )
+        ranges[i] = 2.0f;
+    ranges[14] = 3.0f;
+    ranges[26] = 3.0f;
+
+    vector<uint8_t> valid( size );
+    filter.filter( &ranges[0], 0, &valid[0] );
+
+    check( !valid[14] && !valid[26], "mixed readings removed" );
+    for ( unsigned int i = 15; i <= 25; ++i )
+        check( valid[i], "box kept", i );
+    for ( unsigned int i = 0; i < 13; ++i )
+        check( valid[i] && valid[size-1-i], "wall kept", i );
+}
+
+}
+
+int main()
+{
+    srand( 7 );
+
+    ScanFilterConfig plain;
+
+    ScanFilterConfig full;
+    full.minRange = 0.1;
+    full.maxRange = 25.0;
+    full.minIntensity = 200;
+    full.medianWindow = 5;
+    full.shadowAngle = 0.2;
+    full.shadowWindow = 2;
+    full.rejectedRange = 30.0;
+
+    ScanFilterConfig median3;
+    median3.medianWindow = 3;
+    median3.shadowAngle = 0.15;
+
+    // UTM-30LX and odd sizes, including ones smaller than a SIMD block and the windows
+    const unsigned int sizes[] = { 1081, 1080, 726, 7, 5, 3, 2, 1 };
+    for ( unsigned int s = 0; s < sizeof(sizes)/sizeof(sizes[0]); ++s )
+    {
+        testMillimetres( sizes[s], plain );
+        testMillimetres( sizes[s], full );
+        testMillimetres( sizes[s], median3 );
+        testMetres( sizes[s], plain );
+        testMetres( sizes[s], full );
+        testMetres( sizes[s], median3 );
+    }
+
+    testShadowScene();
+
+    // bad configs are refused
+    ScanFilterConfig bad;
+    bad.medianWindow = 4;
+    check( !bad.isValid(), "even median window is invalid" );
+    try
+    {
+        ScanFilter filter( ScanGeometry( 0.0, 0.01, 100 ), bad );
+        check( false, "ScanFilter accepted an invalid config" );
+    }
+    catch ( const gbxutilacfr::Exception& )
+    {
+    }
+
+    if ( failures > 0 )
+    {
+        cout << "Test FAILED: " << failures << " failures" << endl;
+        return EXIT_FAILURE;
+    }
+    cout << "Test PASSED" << endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+//
+// Per-scan cost of turning a UTM-30LX scan (1081 readings) into points:
+// per-reading step_to_angle() + cos/sin, as consumers do it today, against
+// ScanGeometry in 2D and 3D.
+//
+// Usage: scangeometrybench [number of scans]
+//
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <sys/time.h>
+#include <gbxscanacfr/scangeometry.h>
+
+using namespace std;
+using namespace gbxscanacfr;
+
+namespace {
+
+const int FIRST_STEP = 0;
+const int LAST_STEP = 1080;
+const int FRONT_STEP = 540;
+const double RESOLUTION = 2.0 * M_PI / 1440;
+
+double
+now()
+{
+    timeval tv;
+    gettimeofday( &tv, 0 );
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+void
+report( const char* name, double seconds, int numScans, float checksum )
+{
+    cout << setw(32) << left << name
+         << setw(10) << right << fixed << setprecision(2) << seconds / numScans * 1e6 << " us/scan"
+         << setw(12) << setprecision(0) << numScans / seconds << " scans/s"
+         << "   (checksum " << setprecision(3) << checksum << ")" << endl;
+}
+
+}
+
+int main( int argc, char **argv )
+{
+    int numScans = 20000;
+    if ( argc > 1 )
+        numScans = atoi( argv[1] );
+    if ( numScans <= 0 )
+    {
+        cout << "Usage: scangeometrybench [number of scans]" << endl;
+        return EXIT_FAILURE;
+    }
+
+    ScanGeometry geometry = ScanGeometry::fromSteps( FIRST_STEP, LAST_STEP, 1, FRONT_STEP, RESOLUTION );
+    geometry.setMount( MountTransform( 0.2, 0.0, 0.5, 0.0, 0.1, 0.0 ) );
+    const unsigned int size = geometry.size();
+
+    vector<uint32_t> ranges( size );
+    for ( unsigned int i = 0; i < size; ++i )
+        ranges[i] = ( i % 37 == 0 ) ? 1 : 100 + rand() % 29000;
+
+    vector<float> x( size ), y( size ), z( size );
+    vector<uint8_t> valid( size );
+    float checksum;
+    double start;
+
+    cout << "UTM-30LX geometry, " << size << " readings, " << numScans << " scans" << endl;
+#ifdef __SSE2__
+    cout << "SSE2 kernels" << endl;
+#else
+    cout << "scalar kernels" << endl;
+#endif
+
+    // what a consumer of ScanData does today
+    checksum = 0.0f;
+    start = now();
+    for ( int s = 0; s < numScans; ++s )
+    {
+        for ( unsigned int i = 0; i < size; ++i )
+        {
+            bool good = ranges[i] >= 20;
+            double angle = ( FIRST_STEP + (int)i - FRONT_STEP ) * RESOLUTION;  // Sensor::step_to_angle()
+            double r = good ? ranges[i] * 0.001 : 0.0;
+            x[i] = (float)( r * cos( angle ) );
+            y[i] = (float)( r * sin( angle ) );
+            valid[i] = good;
+        }
+        checksum += x[s % size];
+    }
+    report( "per-reading cos/sin", now() - start, numScans, checksum );
+
+    checksum = 0.0f;
+    start = now();
+    for ( int s = 0; s < numScans; ++s )
+    {
+        geometry.project( &ranges[0], &x[0], &y[0], &valid[0] );
+        checksum += x[s % size];
+    }
+    report( "ScanGeometry 2D", now() - start, numScans, checksum );
+
+    checksum = 0.0f;
+    start = now();
+    for ( int s = 0; s < numScans; ++s )
+    {
+        geometry.project3d( &ranges[0], &x[0], &y[0], &z[0], &valid[0] );
+        checksum += z[s % size];
+    }
+    report( "ScanGeometry 3D with mount", now() - start, numScans, checksum );
+
+    checksum = 0.0f;
+    start = now();
+    for ( int s = 0; s < numScans; ++s )
+        checksum += geometry.errorMask( &ranges[0], &valid[0] );
+    report( "ScanGeometry error mask only", now() - start, numScans, checksum );
+
+    return EXIT_SUCCESS;
+}
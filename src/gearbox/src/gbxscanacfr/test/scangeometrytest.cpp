@@ -0,0 +1,173 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <gbxscanacfr/scangeometry.h>
+
+using namespace std;
+using namespace gbxscanacfr;
+
+namespace {
+
+// float tables against double trig: relative error of a projected point
+const double MAX_RELATIVE_ERROR = 1e-6;
+
+int failures = 0;
+
+void
+check( bool ok, const char* what, unsigned int i=0 )
+{
+    if ( !ok )
+    {
+        cout << "failed: " << what << " (reading " << i << ")" << endl;
+        ++failures;
+    }
+}
+
+// Hokuyo-style ranges in mm, including error codes (<20) and a few far readings
+void
+makeRanges( unsigned int size, vector<uint32_t>& mm, vector<float>& m )
+{
+    mm.resize( size );
+    m.resize( size );
+    for ( unsigned int i = 0; i < size; ++i )
+    {
+        if ( i % 17 == 3 )
+            mm[i] = i % 20;             // error code
+        else
+            mm[i] = 20 + rand() % 30000;
+        m[i] = mm[i] * 0.001f;
+    }
+}
+
+// Projection in the sensor plane against sin/cos of step_to_angle(), for odd sizes too
+void
+testPlanar( const ScanGeometry& g, int firstStep, unsigned int clusterCount, int frontStep, double resolution )
+{
+    vector<uint32_t> mm;
+    vector<float> m;
+    makeRanges( g.size(), mm, m );
+
+    vector<float> x( g.size() ), y( g.size() ), xm( g.size() ), ym( g.size() );
+    vector<uint8_t> valid( g.size() ), validm( g.size() ), mask( g.size() );
+
+    unsigned int count = g.project( &mm[0], &x[0], &y[0], &valid[0] );
+    unsigned int countm = g.project( &m[0], &xm[0], &ym[0], &validm[0] );
+    unsigned int countMask = g.errorMask( &mm[0], &mask[0] );
+
+    unsigned int expected = 0;
+    for ( unsigned int i = 0; i < g.size(); ++i )
+    {
+        bool good = mm[i] >= 20;
+        expected += good;
+        check( valid[i] == good, "mm validity", i );
+        check( validm[i] == good, "m validity", i );
+        check( mask[i] == good, "error mask", i );
+
+        // what Sensor::step_to_angle() gives for the first step of the cluster
+        double angle = ( firstStep + (int)( i * clusterCount ) - frontStep ) * resolution;
+        double r = good ? mm[i] * 0.001 : 0.0;
+        double tol = MAX_RELATIVE_ERROR * ( r + 1.0 );
+        check( fabs( x[i] - r * cos( angle ) ) <= tol, "x", i );
+        check( fabs( y[i] - r * sin( angle ) ) <= tol, "y", i );
+        check( fabs( xm[i] - r * cos( angle ) ) <= tol, "x from metres", i );
+        check( fabs( ym[i] - r * sin( angle ) ) <= tol, "y from metres", i );
+    }
+    check( count == expected, "mm count" );
+    check( countm == expected, "m count" );
+    check( countMask == expected, "mask count" );
+}
+
+// 3D through a mount transform, against the rotation applied by hand
+void
+testMount()
+{
+    ScanGeometry g = ScanGeometry::fromFieldOfView( -M_PI/2, M_PI, 181 );
+    g.setRangeLimits( 0.0, 8.0 );
+    const double roll = 0.1, pitch = -0.3, yaw = 2.0;
+    const double tx = 0.5, ty = -0.2, tz = 1.1;
+    g.setMount( MountTransform( tx, ty, tz, roll, pitch, yaw ) );
+
+    vector<float> ranges( g.size() );
+    for ( unsigned int i = 0; i < g.size(); ++i )
+        ranges[i] = ( rand() % 9000 ) * 0.001f;     // some above maxRange
+    ranges[7] = numeric_limits<float>::quiet_NaN();
+
+    vector<float> x( g.size() ), y( g.size() ), z( g.size() );
+    vector<uint8_t> valid( g.size() );
+    g.project3d( &ranges[0], &x[0], &y[0], &z[0], &valid[0] );
+
+    for ( unsigned int i = 0; i < g.size(); ++i )
+    {
+        double angle = -M_PI/2 + i * M_PI / 180;
+        bool good = ranges[i] >= 0.0f && ranges[i] <= 8.0f;
+        double r = good ? ranges[i] : 0.0;
+        check( valid[i] == good, "3d validity", i );
+
+        // x' = Rz(yaw) Ry(pitch) Rx(roll) (r cos, r sin, 0) + t, step by step
+        double p[3] = { r * cos( angle ), r * sin( angle ), 0.0 };
+        double q[3];
+        q[0] = p[0];
+        q[1] = cos( roll ) * p[1] - sin( roll ) * p[2];
+        q[2] = sin( roll ) * p[1] + cos( roll ) * p[2];
+        p[0] = cos( pitch ) * q[0] + sin( pitch ) * q[2];
+        p[1] = q[1];
+        p[2] = -sin( pitch ) * q[0] + cos( pitch ) * q[2];
+        q[0] = cos( yaw ) * p[0] - sin( yaw ) * p[1];
+        q[1] = sin( yaw ) * p[0] + cos( yaw ) * p[1];
+        q[2] = p[2];
+
+        double tol = MAX_RELATIVE_ERROR * ( r + 2.0 );
+        check( fabs( x[i] - ( q[0] + tx ) ) <= tol, "3d x", i );
+        check( fabs( y[i] - ( q[1] + ty ) ) <= tol, "3d y", i );
+        check( fabs( z[i] - ( q[2] + tz ) ) <= tol, "3d z", i );
+    }
+}
+
+}
+
+int main()
+{
+    srand( 42 );
+
+    // UTM-30LX, full scan
+    const double utmResolution = 2.0 * M_PI / 1440;
+    ScanGeometry utm = ScanGeometry::fromSteps( 0, 1080, 1, 540, utmResolution );
+    check( utm.size() == 1081, "UTM-30LX size" );
+    testPlanar( utm, 0, 1, 540, utmResolution );
+
+    // URG-04LX, part of the scan, clustered, with a size that isn't a multiple of 4
+    const double urgResolution = 2.0 * M_PI / 1024;
+    ScanGeometry urg = ScanGeometry::fromSteps( 44, 725, 3, 384, urgResolution );
+    check( urg.size() == ( 725 - 44 + 1 ) / 3, "URG-04LX clustered size" );
+    testPlanar( urg, 44, 3, 384, urgResolution );
+
+    // smaller than one SIMD block
+    testPlanar( ScanGeometry::fromSteps( 100, 102, 1, 384, urgResolution ), 100, 1, 384, urgResolution );
+
+    testMount();
+
+    // nothing to do, but mustn't crash
+    ScanGeometry empty;
+    check( empty.project( (const float*)0, 0, 0 ) == 0, "empty 2d" );
+    check( empty.project3d( (const float*)0, 0, 0, 0 ) == 0, "empty 3d" );
+
+    if ( failures > 0 )
+    {
+        cout << "Test FAILED: " << failures << " failures" << endl;
+        return EXIT_FAILURE;
+    }
+    cout << "Test PASSED" << endl;
+    return EXIT_SUCCESS;
+}
@@ -65,7 +65,8 @@ Config::Config() :
     maxRange(0.0),
     fieldOfView(0.0),
     startAngle(0.0),
-    numberOfSamples(0)
+    numberOfSamples(0),
+    interlaced(false)
 {
 }
 
@@ -73,7 +74,8 @@ bool
 Config::isValid() const
 {
     // Don't bother verifying device, the user will find out soon enough when the Driver bitches.
-    if ( !( baudRate == 9600    ||
+    if ( !( baudRate == 0       ||
+            baudRate == 9600    ||
             baudRate == 19200   ||
             baudRate == 38400   ||
             baudRate == 500000 ) )
@@ -85,6 +87,15 @@ Config::isValid() const
     if ( fieldOfView <= 0.0 || fieldOfView > DEG2RAD(360.0) ) return false;
     if ( startAngle <= DEG2RAD(-360.0) || startAngle > DEG2RAD(360.0) ) return false;
     if ( numberOfSamples <= 0 ) return false;
+    if ( interlaced )
+    {
+        if ( numberOfSamples < 2 ) return false;
+        // Only finer resolutions are measured over several rotations
+        const int angleIncrementInHundredthDegrees = (int)round(100.0*RAD2DEG(fieldOfView)/(numberOfSamples-1));
+        if ( angleIncrementInHundredthDegrees != ANGULAR_RESOLUTION_0_5_DEG &&
+             angleIncrementInHundredthDegrees != ANGULAR_RESOLUTION_0_25_DEG )
+            return false;
+    }
 
     return true;
 }
@@ -93,7 +104,7 @@ std::string
 Config::toString() const
 {
     std::stringstream ss;
-    ss << "Laser driver config: device="<<device<<", baudRate="<<baudRate<<", minr="<<minRange<<", maxr="<<maxRange<<", fov="<<RAD2DEG(fieldOfView)<<"deg, start="<<RAD2DEG(startAngle)<<"deg, num="<<numberOfSamples;
+    ss << "Laser driver config: device="<<device<<", baudRate="<<baudRate<<", minr="<<minRange<<", maxr="<<maxRange<<", fov="<<RAD2DEG(fieldOfView)<<"deg, start="<<RAD2DEG(startAngle)<<"deg, num="<<numberOfSamples<<", interlaced="<<interlaced;
     return ss.str();
 }
 
@@ -101,20 +112,23 @@ bool
 Config::operator==( const Config & other )
 {
     return (minRange==other.minRange && maxRange==other.maxRange && fieldOfView==other.fieldOfView 
-         && startAngle==other.startAngle && numberOfSamples==other.numberOfSamples);
+         && startAngle==other.startAngle && numberOfSamples==other.numberOfSamples
+         && interlaced==other.interlaced);
 }
 
 bool 
 Config::operator!=( const Config & other )
 {
     return (minRange!=other.minRange || maxRange!=other.maxRange || fieldOfView!=other.fieldOfView 
-         || startAngle!=other.startAngle || numberOfSamples!=other.numberOfSamples);
+         || startAngle!=other.startAngle || numberOfSamples!=other.numberOfSamples
+         || interlaced!=other.interlaced);
 }
 
 ////////////////////////
 
 Driver::Driver( const Config &config, gbxutilacfr::Tracer& tracer, gbxutilacfr::Status& status )
     : config_(config),
+      baudRate_(0),
       tracer_(tracer),
       status_(status)
 {
@@ -312,6 +326,14 @@ Driver::desiredAngularResolution()
     return (uint16_t)angleIncrementInHundredthDegrees;
 }
 
+int
+Driver::numPartialScans()
+{
+    if ( !config_.interlaced )
+        return 1;
+    return ANGULAR_RESOLUTION_1_0_DEG / desiredAngularResolution();
+}
+
 bool 
 Driver::isAsDesired( const LmsConfigurationData &lmsConfig )
 {
@@ -365,19 +387,43 @@ Driver::setBaudRate( int baudRate )
     constructRequestBaudRate( commandAndData_, baudRate );
     sendAndExpectRxMsg( commandAndData_ );
     // And switch myself
-    serialHandler_->setBaudRate( config_.baudRate );
+    serialHandler_->setBaudRate( baudRate );
+}
+
+bool
+Driver::switchBaudRate( int baudRate )
+{
+    stringstream ss;
+    ss << "Driver: Switching to " << baudRate << " baud.";
+    tracer_.info( ss.str() );
+
+    try {
+        setBaudRate( baudRate );
+        // Make sure the link really works at the new rate: the ACK to the switch
+        // was sent at the old one.
+        askLaserForStatusData();
+        return true;
+    }
+    catch ( const std::exception &e )
+    {
+        stringstream ss;
+        ss << "Driver: Failed to switch to " << baudRate << " baud: " << e.what();
+        tracer_.warning( ss.str() );
+        return false;
+    }
 }
 
 int
 Driver::guessLaserBaudRate()
 {
     // Guess our current configuration first: maybe the laser driver was re-started.
+    const int firstBaudRate = config_.baudRate ? config_.baudRate : 500000;
     std::vector<int> baudRates;
-    baudRates.push_back( config_.baudRate );
-    if ( config_.baudRate != 9600 ) baudRates.push_back( 9600 );
-    if ( config_.baudRate != 19200 ) baudRates.push_back( 19200 );
-    if ( config_.baudRate != 38400 ) baudRates.push_back( 38400 );
-    if ( config_.baudRate != 500000 ) baudRates.push_back( 500000 );
+    baudRates.push_back( firstBaudRate );
+    if ( firstBaudRate != 9600 ) baudRates.push_back( 9600 );
+    if ( firstBaudRate != 19200 ) baudRates.push_back( 19200 );
+    if ( firstBaudRate != 38400 ) baudRates.push_back( 38400 );
+    if ( firstBaudRate != 500000 ) baudRates.push_back( 500000 );
     
     for ( size_t baudRateI=0; baudRateI < baudRates.size(); baudRateI++ )
     {
@@ -385,17 +431,17 @@ Driver::guessLaserBaudRate()
         ss << "Driver: Trying to connect at " << baudRates[baudRateI] << " baud.";
         tracer_.info( ss.str() );
 
-        // Switch my local serial port
-        serialHandler_->setBaudRate( baudRates[baudRateI] );
-            
         try {
+            // Switch my local serial port
+            serialHandler_->setBaudRate( baudRates[baudRateI] );
+
             stringstream ss;
             ss <<"Driver: Trying to get laser status with baudrate " << baudRates[baudRateI];
             tracer_.debug( ss.str() );
             askLaserForStatusData();
             return baudRates[baudRateI];
         }
-        catch ( const NoRxMsgException &e )
+        catch ( const std::exception &e )
         {
             stringstream ss;
             ss << "Driver::guessLaserBaudRate(): failed: " << e.what();
@@ -423,10 +469,34 @@ Driver::initLaser()
     // Set Desired BaudRate
     //
     tracer_.debug("Driver: Telling the laser to switch to the desired baud rate");
-    if ( currentBaudRate != config_.baudRate )
+    std::vector<int> desiredBaudRates;
+    if ( config_.baudRate == 0 )
     {
-        setBaudRate( config_.baudRate );
+        // As fast as the serial link allows
+        desiredBaudRates.push_back( 500000 );
+        desiredBaudRates.push_back( 38400 );
     }
+    else
+        desiredBaudRates.push_back( config_.baudRate );
+    for ( size_t i=0; i < desiredBaudRates.size(); i++ )
+    {
+        if ( currentBaudRate == desiredBaudRates[i] )
+            break;
+        if ( switchBaudRate( desiredBaudRates[i] ) )
+        {
+            currentBaudRate = desiredBaudRates[i];
+            break;
+        }
+        // Either end may or may not have switched: find the laser again
+        currentBaudRate = guessLaserBaudRate();
+    }
+    if ( config_.baudRate != 0 && currentBaudRate != config_.baudRate )
+    {
+        stringstream ss;
+        ss << "Failed to switch the laser to " << config_.baudRate << " baud, it is still at " << currentBaudRate << " baud.";
+        throw gbxutilacfr::Exception( ERROR_INFO, ss.str() );
+    }
+    baudRate_ = currentBaudRate;
 
     // Gather info about the SICK
     stringstream ssInfo;
@@ -492,7 +562,8 @@ Driver::initLaser()
     //
     // Configure the angular resolution
     //
-    const uint16_t desiredScanningAngle = 180;
+    // The laser supports 100deg and 180deg
+    const uint16_t desiredScanningAngle = (uint16_t)round(RAD2DEG(config_.fieldOfView));
     constructSwitchVariant( desiredScanningAngle,
                             desiredAngularResolution(),
                             commandAndData_ );
@@ -511,10 +582,18 @@ Driver::initLaser()
     //
     // Start continuous mode
     //
-    constructRequestContinuousMode( commandAndData_ );
+    if ( numPartialScans() > 1 )
+        constructRequestPartialContinuousMode( commandAndData_ );
+    else
+        constructRequestContinuousMode( commandAndData_ );
     TimedLmsRxMsg contRxMsg = sendAndExpectRxMsg( commandAndData_ );
 
-    tracer_.info( "Driver: enabled continuous mode, laser is running." );
+    stringstream ssMode;
+    ssMode << "Driver: enabled continuous mode at " << baudRate_ << " baud";
+    if ( numPartialScans() > 1 )
+        ssMode << ", interlacing " << numPartialScans() << " partial scans";
+    ssMode << ", laser is running.";
+    tracer_.info( ssMode.str() );
 }
 
 TimedLmsRxMsg
@@ -570,9 +649,34 @@ Driver::sendAndExpectRxMsg( const std::vector<uChar> &commandAndData, bool ignor
     return rxMsg;
 }
 
+void
+Driver::checkMeasurementRxMsg( const TimedLmsRxMsg &rxMsg, Data &data )
+{
+    if ( rxMsg.msg->isError() )
+    {
+        std::string errorLog = errorConditions();
+        stringstream ss;
+        ss << "Scan data indicates errors: " << toString(rxMsg.msg) << endl << "Laser error log: " << errorLog;
+        throw RxMsgIsErrorException( ss.str() );        
+    }
+    else if ( rxMsg.msg->isWarn() )
+    {
+        data.haveWarnings = true;
+        stringstream ss;
+        ss << "Scan data indicates warnings: " << toString(rxMsg.msg);
+        data.warnings = ss.str();
+    }
+}
+
 void 
 Driver::read( Data &data )
 {
+    if ( numPartialScans() > 1 )
+    {
+        readInterlaced( data );
+        return;
+    }
+
     TimedLmsRxMsg rxMsg;
 
     // This timeout is greater than the scan inter-arrival time for all baudrates.
@@ -586,25 +690,81 @@ Driver::read( Data &data )
 
     LmsMeasurementData *measuredData = (LmsMeasurementData*)rxMsg.msg->data.get();
 
-    if ( rxMsg.msg->isError() )
-    {
-        std::string errorLog = errorConditions();
-        stringstream ss;
-        ss << "Scan data indicates errors: " << toString(rxMsg.msg) << endl << "Laser error log: " << errorLog;
-        throw RxMsgIsErrorException( ss.str() );        
-    }
-    else if ( rxMsg.msg->isWarn() )
-    {
-        data.haveWarnings = true;
-        stringstream ss;
-        ss << "Scan data indicates warnings: " << toString(rxMsg.msg);
-        data.warnings = ss.str();
-    }
+    checkMeasurementRxMsg( rxMsg, data );
 
     memcpy( &(data.ranges[0]), &(measuredData->ranges[0]), measuredData->ranges.size()*sizeof(float) );
     memcpy( &(data.intensities[0]), &(measuredData->intensities[0]), measuredData->intensities.size()*sizeof(unsigned char) );
     data.timeStampSec = rxMsg.timeStampSec;
     data.timeStampUsec = rxMsg.timeStampUsec;
+    data.numPartialScans = 0;
+}
+
+void
+Driver::readInterlaced( Data &data )
+{
+    const int numPartials = numPartialScans();
+    // Partial scans are numbered by their offset, in quarter degrees
+    const int partialNumberStep = Data::MAX_PARTIAL_SCANS / numPartials;
+    // This timeout is greater than the partial scan inter-arrival time for all baudrates.
+    const int timeoutMs = 1000;
+
+    int nextPartial = 0;
+    while ( nextPartial < numPartials )
+    {
+        TimedLmsRxMsg rxMsg;
+        bool received = waitForRxMsgType( ACK_REQUEST_MEASURED_VALUES, rxMsg, timeoutMs );
+        if ( !received )
+        {
+            throw gbxutilacfr::Exception( ERROR_INFO, "No partial scan received." );
+        }
+
+        LmsMeasurementData *measuredData = (LmsMeasurementData*)rxMsg.msg->data.get();
+        if ( !measuredData->isPartialScan )
+        {
+            throw gbxutilacfr::Exception( ERROR_INFO, "Received a complete scan in interlaced mode." );
+        }
+
+        const int partial = measuredData->partialScanNumber / partialNumberStep;
+        if ( measuredData->partialScanNumber % partialNumberStep != 0 ||
+             partial != nextPartial )
+        {
+            // Joined part way through a scan, or lost part of it: wait for the start of the next one.
+            if ( nextPartial != 0 )
+            {
+                stringstream ss;
+                ss << "Driver: Expected partial scan " << nextPartial*partialNumberStep
+                   << ", got " << measuredData->partialScanNumber << ". Dropping the scan.";
+                tracer_.warning( ss.str() );
+            }
+            nextPartial = 0;
+            if ( measuredData->partialScanNumber != 0 )
+                continue;
+        }
+
+        checkMeasurementRxMsg( rxMsg, data );
+
+        // Partial scan p holds samples p, p+numPartials, p+2*numPartials, ...
+        const int numValues = (config_.numberOfSamples - partial + numPartials - 1) / numPartials;
+        if ( (int)measuredData->ranges.size() != numValues )
+        {
+            stringstream ss;
+            ss << "Partial scan " << measuredData->partialScanNumber << " has " << measuredData->ranges.size()
+               << " samples, expected " << numValues;
+            throw gbxutilacfr::Exception( ERROR_INFO, ss.str() );
+        }
+        for ( int i=0; i < numValues; i++ )
+        {
+            data.ranges[i*numPartials+partial] = measuredData->ranges[i];
+            data.intensities[i*numPartials+partial] = measuredData->intensities[i];
+        }
+        data.partialTimeStampSec[partial] = rxMsg.timeStampSec;
+        data.partialTimeStampUsec[partial] = rxMsg.timeStampUsec;
+        nextPartial++;
+    }
+
+    data.numPartialScans = numPartials;
+    data.timeStampSec = data.partialTimeStampSec[numPartials-1];
+    data.timeStampUsec = data.partialTimeStampUsec[numPartials-1];
 }
 
 } // namespace
@@ -30,7 +30,7 @@ public:
 
     //! Serial device. e.g. "/dev/ttyS0"
     std::string device;
-    //! Baud rate
+    //! Baud rate. Set to 0 to use 500000 if the serial link can carry it, and 38400 otherwise.
     int baudRate;
     //! minimum range [m]
     double minRange;
@@ -42,6 +42,10 @@ public:
     double startAngle;
     //! number of samples in a scan
     int    numberOfSamples;
+    //! At angular resolutions finer than 1deg, the laser measures a scan over 2 (0.5deg)
+    //! or 4 (0.25deg) mirror rotations. If set, each rotation is sent as soon as it is
+    //! measured and the driver interlaces them into the full scan.
+    bool   interlaced;
 };
 
 //! Data structure returned by read()
@@ -49,13 +53,24 @@ class Data
 {
 public:
     Data()
-        : haveWarnings(false)
+        : numPartialScans(0),
+          haveWarnings(false)
         {}
 
+    //! The most partial scans a scan is interlaced from.
+    static const int MAX_PARTIAL_SCANS = 4;
+
     float         *ranges;
     unsigned char *intensities;
+    //! When the scan was received. For interlaced scans, when its last partial scan was received.
     int            timeStampSec;
     int            timeStampUsec;
+    //! Number of partial scans the scan was interlaced from, or 0 if it was received whole.
+    //! Sample i was measured in partial scan i%numPartialScans.
+    int            numPartialScans;
+    //! When each partial scan was received.
+    int            partialTimeStampSec[MAX_PARTIAL_SCANS];
+    int            partialTimeStampUsec[MAX_PARTIAL_SCANS];
     bool           haveWarnings;
     //! if 'haveWarnings' is set, 'warnings' will contain diagnostic information.
     std::string    warnings;
@@ -85,8 +100,15 @@ public:
     //!
     void read( Data &data );
 
+    //! The baud rate the driver is talking to the laser at.
+    int baudRate() const { return baudRate_; }
+
 private: 
 
+    // Reads partial scans until a full scan has been interlaced.
+    void readInterlaced( Data &data );
+    void checkMeasurementRxMsg( const TimedLmsRxMsg &rxMsg, Data &data );
+
     // Waits up to maxWaitMs for a rxMsg of a particular type.
     // Returns true iff it got the rxMsg it wanted.
     bool waitForRxMsgType( uChar type, TimedLmsRxMsg &rxMsg, int maxWaitMs );
@@ -113,9 +135,16 @@ private:
     uChar desiredMeasuredValueUnit();
     uint16_t desiredAngularResolution();
 
+    // Number of partial scans per scan, or 1 if scans aren't interlaced.
+    int numPartialScans();
+
     void setBaudRate( int baudRate );
+    // Switches to baudRate and checks the laser still answers.
+    // If it doesn't, finds it again and returns false.
+    bool switchBaudRate( int baudRate );
 
     Config config_;
+    int    baudRate_;
 
     std::auto_ptr<SerialHandler> serialHandler_;
 
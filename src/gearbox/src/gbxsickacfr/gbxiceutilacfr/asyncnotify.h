@@ -0,0 +1,124 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2013 Dave Coleman
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#ifndef GBXICEUTILACFR_ASYNCNOTIFY_H
+#define GBXICEUTILACFR_ASYNCNOTIFY_H
+
+#include <gbxsickacfr/gbxiceutilacfr/notify.h>
+#include <gbxsickacfr/gbxiceutilacfr/sharedstore.h>
+#include <gbxsickacfr/gbxiceutilacfr/thread.h>
+
+namespace gbxiceutilacfr {
+
+/*!
+ * @brief A Notify which calls the handler from its own thread.
+ *
+ *  set() returns as soon as the data has been handed to a dispatcher thread, which then calls
+ *  NotifyHandler::handleData. The setter is never held up by a slow handler.
+ *
+ *  Data is coalesced: if set() is called again before the handler has been called with the
+ *  previous object, only the latest object is delivered. The handler always gets the latest data,
+ *  but may not see every object.
+ *
+ *  set() copies the object once. Use setBySwap() to hand it over without copying.
+ *
+ *  @see Notify, SharedStore
+ */
+template<class Type>
+class AsyncNotify : public Notify<Type>
+{
+public:
+    AsyncNotify();
+
+    //! Stops the dispatcher thread, waiting for a handler call in progress to return.
+    virtual ~AsyncNotify();
+
+    //! Like set(), but swaps the contents of @p obj out instead of copying them.
+    //! @p obj is left default-constructed.
+    void setBySwap( Type & obj );
+
+protected:
+    virtual void internalSet( const Type & obj );
+
+private:
+
+    class Dispatcher : public gbxiceutilacfr::Thread
+    {
+    public:
+        Dispatcher( AsyncNotify<Type> &notify )
+            : notify_(notify) {}
+        virtual void run();
+    private:
+        AsyncNotify<Type> &notify_;
+    };
+
+    // The next object to deliver
+    SharedStore<Type> pending_;
+    gbxiceutilacfr::ThreadPtr dispatcher_;
+};
+
+template<class Type>
+AsyncNotify<Type>::AsyncNotify()
+{
+    dispatcher_ = new Dispatcher( *this );
+    dispatcher_->start();
+}
+
+template<class Type>
+AsyncNotify<Type>::~AsyncNotify()
+{
+    gbxiceutilacfr::stopAndJoin( dispatcher_ );
+}
+
+template<class Type>
+void AsyncNotify<Type>::setBySwap( Type & obj )
+{
+    if ( !this->hasNotifyHandler() ) {
+        throw gbxutilacfr::Exception( ERROR_INFO, "setting data when data handler has not been set" );
+    }
+
+    pending_.setBySwap( obj );
+}
+
+template<class Type>
+void AsyncNotify<Type>::internalSet( const Type & obj )
+{
+    pending_.set( obj );
+}
+
+template<class Type>
+void AsyncNotify<Type>::Dispatcher::run()
+{
+    // Wake up now and then to check whether we have to stop
+    const int stopCheckIntervalMs = 100;
+
+    typename SharedStore<Type>::Ptr obj;
+    while ( !isStopping() )
+    {
+        if ( notify_.pending_.getNext( obj, stopCheckIntervalMs ) != 0 )
+            continue;
+
+        try {
+            notify_.handler_->handleData( obj->get() );
+        }
+        catch ( const std::exception &e ) {
+            std::cout<<"TRACE(asyncnotify.h): handler threw exception: " << e.what() << std::endl;
+        }
+        catch ( ... ) {
+            std::cout<<"TRACE(asyncnotify.h): handler threw unknown exception." << std::endl;
+        }
+        // Don't hold on to the object until the next one arrives
+        obj = 0;
+    }
+}
+
+} // end namespace
+
+#endif
@@ -16,9 +16,12 @@
 #define GBXICEUTILACFR_GBXICEUTILACFRL_H
 
 #include <gbxsickacfr/gbxiceutilacfr/safethread.h>
+#include <gbxsickacfr/gbxiceutilacfr/periodicthread.h>
 #include <gbxsickacfr/gbxiceutilacfr/timer.h>
 #include <gbxsickacfr/gbxiceutilacfr/buffer.h>
 #include <gbxsickacfr/gbxiceutilacfr/store.h>
+#include <gbxsickacfr/gbxiceutilacfr/sharedstore.h>
+#include <gbxsickacfr/gbxiceutilacfr/asyncnotify.h>
 
 /*!
 @brief Utility namespace (part of SICK-ACFR driver)
@@ -0,0 +1,291 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <pthread.h>
+#include <sched.h>
+
+#include <gbxutilacfr/exceptions.h>
+#include "periodicthread.h"
+
+using namespace std;
+
+namespace gbxiceutilacfr {
+
+namespace {
+
+    const long NSEC_PER_SEC = 1000000000L;
+
+    // How often a long sleep wakes up to check whether we have to stop
+    const long STOP_CHECK_INTERVAL_NS = 100000000L;
+
+    void addNs( struct timespec &t, long long ns )
+    {
+        long long total = t.tv_nsec + ns;
+        t.tv_sec += total / NSEC_PER_SEC;
+        t.tv_nsec = total % NSEC_PER_SEC;
+    }
+
+    // a-b [us]
+    double diffUs( const struct timespec &a, const struct timespec &b )
+    {
+        return (a.tv_sec-b.tv_sec)*1e6 + (a.tv_nsec-b.tv_nsec)/1e3;
+    }
+
+    bool isBefore( const struct timespec &a, const struct timespec &b )
+    {
+        return a.tv_sec < b.tv_sec || ( a.tv_sec == b.tv_sec && a.tv_nsec < b.tv_nsec );
+    }
+
+    struct timespec now()
+    {
+        struct timespec t;
+        clock_gettime( CLOCK_MONOTONIC, &t );
+        return t;
+    }
+
+}
+
+//////////////////////////////////////////////////////////////////////
+
+TimingHistogram::TimingHistogram()
+{
+    reset();
+}
+
+void
+TimingHistogram::reset()
+{
+    for ( int i=0; i<NUM_BINS; ++i )
+        bins_[i] = 0;
+    count_ = 0;
+    sum_ = 0;
+    max_ = 0;
+}
+
+void
+TimingHistogram::add( double us )
+{
+    if ( us < 0 )
+        us = 0;
+
+    int i = 0;
+    double upper = 1.0;
+    while ( us >= upper && i < NUM_BINS-1 ) {
+        upper *= 2.0;
+        ++i;
+    }
+    bins_[i]++;
+
+    count_++;
+    sum_ += us;
+    if ( us > max_ )
+        max_ = us;
+}
+
+double
+TimingHistogram::mean() const
+{
+    if ( count_ == 0 )
+        return 0;
+    return sum_ / count_;
+}
+
+double
+TimingHistogram::percentile( double fraction ) const
+{
+    const double wanted = fraction * count_;
+    int cumulative = 0;
+    double upper = 1.0;
+    for ( int i=0; i<NUM_BINS-1; ++i ) {
+        cumulative += bins_[i];
+        if ( cumulative >= wanted )
+            return std::min( upper, max_ );
+        upper *= 2.0;
+    }
+    return max_;
+}
+
+std::string
+TimingHistogram::toString() const
+{
+    stringstream ss;
+    ss << "mean=" << (int)mean() << "us p99<=" << (int)percentile( 0.99 )
+       << "us max=" << (int)max() << "us";
+    return ss.str();
+}
+
+std::string
+PeriodicThreadStats::toString() const
+{
+    stringstream ss;
+    ss << "iterations=" << iterations << " overruns=" << overruns
+       << " exec: " << executionTime.toString()
+       << " jitter: " << jitter.toString();
+    return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+PeriodicThread::PeriodicThread( gbxutilacfr::Tracer &tracer,
+                                gbxutilacfr::Status &status,
+                                const std::string   &subsysName,
+                                double               periodSec,
+                                double               reportIntervalSec ) :
+    SafeThread( tracer ),
+    tracer_(tracer),
+    subStatus_( status, subsysName ),
+    periodSec_(periodSec),
+    reportIntervalSec_(reportIntervalSec),
+    realtimePriority_(0),
+    cpu_(-1),
+    overrunsReported_(0)
+{
+    if ( periodSec_ <= 0 )
+        throw gbxutilacfr::Exception( ERROR_INFO, "PeriodicThread: period must be positive" );
+
+    // Allow for a report interval's worth of missed periods before calling it a stall
+    subStatus_.setMaxHeartbeatInterval( 2*reportIntervalSec_ + periodSec_ );
+}
+
+void
+PeriodicThread::setRealtimePriority( int priority )
+{
+    realtimePriority_ = priority;
+}
+
+void
+PeriodicThread::setCpuAffinity( int cpu )
+{
+    cpu_ = cpu;
+}
+
+PeriodicThreadStats
+PeriodicThread::stats() const
+{
+    IceUtil::Mutex::Lock lock( statsMutex_ );
+    return stats_;
+}
+
+void
+PeriodicThread::applySchedulingOptions()
+{
+    if ( realtimePriority_ > 0 )
+    {
+        struct sched_param param;
+        param.sched_priority = realtimePriority_;
+        int ret = pthread_setschedparam( pthread_self(), SCHED_FIFO, &param );
+        if ( ret != 0 ) {
+            stringstream ss;
+            ss << "PeriodicThread: failed to set real-time priority " << realtimePriority_
+               << ", running at normal priority: " << strerror( ret );
+            tracer_.warning( ss.str() );
+        }
+    }
+
+    if ( cpu_ >= 0 )
+    {
+        cpu_set_t cpus;
+        CPU_ZERO( &cpus );
+        CPU_SET( cpu_, &cpus );
+        int ret = pthread_setaffinity_np( pthread_self(), sizeof(cpus), &cpus );
+        if ( ret != 0 ) {
+            stringstream ss;
+            ss << "PeriodicThread: failed to set affinity to CPU " << cpu_ << ": " << strerror( ret );
+            tracer_.warning( ss.str() );
+        }
+    }
+}
+
+bool
+PeriodicThread::sleepUntil( const struct timespec &deadline )
+{
+    while ( !isStopping() )
+    {
+        struct timespec wakeUp = now();
+        if ( !isBefore( wakeUp, deadline ) )
+            return true;
+
+        addNs( wakeUp, STOP_CHECK_INTERVAL_NS );
+        if ( isBefore( deadline, wakeUp ) )
+            wakeUp = deadline;
+
+        int ret = clock_nanosleep( CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUp, 0 );
+        if ( ret != 0 && ret != EINTR )
+            throw gbxutilacfr::Exception( ERROR_INFO, string("PeriodicThread: clock_nanosleep failed: ")+strerror(ret) );
+    }
+    return false;
+}
+
+void
+PeriodicThread::report()
+{
+    PeriodicThreadStats stats = this->stats();
+
+    stringstream ss;
+    ss << "period=" << periodSec_*1e3 << "ms " << stats.toString();
+    if ( stats.overruns > overrunsReported_ )
+        subStatus_.warning( ss.str() );
+    else
+        subStatus_.ok( ss.str() );
+    overrunsReported_ = stats.overruns;
+}
+
+void
+PeriodicThread::walk()
+{
+    subStatus_.initialising();
+    applySchedulingOptions();
+    initialise();
+    subStatus_.working();
+
+    const long long periodNs = (long long)( periodSec_*1e9 );
+    struct timespec deadline = now();
+    struct timespec nextReport = deadline;
+    addNs( nextReport, (long long)( reportIntervalSec_*1e9 ) );
+
+    while ( sleepUntil( deadline ) )
+    {
+        const struct timespec start = now();
+        const double jitterUs = diffUs( start, deadline );
+        iterate();
+        const struct timespec end = now();
+
+        // Skip the periods we ran into, rather than running late ones back to back
+        int overruns = 0;
+        addNs( deadline, periodNs );
+        while ( isBefore( deadline, end ) ) {
+            addNs( deadline, periodNs );
+            overruns++;
+        }
+
+        {
+            IceUtil::Mutex::Lock lock( statsMutex_ );
+            stats_.iterations++;
+            stats_.overruns += overruns;
+            stats_.executionTime.add( diffUs( end, start ) );
+            stats_.jitter.add( jitterUs );
+        }
+
+        if ( !isBefore( end, nextReport ) ) {
+            report();
+            addNs( nextReport, (long long)( reportIntervalSec_*1e9 ) );
+        }
+    }
+
+    subStatus_.finalising();
+    finalise();
+}
+
+} // end namespace
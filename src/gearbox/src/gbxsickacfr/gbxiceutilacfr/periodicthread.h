@@ -0,0 +1,175 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#ifndef GBXICEUTILACFR_PERIODIC_THREAD_H
+#define GBXICEUTILACFR_PERIODIC_THREAD_H
+
+#include <gbxsickacfr/gbxiceutilacfr/safethread.h>
+#include <gbxutilacfr/substatus.h>
+#include <IceUtil/Mutex.h>
+#include <ctime>
+#include <string>
+
+namespace gbxiceutilacfr {
+
+/*!
+@brief A histogram of durations with power-of-two bins.
+
+Bin 0 counts durations under 1us, bin i (i>0) durations in [2^(i-1),2^i) us. The last bin
+also counts anything longer. Not thread-safe.
+ */
+class TimingHistogram
+{
+public:
+    //! The last bin starts at 2^(NUM_BINS-2) us, about 4s.
+    static const int NUM_BINS = 24;
+
+    TimingHistogram();
+
+    //! Records a duration [us].
+    void add( double us );
+
+    //! Forgets all durations.
+    void reset();
+
+    //! Number of durations recorded.
+    int count() const { return count_; }
+    //! Number of durations in bin @p i.
+    int bin( int i ) const { return bins_[i]; }
+    //! Mean duration [us], or 0 if none was recorded.
+    double mean() const;
+    //! Longest duration [us].
+    double max() const { return max_; }
+    //! Upper bound of the bin holding the @p fraction (0..1) quantile [us],
+    //! e.g. percentile(0.99) is an upper bound on the 99th percentile.
+    double percentile( double fraction ) const;
+
+    //! Returns a one-line summary.
+    std::string toString() const;
+
+private:
+    int bins_[NUM_BINS];
+    int count_;
+    double sum_;
+    double max_;
+};
+
+//! Timing statistics of a PeriodicThread.
+struct PeriodicThreadStats
+{
+    PeriodicThreadStats()
+        : iterations(0), overruns(0) {}
+
+    //! Number of times iterate() was called.
+    int iterations;
+    //! Number of periods missed because an iteration took too long.
+    int overruns;
+    //! How long iterate() took.
+    TimingHistogram executionTime;
+    //! How long after its deadline each iteration started.
+    TimingHistogram jitter;
+
+    //! Returns a one-line summary.
+    std::string toString() const;
+};
+
+/*!
+@brief A SafeThread which calls iterate() at a fixed rate.
+
+Iterations are scheduled against absolute deadlines on the monotonic clock (clock_nanosleep with
+TIMER_ABSTIME), so the rate doesn't drift with the time taken by iterate(). If an iteration
+overruns its period, the periods it ran into are skipped and counted as overruns; the thread
+does not try to catch up.
+
+The thread registers a subsystem with gbxutilacfr::Status. Every report interval it sends a
+heartbeat with a summary of the execution-time and jitter histograms, with health Warning if there
+were overruns since the last report. The full statistics are available from stats().
+
+To use this class, implement iterate() and optionally initialise() and finalise().
+@verbatim
+class MyThread : public gbxiceutilacfr::PeriodicThread
+{
+public:
+    MyThread( gbxutilacfr::Tracer &tracer, gbxutilacfr::Status &status )
+        : PeriodicThread( tracer, status, "MyThread", 0.01 ) {}
+private:
+    virtual void iterate() { // do something, 100 times a second }
+};
+@endverbatim
+
+Linux only.
+
+@see SafeThread
+ */
+class PeriodicThread : public SafeThread
+{
+public:
+    //! @p periodSec is the time between iterations. @p subsysName is the name of the
+    //! subsystem registered with @p status.
+    PeriodicThread( gbxutilacfr::Tracer &tracer,
+                    gbxutilacfr::Status &status,
+                    const std::string   &subsysName,
+                    double               periodSec,
+                    double               reportIntervalSec=10.0 );
+
+    //! Runs the thread with the SCHED_FIFO real-time policy at @p priority (1-99). 0, the default,
+    //! leaves the normal policy. Takes effect at start(). If the priority can't be set (usually for
+    //! lack of privileges) a warning is traced and the thread runs at normal priority.
+    void setRealtimePriority( int priority );
+
+    //! Restricts the thread to CPU @p cpu. -1, the default, allows any CPU. Takes effect at start().
+    void setCpuAffinity( int cpu );
+
+    //! Returns the timing statistics since start(). Thread-safe.
+    PeriodicThreadStats stats() const;
+
+    double periodSec() const { return periodSec_; }
+
+protected:
+    //! Called in the thread before the first iteration.
+    virtual void initialise() {}
+
+    //! Called once every period. Implement this function in the derived class.
+    virtual void iterate()=0;
+
+    //! Called in the thread after the last iteration, when it has been told to stop.
+    virtual void finalise() {}
+
+    //! The subsystem status, for the derived class to report its own health.
+    gbxutilacfr::SubStatus& subStatus() { return subStatus_; }
+
+private:
+    // from SafeThread
+    virtual void walk();
+
+    void applySchedulingOptions();
+    // Sleeps until deadline, waking up regularly to check whether we have to stop.
+    // Returns false if we have to stop.
+    bool sleepUntil( const struct timespec &deadline );
+    void report();
+
+    gbxutilacfr::Tracer   &tracer_;
+    gbxutilacfr::SubStatus subStatus_;
+
+    double periodSec_;
+    double reportIntervalSec_;
+    int    realtimePriority_;
+    int    cpu_;
+
+    PeriodicThreadStats stats_;
+    int overrunsReported_;
+    mutable IceUtil::Mutex statsMutex_;
+};
+//! A smart pointer to the PeriodicThread class.
+typedef IceUtil::Handle<PeriodicThread> PeriodicThreadPtr;
+
+} // end namespace
+
+#endif
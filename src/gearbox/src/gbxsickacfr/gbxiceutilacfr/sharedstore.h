@@ -0,0 +1,357 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2013 Dave Coleman
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#ifndef GBXICEUTILACFR_SHAREDSTORE_H
+#define GBXICEUTILACFR_SHAREDSTORE_H
+
+#include <gbxutilacfr/exceptions.h>
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Handle.h>
+#include <IceUtil/Time.h>
+
+#include <algorithm>
+#include <climits>
+#include <ctime>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+namespace gbxiceutilacfr {
+
+/*!
+@brief An object shared read-only between threads.
+
+Hold it with SharedObject::Ptr. Once it has been handed to another thread (e.g. through a
+SharedStore), nobody may change it, so any number of threads can read it without copying or locking.
+ */
+template<class Type>
+class SharedObject : public IceUtil::Shared
+{
+public:
+    typedef IceUtil::Handle< SharedObject<Type> > Ptr;
+
+    SharedObject() {}
+    explicit SharedObject( const Type & obj )
+        : obj_(obj) {}
+
+    //! Returns the object.
+    const Type & get() const { return obj_; }
+
+    //! Creates a shared object holding the contents of @p obj without copying them: they are
+    //! swapped in, leaving @p obj default-constructed.
+    static Ptr swapIn( Type & obj )
+    {
+        Ptr ptr = new SharedObject<Type>;
+        std::swap( ptr->obj_, obj );
+        return ptr;
+    }
+
+private:
+    Type obj_;
+};
+
+namespace detail {
+
+    // Waits while *addr==expected, for at most timeoutMs (or forever if negative).
+    // May return early.
+    inline void futexWait( volatile int *addr, int expected, int timeoutMs )
+    {
+        struct timespec timeout;
+        timeout.tv_sec = timeoutMs / 1000;
+        timeout.tv_nsec = (timeoutMs % 1000) * 1000000;
+        syscall( SYS_futex, addr, FUTEX_WAIT_PRIVATE, expected,
+                 timeoutMs<0 ? 0 : &timeout, 0, 0 );
+    }
+
+    inline void futexWakeAll( volatile int *addr )
+    {
+        syscall( SYS_futex, addr, FUTEX_WAKE_PRIVATE, INT_MAX, 0, 0, 0 );
+    }
+
+    // One set(): the object, and the sequence number that tells it apart from the
+    // objects set before and after it.
+    template<class Type>
+    class SharedSlot : public IceUtil::Shared
+    {
+    public:
+        SharedSlot( const typename SharedObject<Type>::Ptr & obj, int sequence )
+            : obj(obj),
+              sequence(sequence) {}
+
+        const typename SharedObject<Type>::Ptr obj;
+        const int sequence;
+    };
+
+}
+
+/*!
+@brief Thread-safe storage for a single shared object.
+
+Works like Store, but holds a SharedObject by pointer, so set() and get() never copy the object
+itself. This suits large data such as laser scans that are read by several threads.
+
+It is lock-free. The store holds a pointer to a reference-counted slot, and set() swaps in a new
+slot with a compare-and-swap. The pointer shares a 64-bit word with a count of the readers that
+are taking a reference to the slot, so nobody ever waits for a lock. A writer that swaps out a
+slot hands those readers' references over to the slot itself, and the old object is freed when
+the last reader lets go of it. getNext() sleeps on a futex, which set() only touches when
+somebody is waiting.
+
+This is a Linux-only implementation. It relies on user-space addresses fitting in 48 bits,
+as they do on x86-64 and on ARM64 unless 52-bit addresses are enabled.
+
+@see Store, SharedObject
+ */
+template<class Type>
+class SharedStore
+{
+public:
+    typedef typename SharedObject<Type>::Ptr Ptr;
+
+    SharedStore();
+    ~SharedStore();
+
+    //! Returns TRUE if there's something in the Store.
+    bool isEmpty() const;
+
+    //! Returns TRUE if the data in the Store has not been accessed with get() yet.
+    bool isNewData() const;
+
+    //! Sets the contents of the Store. The object must not be changed afterwards.
+    void set( const Ptr & ptr );
+
+    //! Sets the contents of the Store to a copy of @p obj.
+    void set( const Type & obj ) { set( Ptr( new SharedObject<Type>( obj ) ) ); }
+
+    //! Sets the contents of the Store to the contents of @p obj, without copying them.
+    //! @p obj is left default-constructed.
+    void setBySwap( Type & obj ) { set( SharedObject<Type>::swapIn( obj ) ); }
+
+    //! Returns the contents of the Store and makes them "not new". Raises gbxutilacfr::Exception
+    //! if the Store is empty.
+    void get( Ptr & ptr );
+
+    //! Returns the contents of the Store, leaving them "new". Raises gbxutilacfr::Exception
+    //! if the Store is empty.
+    void peek( Ptr & ptr ) const;
+
+    /*!
+    @brief Returns the next new value, waiting for one if needed.
+
+    As with Store::getNext(), an object that has not been read with get() or getNext() yet is
+    returned at once. Otherwise this waits for the next set().
+
+    By default, there is no timeout (negative value). Returns 0 if successful.
+    If timeout is set to a positive value (in milliseconds) and the wait times out, the function returns -1
+    and @p ptr is not touched. Unlike Store::getNext(), spurious wakeups are waited out, so 1 is never
+    returned.
+     */
+    int getNext( Ptr & ptr, int timeoutMs=-1 );
+
+    //! Makes the Store empty.
+    void purge();
+
+private:
+
+    typedef detail::SharedSlot<Type> Slot;
+    typedef IceUtil::Handle<Slot> SlotPtr;
+
+    // The low 48 bits of slot_ point to the current slot, or are 0 when empty. The store
+    // holds one reference to it. The high 16 bits count the readers taking a reference.
+    static const int readerShift = 48;
+    static const uint64_t oneReader = 1ULL << readerShift;
+    static const uint64_t slotMask = oneReader - 1;
+    mutable volatile uint64_t slot_;
+    // Hands out the slots' sequence numbers
+    volatile int sequence_;
+    // Bumped after every set(). This is the futex getNext() waits on.
+    volatile int generation_;
+    // The sequence number of the last object returned by get() or getNext()
+    volatile int readSequence_;
+    volatile int numWaiting_;
+
+    static Slot *slotOf( uint64_t word ) { return reinterpret_cast<Slot*>( (uintptr_t)( word & slotMask ) ); }
+
+    // Returns the current slot, or 0 if the store is empty.
+    SlotPtr load() const;
+    void exchange( Slot *slot );
+
+    // Not copyable
+    SharedStore( const SharedStore & );
+    void operator=( const SharedStore & );
+};
+
+
+//////////////////////////////////////////////////////////////////////
+
+template<class Type>
+SharedStore<Type>::SharedStore()
+    : slot_(0),
+      sequence_(0),
+      generation_(0),
+      readSequence_(0),
+      numWaiting_(0)
+{
+}
+
+template<class Type>
+SharedStore<Type>::~SharedStore()
+{
+    if ( slotOf( slot_ ) )
+        slotOf( slot_ )->__decRef();
+}
+
+template<class Type>
+typename SharedStore<Type>::SlotPtr SharedStore<Type>::load() const
+{
+    // Count ourselves in first. A writer that swaps the slot out before we have our
+    // reference then takes one for us, so the slot can't be freed in between.
+    uint64_t word = slot_;
+    while ( true )
+    {
+        if ( !slotOf( word ) )
+            return 0;
+        const uint64_t seen = __sync_val_compare_and_swap( &slot_, word, word + oneReader );
+        if ( seen == word )
+            break;
+        word = seen;
+    }
+
+    SlotPtr slot = slotOf( word );
+
+    // Count ourselves out again. If the slot has been swapped out meanwhile, drop the
+    // reference the writer took for us instead. Slots are never set twice, so the same
+    // pointer means the same slot.
+    word += oneReader;
+    while ( slotOf( word ) == slot.get() )
+    {
+        const uint64_t seen = __sync_val_compare_and_swap( &slot_, word, word - oneReader );
+        if ( seen == word )
+            return slot;
+        word = seen;
+    }
+    slot->__decRef();
+    return slot;
+}
+
+template<class Type>
+void SharedStore<Type>::exchange( Slot *slot )
+{
+    if ( slot )
+    {
+        if ( (uintptr_t)slot & ~slotMask )
+            throw gbxutilacfr::Exception( ERROR_INFO, "SharedStore: slot address does not fit in 48 bits." );
+        slot->__incRef();
+    }
+
+    uint64_t word = slot_;
+    while ( true )
+    {
+        const uint64_t seen = __sync_val_compare_and_swap( &slot_, word, (uintptr_t)slot );
+        if ( seen == word )
+            break;
+        word = seen;
+    }
+
+    Slot *old = slotOf( word );
+    if ( old )
+    {
+        // One reference for each reader still counted in, who will drop it, before the
+        // store's own. The old object is freed here if nobody else holds it.
+        for ( uint64_t readers = word >> readerShift; readers > 0; readers-- )
+            old->__incRef();
+        old->__decRef();
+    }
+}
+
+template<class Type>
+bool SharedStore<Type>::isEmpty() const
+{
+    return slotOf( slot_ ) == 0;
+}
+
+template<class Type>
+bool SharedStore<Type>::isNewData() const
+{
+    SlotPtr slot = load();
+    return slot && slot->sequence != readSequence_;
+}
+
+template<class Type>
+void SharedStore<Type>::set( const Ptr & ptr )
+{
+    exchange( new Slot( ptr, __sync_add_and_fetch( &sequence_, 1 ) ) );
+
+    // Orders the new slot before the check for waiters (getNext() does the reverse)
+    __sync_add_and_fetch( &generation_, 1 );
+    if ( numWaiting_ > 0 )
+        detail::futexWakeAll( &generation_ );
+}
+
+template<class Type>
+void SharedStore<Type>::get( Ptr & ptr )
+{
+    SlotPtr slot = load();
+    if ( !slot )
+        throw gbxutilacfr::Exception( ERROR_INFO, "trying to read from an empty SharedStore." );
+    ptr = slot->obj;
+    readSequence_ = slot->sequence;
+}
+
+template<class Type>
+void SharedStore<Type>::peek( Ptr & ptr ) const
+{
+    SlotPtr slot = load();
+    if ( !slot )
+        throw gbxutilacfr::Exception( ERROR_INFO, "trying to read from an empty SharedStore." );
+    ptr = slot->obj;
+}
+
+template<class Type>
+int SharedStore<Type>::getNext( Ptr & ptr, int timeoutMs )
+{
+    const IceUtil::Time deadline = IceUtil::Time::now() + IceUtil::Time::milliSeconds( timeoutMs );
+    while ( true )
+    {
+        const int generation = generation_;
+        SlotPtr slot = load();
+        if ( slot && slot->sequence != readSequence_ )
+        {
+            ptr = slot->obj;
+            readSequence_ = slot->sequence;
+            return 0;
+        }
+
+        int waitMs = -1;
+        if ( timeoutMs >= 0 )
+        {
+            waitMs = (int)( deadline - IceUtil::Time::now() ).toMilliSeconds();
+            if ( waitMs <= 0 )
+                return -1;
+        }
+
+        __sync_fetch_and_add( &numWaiting_, 1 );
+        // Returns at once if there has been a set() since the slot was loaded
+        detail::futexWait( &generation_, generation, waitMs );
+        __sync_fetch_and_sub( &numWaiting_, 1 );
+    }
+}
+
+template<class Type>
+void SharedStore<Type>::purge()
+{
+    exchange( 0 );
+}
+
+} // end namespace
+
+#endif
@@ -11,6 +11,10 @@
 #include <iostream>
 #include <cstdlib>
 #include <gbxsickacfr/gbxiceutilacfr/notify.h>
+#include <gbxsickacfr/gbxiceutilacfr/asyncnotify.h>
+#include <gbxsickacfr/gbxiceutilacfr/timer.h>
+#include <IceUtil/Monitor.h>
+#include <IceUtil/Mutex.h>
 
 using namespace std;
 
@@ -25,6 +29,54 @@ public:
     double copy_;
 };
 
+// Records what it was called with, optionally taking its time about it
+class AsyncTestNotifyHandler : public gbxiceutilacfr::NotifyHandler<double>,
+                               public IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+    AsyncTestNotifyHandler( int delayMs=0 )
+        : count_(0), last_(-1), delayMs_(delayMs) {}
+
+    virtual void handleData( const double& obj )
+    {
+        if ( delayMs_ > 0 )
+            IceUtil::ThreadControl::sleep( IceUtil::Time::milliSeconds( delayMs_ ) );
+        IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
+        count_++;
+        last_ = obj;
+        notifyAll();
+    };
+
+    // Waits up to 1s for the handler to have been called with obj
+    bool waitFor( double obj )
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock lock(*this);
+        while ( last_ != obj ) {
+            if ( !timedWait( IceUtil::Time::seconds( 1 ) ) )
+                return false;
+        }
+        return true;
+    }
+
+    int count_;
+    double last_;
+private:
+    int delayMs_;
+};
+
+// Returns the mean time between set() and handleData(), in us
+double notifyLatency( gbxiceutilacfr::Notify<double> &notify, AsyncTestNotifyHandler &handler )
+{
+    const int numSets = 1000;
+    notify.setNotifyHandler( &handler );
+    gbxiceutilacfr::Timer timer;
+    for ( int i=0; i<numSets; ++i ) {
+        notify.set( i );
+        handler.waitFor( i );
+    }
+    return timer.elapsedMs()*1000.0/numSets;
+}
+
 int main(int argc, char * argv[])
 {
     gbxiceutilacfr::Notify<double> notify;
@@ -83,6 +135,63 @@ int main(int argc, char * argv[])
         return EXIT_FAILURE;
     }
     cout<<"ok"<<endl;
-    
+
+    cout<<"testing AsyncNotify set() ... ";
+    {
+        gbxiceutilacfr::AsyncNotify<double> asyncNotify;
+        AsyncTestNotifyHandler asyncHandler;
+        try
+        {
+            asyncNotify.set( data );
+            cout<<"failed. empty notify handler, should've caught exception"<<endl;
+            return EXIT_FAILURE;
+        }
+        catch ( const gbxutilacfr::Exception & )
+        {
+            ; // ok
+        }
+        asyncNotify.setNotifyHandler( &asyncHandler );
+        asyncNotify.set( data );
+        if ( !asyncHandler.waitFor( data ) ) {
+            cout<<"failed. expecting the handler to get the data."<<endl;
+            return EXIT_FAILURE;
+        }
+    }
+    cout<<"ok"<<endl;
+
+    cout<<"testing AsyncNotify coalescing ... ";
+    {
+        const int numSets = 50;
+        AsyncTestNotifyHandler slowHandler( 10 );
+        gbxiceutilacfr::AsyncNotify<double> asyncNotify;
+        asyncNotify.setNotifyHandler( &slowHandler );
+        gbxiceutilacfr::Timer timer;
+        for ( int i=0; i<numSets; ++i )
+            asyncNotify.set( i );
+        if ( timer.elapsedMs() > 10*numSets/2 ) {
+            cout<<"failed. set() should not wait for the handler."<<endl;
+            return EXIT_FAILURE;
+        }
+        if ( !slowHandler.waitFor( numSets-1 ) ) {
+            cout<<"failed. expecting the handler to get the latest data."<<endl;
+            return EXIT_FAILURE;
+        }
+        if ( slowHandler.count_ >= numSets ) {
+            cout<<"failed. expecting stale data to be dropped."<<endl;
+            return EXIT_FAILURE;
+        }
+    }
+    cout<<"ok"<<endl;
+
+    // Informational only: machines differ too much to check against a threshold
+    {
+        gbxiceutilacfr::Notify<double> syncNotify;
+        gbxiceutilacfr::AsyncNotify<double> asyncNotify;
+        AsyncTestNotifyHandler syncHandler, asyncHandler;
+        cout<<"set() to handleData() latency:"<<endl;
+        cout<<"\tNotify:      "<<notifyLatency( syncNotify, syncHandler )<<" us"<<endl;
+        cout<<"\tAsyncNotify: "<<notifyLatency( asyncNotify, asyncHandler )<<" us"<<endl;
+    }
+
     return EXIT_SUCCESS;
 }
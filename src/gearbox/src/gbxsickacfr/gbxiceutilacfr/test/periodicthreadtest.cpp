@@ -0,0 +1,146 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * This distribution is licensed to you under the terms described in
+ * the LICENSE file included in this distribution.
+ *
+ */
+
+#include <iostream>
+#include <cstdlib>
+
+#include <IceUtil/Time.h>
+
+#include <gbxsickacfr/gbxiceutilacfr/periodicthread.h>
+#include <gbxutilacfr/trivialtracer.h>
+#include <gbxutilacfr/trivialstatus.h>
+
+using namespace std;
+
+class TestThread : public gbxiceutilacfr::PeriodicThread
+{
+public:
+    TestThread( gbxutilacfr::Tracer &tracer, gbxutilacfr::Status &status,
+                double periodSec, int workMs=0 ) :
+        PeriodicThread( tracer, status, "TestThread", periodSec, 0.1 ),
+        initialised_(false),
+        finalised_(false),
+        workMs_(workMs) {};
+
+    bool initialised_;
+    bool finalised_;
+
+private:
+    virtual void initialise() { initialised_ = true; }
+    virtual void iterate()
+    {
+        if ( workMs_ > 0 )
+            IceUtil::ThreadControl::sleep( IceUtil::Time::milliSeconds( workMs_ ) );
+    }
+    virtual void finalise() { finalised_ = true; }
+
+    int workMs_;
+};
+
+int main(int argc, char * argv[])
+{
+    gbxutilacfr::TrivialTracer tracer;
+    gbxutilacfr::TrivialStatus status( tracer, false, false, false, false, false );
+
+    cout<<"testing TimingHistogram ... ";
+    {
+        gbxiceutilacfr::TimingHistogram histogram;
+        histogram.add( 0.5 );
+        histogram.add( 3 );
+        histogram.add( 3 );
+        histogram.add( 1000 );
+        if ( histogram.count()!=4 || histogram.bin(0)!=1 || histogram.bin(2)!=2 || histogram.bin(10)!=1 ) {
+            cout<<"failed. wrong bins"<<endl;
+            return EXIT_FAILURE;
+        }
+        if ( histogram.max()!=1000 || histogram.percentile( 0.5 )!=4 || histogram.percentile( 1.0 )!=1000 ) {
+            cout<<"failed. wrong max or percentiles: "<<histogram.toString()<<endl;
+            return EXIT_FAILURE;
+        }
+    }
+    cout<<"ok"<<endl;
+
+    cout<<"testing iteration rate ... ";
+    {
+        IceUtil::Handle<TestThread> t = new TestThread( tracer, status, 0.01 );
+        t->start();
+        IceUtil::ThreadControl::sleep( IceUtil::Time::milliSeconds( 500 ) );
+        gbxiceutilacfr::stopAndJoin( t );
+
+        gbxiceutilacfr::PeriodicThreadStats stats = t->stats();
+        // a loaded test machine may well miss the odd period
+        if ( stats.iterations < 40 || stats.iterations > 52 ) {
+            cout<<"failed. expecting about 50 iterations: "<<stats.toString()<<endl;
+            return EXIT_FAILURE;
+        }
+        if ( stats.executionTime.count()!=stats.iterations || stats.jitter.count()!=stats.iterations ) {
+            cout<<"failed. expecting a timing sample for every iteration: "<<stats.toString()<<endl;
+            return EXIT_FAILURE;
+        }
+        if ( !t->initialised_ || !t->finalised_ ) {
+            cout<<"failed. expecting initialise() and finalise() to be called"<<endl;
+            return EXIT_FAILURE;
+        }
+        cout<<"ok"<<endl;
+        cout<<"\t"<<stats.toString()<<endl;
+    }
+
+    cout<<"testing overruns ... ";
+    {
+        IceUtil::Handle<TestThread> t = new TestThread( tracer, status, 0.01, 25 );
+        t->start();
+        IceUtil::ThreadControl::sleep( IceUtil::Time::milliSeconds( 300 ) );
+        gbxiceutilacfr::stopAndJoin( t );
+
+        gbxiceutilacfr::PeriodicThreadStats stats = t->stats();
+        // each 25ms iteration runs into the next two periods
+        if ( stats.iterations > 12 || stats.overruns < 2*(stats.iterations-1) ) {
+            cout<<"failed. expecting missed periods to be skipped: "<<stats.toString()<<endl;
+            return EXIT_FAILURE;
+        }
+    }
+    cout<<"ok"<<endl;
+
+    cout<<"testing stop() during a long period ... ";
+    {
+        IceUtil::Handle<TestThread> t = new TestThread( tracer, status, 60.0 );
+        t->start();
+        IceUtil::ThreadControl::sleep( IceUtil::Time::milliSeconds( 50 ) );
+        IceUtil::Time start = IceUtil::Time::now();
+        gbxiceutilacfr::stopAndJoin( t );
+        if ( ( IceUtil::Time::now()-start ).toMilliSeconds() > 500 ) {
+            cout<<"failed. expecting the thread to stop promptly"<<endl;
+            return EXIT_FAILURE;
+        }
+        if ( t->stats().iterations!=1 ) {
+            cout<<"failed. expecting a single iteration"<<endl;
+            return EXIT_FAILURE;
+        }
+    }
+    cout<<"ok"<<endl;
+
+    cout<<"testing setRealtimePriority() and setCpuAffinity() ... ";
+    {
+        // without privileges this only traces a warning
+        IceUtil::Handle<TestThread> t = new TestThread( tracer, status, 0.01 );
+        t->setRealtimePriority( 10 );
+        t->setCpuAffinity( 0 );
+        t->start();
+        IceUtil::ThreadControl::sleep( IceUtil::Time::milliSeconds( 100 ) );
+        gbxiceutilacfr::stopAndJoin( t );
+        if ( t->stats().iterations < 5 ) {
+            cout<<"failed. expecting the thread to run regardless"<<endl;
+            return EXIT_FAILURE;
+        }
+    }
+    cout<<"ok"<<endl;
+
+    return EXIT_SUCCESS;
+}
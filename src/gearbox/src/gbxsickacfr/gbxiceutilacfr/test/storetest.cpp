@@ -10,10 +10,144 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <vector>
 #include <gbxsickacfr/gbxiceutilacfr/store.h>
+#include <gbxsickacfr/gbxiceutilacfr/sharedstore.h>
+#include <gbxsickacfr/gbxiceutilacfr/thread.h>
+#include <gbxsickacfr/gbxiceutilacfr/timer.h>
 
 using namespace std;
 
+namespace {
+
+// About the size of a laser scan with intensities
+const int scanSize = 2*1081;
+const int numReads = 20000;
+
+typedef vector<float> Scan;
+
+// Keeps replacing the contents of a store, to compete with the readers
+template<class StoreType>
+class Writer : public gbxiceutilacfr::Thread
+{
+public:
+    Writer( StoreType &store )
+        : store_(store) {}
+    virtual void run()
+    {
+        Scan scan( scanSize, 1.0 );
+        while ( !isStopping() )
+            store_.set( scan );
+    }
+private:
+    StoreType &store_;
+};
+
+// Returns the number of reads per second while another thread writes
+double readStore( gbxiceutilacfr::Store<Scan> &store )
+{
+    gbxiceutilacfr::ThreadPtr writer = new Writer<gbxiceutilacfr::Store<Scan> >( store );
+    writer->start();
+    Scan scan;
+    float sum = 0;
+    gbxiceutilacfr::Timer timer;
+    for ( int i=0; i<numReads; ++i ) {
+        store.peek( scan );
+        sum += scan[i%scanSize];
+    }
+    double elapsed = timer.elapsedSec();
+    gbxiceutilacfr::stopAndJoin( writer );
+    return numReads/elapsed;
+}
+
+double readStore( gbxiceutilacfr::SharedStore<Scan> &store )
+{
+    gbxiceutilacfr::ThreadPtr writer = new Writer<gbxiceutilacfr::SharedStore<Scan> >( store );
+    writer->start();
+    gbxiceutilacfr::SharedStore<Scan>::Ptr scan;
+    float sum = 0;
+    gbxiceutilacfr::Timer timer;
+    for ( int i=0; i<numReads; ++i ) {
+        store.peek( scan );
+        sum += scan->get()[i%scanSize];
+    }
+    double elapsed = timer.elapsedSec();
+    gbxiceutilacfr::stopAndJoin( writer );
+    return numReads/elapsed;
+}
+
+// Counts the live objects, to check that each one is freed exactly once
+volatile int numLive = 0;
+
+struct Counted
+{
+    Counted() : value(0) { __sync_fetch_and_add( &numLive, 1 ); }
+    Counted( const Counted &other ) : value(other.value) { __sync_fetch_and_add( &numLive, 1 ); }
+    ~Counted() { value = -1; __sync_fetch_and_sub( &numLive, 1 ); }
+    int value;
+};
+
+// Sets ever larger values
+class CountingWriter : public gbxiceutilacfr::Thread
+{
+public:
+    CountingWriter( gbxiceutilacfr::SharedStore<Counted> &store )
+        : store_(store) {}
+    virtual void run()
+    {
+        Counted counted;
+        while ( !isStopping() )
+        {
+            counted.value++;
+            store_.set( counted );
+        }
+    }
+private:
+    gbxiceutilacfr::SharedStore<Counted> &store_;
+};
+
+// Checks that the values it reads never go back, which they would if an object was freed
+// under it
+class CountingReader : public gbxiceutilacfr::Thread
+{
+public:
+    CountingReader( gbxiceutilacfr::SharedStore<Counted> &store )
+        : failed(false),
+          store_(store) {}
+    virtual void run()
+    {
+        gbxiceutilacfr::SharedStore<Counted>::Ptr counted;
+        int last = 0;
+        for ( int i=0; i<numReads; ++i )
+        {
+            store_.peek( counted );
+            if ( counted->get().value < last )
+                failed = true;
+            last = counted->get().value;
+        }
+    }
+    bool failed;
+private:
+    gbxiceutilacfr::SharedStore<Counted> &store_;
+};
+
+// Sets the store a while after getNext() starts waiting
+class DelayedSetter : public gbxiceutilacfr::Thread
+{
+public:
+    DelayedSetter( gbxiceutilacfr::SharedStore<double> &store )
+        : store_(store) {}
+    virtual void run()
+    {
+        IceUtil::ThreadControl::sleep( IceUtil::Time::milliSeconds( 20 ) );
+        store_.set( 7.0 );
+    }
+private:
+    gbxiceutilacfr::SharedStore<double> &store_;
+};
+
+}
+
 int main(int argc, char * argv[])
 {
     gbxiceutilacfr::Store<double> store;
@@ -132,6 +266,142 @@ int main(int argc, char * argv[])
     }
     cout<<"ok"<<endl;
 
-    
+    gbxiceutilacfr::SharedStore<double> sharedStore;
+    gbxiceutilacfr::SharedStore<double>::Ptr sharedCopy;
+
+    cout<<"testing SharedStore get() and peek() ... ";
+    try
+    {
+        sharedStore.get( sharedCopy );
+        cout<<"failed. empty store, should've caught exception"<<endl;
+        return EXIT_FAILURE;
+    }
+    catch ( const gbxutilacfr::Exception & )
+    {
+        ; // ok
+    }
+    try
+    {
+        sharedStore.peek( sharedCopy );
+        cout<<"failed. empty store, should've caught exception"<<endl;
+        return EXIT_FAILURE;
+    }
+    catch ( const gbxutilacfr::Exception & )
+    {
+        ; // ok
+    }
+    if ( !sharedStore.isEmpty() || sharedStore.isNewData() ) {
+        cout<<"failed. expecting an empty non-new store."<<endl;
+        return EXIT_FAILURE;
+    }
+    cout<<"ok"<<endl;
+
+    cout<<"testing SharedStore set() ... ";
+    sharedStore.set( data );
+    sharedStore.peek( sharedCopy );
+    if ( sharedCopy->get()!=data || !sharedStore.isNewData() ) {
+        cout<<"failed. expecting the data, still new."<<endl;
+        return EXIT_FAILURE;
+    }
+    sharedStore.get( sharedCopy );
+    if ( sharedCopy->get()!=data || sharedStore.isNewData() ) {
+        cout<<"failed. expecting the data, not new any more."<<endl;
+        return EXIT_FAILURE;
+    }
+    // the old object stays valid while somebody holds it
+    sharedStore.set( data+1 );
+    if ( sharedCopy->get()!=data ) {
+        cout<<"failed. expecting the old object to be unchanged."<<endl;
+        return EXIT_FAILURE;
+    }
+    cout<<"ok"<<endl;
+
+    cout<<"testing SharedStore setBySwap() ... ";
+    {
+        gbxiceutilacfr::SharedStore<Scan> scanStore;
+        gbxiceutilacfr::SharedStore<Scan>::Ptr scanCopy;
+        Scan scan( scanSize, 3.0 );
+        const float *contents = &scan[0];
+        scanStore.setBySwap( scan );
+        scanStore.get( scanCopy );
+        if ( !scan.empty() || &scanCopy->get()[0]!=contents ) {
+            cout<<"failed. expecting the contents to be moved, not copied."<<endl;
+            return EXIT_FAILURE;
+        }
+    }
+    cout<<"ok"<<endl;
+
+    cout<<"testing SharedStore getNext() ... ";
+    if ( sharedStore.getNext( sharedCopy, 50 )!=0 || sharedCopy->get()!=data+1 ) {
+        cout<<"failed. expected to get the new data"<<endl;
+        return EXIT_FAILURE;
+    }
+    if ( sharedStore.getNext( sharedCopy, 50 )==0 ) {
+        cout<<"failed. not expecting anybody setting the store"<<endl;
+        return EXIT_FAILURE;
+    }
+    {
+        gbxiceutilacfr::ThreadPtr setter = new DelayedSetter( sharedStore );
+        setter->start();
+        int ret = sharedStore.getNext( sharedCopy, 1000 );
+        gbxiceutilacfr::stopAndJoin( setter );
+        if ( ret!=0 || sharedCopy->get()!=7.0 ) {
+            cout<<"failed. expected to be woken up by the setter"<<endl;
+            return EXIT_FAILURE;
+        }
+    }
+    cout<<"ok"<<endl;
+
+    cout<<"testing SharedStore purge()... ";
+    sharedStore.set( data );
+    sharedStore.purge();
+    if ( !sharedStore.isEmpty() || sharedStore.isNewData() ) {
+        cout<<"failed. expecting an empty non-new store."<<endl;
+        return EXIT_FAILURE;
+    }
+    cout<<"ok"<<endl;
+
+    cout<<"testing SharedStore with concurrent readers ... ";
+    {
+        gbxiceutilacfr::SharedStore<Counted> countedStore;
+        countedStore.set( Counted() );
+        gbxiceutilacfr::ThreadPtr writer = new CountingWriter( countedStore );
+        writer->start();
+        vector<IceUtil::Handle<CountingReader> > readers;
+        for ( int i=0; i<4; ++i ) {
+            readers.push_back( new CountingReader( countedStore ) );
+            readers.back()->start();
+        }
+        bool failed = false;
+        for ( size_t i=0; i<readers.size(); ++i ) {
+            // they stop by themselves
+            gbxiceutilacfr::stopAndJoin( readers[i].get() );
+            failed |= readers[i]->failed;
+        }
+        gbxiceutilacfr::stopAndJoin( writer );
+        if ( failed ) {
+            cout<<"failed. read a value older than one read before."<<endl;
+            return EXIT_FAILURE;
+        }
+    }
+    if ( numLive!=0 ) {
+        cout<<"failed. expecting every object to be freed, "<<numLive<<" left."<<endl;
+        return EXIT_FAILURE;
+    }
+    cout<<"ok"<<endl;
+
+    // Informational only: machines differ too much to check against a threshold
+    cout<<"reading a "<<scanSize<<"-float scan while another thread writes it:"<<endl;
+    {
+        gbxiceutilacfr::Store<Scan> scanStore;
+        scanStore.set( Scan( scanSize ) );
+        cout<<"\tStore:       "<<readStore( scanStore )<<" reads/s"<<endl;
+    }
+    {
+        gbxiceutilacfr::SharedStore<Scan> scanStore;
+        scanStore.set( Scan( scanSize ) );
+        cout<<"\tSharedStore: "<<readStore( scanStore )<<" reads/s"<<endl;
+    }
+
     return EXIT_SUCCESS;
 }
@@ -564,16 +564,17 @@ parseLmsMeasurementData( const uChar *buf, int len )
         throw gbxutilacfr::Exception( ERROR_INFO, ss.str() );
     }
 
-    bool scanType = (buf[1] >> 5) & 0x01;
-    // uChar partialScanNumber = (buf[1] >> 3) & 0x03;
-    if ( scanType != 0 )
+    d->isPartialScan = (buf[1] >> 5) & 0x01;
+    d->partialScanNumber = (buf[1] >> 3) & 0x03;
+
+    // The number of values is in the low 10 bits
+    int numMeasurements = ((buf[1]&0x03)<<8) | (buf[0]);
+    if ( 2+numMeasurements*(int)sizeof(uint16_t) != len )
     {
         stringstream ss;
-        ss << "parseLmsMeasurementData(): Only know how to deal with complete scan.";
+        ss << "parseLmsMeasurementData(): " << numMeasurements << " measurements don't fit in " << len << " bytes.";
         throw gbxutilacfr::Exception( ERROR_INFO, ss.str() );
     }
-
-    int numMeasurements = ((buf[1]&0x80)<<8) | (buf[0]);
     int pos = 2;
     
     d->ranges.resize( numMeasurements );
@@ -956,6 +957,16 @@ constructRequestContinuousMode( std::vector<uChar> &commandAndData )
     commandAndData[pos++] = OPERATING_MODE_ALL_MEASURED_CONTINUOUS;
 }
 
+void
+constructRequestPartialContinuousMode( std::vector<uChar> &commandAndData )
+{
+    commandAndData.resize( 2 );
+
+    int pos=0;
+    commandAndData[pos++] = CMD_SWITCH_OPERATING_MODE;
+    commandAndData[pos++] = OPERATING_MODE_MEASURED_PARTIAL_CONTINUOUS;
+}
+
 void
 constructRequestMeasuredOnRequestMode( std::vector<uChar> &commandAndData )
 {
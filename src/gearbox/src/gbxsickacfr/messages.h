@@ -224,11 +224,20 @@ namespace gbxsickacfr {
 
     class LmsMeasurementData : public LmsRxMsgData {
     public:
+        LmsMeasurementData()
+            : isPartialScan(false),
+              partialScanNumber(0)
+            {}
         
         // ranges in metres
         std::vector<float> ranges;
         std::vector<uChar> intensities;
 
+        // In the interlaced mode, each mirror rotation is sent as a partial scan.
+        // Partial scan n starts n*0.25deg after the start of the full scan.
+        bool isPartialScan;
+        int  partialScanNumber;
+
         std::string toString() const;
         LmsRxMsgData *clone() const { return new LmsMeasurementData(*this); }        
     };
@@ -270,6 +279,8 @@ namespace gbxsickacfr {
     void constructRequestInstallationMode( std::vector<uChar> &commandAndData );
 
     void constructRequestContinuousMode( std::vector<uChar> &commandAndData );
+    // Like continuous mode, but sends each partial scan of an interlaced scan as it is measured.
+    void constructRequestPartialContinuousMode( std::vector<uChar> &commandAndData );
     void constructRequestMeasuredOnRequestMode( std::vector<uChar> &commandAndData );
 
     void constructInitAndReset( std::vector<uChar> &commandAndData );
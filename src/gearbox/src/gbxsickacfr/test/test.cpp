@@ -16,6 +16,7 @@
 #include <iostream>
 #include <sstream>
 #include <gbxsickacfr/driver.h>
+#include <gbxsickacfr/gbxiceutilacfr/timer.h>
 #include <gbxutilacfr/trivialtracer.h>
 #include <gbxutilacfr/trivialstatus.h>
 #include <gbxutilacfr/mathdefs.h>
@@ -31,6 +32,8 @@ int main( int argc, char **argv )
     string port = "/dev/ttyS0";
     int debug = 0;
     bool showScan = false;
+    bool interlaced = false;
+    int numReads = 3;
 
     // Get some options from the command line
     for ( int i=1; i < argc; i++ )
@@ -53,12 +56,23 @@ int main( int argc, char **argv )
         {
             showScan = true;
         }
+        else if ( !strcmp(argv[i],"-i") )
+        {
+            interlaced = true;
+        }
+        else if ( !strcmp(argv[i],"-n") && i < argc-1 )
+        {
+            numReads = atoi(argv[i+1]);
+            i++;
+        }
         else
         {
             cout << "Unknown option: " << argv[i] << endl;
-            cout << "Usage: " << argv[0] << " [-p port] [-b baud] [-v(erbose)] [-s(how scan)]" << endl << endl
+            cout << "Usage: " << argv[0] << " [-p port] [-b baud] [-v(erbose)] [-s(how scan)] [-i(nterlaced)] [-n reads]" << endl << endl
                  << "-p port\tPort the laser scanner is connected to. E.g. /dev/ttyS0" << endl
-                 << "-b baud\tBaud rate to connect at (9600, 19200, 38400, or 500000)." << endl;
+                 << "-b baud\tBaud rate to connect at (9600, 19200, 38400, or 500000), or 0 for the fastest that works." << endl
+                 << "-i\tRead 0.5deg scans as interlaced partial scans." << endl
+                 << "-n reads\tNumber of scans to read. The scan rate is reported at the end." << endl;
             return 1;
         }
     }
@@ -70,6 +84,11 @@ int main( int argc, char **argv )
     config.fieldOfView = 180.0*DEG2RAD_RATIO;
     config.startAngle = -90.0*DEG2RAD_RATIO;
     config.numberOfSamples = 181;
+    if ( interlaced )
+    {
+        config.numberOfSamples = 361;
+        config.interlaced = true;
+    }
     config.baudRate = baud;
     config.device = port;
     if ( !config.isValid() ) {
@@ -102,13 +121,15 @@ int main( int argc, char **argv )
     data.intensities = &(intensities[0]);
 
     // Read a few times
-    const int numReads = 3;
+    int numScans = 0;
+    gbxiceutilacfr::Timer timer;
     for ( int i=0; i < numReads; i++ )
     {
         try 
         {
             device->read( data );
 
+            numScans++;
             cout<<"Test: Got scan "<<i+1<<" of "<<numReads<<endl;
             if ( showScan )
             {
@@ -129,6 +150,11 @@ int main( int argc, char **argv )
         }    
     }
 
+    double elapsedSec = timer.elapsedSec();
+    cout << "Test: " << numScans << " scans in " << elapsedSec << "s: "
+         << numScans/elapsedSec << " scans/sec at " << device->baudRate() << " baud, "
+         << config.numberOfSamples << " samples" << (interlaced ? " interlaced" : "") << endl;
+
     delete device;
     return 0;
 }
@@ -30,26 +30,18 @@ OceanServer::OceanServer( const std::string   &port,
 void
 OceanServer::walk()
 {
+    OceanServerChanges changes;
+
     while ( !isStopping() )
     {
-
-        gbxsmartbatteryacfr::OceanServerSystem latestData;
-        gbxsmartbatteryacfr::OceanServerSystem mergedData;
-
         try
         {
-            // read new data, this may throw
-            reader_->read(latestData);
+            // read and apply a new line, this may throw
+            reader_->readLine( system_, changes );
             
             // successful read: reset counter and string
             exceptionCounter_ = 0;
             exceptionString_ = "";
-
-            // merge latest data into a full record
-            if ( !dataStore_.isEmpty() )
-                dataStore_.get( mergedData );
-            gbxsmartbatteryacfr::updateWithNewData( latestData, mergedData );
-            dataStore_.set( mergedData );
         }
         catch ( gbxsmartbatteryacfr::ParsingException &e )
         {
@@ -62,8 +54,9 @@ OceanServer::walk()
             exceptionCounter_++;
             stringstream ssEx;
             ssEx << e.what() << endl;
-            for (unsigned int i=0; i<latestData.rawRecord().size(); i++)
-                ssEx << latestData.rawRecord()[i] << endl;
+            ssEx << "Last complete record:" << endl;
+            for (unsigned int i=0; i<system_.rawRecord().size(); i++)
+                ssEx << system_.rawRecord()[i] << endl;
             ssEx << endl;
             exceptionString_ = exceptionString_ + ssEx.str();
             
@@ -86,7 +79,51 @@ OceanServer::walk()
             }
         }
 
+        // a line which failed to parse may still have changed something
+        if ( changes.any() )
+            publish( changes );
+    }
+}
+
+void
+OceanServer::publish( OceanServerChanges &changes )
+{
+    if ( healthMonitor_.get() && healthMonitor_->update( system_, changes ) )
+    {
+        changes.healthWarnings = true;
+        
+        IceUtil::Mutex::Lock lock( warningsMutex_ );
+        warnShort_.clear();
+        warnVerbose_.clear();
+        healthMonitor_->warnings( warnShort_, warnVerbose_ );
     }
+
+    dataStore_.set( system_ );
+    if ( changeNotify_.hasNotifyHandler() )
+        changeNotify_.set( changes );
+    changes.clear();
+}
+
+void
+OceanServer::setHealthWarningConfig( const BatteryHealthWarningConfig &config )
+{
+    healthMonitor_.reset( new OceanServerHealthMonitor( config ) );
+}
+
+bool
+OceanServer::getHealthWarnings( std::vector<std::string> &warnShort,
+                                std::vector<std::string> &warnVerbose )
+{
+    IceUtil::Mutex::Lock lock( warningsMutex_ );
+    warnShort = warnShort_;
+    warnVerbose = warnVerbose_;
+    return !warnShort_.empty();
+}
+
+void
+OceanServer::setChangeHandler( gbxiceutilacfr::NotifyHandler<OceanServerChanges> *handler )
+{
+    changeNotify_.setNotifyHandler( handler );
 }
 
 void 
@@ -14,7 +14,10 @@
 #include <memory>
 #include <gbxutilacfr/tracer.h>
 #include <gbxsmartbatteryacfr/oceanserverreader.h>
+#include <gbxsmartbatteryacfr/oceanserverhealthchecks.h>
 #include <gbxsickacfr/gbxiceutilacfr/store.h>
+#include <gbxsickacfr/gbxiceutilacfr/notify.h>
+#include <IceUtil/Mutex.h>
 #include <gbxsickacfr/gbxiceutilacfr/safethread.h>
 
 using namespace std;
@@ -27,6 +30,10 @@ namespace gbxsmartbatteryacfr {
 //! maintain some incremental internal data storage.
 //! Also handles all ParsingExceptions.
 //!
+//! The data is updated line by line as it arrives, rather than once per record, so
+//! changes (e.g. a module running hot) show up as soon as the module reports them.
+//! Optionally keeps health warnings up to date and notifies a handler of every change.
+//!
 //! @author Tobias Kaupp
 //!
 class OceanServer : public gbxiceutilacfr::SafeThread
@@ -45,6 +52,20 @@ public:
     //! Returns true if there is some non-empty data available
     bool haveData();
 
+    //! Enables health checks with the given configuration. Only the checks affected by a change
+    //! are re-run. Call before start().
+    void setHealthWarningConfig( const BatteryHealthWarningConfig &config );
+
+    //! Access to the current health warnings (see setHealthWarningConfig)
+    //! Returns true if there are warnings
+    bool getHealthWarnings( std::vector<std::string> &warnShort,
+                            std::vector<std::string> &warnVerbose );
+
+    //! Sets a handler which is called with the parts of the data that changed, every time the data
+    //! changes. It's called from this thread, once the new data can be read with getData().
+    //! Call before start().
+    void setChangeHandler( gbxiceutilacfr::NotifyHandler<OceanServerChanges> *handler );
+
     //! The main thread function, inherited from SubsystemThread
     //! Reads data from OceanServer and incrementally updates internal storage
     //! May throw gbxutilacfr::Exception
@@ -52,7 +73,18 @@ public:
     
 private:
 
+    void publish( OceanServerChanges &changes );
+
     gbxiceutilacfr::Store<gbxsmartbatteryacfr::OceanServerSystem> dataStore_;
+    gbxiceutilacfr::Notify<gbxsmartbatteryacfr::OceanServerChanges> changeNotify_;
+    // the latest data, updated line by line
+    gbxsmartbatteryacfr::OceanServerSystem system_;
+
+    auto_ptr<gbxsmartbatteryacfr::OceanServerHealthMonitor> healthMonitor_;
+    std::vector<std::string> warnShort_;
+    std::vector<std::string> warnVerbose_;
+    IceUtil::Mutex warningsMutex_;
+
     gbxutilacfr::Tracer& tracer_;
     auto_ptr<gbxsmartbatteryacfr::OceanServerReader> reader_;
     
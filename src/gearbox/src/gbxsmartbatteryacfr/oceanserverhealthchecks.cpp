@@ -9,6 +9,8 @@
  */
 
 #include <sstream>
+#include <set>
+#include <cassert>
 #include "oceanserverhealthchecks.h"
 
 
@@ -31,6 +33,99 @@ namespace gbxsmartbatteryacfr
             return true;
         }
 
+        bool checkBatteryCycles( int                 batteryNumber,
+                                 const SmartBattery &bat,
+                                 vector<string>     &warnShort,
+                                 vector<string>     &warnVerbose,
+                                 int                 numCyclesThreshhold )
+        {
+            if ( !bat.has(CycleCount) ) return false;
+
+            int numCycles = bat.cycleCount();
+            if ( numCycles <= numCyclesThreshhold ) return false;
+
+            stringstream ssWarnShort;
+            ssWarnShort << "BAT(" << batteryNumber << "): HIGH CYCLES! ";
+            warnShort.push_back(ssWarnShort.str());
+            stringstream ssWarnVerbose;
+            ssWarnVerbose << "High charge cycles! Battery no " << batteryNumber << " has had " << numCycles << " cycles (consider swapping at " << numCyclesThreshhold << " cycles)" << endl;
+            warnVerbose.push_back(ssWarnVerbose.str());
+            return true;
+        }
+
+        bool checkBatteryTemperature( const OceanServerSystem &batteryData,
+                                      int                      batteryNumber,
+                                      const SmartBattery      &bat,
+                                      vector<string>          &warnShort,
+                                      vector<string>          &warnVerbose,
+                                      double                   chargeTempThreshhold,
+                                      double                   dischargeTempThreshhold )
+        {
+            if ( !bat.has(Temperature) ) return false;
+
+            assert( (int)batteryData.chargingStates().size() >= batteryNumber-1 );
+            bool isCharging = batteryData.chargingStates()[batteryNumber-1];
+
+            double tempThreshhold = 0.0;
+            if (isCharging) {
+                tempThreshhold = chargeTempThreshhold;
+            } else {
+                tempThreshhold = dischargeTempThreshhold;
+            }
+
+            double temperature = bat.temperature();
+            if ( temperature <= tempThreshhold ) return false;
+
+            stringstream ssWarnShort;
+            ssWarnShort << "BAT(" << batteryNumber << "): HOT! ";
+            warnShort.push_back(ssWarnShort.str());
+            stringstream ssWarnVerbose;
+            ssWarnVerbose << "High temperature! Battery no " << batteryNumber << " has " << temperature << "degC (threshhold: " << tempThreshhold << "degC)" << endl;
+            warnVerbose.push_back(ssWarnVerbose.str());
+            return true;
+        }
+
+        // The caller has to check whether charge power is present
+        bool checkBatteryCharge( const OceanServerSystem &batteryData,
+                                 int                      batteryNumber,
+                                 const SmartBattery      &bat,
+                                 vector<string>          &warnShort,
+                                 vector<string>          &warnVerbose,
+                                 int                      chargeWarnThreshhold,
+                                 int                      chargeDeviationThreshold )
+        {
+            if ( !bat.has(RelativeStateOfCharge) ) return false;
+
+            bool haveWarning = false;
+            int charge = bat.relativeStateOfCharge();
+            const int avgCharge = batteryData.percentCharge();
+
+            // check whether battery charge is lower than the average
+            if ( charge < (avgCharge - chargeDeviationThreshold) )
+            {
+                haveWarning = true;
+                stringstream ssWarnShort;
+                ssWarnShort << "BAT(" << batteryNumber << "): INCONSISTENT CHARGE! ";
+                warnShort.push_back(ssWarnShort.str());
+                stringstream ssWarnVerbose;
+                ssWarnVerbose << "Inconsistent charge! Battery no " << batteryNumber << "'s charge is " << charge << "% (average: " << avgCharge << "%)"  << endl;
+                warnVerbose.push_back(ssWarnVerbose.str());
+            }
+
+            if (charge < chargeWarnThreshhold)
+            {
+                haveWarning = true;
+                stringstream ssWarnShort;
+                ssWarnShort << "BAT(" << batteryNumber << "): LOW CHARGE! ";
+                warnShort.push_back(ssWarnShort.str());
+                stringstream ssWarnVerbose;
+                ssWarnVerbose << "Low charge! Battery no " << batteryNumber << "'s charge is " << charge << "% (threshhold: " << chargeWarnThreshhold << "%)" << endl;
+                warnVerbose.push_back(ssWarnVerbose.str());
+            }
+
+            return haveWarning;
+        }
+
         string toString( const vector<string> &stringList )
         {
             stringstream ss;
@@ -89,21 +184,8 @@ bool checkNumCycles( const OceanServerSystem &batteryData,
     map<int,SmartBattery>::const_iterator it;
     for (it=batteryData.batteries().begin(); it!=batteryData.batteries().end(); it++)
     {
-        const SmartBattery &bat = batteryData.battery( it->first );
-        if ( !bat.has(CycleCount) ) continue;
-    
-        int numCycles = bat.cycleCount();
-        
-        if ( numCycles > numCyclesThreshhold )
-        {
+        if ( checkBatteryCycles( it->first, it->second, warnShort, warnVerbose, numCyclesThreshhold ) )
             haveWarning = true;
-            stringstream ssWarnShort;
-            ssWarnShort << "BAT(" << it->first << "): HIGH CYCLES! ";
-            warnShort.push_back(ssWarnShort.str());
-            stringstream ssWarnVerbose;
-            ssWarnVerbose << "High charge cycles! Battery no " << it->first << " has had " << numCycles << " cycles (consider swapping at " << numCyclesThreshhold << " cycles)" << endl;
-            warnVerbose.push_back(ssWarnVerbose.str());
-        }    
     }
     
     if (haveWarning && printRawRecord)
@@ -132,31 +214,9 @@ bool checkTemperatures(const OceanServerSystem &batteryData,
 
     for (it=batteryData.batteries().begin(); it!=batteryData.batteries().end(); it++)
     {
-        int batteryNumber = it->first;
-        const SmartBattery &bat = batteryData.battery( batteryNumber );
-        if ( !bat.has(Temperature) ) continue;
-
-        assert( (int)batteryData.chargingStates().size() >= batteryNumber-1 );
-        bool isCharging = batteryData.chargingStates()[batteryNumber-1];
-    
-        double tempThreshhold = 0.0;
-        if (isCharging) {
-            tempThreshhold = chargeTempThreshhold;
-        } else {
-            tempThreshhold = dischargeTempThreshhold;
-        }
-                    
-        double temperature = bat.temperature();
-        if ( temperature > tempThreshhold)
-        {
+        if ( checkBatteryTemperature( batteryData, it->first, it->second, warnShort, warnVerbose,
+                                      chargeTempThreshhold, dischargeTempThreshhold ) )
             haveWarning = true;
-            stringstream ssWarnShort;
-            ssWarnShort << "BAT(" << batteryNumber << "): HOT! ";
-            warnShort.push_back(ssWarnShort.str());
-            stringstream ssWarnVerbose;
-            ssWarnVerbose << "High temperature! Battery no " << batteryNumber << " has " << temperature << "degC (threshhold: " << tempThreshhold << "degC)" << endl;
-            warnVerbose.push_back(ssWarnVerbose.str());
-        }
     }
     
     if (haveWarning && printRawRecord)
@@ -187,35 +247,9 @@ bool checkCharges(const OceanServerSystem &batteryData,
     
     for (it=batteryData.batteries().begin(); it!=batteryData.batteries().end(); it++)
     {
-        int batteryNumber = it->first;
-        const SmartBattery &bat = batteryData.battery( batteryNumber );
-        if ( !bat.has(RelativeStateOfCharge) ) continue;
-    
-        int charge = bat.relativeStateOfCharge();
-        const int avgCharge = batteryData.percentCharge();
-        
-        // check whether battery charge is lower than the average
-        if ( charge < (avgCharge - chargeDeviationThreshold) )
-        {
+        if ( checkBatteryCharge( batteryData, it->first, it->second, warnShort, warnVerbose,
+                                 chargeWarnThreshhold, chargeDeviationThreshold ) )
             haveWarning = true;
-            stringstream ssWarnShort;
-            ssWarnShort << "BAT(" << batteryNumber << "): INCONSISTENT CHARGE! ";
-            warnShort.push_back(ssWarnShort.str());
-            stringstream ssWarnVerbose;
-            ssWarnVerbose << "Inconsistent charge! Battery no " << batteryNumber << "'s charge is " << charge << "% (average: " << avgCharge << "%)"  << endl;
-            warnVerbose.push_back(ssWarnVerbose.str());
-        }
-
-        if (charge < chargeWarnThreshhold)
-        {
-            haveWarning = true;
-            stringstream ssWarnShort;
-            ssWarnShort << "BAT(" << batteryNumber << "): LOW CHARGE! ";
-            warnShort.push_back(ssWarnShort.str());
-            stringstream ssWarnVerbose;
-            ssWarnVerbose << "Low charge! Battery no " << batteryNumber << "'s charge is " << charge << "% (threshhold: " << chargeWarnThreshhold << "%)" << endl;
-            warnVerbose.push_back(ssWarnVerbose.str());
-        }  
     }      
     
     return haveWarning;
@@ -290,7 +324,158 @@ bool conductAllHealthChecks( const OceanServerSystem          &batteryData,
     return haveWarnings;
 }
 
+namespace {
+
+    // The checks, in the order conductAllHealthChecks runs them
+    enum HealthCheck
+    {
+        EmptyRecordCheck,
+        NumberOfBatteriesCheck,
+        ModuleHealthCheck,
+        NumCyclesCheck,
+        TemperatureCheck,
+        ChargeCheck
+    };
+
+}
+
+OceanServerHealthMonitor::OceanServerHealthMonitor( const BatteryHealthWarningConfig &config )
+    : config_(config)
+{
+}
+
+bool
+OceanServerHealthMonitor::runCheck( const OceanServerSystem &batteryData,
+                                    int                      check,
+                                    int                      batteryNumber )
+{
+    const pair<int,int> key( check, batteryNumber );
+    Warnings w;
+    
+    map<int,SmartBattery>::const_iterator bat = batteryData.batteries().find( batteryNumber );
+    const bool haveBattery = ( bat != batteryData.batteries().end() );
+
+    switch ( check )
+    {
+        case EmptyRecordCheck:
+            isRecordEmpty( batteryData, w.warnShort, w.warnVerbose ); break;
+        case NumberOfBatteriesCheck:
+            checkNumberOfBatteries( batteryData, w.warnShort, w.warnVerbose, config_.expectedNumBatteries ); break;
+        case ModuleHealthCheck:
+            checkModuleHealth( batteryData, w.warnShort, w.warnVerbose ); break;
+        case NumCyclesCheck:
+            if ( haveBattery )
+                checkBatteryCycles( batteryNumber, bat->second, w.warnShort, w.warnVerbose, 
+                                    config_.numCyclesThreshhold );
+            break;
+        case TemperatureCheck:
+            if ( haveBattery )
+                checkBatteryTemperature( batteryData, batteryNumber, bat->second, w.warnShort, w.warnVerbose,
+                                         config_.chargeTempThreshhold, config_.dischargeTempThreshhold );
+            break;
+        case ChargeCheck:
+            // if the system is charging, don't bother issuing warnings
+            if ( haveBattery && !isChargePowerPresent(batteryData) )
+                checkBatteryCharge( batteryData, batteryNumber, bat->second, w.warnShort, w.warnVerbose,
+                                    config_.chargeWarnThreshhold, config_.chargeDeviationThreshold );
+            break;
+    }
+
+    WarningMap::iterator it = warnings_.find( key );
+    if ( w.warnShort.empty() )
+    {
+        if ( it == warnings_.end() ) 
+            return false;
+        warnings_.erase( it );
+        return true;
+    }
+    if ( it != warnings_.end() && it->second.warnShort == w.warnShort && it->second.warnVerbose == w.warnVerbose )
+        return false;
+    warnings_[key] = w;
+    return true;
+}
+
+bool
+OceanServerHealthMonitor::update( const OceanServerSystem  &batteryData,
+                                  const OceanServerChanges &changes )
+{
+    if ( batteryData.isEmpty() )
+    {
+        const bool changed = !( warnings_.size()==1 && warnings_.begin()->first.first==EmptyRecordCheck );
+        warnings_.clear();
+        runCheck( batteryData, EmptyRecordCheck, 0 );
+        return changed;
+    }
+
+    bool changed = runCheck( batteryData, EmptyRecordCheck, 0 );
+
+    if ( changed ) {
+        // we weren't keeping track while the record was empty
+        return updateAll( batteryData ) || changed;
+    }
+
+    if ( changes.controller )
+    {
+        changed = runCheck( batteryData, NumberOfBatteriesCheck, 0 ) || changed;
+        changed = runCheck( batteryData, ModuleHealthCheck, 0 ) || changed;
+    }
+
+    // The temperature checks depend on the controller's charging flags, the charge checks on
+    // the system's average charge and the controller's charge power flags.
+    set<int> numCycles = changes.batteries;
+    set<int> temperature = changes.batteries;
+    set<int> charge = changes.batteries;
+    map<int,SmartBattery>::const_iterator it;
+    for (it=batteryData.batteries().begin(); it!=batteryData.batteries().end(); it++)
+    {
+        if ( changes.controller ) 
+            temperature.insert( it->first );
+        if ( changes.controller || changes.system )
+            charge.insert( it->first );
+    }
+
+    // Batteries which were erased are checked as well, which clears their warnings
+    set<int>::const_iterator bat;
+    for (bat=numCycles.begin(); bat!=numCycles.end(); bat++)
+        changed = runCheck( batteryData, NumCyclesCheck, *bat ) || changed;
+    for (bat=temperature.begin(); bat!=temperature.end(); bat++)
+        changed = runCheck( batteryData, TemperatureCheck, *bat ) || changed;
+    for (bat=charge.begin(); bat!=charge.end(); bat++)
+        changed = runCheck( batteryData, ChargeCheck, *bat ) || changed;
+
+    return changed;
+}
+
+bool
+OceanServerHealthMonitor::updateAll( const OceanServerSystem &batteryData )
+{
+    OceanServerChanges changes;
+    changes.system = true;
+    changes.controller = true;
     
+    // also clear the warnings of batteries we no longer have
+    for (WarningMap::const_iterator it=warnings_.begin(); it!=warnings_.end(); it++)
+    {
+        if ( it->first.second != 0 )
+            changes.batteries.insert( it->first.second );
+    }
+    map<int,SmartBattery>::const_iterator it;
+    for (it=batteryData.batteries().begin(); it!=batteryData.batteries().end(); it++)
+        changes.batteries.insert( it->first );
+
+    return update( batteryData, changes );
+}
+
+void
+OceanServerHealthMonitor::warnings( std::vector<std::string> &warnShort,
+                                    std::vector<std::string> &warnVerbose ) const
+{
+    for (WarningMap::const_iterator it=warnings_.begin(); it!=warnings_.end(); it++)
+    {
+        warnShort.insert( warnShort.end(), it->second.warnShort.begin(), it->second.warnShort.end() );
+        warnVerbose.insert( warnVerbose.end(), it->second.warnVerbose.begin(), it->second.warnVerbose.end() );
+    }
+}
     
 }
 
@@ -83,9 +83,54 @@ bool conductAllHealthChecks( const OceanServerSystem          &batteryData,
                              std::vector<std::string>         &warnShort,
                              std::vector<std::string>         &warnVerbose,
                              bool                              printRawRecord = false );
-                       
 
+//!
+//! Keeps the health warnings of an OceanServerSystem up to date as it is updated piece by piece.
+//!
+//! Runs the same checks as conductAllHealthChecks, but after an update only re-runs the checks
+//! which depend on the parts of the system that changed, e.g. only the checks of one battery
+//! module after a line with that module's data. The warnings of the other checks are kept.
+//!
+//! Not thread-safe.
+//!
+class OceanServerHealthMonitor
+{
+public:
+    
+    OceanServerHealthMonitor( const BatteryHealthWarningConfig &config );
+
+    //! Re-runs the checks which depend on the parts of batteryData marked in 'changes'.
+    //! Returns true if the warnings changed.
+    bool update( const OceanServerSystem  &batteryData,
+                 const OceanServerChanges &changes );
+
+    //! Re-runs all checks. Returns true if the warnings changed.
+    bool updateAll( const OceanServerSystem &batteryData );
+
+    //! Returns true if there are warnings
+    bool haveWarnings() const { return !warnings_.empty(); };
+
+    //! Returns the current warnings, in the same order as conductAllHealthChecks would
+    void warnings( std::vector<std::string> &warnShort,
+                   std::vector<std::string> &warnVerbose ) const;
 
+private:
+
+    struct Warnings
+    {
+        std::vector<std::string> warnShort;
+        std::vector<std::string> warnVerbose;
+    };
+
+    // key: check type and battery number (0 for checks on the whole system)
+    typedef std::map<std::pair<int,int>,Warnings> WarningMap;
+
+    // Runs a check and stores its warnings. Returns true if they changed.
+    bool runCheck( const OceanServerSystem &batteryData, int check, int batteryNumber );
+
+    BatteryHealthWarningConfig config_;
+    WarningMap warnings_;
+};
 
 } // namespace
 
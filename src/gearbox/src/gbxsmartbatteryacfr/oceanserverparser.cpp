@@ -26,8 +26,8 @@ namespace
     bool
     containsBinaryCharacters( const std::string &line )
     {
-        // check for binary characters
-        for (unsigned int k=0; k<line.size()-2; k++)
+        // check for binary characters, except for the trailing "\r\n"
+        for (unsigned int k=0; k+2<line.size(); k++)
         {            
             if ( iscntrl(line[k]) ) 
                 return true;
@@ -213,8 +213,9 @@ OceanServerParser::parseSingleBatteryData( const map<string,string> &keyValuePai
 }
 
 void 
-OceanServerParser::parseFields( vector<string>    &fields, 
-                                OceanServerSystem &batterySystem )
+OceanServerParser::parseFields( vector<string>     &fields, 
+                                OceanServerSystem  &batterySystem,
+                                OceanServerChanges &changes )
 {
     if (fields.size()==0) return;
     
@@ -233,10 +234,12 @@ OceanServerParser::parseFields( vector<string>    &fields,
     if (msgTypeKey=="$S") 
     {
         parseSystemData( keyValuePairs, batterySystem );
+        changes.system = true;
     } 
     else if  (msgTypeKey=="$C")
     {
         parseControllerData( keyValuePairs, batterySystem );    
+        changes.controller = true;
     }
     else if (msgTypeKey=="$B")
     {   
@@ -244,6 +247,7 @@ OceanServerParser::parseFields( vector<string>    &fields,
         int batteryNum;
         ss >> batteryNum;
         parseSingleBatteryData( keyValuePairs, batteryNum, batterySystem );
+        changes.batteries.insert( batteryNum );
     }
     else
     {
@@ -300,28 +304,37 @@ OceanServerParser::parse( vector<string>    &stringList,
     //
     // Parsing
     //
+    OceanServerChanges changes;
     for (unsigned int i=0; i<stringList.size(); i++)
     {
-        if ( containsBinaryCharacters( stringList[i] ) )
-             throw ParsingException( ERROR_INFO, "Found a binary character" );
-
-        // divide the filteredString into 2 parts: data and checksum (if present)
-        vector<string> checksumList = gbxutilacfr::tokenise( stringList[i], "%" );
-        if ( checksumList.size()==2 )
-        {        
-            // we have a checksum, is it correct?
-            if (!isChecksumValid( checksumList[0], checksumList[1] ) )
-                throw ParsingException( ERROR_INFO, "Checksum failed!" );
-        }
-                 
-        // divide the data into individual fields and parse
-        if (checksumList.size()==0)
-            throw ParsingException( ERROR_INFO, "String length is 0" );
-        vector<string> fields = gbxutilacfr::tokenise( checksumList[0], "," );
-        parseFields( fields, batterySystem );
+        parseLine( stringList[i], batterySystem, changes );
     }
 
 }
 
+void
+OceanServerParser::parseLine( const string       &line,
+                              OceanServerSystem  &batterySystem,
+                              OceanServerChanges &changes )
+{
+    if ( containsBinaryCharacters( line ) )
+         throw ParsingException( ERROR_INFO, "Found a binary character" );
+
+    // divide the filteredString into 2 parts: data and checksum (if present)
+    vector<string> checksumList = gbxutilacfr::tokenise( line, "%" );
+    if ( checksumList.size()==2 )
+    {        
+        // we have a checksum, is it correct?
+        if (!isChecksumValid( checksumList[0], checksumList[1] ) )
+            throw ParsingException( ERROR_INFO, "Checksum failed!" );
+    }
+             
+    // divide the data into individual fields and parse
+    if (checksumList.size()==0)
+        throw ParsingException( ERROR_INFO, "String length is 0" );
+    vector<string> fields = gbxutilacfr::tokenise( checksumList[0], "," );
+    parseFields( fields, batterySystem, changes );
+}
+
 }
 
@@ -33,6 +33,13 @@ public:
     //! Parses each line and sets corresponding fields in batterySystem
     void parse( std::vector<std::string> &stringList, 
                 OceanServerSystem        &batterySystem );
+
+    //! Parses a single line of a record and sets the corresponding fields in batterySystem.
+    //! Marks the part of batterySystem the line is about in 'changes'.
+    //! On a ParsingException, batterySystem may have been partly updated.
+    void parseLine( const std::string  &line,
+                    OceanServerSystem  &batterySystem,
+                    OceanServerChanges &changes );
     
     //! Checks whether the passed string (one line) is the first line of the record
     bool atBeginningOfRecord( const std::string &line );
@@ -43,7 +50,8 @@ private:
             
     // parsing functions
     void parseFields( std::vector<std::string>       &fields, 
-                      OceanServerSystem              &batterySystem );
+                      OceanServerSystem              &batterySystem,
+                      OceanServerChanges             &changes );
     
     void parseSystemData( const std::map<std::string,std::string> &keyValuePairs,
                           OceanServerSystem                       &batterySystem);
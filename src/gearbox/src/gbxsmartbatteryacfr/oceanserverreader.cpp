@@ -10,6 +10,7 @@
 
 #include <sstream>
 #include <cstring>
+#include <cstdlib>
 #include <gbxsmartbatteryacfr/exceptions.h>
 
 #include "oceanserverreader.h"
@@ -63,7 +64,9 @@ OceanServerReader::OceanServerReader( const string        &serialPort,
     : serial_( serialPort, BAUDRATE, gbxserialacfr::Serial::Timeout(TIMEOUT_SEC,0) ),
       tracer_(tracer),
       parser_(tracer),
-      firstTime_(true)
+      firstTime_(true),
+      inRecord_(false),
+      recordDamaged_(false)
 {
     checkConnection();
     reset();
@@ -83,6 +86,8 @@ OceanServerReader::reset()
     serial_.write(&startSendingHex, 1);
 
     firstTime_ = true;
+    inRecord_ = false;
+    lastLines_.clear();
 }
 
 void
@@ -218,5 +223,96 @@ OceanServerReader::read( OceanServerSystem &system )
     }
 }
 
+void
+OceanServerReader::completeRecord( OceanServerSystem  &system,
+                                   OceanServerChanges &changes )
+{
+    system.rawRecord() = record_;
+    if ( recordDamaged_ ) 
+        return;
+
+    // reap battery modules which are no longer connected
+    vector<int> reapingIds;
+    map<int,SmartBattery>::const_iterator it;
+    for (it=system.batteries().begin(); it!=system.batteries().end(); it++)
+    {
+        if ( recordBatteries_.find( it->first ) == recordBatteries_.end() )
+            reapingIds.push_back( it->first );
+    }
+    for (unsigned int i=0; i<reapingIds.size(); i++)
+    {
+        system.eraseBattery( reapingIds[i] );
+        changes.batteries.insert( reapingIds[i] );
+    }
+    
+    // make sure a module which comes back is parsed again
+    map<string,string>::iterator line = lastLines_.begin();
+    while ( line != lastLines_.end() )
+    {
+        if ( line->first.compare( 0, 2, "$B" )==0 && 
+             recordBatteries_.find( atoi( line->first.c_str()+2 ) ) == recordBatteries_.end() )
+            lastLines_.erase( line++ );
+        else
+            ++line;
+    }
+}
+
+bool
+OceanServerReader::readLine( OceanServerSystem  &system,
+                             OceanServerChanges &changes )
+{
+    string serialData = tryToReadLineFromSerialPort();
+    
+    bool recordComplete = false;
+    if ( parser_.atBeginningOfRecord( serialData ) )
+    {
+        if ( inRecord_ ) 
+        {
+            tracer_.debug( "OceanServerReader: End of the record (beginning of a SUBSEQUENT record)", 5 );
+            completeRecord( system, changes );
+            recordComplete = true;
+        }
+        inRecord_ = true;
+        recordDamaged_ = false;
+        record_.clear();
+        recordBatteries_.clear();
+    }
+    
+    // wait until we got the beginning of the record
+    if ( !inRecord_ ) 
+        return false;
+    record_.push_back( serialData );
+    
+    const string msgType = serialData.substr( 0, serialData.find(',') );
+    if ( msgType.compare( 0, 2, "$B" )==0 )
+        recordBatteries_.insert( atoi( msgType.c_str()+2 ) );
+
+    // nothing new: the modules don't change between records most of the time
+    map<string,string>::iterator lastLine = lastLines_.find( msgType );
+    if ( lastLine != lastLines_.end() && lastLine->second == serialData )
+        return recordComplete;
+        
+    try
+    {
+        parser_.parseLine( serialData, system, changes );
+        lastLines_[msgType] = serialData;
+    }
+    catch (ParsingException &e)
+    {
+        stringstream ss;
+        ss << "OceanServerReader: Caught ParsingException: " << e.what() << ". ";
+        ss << "It's not critical, we will continue with the next line.";
+        tracer_.debug( ss.str(), 3 );
+        
+        if ( lastLine != lastLines_.end() )
+            lastLines_.erase( lastLine );
+        recordDamaged_ = true;
+        
+        // we have to rethrow, so that the caller knows that the line was lost
+        throw;
+    }
+    
+    return recordComplete;
+}
+
 }
-         
@@ -11,6 +11,8 @@
 #ifndef GBX_OCEANSERVER_READER_H
 #define GBX_OCEANSERVER_READER_H
 
+#include <set>
+#include <map>
 #include <gbxserialacfr/serial.h>
 #include <gbxutilacfr/tracer.h>
 
@@ -41,6 +43,21 @@ public:
     //! May throw HardwareReadingExceptions and ParsingExceptions
     void read( OceanServerSystem &system );
 
+    //! Reads a single line and applies it to 'system' straight away. 'system' is the caller's model
+    //! of the battery system, and has to be the same object in every call.
+    //! Marks the parts of 'system' which changed in 'changes' (which is not cleared first).
+    //! Lines which are the same as the last time are not parsed again.
+    //! When a record is complete, battery modules which were not in it are erased and the raw 
+    //! record is set. Returns true if the line completed a record.
+    //!
+    //! If a line can't be parsed, the rest of the record is still applied, but no modules are erased
+    //! at the end of it.
+    //! May throw HardwareReadingExceptions and ParsingExceptions
+    //!
+    //! Don't mix calls to read() and readLine().
+    bool readLine( OceanServerSystem  &system,
+                   OceanServerChanges &changes );
+
     //! Resets the reader:
     //!  - tells the OceanServer system to spit out hex data
     //!  - tries to find the beginning of a new record
@@ -58,6 +75,18 @@ private:
     
     std::string beginningRecordLine_;
     bool firstTime_;
+
+    // For readLine()
+    void completeRecord( OceanServerSystem &system, OceanServerChanges &changes );
+    // true if we have seen the beginning of a record
+    bool inRecord_;
+    // true if a line of the current record could not be parsed
+    bool recordDamaged_;
+    std::vector<std::string> record_;
+    // battery modules in the current record
+    std::set<int> recordBatteries_;
+    // key: message type (e.g. $B01), data: the last line of that type which was parsed
+    std::map<std::string,std::string> lastLines_;
 };
 
 } // namespace
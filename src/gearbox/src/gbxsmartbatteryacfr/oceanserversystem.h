@@ -12,6 +12,7 @@
 #define GBX_OCEANSERVER_SYSTEM_H
 
 #include <map>
+#include <set>
 #include <gbxsmartbatteryacfr/smartbattery.h>
 
 namespace gbxsmartbatteryacfr
@@ -113,6 +114,28 @@ class OceanServerSystem
         std::map<int,SmartBattery> batteries_;
 };
 
+//!
+//! Marks which parts of an OceanServerSystem were changed by an update
+//!
+struct OceanServerChanges
+{
+    OceanServerChanges() : system(false), controller(false), healthWarnings(false) {};
+
+    //! Returns true if anything changed
+    bool any() const { return system || controller || !batteries.empty() || healthWarnings; };
+    //! Marks nothing as changed
+    void clear() { system=false; controller=false; batteries.clear(); healthWarnings=false; };
+
+    //! The system averages (percentCharge, minToEmpty, messageToSystem)
+    bool system;
+    //! The controller's module state flags
+    bool controller;
+    //! Slot numbers of battery modules which were updated, added or erased
+    std::set<int> batteries;
+    //! The health warnings derived from the data (see OceanServerHealthMonitor)
+    bool healthWarnings;
+};
+
 //! Puts OceanServerSystem data into a human-readable string
 std::string toString( const OceanServerSystem &system );
 
@@ -0,0 +1,137 @@
+#include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <gbxutilacfr/trivialtracer.h>
+#include <gbxsmartbatteryacfr/exceptions.h>
+#include <gbxsmartbatteryacfr/oceanserverparser.h>
+#include <gbxsmartbatteryacfr/oceanserverhealthchecks.h>
+
+using namespace std;
+using namespace gbxsmartbatteryacfr;
+
+namespace {
+
+// Appends the checksum and line ending the OceanServer system sends
+string line( const string &data )
+{
+    unsigned int checksum = 0;
+    for (unsigned int i=1; i<data.size(); i++)
+        checksum ^= data[i];
+    char suffix[8];
+    snprintf( suffix, sizeof(suffix), "%%%02X\r\n", checksum );
+    return data + suffix;
+}
+
+// Returns true if the monitor has the same warnings as conductAllHealthChecks
+bool sameAsAllChecks( const OceanServerSystem          &system,
+                      const OceanServerHealthMonitor   &monitor,
+                      const BatteryHealthWarningConfig &config )
+{
+    vector<string> allShort, allVerbose, monitorShort, monitorVerbose;
+    conductAllHealthChecks( system, config, allShort, allVerbose );
+    monitor.warnings( monitorShort, monitorVerbose );
+    if ( allShort==monitorShort && allVerbose==monitorVerbose )
+        return true;
+
+    cout << "conductAllHealthChecks: ";
+    for (unsigned int i=0; i<allShort.size(); i++) cout << allShort[i];
+    cout << endl << "OceanServerHealthMonitor: ";
+    for (unsigned int i=0; i<monitorShort.size(); i++) cout << monitorShort[i];
+    cout << endl;
+    return false;
+}
+
+}
+
+// Applies records line by line and checks that the incremental health checks agree
+// with the full ones after every line
+int main( int argc, char **argv )
+{
+    gbxutilacfr::TrivialTracer tracer;
+    OceanServerParser parser( tracer );
+
+    BatteryHealthWarningConfig config;
+    config.expectedNumBatteries = 2;
+    config.numCyclesThreshhold = 100;
+    config.chargeTempThreshhold = 45;
+    config.dischargeTempThreshhold = 60;
+    config.chargeWarnThreshhold = 20;
+    config.chargeDeviationThreshold = 10;
+
+    OceanServerSystem system;
+    OceanServerHealthMonitor monitor( config );
+    OceanServerChanges changes;
+
+    cout << "testing empty record ... ";
+    if ( !monitor.update( system, changes ) || !sameAsAllChecks( system, monitor, config ) ) {
+        cout << "failed. expecting an empty-record warning" << endl;
+        return 1;
+    }
+    cout << "ok" << endl;
+
+    // temperature 0x0CA0 = 50.05degC, charge 0x32 = 50%, cycles 0x10 = 16
+    vector<string> lines;
+    lines.push_back( line("$S,01,0100,04,50") );
+    lines.push_back( line("$C,01,03,02,00,03,00,05,00,06,00,07,00") );
+    lines.push_back( line("$B01,08,0CA0,0D,0032,17,0010") );
+    lines.push_back( line("$B02,08,0CA0,0D,0032,17,0010") );
+    // battery 2 runs low and hot, then its charger comes on which makes it too hot to charge
+    lines.push_back( line("$B02,08,0D10,0D,0005,17,0010") );
+    lines.push_back( line("$C,01,03,02,02,03,00,05,02,06,00,07,00") );
+    // battery 1 has had too many cycles and battery 2 is gone
+    lines.push_back( line("$B01,08,0CA0,0D,0032,17,0080") );
+    lines.push_back( line("$C,01,01,02,00,03,00,05,00,06,00,07,00") );
+
+    cout << "testing parseLine() and OceanServerHealthMonitor::update() ... ";
+    for (unsigned int i=0; i<lines.size(); i++)
+    {
+        changes.clear();
+        try {
+            parser.parseLine( lines[i], system, changes );
+        }
+        catch ( std::exception &e ) {
+            cout << "failed. couldn't parse line " << i << ": " << e.what() << endl;
+            return 1;
+        }
+        if ( i==6 ) {
+            system.eraseBattery( 2 );
+            changes.batteries.insert( 2 );
+        }
+        if ( !changes.any() ) {
+            cout << "failed. expecting line " << i << " to change something" << endl;
+            return 1;
+        }
+        monitor.update( system, changes );
+        if ( !sameAsAllChecks( system, monitor, config ) ) {
+            cout << "failed. different warnings after line " << i << endl;
+            return 1;
+        }
+    }
+    if ( !monitor.haveWarnings() ) {
+        cout << "failed. expecting a high-cycles warning" << endl;
+        return 1;
+    }
+    cout << "ok" << endl;
+
+    cout << "testing change marking ... ";
+    changes.clear();
+    parser.parseLine( line("$B03,08,0CA0"), system, changes );
+    if ( changes.system || changes.controller || changes.batteries.size()!=1 || *changes.batteries.begin()!=3 ) {
+        cout << "failed. expecting only battery 3 to be marked" << endl;
+        return 1;
+    }
+    cout << "ok" << endl;
+
+    cout << "testing bad checksum ... ";
+    try {
+        parser.parseLine( "$S,01,0100,04,50%00\r\n", system, changes );
+        cout << "failed. expecting a ParsingException" << endl;
+        return 1;
+    }
+    catch ( ParsingException & ) {
+        ; // ok
+    }
+    cout << "ok" << endl;
+
+    return 0;
+}
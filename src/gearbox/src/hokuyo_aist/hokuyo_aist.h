@@ -24,6 +24,7 @@
 #include "sensor_info.h"
 #include "scan_data.h"
 #include "sensor.h"
+#include "sensor_group.h"
 
 // TODO: The line reading code is suffering from age. It is getting bloated and
 // complicated, not to mention slow. Reading the range data has been switched
@@ -317,7 +317,11 @@ std::string desc_code_to_string(unsigned int code)
 /* 35 */ "SCIP version 1 does not support the semi-reset command.",
 /* 36 */ "SCIP version 1 does not support the get ranges and intensities command.",
 /* 37 */ "Error configuring IP address.",
-/* 38 */ "Did not receive a full line."
+/* 38 */ "Did not receive a full line.",
+/* 39 */ "Compact storage cannot be used with provided buffers.",
+/* 40 */ "Compact range scale must be a power of two no larger than 32768.",
+/* 41 */ "No scan has been requested.",
+/* 42 */ "A scan has already been requested."
     };
 
     return std::string(descriptions[code]);
@@ -69,8 +69,9 @@ class ScanDataWrap : public ScanData, public boost::python::wrapper<ScanData>
             : ScanData(rhs)
         {}
 
+        // Through the base class, so compact data is widened
         uint32_t range(unsigned int index)
-            { return ranges_[index]; }
+            { return ScanData::range(index); }
         /*unsigned int ranges_length() const
         {
             if (boost::python::override f = get_override("ranges_length"))
@@ -81,7 +82,7 @@ class ScanDataWrap : public ScanData, public boost::python::wrapper<ScanData>
         }*/
 
         uint32_t intensity(unsigned int index)
-            { return intensities_[index]; }
+            { return ScanData::intensity(index); }
         /*unsigned int intensities_length() const
         {
             if (boost::python::override f = get_override("intensities_length"))
@@ -128,6 +129,8 @@ class ScanDataWrap : public ScanData, public boost::python::wrapper<ScanData>
         }*/
 };
 
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(scan_data_overloads1,
+        set_compact, 1, 2)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(sensor_overloads1,
         get_ranges, 1, 4)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(sensor_overloads2,
@@ -169,6 +172,9 @@ BOOST_PYTHON_MODULE(hokuyo_aist)
         .def("system_time_stamp", &ScanData::system_time_stamp)
         .def("model", &ScanData::model)
         .def("buffers_provided", &ScanData::buffers_provided)
+        .def("set_compact", &ScanData::set_compact, scan_data_overloads1())
+        .def("compact", &ScanData::compact)
+        .def("range_scale", &ScanData::range_scale)
         .def("as_string", &ScanData::as_string)
         .def("clean_up", &ScanData::clean_up)
         ;
@@ -176,6 +182,7 @@ BOOST_PYTHON_MODULE(hokuyo_aist)
     class_<Sensor>("Sensor")
         .def("open", &Sensor::open)
         .def("open_with_probing", &Sensor::open_with_probing)
+        .def("set_info_cache", &Sensor::set_info_cache)
         .def("close", &Sensor::close)
         .def("is_open", &Sensor::is_open)
         .def("set_power", &Sensor::set_power)
@@ -215,6 +222,7 @@ BOOST_PYTHON_MODULE(hokuyo_aist)
         .def("set_verbose", &Sensor::set_verbose)
         .def("ignore_unknowns", &Sensor::ignore_unknowns)
         .def("set_multiecho_mode", &Sensor::set_multiecho_mode)
+        .def("set_keep_echoes", &Sensor::set_keep_echoes)
         .def("step_to_angle", &Sensor::step_to_angle)
         .def("angle_to_step", &Sensor::angle_to_step)
         ;
@@ -33,7 +33,11 @@ using namespace hokuyo_aist;
 ScanData::ScanData()
     : ranges_(0), intensities_(0), ranges_length_(0),
     intensities_length_(0), error_(false), laser_time_(0), system_time_(0),
-    model_(MODEL_UNKNOWN), buffers_provided_(false)
+    model_(MODEL_UNKNOWN), buffers_provided_(false), range_echoes_(0),
+    range_echo_counts_(0), intensity_echoes_(0), intensity_echo_counts_(0),
+    echoes_length_(0), compact_(false), range_shift_(0), compact_ranges_(0),
+    compact_intensities_(0), wide_ranges_(0), wide_intensities_(0),
+    ranges_widened_(false), intensities_widened_(false)
 {
 }
 
@@ -44,15 +48,25 @@ ScanData::ScanData(uint32_t* const ranges_buffer,
     : ranges_(ranges_buffer), intensities_(intensities_buffer),
     ranges_length_(ranges_length), intensities_length_(intensities_length),
     error_(false), laser_time_(0), system_time_(0), model_(MODEL_UNKNOWN),
-    buffers_provided_(true)
+    buffers_provided_(true), range_echoes_(0), range_echo_counts_(0),
+    intensity_echoes_(0), intensity_echo_counts_(0), echoes_length_(0),
+    compact_(false), range_shift_(0), compact_ranges_(0),
+    compact_intensities_(0), wide_ranges_(0), wide_intensities_(0),
+    ranges_widened_(false), intensities_widened_(false)
 {
 }
 
 
 ScanData::ScanData(ScanData const& rhs)
+    : range_echoes_(0), range_echo_counts_(0), intensity_echoes_(0),
+    intensity_echo_counts_(0), echoes_length_(0), compact_(rhs.compact_),
+    range_shift_(rhs.range_shift_), compact_ranges_(0),
+    compact_intensities_(0), wide_ranges_(0), wide_intensities_(0),
+    ranges_widened_(false), intensities_widened_(false)
 {
-    ranges_length_ = rhs.ranges_length();
-    intensities_length_ = rhs.intensities_length();
+    // Compact data is copied by copy_compact(), below
+    ranges_length_ = compact_ ? 0 : rhs.ranges_length();
+    intensities_length_ = compact_ ? 0 : rhs.intensities_length();
     if(ranges_length_ == 0)
         ranges_ = 0;
     else
@@ -81,14 +95,18 @@ ScanData::ScanData(ScanData const& rhs)
             intensities_length_ = 0;
             throw;
         }
-        memcpy(intensities_, rhs.ranges(),
+        memcpy(intensities_, rhs.intensities(),
                 sizeof(uint32_t) * intensities_length_);
     }
     error_ = rhs.get_error_status();
     laser_time_ = rhs.laser_time_stamp();
     system_time_ = rhs.system_time_stamp();
     model_ = rhs.model();
-    buffers_provided_ = rhs.buffers_provided();
+    // The copy always has its own buffers
+    buffers_provided_ = false;
+    copy_echoes(rhs);
+    if(compact_)
+        copy_compact(rhs);
 }
 
 
@@ -107,6 +125,8 @@ ScanData::~ScanData()
             intensities_ = 0;
         }
     }
+    release_echoes();
+    release_compact();
 }
 
 
@@ -189,6 +209,57 @@ std::string ScanData::error_code_to_string(uint32_t error_code)
 
 ScanData& ScanData::operator=(ScanData const& rhs)
 {
+    if(rhs.compact() && !compact_ && !buffers_provided_)
+    {
+        // Take the compact arrays as they are
+        delete[] ranges_;
+        ranges_ = 0;
+        delete[] intensities_;
+        intensities_ = 0;
+        ranges_length_ = 0;
+        intensities_length_ = 0;
+        compact_ = true;
+    }
+
+    if(compact_)
+    {
+        // Stay compact, whatever the rhs is. No provided buffers in this mode.
+        if(rhs.compact())
+        {
+            range_shift_ = rhs.range_shift_;
+            copy_compact(rhs);
+        }
+        else if(rhs.ranges_length() == 0)
+        {
+            release_compact();
+        }
+        else
+        {
+            unsigned int length(rhs.ranges_length());
+            bool include_intensities(rhs.intensities_length() == length);
+            allocate_compact(length, include_intensities);
+            for (unsigned int ii = 0; ii < length; ii++)
+                compact_ranges_[ii] = narrow_range(rhs.ranges_[ii]);
+            if(include_intensities)
+            {
+                for (unsigned int ii = 0; ii < length; ii++)
+                {
+                    compact_intensities_[ii] =
+                        narrow_intensity(rhs.intensities_[ii]);
+                }
+            }
+        }
+        error_ = rhs.get_error_status();
+        laser_time_ = rhs.laser_time_stamp();
+        system_time_ = rhs.system_time_stamp();
+        model_ = rhs.model();
+        copy_echoes(rhs);
+        return *this;
+    }
+
+    // From here on the lhs is not compact, so either the rhs isn't either or
+    // the lhs has provided buffers. A compact rhs's data is widened by its
+    // ranges() and intensities().
     unsigned int rhslength = rhs.ranges_length();
     if(rhslength == 0)
     {
@@ -266,38 +337,78 @@ ScanData& ScanData::operator=(ScanData const& rhs)
     laser_time_ = rhs.laser_time_stamp();
     system_time_ = rhs.system_time_stamp();
     model_ = rhs.model();
-    buffers_provided_ = rhs.buffers_provided();
+    // The lhs keeps its own buffers, provided or not
+    copy_echoes(rhs);
 
     return *this;
 }
 
 
 uint32_t ScanData::operator[](unsigned int index)
+{
+    return range(index);
+}
+
+
+uint32_t ScanData::range(unsigned int index) const
 {
     if(index >= ranges_length_)
         throw IndexError();
+    if(compact_ranges_ != 0)
+        return widen_range(compact_ranges_[index]);
     return ranges_[index];
 }
 
 
+uint32_t ScanData::intensity(unsigned int index) const
+{
+    if(index >= intensities_length_)
+        throw IndexError();
+    if(compact_intensities_ != 0)
+        return compact_intensities_[index];
+    return intensities_[index];
+}
+
+
+void ScanData::set_compact(bool compact, unsigned int range_scale)
+{
+    if(compact && buffers_provided_)
+        throw UnsupportedError(39);
+    if(range_scale == 0 || range_scale > 0x8000 ||
+            (range_scale & (range_scale - 1)) != 0)
+        throw ArgError(40);
+
+    unsigned int shift(0);
+    while((1U << shift) < range_scale)
+        shift++;
+    if(compact != compact_ || shift != range_shift_)
+        clean_up();
+    compact_ = compact;
+    range_shift_ = shift;
+}
+
+
 std::string ScanData::as_string()
 {
     std::stringstream ss;
+    // Widened in compact mode
+    uint32_t const* ranges_data(ranges());
+    uint32_t const* intensities_data(intensities());
 
-    if(ranges_ != 0)
+    if(ranges_data != 0)
     {
         ss << ranges_length_ << " ranges from model ";
         ss << model_to_string(model_) << ":\n";
         for(unsigned int ii(0); ii < ranges_length_; ii++)
-            ss << ranges_[ii] << '\t';
+            ss << ranges_data[ii] << '\t';
         ss << '\n';
     }
-    if(intensities_ != 0)
+    if(intensities_data != 0)
     {
         ss << intensities_length_ << " intensities from model ";
         ss << model_to_string(model_) << ":\n";
         for(unsigned int ii(0); ii < intensities_length_; ii++)
-            ss << intensities_[ii] << '\t';
+            ss << intensities_data[ii] << '\t';
         ss << '\n';
     }
 
@@ -306,8 +417,11 @@ std::string ScanData::as_string()
         ss << "Detected data errors:\n";
         for(unsigned int ii = 0; ii < ranges_length_; ii++)
         {
-            if(ranges_[ii] < 20)
-                ss << ii << ": " << error_code_to_string(ranges_[ii]) << '\n';
+            if(ranges_data[ii] < 20)
+            {
+                ss << ii << ": " << error_code_to_string(ranges_data[ii]) <<
+                    '\n';
+            }
         }
     }
     else
@@ -335,6 +449,8 @@ void ScanData::clean_up()
     error_ = false;
     laser_time_ = 0;
     system_time_ = 0;
+    release_echoes();
+    release_compact();
 }
 
 
@@ -343,6 +459,11 @@ void ScanData::allocate_data(unsigned int length, bool include_intensities)
     // If buffers have been provided, automatic allocation is off.
     if(buffers_provided_)
         return;
+    if(compact_)
+    {
+        allocate_compact(length, include_intensities);
+        return;
+    }
 
     // If no data yet, allocate new
     if(ranges_ == 0)
@@ -419,9 +540,92 @@ void ScanData::allocate_data(unsigned int length, bool include_intensities)
 }
 
 
+void ScanData::allocate_echoes(unsigned int length, bool include_intensities)
+{
+    // Reallocate only if the length is different
+    if(length != echoes_length_)
+        release_echoes();
+
+    try
+    {
+        if(range_echoes_ == 0)
+        {
+            range_echoes_ = new uint32_t[length * MAX_ECHOES];
+            range_echo_counts_ = new uint8_t[length];
+        }
+        if(include_intensities && intensity_echoes_ == 0)
+        {
+            intensity_echoes_ = new uint32_t[length * MAX_ECHOES];
+            intensity_echo_counts_ = new uint8_t[length];
+        }
+    }
+    catch(std::bad_alloc& e)
+    {
+        release_echoes();
+        throw;
+    }
+    echoes_length_ = length;
+
+    if(!include_intensities && intensity_echoes_ != 0)
+    {
+        delete[] intensity_echoes_;
+        delete[] intensity_echo_counts_;
+        intensity_echoes_ = 0;
+        intensity_echo_counts_ = 0;
+    }
+}
+
+
+void ScanData::release_echoes()
+{
+    delete[] range_echoes_;
+    delete[] range_echo_counts_;
+    delete[] intensity_echoes_;
+    delete[] intensity_echo_counts_;
+    range_echoes_ = 0;
+    range_echo_counts_ = 0;
+    intensity_echoes_ = 0;
+    intensity_echo_counts_ = 0;
+    echoes_length_ = 0;
+}
+
+
+void ScanData::copy_echoes(ScanData const& rhs)
+{
+    if(&rhs == this)
+        return;
+    if(!rhs.has_echoes())
+    {
+        release_echoes();
+        return;
+    }
+
+    allocate_echoes(rhs.echoes_length_, rhs.intensity_echoes_ != 0);
+    memcpy(range_echoes_, rhs.range_echoes_,
+            sizeof(uint32_t) * echoes_length_ * MAX_ECHOES);
+    memcpy(range_echo_counts_, rhs.range_echo_counts_,
+            sizeof(uint8_t) * echoes_length_);
+    if(intensity_echoes_ != 0)
+    {
+        memcpy(intensity_echoes_, rhs.intensity_echoes_,
+                sizeof(uint32_t) * echoes_length_ * MAX_ECHOES);
+        memcpy(intensity_echo_counts_, rhs.intensity_echo_counts_,
+                sizeof(uint8_t) * echoes_length_);
+    }
+}
+
+
 void ScanData::write_range(unsigned int index, uint32_t value)
 {
-    if(ranges_ != 0)
+    if(compact_ranges_ != 0)
+    {
+        if(index >= ranges_length_)
+            throw IndexError();
+        compact_ranges_[index] = narrow_range(value);
+        if(value < 20)
+            error_ = true;
+    }
+    else if(ranges_ != 0)
     {
         if(index >= ranges_length_)
             throw IndexError();
@@ -434,7 +638,15 @@ void ScanData::write_range(unsigned int index, uint32_t value)
 
 void ScanData::write_intensity(unsigned int index, uint32_t value)
 {
-    if(intensities_ != 0)
+    if(compact_intensities_ != 0)
+    {
+        if(index >= intensities_length_)
+            throw IndexError();
+        compact_intensities_[index] = narrow_intensity(value);
+        if(value < 20)
+            error_ = true;
+    }
+    else if(intensities_ != 0)
     {
         if(index >= intensities_length_)
             throw IndexError();
@@ -444,3 +656,149 @@ void ScanData::write_intensity(unsigned int index, uint32_t value)
     }
 }
 
+
+void ScanData::allocate_compact(unsigned int length, bool include_intensities)
+{
+    // Reallocate only if the length is different. The widened copies are
+    // made again on demand.
+    if(compact_ranges_ == 0 || length != ranges_length_)
+    {
+        delete[] compact_ranges_;
+        delete[] wide_ranges_;
+        compact_ranges_ = 0;
+        wide_ranges_ = 0;
+        ranges_length_ = 0;
+        compact_ranges_ = new uint16_t[length];
+        ranges_length_ = length;
+    }
+    ranges_widened_ = false;
+
+    if(include_intensities)
+    {
+        if(compact_intensities_ == 0 || length != intensities_length_)
+        {
+            delete[] compact_intensities_;
+            delete[] wide_intensities_;
+            compact_intensities_ = 0;
+            wide_intensities_ = 0;
+            intensities_length_ = 0;
+            compact_intensities_ = new uint16_t[length];
+            intensities_length_ = length;
+        }
+    }
+    else if(compact_intensities_ != 0)
+    {
+        delete[] compact_intensities_;
+        delete[] wide_intensities_;
+        compact_intensities_ = 0;
+        wide_intensities_ = 0;
+        intensities_length_ = 0;
+    }
+    intensities_widened_ = false;
+}
+
+
+void ScanData::release_compact()
+{
+    delete[] compact_ranges_;
+    delete[] compact_intensities_;
+    delete[] wide_ranges_;
+    delete[] wide_intensities_;
+    compact_ranges_ = 0;
+    compact_intensities_ = 0;
+    wide_ranges_ = 0;
+    wide_intensities_ = 0;
+    ranges_widened_ = false;
+    intensities_widened_ = false;
+    if(compact_)
+    {
+        ranges_length_ = 0;
+        intensities_length_ = 0;
+    }
+}
+
+
+void ScanData::copy_compact(ScanData const& rhs)
+{
+    if(&rhs == this)
+        return;
+
+    if(rhs.compact_ranges_ == 0)
+    {
+        // Nothing read yet
+        release_compact();
+        return;
+    }
+    allocate_compact(rhs.ranges_length_, rhs.compact_intensities_ != 0);
+    memcpy(compact_ranges_, rhs.compact_ranges_,
+            sizeof(uint16_t) * ranges_length_);
+    if(compact_intensities_ != 0)
+    {
+        memcpy(compact_intensities_, rhs.compact_intensities_,
+                sizeof(uint16_t) * intensities_length_);
+    }
+}
+
+
+uint32_t const* ScanData::widen_ranges() const
+{
+    if(compact_ranges_ == 0)
+        return 0;
+    if(!ranges_widened_)
+    {
+        if(wide_ranges_ == 0)
+            wide_ranges_ = new uint32_t[ranges_length_];
+        for (unsigned int ii = 0; ii < ranges_length_; ii++)
+            wide_ranges_[ii] = widen_range(compact_ranges_[ii]);
+        ranges_widened_ = true;
+    }
+    return wide_ranges_;
+}
+
+
+uint32_t const* ScanData::widen_intensities() const
+{
+    if(compact_intensities_ == 0)
+        return 0;
+    if(!intensities_widened_)
+    {
+        if(wide_intensities_ == 0)
+            wide_intensities_ = new uint32_t[intensities_length_];
+        for (unsigned int ii = 0; ii < intensities_length_; ii++)
+            wide_intensities_[ii] = compact_intensities_[ii];
+        intensities_widened_ = true;
+    }
+    return wide_intensities_;
+}
+
+
+uint32_t* ScanData::wide_ranges_buffer()
+{
+    if(wide_ranges_ == 0)
+        wide_ranges_ = new uint32_t[ranges_length_];
+    ranges_widened_ = false;
+    return wide_ranges_;
+}
+
+
+uint32_t* ScanData::wide_intensities_buffer()
+{
+    if(wide_intensities_ == 0)
+        wide_intensities_ = new uint32_t[intensities_length_];
+    intensities_widened_ = false;
+    return wide_intensities_;
+}
+
+
+void ScanData::narrow_ranges()
+{
+    for (unsigned int ii = 0; ii < ranges_length_; ii++)
+        compact_ranges_[ii] = narrow_range(wide_ranges_[ii]);
+}
+
+
+void ScanData::narrow_intensities()
+{
+    for (unsigned int ii = 0; ii < intensities_length_; ii++)
+        compact_intensities_[ii] = narrow_intensity(wide_intensities_[ii]);
+}
@@ -22,6 +22,7 @@
 
 #if defined(WIN32)
     typedef unsigned char           uint8_t;
+    typedef unsigned short          uint16_t;
     typedef unsigned int            uint32_t;
     #if defined(HOKUYO_AIST_STATIC)
         #define HOKUYO_AIST_EXPORT
@@ -54,6 +55,9 @@ class HOKUYO_AIST_EXPORT ScanData
     public:
         friend class Sensor;
 
+        /// The most echoes a sensor reports for one step in multi-echo mode.
+        enum { MAX_ECHOES = 3 };
+
         /// This constructor creates an empty ScanData with no data currently
         /// allocated.
         ScanData();
@@ -85,12 +89,28 @@ class HOKUYO_AIST_EXPORT ScanData
 
         Values less than 20mm indicate an error. Check the error value for the
         data to see a probable cause for the error. Most of the time, it will
-        just be an out-of-range reading. */
+        just be an out-of-range reading.
+
+        In compact mode, the first call after new data arrives widens the
+        compact ranges into an internal buffer. Use range() or
+        compact_ranges() to avoid that.
+
+        Not thread-safe in compact mode, even though it is const: two threads
+        calling ranges() or intensities() on the same ScanData can both be
+        widening into that buffer. Widen it once before sharing the data, or
+        use range() and compact_ranges(), which only read. */
         const uint32_t* ranges() const
-            { return ranges_; }
+            { return compact_ ? widen_ranges() : ranges_; }
         /// @brief Return a pointer to an array of intensity readings.
+        ///
+        /// In compact mode, widened as for ranges().
         const uint32_t* intensities() const
-            { return intensities_; }
+            { return compact_ ? widen_intensities() : intensities_; }
+        /// @brief Get a single range reading in millimetres. Works in both
+        /// modes without widening the whole scan.
+        uint32_t range(unsigned int index) const;
+        /// @brief Get a single intensity reading.
+        uint32_t intensity(unsigned int index) const;
         /// @brief Get the number of range samples in the data.
         unsigned int ranges_length() const { return ranges_length_; }
         /// @brief Get the number of intensity samples in the data.
@@ -116,6 +136,61 @@ class HOKUYO_AIST_EXPORT ScanData
         /// Check if the buffers are being provided instead of automatic.
         bool buffers_provided() const { return buffers_provided_; }
 
+        /** @brief Check if every echo of a multi-echo scan is available.
+
+        Only scans read in multi-echo mode with Sensor::set_keep_echoes(true)
+        have them. ranges() and intensities() still hold one value per step,
+        combined according to the multi-echo mode. */
+        bool has_echoes() const { return range_echoes_ != 0; }
+        /// @brief Get the number of steps in the echo arrays.
+        unsigned int echoes_length() const { return echoes_length_; }
+        /** @brief Return a pointer to every range echo, in millimetres.
+
+        The echoes are stored one plane per echo: echo e of step s is at
+        range_echoes()[e * echoes_length() + s], for e < MAX_ECHOES. Echoes
+        that a step did not get are 0. */
+        const uint32_t* range_echoes() const { return range_echoes_; }
+        /// @brief Return a pointer to the number of range echoes of each step
+        /// (1 to MAX_ECHOES).
+        const uint8_t* range_echo_counts() const { return range_echo_counts_; }
+        /// @brief Return a pointer to every intensity echo, laid out as
+        /// range_echoes(). 0 if the scan has no intensities.
+        const uint32_t* intensity_echoes() const { return intensity_echoes_; }
+        /// @brief Return a pointer to the number of intensity echoes of each
+        /// step.
+        const uint8_t* intensity_echo_counts() const
+            { return intensity_echo_counts_; }
+
+        /** @brief Store ranges and intensities in 16 bits.
+
+        Halves the memory used by scans, and by copies and recordings of them.
+        Scans read after this call are decoded straight into the compact
+        arrays. Error codes (below 20) are always kept exactly. Ranges from
+        20mm up are stored in steps of @p range_scale millimetres, so with the
+        default scale of 1, any range up to 65535mm survives the round trip
+        exactly. Ranges past the largest that can be stored
+        (20 + 65515 * range_scale) and intensities above 65535 are clamped.
+
+        Compact mode cannot be used with provided buffers. Changing the mode
+        discards the current data.
+
+        @param compact Turn compact mode on or off.
+        @param range_scale Millimetres per stored step: a power of two. Use 2
+        for sensors that reach past 65m, such as the UXM-30LX-E. */
+        void set_compact(bool compact, unsigned int range_scale = 1);
+        /// @brief Check if the data is stored in compact mode.
+        bool compact() const { return compact_; }
+        /// @brief Get the millimetres per stored step of compact ranges.
+        unsigned int range_scale() const { return 1U << range_shift_; }
+        /** @brief Return a pointer to the compact range readings.
+
+        0 if not in compact mode. Values below 20 are error codes; other
+        values v are 20 + (v - 20) * range_scale() millimetres. */
+        const uint16_t* compact_ranges() const { return compact_ranges_; }
+        /// @brief Return a pointer to the compact intensity readings.
+        const uint16_t* compact_intensities() const
+            { return compact_intensities_; }
+
         /// @brief Assignment operator.
         ///
         /// If the rhs has provided buffers, the lhs will not receive the same
@@ -124,6 +199,12 @@ class HOKUYO_AIST_EXPORT ScanData
         /// to ensure they will be big enough to receive the data from the rhs,
         /// except in the case of 0 buffers (no data will be copied for 0
         /// buffers).
+        ///
+        /// Compact mode is never dropped by an assignment. A compact lhs
+        /// takes a compact rhs's data as is, range scale included, and narrows
+        /// the data of a normal rhs with its own range scale. A normal lhs
+        /// turns compact to take a compact rhs's data, unless it has provided
+        /// buffers, which get the data widened.
         ScanData& operator=(ScanData const& rhs);
         /** @brief Subscript operator.
 
@@ -146,11 +227,62 @@ class HOKUYO_AIST_EXPORT ScanData
         unsigned long long system_time_;
         LaserModel model_;
         bool buffers_provided_;
+        // Multi-echo data. Always allocated here, even when the range and
+        // intensity buffers are provided.
+        uint32_t* range_echoes_;
+        uint8_t* range_echo_counts_;
+        uint32_t* intensity_echoes_;
+        uint8_t* intensity_echo_counts_;
+        unsigned int echoes_length_;
+        // Compact mode. ranges_length_ and intensities_length_ give the sizes
+        // of the compact arrays, and ranges_ and intensities_ stay 0.
+        bool compact_;
+        unsigned int range_shift_;
+        uint16_t* compact_ranges_;
+        uint16_t* compact_intensities_;
+        // Widened copies of the compact arrays, made on demand
+        mutable uint32_t* wide_ranges_;
+        mutable uint32_t* wide_intensities_;
+        mutable bool ranges_widened_, intensities_widened_;
+
+        /// Check if there are ranges to write to, in either mode.
+        bool has_ranges() const
+            { return ranges_ != 0 || compact_ranges_ != 0; }
+        uint16_t narrow_range(uint32_t value) const
+        {
+            if(value < 20)
+                return value;
+            uint32_t steps = ((value - 20) >> range_shift_) + 20;
+            return steps > 0xFFFF ? 0xFFFF : steps;
+        }
+        uint32_t widen_range(uint16_t value) const
+        {
+            if(value < 20)
+                return value;
+            return ((static_cast<uint32_t>(value) - 20) << range_shift_) + 20;
+        }
+        static uint16_t narrow_intensity(uint32_t value)
+            { return value > 0xFFFF ? 0xFFFF : value; }
+        uint32_t const* widen_ranges() const;
+        uint32_t const* widen_intensities() const;
+        void allocate_compact(unsigned int length, bool include_intensities);
+        void release_compact();
+        void copy_compact(ScanData const& rhs);
 
         void allocate_data(unsigned int length,
                 bool include_intensities = false);
+        void allocate_echoes(unsigned int length,
+                bool include_intensities = false);
+        void release_echoes();
+        void copy_echoes(ScanData const& rhs);
         void write_range(unsigned int index, uint32_t value);
         void write_intensity(unsigned int index, uint32_t value);
+        // Compact mode: buffers to decode a whole scan into before it is
+        // narrowed into the compact arrays
+        uint32_t* wide_ranges_buffer();
+        uint32_t* wide_intensities_buffer();
+        void narrow_ranges();
+        void narrow_intensities();
 }; // class ScanData
 
 } // namespace hokuyo_aist
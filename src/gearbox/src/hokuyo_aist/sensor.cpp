@@ -27,6 +27,7 @@ using namespace hokuyo_aist;
 #include <flexiport/port.h>
 #include <flexiport/serialport.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <cstdarg>
@@ -40,6 +41,11 @@ using namespace hokuyo_aist;
 #include <iomanip>
 #include <ctime>
 #include <fstream>
+#include <vector>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
 
 #if defined(WIN32)
     #define __func__    __FUNCTION__
@@ -268,6 +274,82 @@ void number_to_string(unsigned int num, char* dest, int length)
 }
 
 
+///////////////////////////////////////////////////////////////////////////////
+// Sensor information cache
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+/// How long to wait for an answer when probing for the baud rate, in
+/// milliseconds.
+int const PROBE_TIMEOUT = 100;
+
+/// A cached sensor: the port options it was opened with and its information.
+typedef std::pair<std::string, SensorInfo> CacheEntry;
+
+/* The cache file holds one sensor per line, the most recently opened first:
+
+   port options<TAB>serial<TAB>firmware<TAB>model<TAB>min range max range
+   steps first step last step front step standard speed speed baud
+
+   Lines that can't be read are ignored. */
+void read_info_cache(std::string const& path, std::vector<CacheEntry>& entries)
+{
+    std::ifstream file(path.c_str());
+    std::string line;
+    while(std::getline(file, line))
+    {
+        std::istringstream fields(line);
+        CacheEntry entry;
+        SensorInfo& info(entry.second);
+        if(!std::getline(fields, entry.first, '\t') ||
+            !std::getline(fields, info.serial, '\t') ||
+            !std::getline(fields, info.firmware, '\t') ||
+            !std::getline(fields, info.model, '\t'))
+        {
+            continue;
+        }
+        if(!(fields >> info.min_range >> info.max_range >> info.steps >>
+                    info.first_step >> info.last_step >> info.front_step >>
+                    info.standard_speed >> info.speed >> info.baud))
+        {
+            continue;
+        }
+        entries.push_back(entry);
+    }
+}
+
+
+bool write_info_cache(std::string const& path,
+        std::vector<CacheEntry> const& entries)
+{
+    // Write a new file and move it over the old one, so a driver killed part
+    // way through doesn't leave half a cache behind
+    std::string temp_path(path + ".tmp");
+    std::ofstream file(temp_path.c_str());
+    for(unsigned int ii = 0; ii < entries.size(); ii++)
+    {
+        SensorInfo const& info(entries[ii].second);
+        file << entries[ii].first << '\t' << info.serial << '\t' <<
+            info.firmware << '\t' << info.model << '\t' << info.min_range <<
+            ' ' << info.max_range << ' ' << info.steps << ' ' <<
+            info.first_step << ' ' << info.last_step << ' ' <<
+            info.front_step << ' ' << info.standard_speed << ' ' <<
+            info.speed << ' ' << info.baud << '\n';
+    }
+    file.close();
+    if(!file)
+        return false;
+#if defined(WIN32)
+    std::remove(path.c_str());
+#endif
+    return std::rename(temp_path.c_str(), path.c_str()) == 0;
+}
+
+} // namespace
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Sensor class
 ///////////////////////////////////////////////////////////////////////////////
@@ -278,10 +360,12 @@ void number_to_string(unsigned int num, char* dest, int length)
 Sensor::Sensor()
     : port_(0), err_output_(std::cerr), scip_version_(2), verbose_(false),
     enable_checksum_workaround_(false), ignore_unknowns_(false),
-    multiecho_mode_(ME_OFF), min_angle_(0.0), max_angle_(0.0),
-    resolution_(0.0), first_step_(0), last_step_(0), front_step_(0),
-    max_range_(0), time_resolution_(0), time_offset_(0), last_timestamp_(0),
-    wrap_count_(0), time_drift_rate_(0.0), time_skew_alpha_(0.0)
+    multiecho_mode_(ME_OFF), keep_echoes_(false), min_angle_(0.0),
+    max_angle_(0.0), resolution_(0.0), first_step_(0), last_step_(0),
+    front_step_(0), max_range_(0), time_resolution_(0), time_offset_(0),
+    last_timestamp_(0), wrap_count_(0), time_drift_rate_(0.0),
+    time_skew_alpha_(0.0), request_pending_(false), pending_start_step_(0),
+    pending_num_steps_(0), pending_intensities_(false)
 {
 }
 
@@ -289,10 +373,12 @@ Sensor::Sensor()
 Sensor::Sensor(std::ostream& err_output)
     : port_(0), err_output_(err_output), scip_version_(2), verbose_(false),
     enable_checksum_workaround_(false), ignore_unknowns_(false),
-    multiecho_mode_(ME_OFF), min_angle_(0.0), max_angle_(0.0),
-    resolution_(0.0), first_step_(0), last_step_(0), front_step_(0),
-    max_range_(0), time_resolution_(0), time_offset_(0), last_timestamp_(0),
-    wrap_count_(0), time_drift_rate_(0.0), time_skew_alpha_(0.0)
+    multiecho_mode_(ME_OFF), keep_echoes_(false), min_angle_(0.0),
+    max_angle_(0.0), resolution_(0.0), first_step_(0), last_step_(0),
+    front_step_(0), max_range_(0), time_resolution_(0), time_offset_(0),
+    last_timestamp_(0), wrap_count_(0), time_drift_rate_(0.0),
+    time_skew_alpha_(0.0), request_pending_(false), pending_start_step_(0),
+    pending_num_steps_(0), pending_intensities_(false)
 {
 }
 
@@ -322,12 +408,9 @@ void Sensor::open(std::string port_options)
         err_output_ << port_->GetStatus();
     }
     port_->Flush();
+    port_options_ = port_options;
 
-    // Figure out the SCIP version currently in use and switch to a higher one
-    // if possible
-    get_and_set_scip_version();
-    // Get some values we need for providing default ranges
-    get_defaults();
+    initialise();
 }
 
 
@@ -349,76 +432,58 @@ unsigned int Sensor::open_with_probing(std::string port_options)
         err_output_ << port_->GetStatus();
     }
     port_->Flush();
+    port_options_ = port_options;
 
-    try
-    {
-        // Figure out the SCIP version currently in use and switch to a higher
-        // one if possible
-        get_and_set_scip_version();
-        // Get some values we need for providing default ranges
-        get_defaults();
-    }
-    catch(BaseError)
+    if(port_->GetPortType() != "serial")
     {
         if(verbose_)
         {
             err_output_ << "Sensor::" << __func__ <<
-                "() Failed to connect at the default baud rate.\n";
+                "() Port is not serial, cannot probe.\n";
         }
-        if(port_->GetPortType() == "serial")
+        initialise();
+        return 0;
+    }
+
+    flexiport::SerialPort* serial(
+            reinterpret_cast<flexiport::SerialPort*>(port_));
+    unsigned int const requested(serial->GetBaudRate());
+    // Try the baud rate the sensor was last used at, then the one asked for,
+    // then the others from fastest to slowest. Note that a baud rate of
+    // 750000 or 250000 doesn't appear to be supported on any common OS.
+    unsigned int const bauds[] = {cached_baud(), requested,
+        500000, 115200, 57600, 38400, 19200};
+    unsigned int const numBauds(7);
+    bool found(false);
+    for(unsigned int ii = 0; ii < numBauds && !found; ii++)
+    {
+        if(bauds[ii] == 0 ||
+                std::find(bauds, bauds + ii, bauds[ii]) != bauds + ii)
         {
-            // Failed at the default baud rate, so try again at the other
-            // rates. Note that a baud rate of 750000 or 250000 doesn't appear
-            // to be supported on any common OS.
-            unsigned int const bauds[] = {500000, 115200, 57600, 38400, 19200};
-            unsigned int const numBauds(5);
-            for (unsigned int ii = 0; ii < numBauds; ii++)
-            {
-                reinterpret_cast<flexiport::SerialPort*>(port_)->SetBaudRate(bauds[ii]);
-                try
-                {
-                    get_and_set_scip_version();
-                    get_defaults();
-                    // If the above two functions succeed, break out of the
-                    // loop and be happy
-                    if(verbose_)
-                    {
-                        err_output_ << "Sensor::" << __func__ <<
-                            "() Connected at " << bauds[ii] << '\n';
-                    }
-                    return bauds[ii];
-                }
-                catch(BaseError)
-                {
-                    if(ii == numBauds - 1)
-                    {
-                        // Last baud rate, give up and rethrow
-                        if(verbose_)
-                        {
-                            err_output_ << "Sensor::" << __func__ <<
-                                "() Failed to connect at any baud rate.\n";
-                        }
-                        throw;
-                    }
-                    // Otherwise go around again
-                }
-            }
+            // Unknown or already tried
+            continue;
         }
-        else
+        found = probe_baud(bauds[ii]);
+    }
+    if(!found)
+    {
+        // Nothing answered quickly; go back to the baud rate asked for and
+        // let the normal start-up report what went wrong
+        if(verbose_)
         {
-            if(verbose_)
-            {
-                err_output_ << "Sensor::" << __func__ <<
-                    "() Port is not serial, cannot probe.\n";
-            }
-            throw;
+            err_output_ << "Sensor::" << __func__ <<
+                "() Failed to connect at any baud rate.\n";
         }
+        serial->SetBaudRate(requested);
     }
 
-    if(port_->GetPortType() == "serial")
-        return reinterpret_cast<flexiport::SerialPort*>(port_)->GetBaudRate();
-    else
-        return 0;
+    initialise();
+    if(verbose_)
+    {
+        err_output_ << "Sensor::" << __func__ <<
+            "() Connected at " << serial->GetBaudRate() << '\n';
+    }
+    return serial->GetBaudRate();
 }
 
 
@@ -519,6 +584,9 @@ void Sensor::set_baud(unsigned int baud)
     }
     else
         throw UnknownScipVersionError();
+
+    if(!info_cache_.empty())
+        cache_baud(baud);
 }
 
 
@@ -1116,43 +1184,68 @@ unsigned int Sensor::get_ranges_intensities_by_angle(ScanData& data,
 
 unsigned int Sensor::get_new_ranges(ScanData& data, int start_step,
         int end_step, unsigned int cluster_count)
+{
+    request_new_ranges(start_step, end_step, cluster_count);
+    return read_new_ranges(data);
+}
+
+
+void Sensor::request_new_ranges(int start_step, int end_step,
+        unsigned int cluster_count, bool intensities)
 {
     if(scip_version_ == 1)
-        throw UnsupportedError(16);
+        throw UnsupportedError(intensities ? 17 : 16);
     else if(scip_version_ != 2)
         throw UnknownScipVersionError();
-
-    char buffer[14];
-    memset(buffer, 0, sizeof(char) * 14);
+    if(request_pending_)
+        throw LogicError(42);
 
     if(start_step < 0)
         start_step = first_step_;
     if(end_step < 0)
         end_step = last_step_;
 
-    unsigned int num_steps = (end_step - start_step + 1) / cluster_count;
+    pending_num_steps_ = (end_step - start_step + 1) / cluster_count;
     if(verbose_)
     {
-        err_output_ << "Sensor::" << __func__ << "() Reading " <<
-            num_steps << " new ranges between " << start_step << " and " <<
-            end_step << " with a cluster count of " << cluster_count <<
-            '\n';
+        err_output_ << "Sensor::" << __func__ << "() Requesting " <<
+            pending_num_steps_ << " new ranges" <<
+            (intensities ? " and intensities" : "") << " between " <<
+            start_step << " and " << end_step <<
+            " with a cluster count of " << cluster_count << '\n';
     }
 
-    // Send the command to ask for the most recent range data from start_step to end_step
-    number_to_string(start_step, buffer, 4);
-    number_to_string(end_step, &buffer[4], 4);
-    number_to_string(cluster_count, &buffer[8], 2);
-    number_to_string(1, &buffer[10], 1);
-    number_to_string(1, &buffer[11], 2);
-    char command[3];
+    // Send the command to ask for the most recent range data (with
+    // intensity data if asked for) from start_step to end_step
+    memset(pending_params_, 0, sizeof(pending_params_));
+    number_to_string(start_step, pending_params_, 4);
+    number_to_string(end_step, &pending_params_[4], 4);
+    number_to_string(cluster_count, &pending_params_[8], 2);
+    number_to_string(1, &pending_params_[10], 1);
+    number_to_string(1, &pending_params_[11], 2);
     if(model_ == MODEL_UXM30LXE && multiecho_mode_ != ME_OFF)
-        command[0] = 'N';
+        pending_command_[0] = 'N';
     else
-        command[0] = 'M';
-    command[1] = 'D';
-    command[2] = '\0';
-    send_command(command, buffer, 13, 0);
+        pending_command_[0] = 'M';
+    pending_command_[1] = intensities ? 'E' : 'D';
+    pending_command_[2] = '\0';
+    pending_start_step_ = start_step;
+    pending_intensities_ = intensities;
+    send_command(pending_command_, pending_params_, 13, 0);
+    request_pending_ = true;
+}
+
+
+unsigned int Sensor::read_new_ranges(ScanData& data)
+{
+    if(!request_pending_)
+        throw LogicError(41);
+    // Whatever happens below, this request has been dealt with
+    request_pending_ = false;
+
+    char const* command = pending_command_;
+    char buffer[14];
+    memcpy(buffer, pending_params_, sizeof(buffer));
     // Mx commands will perform a scan, then send the data prefixed with
     // another command echo.
     // Read back the command echo (minimum of 3 bytes, maximum of 16 bytes)
@@ -1190,16 +1283,27 @@ unsigned int Sensor::get_new_ranges(ScanData& data, int start_step,
     if(read_line_with_check(buffer) == 0)
         throw NoDataError();
     data.laser_time_ = decode_4_byte_value(buffer) +
-        step_to_time_offset(start_step);
+        step_to_time_offset(pending_start_step_);
     data.system_time_ = offset_timestamp(wrap_timestamp(data.laser_time_));
     // In SCIP2 mode we're going to get back 3-byte data because we're
-    // sending the MD command
-    read_3_byte_range_data(data, num_steps);
+    // sending the MD or ME command
+    if(pending_intensities_)
+        read_3_byte_range_and_intensity_data(data, pending_num_steps_);
+    else
+        read_3_byte_range_data(data, pending_num_steps_);
 
     return data.ranges_length_;
 }
 
 
+bool Sensor::data_waiting()
+{
+    if(port_ == 0)
+        return false;
+    return port_->BytesAvailable() > 0;
+}
+
+
 unsigned int Sensor::get_new_ranges_by_angle(ScanData& data,
         double start_angle, double end_angle, unsigned int cluster_count)
 {
@@ -1232,87 +1336,8 @@ unsigned int Sensor::get_new_ranges_by_angle(ScanData& data,
 unsigned int Sensor::get_new_ranges_intensities(ScanData& data,
         int start_step, int end_step, unsigned int cluster_count)
 {
-    if(scip_version_ == 1)
-        throw UnsupportedError(17);
-    else if(scip_version_ != 2)
-        throw UnknownScipVersionError();
-
-    char buffer[14];
-    memset(buffer, 0, sizeof(char) * 14);
-
-    if(start_step < 0)
-        start_step = first_step_;
-    if(end_step < 0)
-        end_step = last_step_;
-
-    unsigned int num_steps = (end_step - start_step + 1) / cluster_count;
-    if(verbose_)
-    {
-        err_output_ << "Sensor::" << __func__ << "() Reading " <<
-            num_steps << " new ranges and intensities between " <<
-            start_step << " and " << end_step <<
-            " with a cluster count of " << cluster_count << '\n';
-    }
-
-    // Send the command to ask for the most recent range data with
-    // intensity data from start_step to end_step
-    number_to_string(start_step, buffer, 4);
-    number_to_string(end_step, &buffer[4], 4);
-    number_to_string(cluster_count, &buffer[8], 2);
-    number_to_string(1, &buffer[10], 1);
-    number_to_string(1, &buffer[11], 2);
-    char command[3];
-    if(model_ == MODEL_UXM30LXE && multiecho_mode_ != ME_OFF)
-        command[0] = 'N';
-    else
-        command[0] = 'M';
-    command[1] = 'E';
-    command[2] = '\0';
-    send_command(command, buffer, 13, 0);
-    // Mx commands will perform a scan, then send the data prefixed with
-    // another command echo.
-    // Read back the command echo (minimum of 3 bytes, maximum of 16 bytes)
-    char response[17];
-    skip_lines(1); // End of the command echo message
-    read_line(response, 16); // Size is command(2)+params(13)+new line(1)
-    // Check the echo is correct
-    if(response[0] != command[0] || response[1] != command[1])
-        throw CommandEchoError(command, response);
-    // Then compare the parameters
-    buffer[12] = '0'; // There will be zero scans remaining after this one
-    if(memcmp(&response[2], buffer, 13) != 0)
-        throw ParamEchoError(command);
-    // The next line should be the status line
-    read_line_with_check(response, 4);
-    if(verbose_)
-    {
-        err_output_ << "Sensor::" << __func__ <<
-            "() " << command << " data prefix status: " << response[0] <<
-            response[1] << '\n';
-    }
-    // Check the status code is OK - should only get 99 here
-    if(response[0] != '9' || response[1] != '9')
-    {
-        // There is an extra line feed after an error status (signalling
-        // end of message)
-        skip_lines(1);
-        throw ResponseError(response, command);
-    }
-
-    // Now the actual data will arrive
-    // There will be a timestamp before the data (if there is data)
-    // Normally we would send 6 for the expected length, but we may get no
-    // timestamp back if there was no data.
-    if(read_line_with_check(buffer) == 0)
-        throw NoDataError();
-    data.laser_time_ = decode_4_byte_value(buffer) +
-        step_to_time_offset(start_step);
-    data.system_time_ = offset_timestamp(wrap_timestamp(data.laser_time_));
-    // In SCIP2 mode we're going to get back 3-byte data because we're
-    // sending the ME command
-    read_3_byte_range_and_intensity_data(data, num_steps);
-
-    return data.ranges_length_;
+    request_new_ranges(start_step, end_step, cluster_count, true);
+    return read_new_ranges(data);
 }
 
 
@@ -1923,7 +1948,9 @@ void Sensor::find_model(char const* buffer)
 }
 
 
-void Sensor::get_and_set_scip_version()
+// If version_info is given and the sensor uses SCIP version 2, the reply to
+// the VV command is read into it instead of being skipped.
+void Sensor::get_and_set_scip_version(SensorInfo* version_info)
 {
     bool scip2Failed = false;
 
@@ -2034,8 +2061,19 @@ void Sensor::get_and_set_scip_version()
         // Currently using SCIP version 2
         scip_version_ = 2;
 
-        // Dump the rest of the result
-        skip_lines(6);
+        if(version_info != 0)
+        {
+            char buffer[SCIP2_LINE_LENGTH];
+            memset(buffer, 0, sizeof(char) * SCIP2_LINE_LENGTH);
+            while(read_line_with_check(buffer, -1, true) != 0)
+                process_vv_line(buffer, *version_info);
+            enable_checksum_workaround_ = false;
+        }
+        else
+        {
+            // Dump the rest of the result
+            skip_lines(6);
+        }
         if(verbose_)
             err_output_ << "Sensor::" << __func__ <<
                 "() Using SCIP version 2.\n";
@@ -2047,15 +2085,33 @@ void Sensor::get_and_set_scip_version()
 }
 
 
-void Sensor::get_defaults()
+void Sensor::initialise()
 {
-    if(verbose_)
-        err_output_ << "Sensor::" << __func__ <<
-            "() Getting default values.\n";
-
-    // Get the laser's info
     SensorInfo info;
-    get_sensor_info(info);
+    bool use_cache(!info_cache_.empty());
+
+    // Figure out the SCIP version currently in use and switch to a higher one
+    // if possible. With a cache, keep the version information to recognise
+    // the sensor by.
+    get_and_set_scip_version(use_cache ? &info : 0);
+    if(use_cache && scip_version_ == 2 && load_cached_info(info))
+    {
+        if(verbose_)
+        {
+            err_output_ << "Sensor::" << __func__ <<
+                "() Using cached sensor information.\n";
+        }
+    }
+    else
+    {
+        if(verbose_)
+            err_output_ << "Sensor::" << __func__ <<
+                "() Getting default values.\n";
+        // Get some values we need for providing default ranges
+        get_sensor_info(info);
+        if(use_cache && scip_version_ == 2)
+            store_cached_info(info);
+    }
 
     min_angle_ = info.min_angle;
     max_angle_ = info.max_angle;
@@ -2064,6 +2120,8 @@ void Sensor::get_defaults()
     last_step_ = info.last_step;
     front_step_ = info.front_step;
     max_range_ = info.max_range;
+    time_resolution_ = info.time_resolution;
+    serial_ = info.serial;
     if(verbose_)
     {
         err_output_ << "Sensor::" << __func__ <<
@@ -2074,6 +2132,148 @@ void Sensor::get_defaults()
 }
 
 
+/// Fills in what the PP and II commands give from the cache, if the sensor
+/// described by the VV reply in info is there.
+bool Sensor::load_cached_info(SensorInfo& info)
+{
+    std::vector<CacheEntry> entries;
+    read_info_cache(info_cache_, entries);
+    for(unsigned int ii = 0; ii < entries.size(); ii++)
+    {
+        SensorInfo const& cached(entries[ii].second);
+        if(entries[ii].first != port_options_ || cached.serial != info.serial)
+            continue;
+        // New firmware may report different values
+        if(cached.firmware != info.firmware)
+            return false;
+
+        info.model = cached.model;
+        info.min_range = cached.min_range;
+        info.max_range = cached.max_range;
+        info.steps = cached.steps;
+        info.first_step = cached.first_step;
+        info.last_step = cached.last_step;
+        info.front_step = cached.front_step;
+        info.standard_speed = cached.standard_speed;
+        info.speed = cached.speed;
+        info.baud = cached.baud;
+        info.calculate_values();
+        return true;
+    }
+    return false;
+}
+
+
+void Sensor::store_cached_info(SensorInfo const& info)
+{
+    std::vector<CacheEntry> entries;
+    read_info_cache(info_cache_, entries);
+
+    // This sensor goes first, replacing whatever was on this port before and
+    // wherever this sensor was before
+    std::vector<CacheEntry> updated;
+    updated.push_back(CacheEntry(port_options_, info));
+    if(port_->GetPortType() == "serial")
+    {
+        updated[0].second.baud =
+            reinterpret_cast<flexiport::SerialPort*>(port_)->GetBaudRate();
+    }
+    for(unsigned int ii = 0; ii < entries.size(); ii++)
+    {
+        if(entries[ii].first != port_options_ &&
+                entries[ii].second.serial != info.serial)
+        {
+            updated.push_back(entries[ii]);
+        }
+    }
+
+    if(!write_info_cache(info_cache_, updated) && verbose_)
+    {
+        err_output_ << "Sensor::" << __func__ <<
+            "() Failed to write sensor information cache " << info_cache_ <<
+            '\n';
+    }
+}
+
+
+/// The baud rate the sensor on this port was last used at, or 0 if unknown.
+unsigned int Sensor::cached_baud()
+{
+    if(info_cache_.empty())
+        return 0;
+    std::vector<CacheEntry> entries;
+    read_info_cache(info_cache_, entries);
+    for(unsigned int ii = 0; ii < entries.size(); ii++)
+    {
+        if(entries[ii].first == port_options_)
+            return entries[ii].second.baud;
+    }
+    return 0;
+}
+
+
+void Sensor::cache_baud(unsigned int baud)
+{
+    std::vector<CacheEntry> entries;
+    read_info_cache(info_cache_, entries);
+    for(unsigned int ii = 0; ii < entries.size(); ii++)
+    {
+        if(entries[ii].first == port_options_ &&
+                entries[ii].second.serial == serial_)
+        {
+            entries[ii].second.baud = baud;
+            if(!write_info_cache(info_cache_, entries) && verbose_)
+            {
+                err_output_ << "Sensor::" << __func__ <<
+                    "() Failed to write sensor information cache " <<
+                    info_cache_ << '\n';
+            }
+            return;
+        }
+    }
+}
+
+
+/// Checks for a sensor answering at a baud rate without waiting the port's
+/// full timeout. SCIP version 2 sensors answer VV, version 1 sensors V.
+bool Sensor::probe_baud(unsigned int baud)
+{
+    if(verbose_)
+    {
+        err_output_ << "Sensor::" << __func__ << "() Probing at " << baud <<
+            '\n';
+    }
+    reinterpret_cast<flexiport::SerialPort*>(port_)->SetBaudRate(baud);
+    flexiport::Timeout timeout(port_->GetTimeout());
+    port_->SetTimeout(flexiport::Timeout(0, PROBE_TIMEOUT * 1000));
+    uint8_t version(scip_version_);
+
+    bool found(false);
+    char const* const probes[] = {"VV", "V"};
+    for(unsigned int ii = 0; ii < 2 && !found; ii++)
+    {
+        scip_version_ = 2 - ii;
+        try
+        {
+            send_command(probes[ii], 0, 0, 0);
+            found = true;
+            // Let the rest of the reply arrive so it can't confuse the next
+            // command
+            char buffer[SCIP2_LINE_LENGTH];
+            while(read_line(buffer) != 0);
+        }
+        catch(BaseError)
+        {
+        }
+    }
+
+    scip_version_ = version;
+    port_->SetTimeout(timeout);
+    port_->Flush();
+    return found;
+}
+
+
 void Sensor::process_vv_line(char const* buffer, SensorInfo& info)
 {
     if(strncmp(buffer, "VEND", 4) == 0)
@@ -2188,35 +2388,232 @@ void Sensor::process_ii_line(char const* buffer, SensorInfo& info)
 }
 
 
-/// Combines up to three values from an echo buffer into a single value based
-/// on the setting of multiecho_mode_.
-uint32_t Sensor::process_echo_buffer(int const* buffer, int num_echos)
+///////////////////////////////////////////////////////////////////////////////
+// Multi-echo data
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+/// Collects the echoes of each step as they are decoded. Given echo planes
+/// (see ScanData::range_echoes()), every echo is stored there. Without, only
+/// the first echo of each step is kept, for the caller to write.
+class EchoCollector
+{
+    public:
+        EchoCollector(uint32_t* planes, uint8_t* counts, unsigned int length)
+            : planes_(planes), counts_(counts), length_(length), echo_(0),
+            have_value_(false), first_(0)
+        {}
+
+        /// An '&' was read: the next value is another echo of the same step.
+        void next_echo() { echo_++; }
+
+        void set(unsigned int step, uint32_t value)
+        {
+            if(echo_ == 0)
+                first_ = value;
+            if(planes_ != 0)
+            {
+                if(step >= length_)
+                    throw IndexError();
+                // Drop any echoes beyond what the planes can hold
+                if(echo_ < ScanData::MAX_ECHOES)
+                    planes_[echo_ * length_ + step] = value;
+            }
+            have_value_ = true;
+        }
+
+        bool have_value() const { return have_value_; }
+        uint32_t first() const { return first_; }
+
+        /// Finishes a step: stores its echo count and clears the echoes it
+        /// didn't get.
+        void end_step(unsigned int step)
+        {
+            if(planes_ != 0)
+            {
+                unsigned int count = echo_ < ScanData::MAX_ECHOES ?
+                    echo_ + 1 : ScanData::MAX_ECHOES;
+                counts_[step] = count;
+                for (unsigned int ii = count; ii < ScanData::MAX_ECHOES; ii++)
+                    planes_[ii * length_ + step] = 0;
+            }
+            echo_ = 0;
+            have_value_ = false;
+        }
+
+    private:
+        uint32_t* planes_;
+        uint8_t* counts_;
+        unsigned int length_;
+        unsigned int echo_;
+        bool have_value_;
+        uint32_t first_;
+};
+
+
+/// Combines the echoes of one step. Unused echoes are 0, so the sum of all
+/// three is the sum of the step's echoes. Mode is a constant, so all but one
+/// branch of each call folds away.
+template<MultiechoMode Mode>
+inline uint32_t reduce_step(uint32_t e0, uint32_t e1, uint32_t e2,
+        uint32_t count)
 {
-    uint32_t sum = 0;
-    switch(multiecho_mode_)
+    if(Mode == ME_MIDDLE)
+        return count == 3 ? e1 : e0;
+    else if(Mode == ME_REAR)
+        return count == 3 ? e2 : (count == 2 ? e1 : e0);
+    else if(Mode == ME_AVERAGE)
+    {
+        // x / 3 == (x * 0xAAAAAAAB) >> 33 for any 32-bit x
+        uint32_t sum = e0 + e1 + e2;
+        uint32_t third =
+            static_cast<uint32_t>((sum * 0xAAAAAAABULL) >> 33);
+        return count == 3 ? third : (count == 2 ? sum >> 1 : sum);
+    }
+    return e0;
+}
+
+
+#if defined(__SSE2__)
+inline __m128i select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+
+/// reduce_step() for four steps.
+template<MultiechoMode Mode>
+inline __m128i reduce_block(__m128i e0, __m128i e1, __m128i e2,
+        __m128i is2, __m128i is3)
+{
+    if(Mode == ME_MIDDLE)
+        return select(is3, e1, e0);
+    else if(Mode == ME_REAR)
+        return select(is3, e2, select(is2, e1, e0));
+    else if(Mode == ME_AVERAGE)
+    {
+        __m128i sum = _mm_add_epi32(_mm_add_epi32(e0, e1), e2);
+        __m128i magic = _mm_set1_epi32(static_cast<int>(0xAAAAAAABU));
+        // _mm_mul_epu32 multiplies lanes 0 and 2, so do 1 and 3 separately
+        __m128i even = _mm_srli_epi64(_mm_mul_epu32(sum, magic), 33);
+        __m128i odd = _mm_srli_epi64(
+                _mm_mul_epu32(_mm_srli_epi64(sum, 32), magic), 33);
+        __m128i third = _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+        return select(is3, third, select(is2, _mm_srli_epi32(sum, 1), sum));
+    }
+    return e0;
+}
+#endif // defined(__SSE2__)
+
+
+/// Combines a set of echo planes, length steps each, into out without
+/// branching on the data. Returns true if any of the
+/// combined values is an error code.
+template<MultiechoMode Mode>
+bool reduce_planes(uint32_t const* planes, uint8_t const* counts,
+        unsigned int length, uint32_t* out)
+{
+    uint32_t const* e0 = planes;
+    uint32_t const* e1 = planes + length;
+    uint32_t const* e2 = planes + 2 * length;
+    unsigned int ii = 0;
+    bool error = false;
+
+#if defined(__SSE2__)
+    __m128i const zero = _mm_setzero_si128();
+    __m128i const two = _mm_set1_epi32(2);
+    __m128i const three = _mm_set1_epi32(3);
+    __m128i const min_range = _mm_set1_epi32(20);
+    __m128i errors = zero;
+    for (; ii + 4 <= length; ii += 4)
+    {
+        int packed_counts;
+        memcpy(&packed_counts, &counts[ii], sizeof(packed_counts));
+        __m128i count = _mm_unpacklo_epi16(_mm_unpacklo_epi8(
+                    _mm_cvtsi32_si128(packed_counts), zero), zero);
+        __m128i value = reduce_block<Mode>(
+                _mm_loadu_si128(reinterpret_cast<__m128i const*>(&e0[ii])),
+                _mm_loadu_si128(reinterpret_cast<__m128i const*>(&e1[ii])),
+                _mm_loadu_si128(reinterpret_cast<__m128i const*>(&e2[ii])),
+                _mm_cmpeq_epi32(count, two), _mm_cmpeq_epi32(count, three));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&out[ii]), value);
+        // Values are at most 24 bits, so a signed compare is fine
+        errors = _mm_or_si128(errors, _mm_cmplt_epi32(value, min_range));
+    }
+    error = _mm_movemask_epi8(errors) != 0;
+#endif // defined(__SSE2__)
+
+    for (; ii < length; ii++)
+    {
+        out[ii] = reduce_step<Mode>(e0[ii], e1[ii], e2[ii], counts[ii]);
+        error |= out[ii] < 20;
+    }
+    return error;
+}
+
+
+bool reduce_planes(MultiechoMode mode, uint32_t const* planes,
+        uint8_t const* counts, unsigned int length, uint32_t* out)
+{
+    switch(mode)
     {
-        case ME_FRONT:
-            return buffer[0];
-            break;
         case ME_MIDDLE:
-            if(num_echos == 3)
-                return buffer[1];
-            else
-                return buffer[0];
-            break;
+            return reduce_planes<ME_MIDDLE>(planes, counts, length, out);
         case ME_REAR:
-            return buffer[num_echos -1 ];
-            break;
+            return reduce_planes<ME_REAR>(planes, counts, length, out);
         case ME_AVERAGE:
-            for (int ii = 0; ii < num_echos; ii++)
-                sum += buffer[ii];
-            sum /= static_cast<float>(num_echos);
-            return sum;
-            break;
+            return reduce_planes<ME_AVERAGE>(planes, counts, length, out);
+        case ME_FRONT:
         case ME_OFF:
         default:
-            return buffer[0];
-            break;
+            return reduce_planes<ME_FRONT>(planes, counts, length, out);
+    }
+}
+
+} // namespace
+
+
+/// Combines the echoes of a multi-echo scan into the ranges and intensities
+/// of data, one value per step, based on the setting of multiecho_mode_.
+void Sensor::reduce_echoes(ScanData& data, ScanData const& echoes)
+{
+    unsigned int length = echoes.echoes_length();
+    if(data.has_ranges() && echoes.range_echoes() != 0)
+    {
+        if(length > data.ranges_length_)
+            throw IndexError();
+        // Compact data is combined at full width, then narrowed
+        uint32_t* ranges = data.compact_ ? data.wide_ranges_buffer() :
+            data.ranges_;
+        if(reduce_planes(multiecho_mode_, echoes.range_echoes(),
+                    echoes.range_echo_counts(), length, ranges))
+            data.error_ = true;
+        for (unsigned int ii = 0; ii < length; ii++)
+        {
+            if(ranges[ii] > max_range_)
+            {
+                err_output_ << "WARNING: Sensor::" << __func__ <<
+                    "() Value at step " << ii <<
+                    " beyond maximum range: " << ranges[ii] << '\n';
+            }
+        }
+        if(data.compact_)
+            data.narrow_ranges();
+    }
+    if((data.intensities_ != 0 || data.compact_intensities_ != 0) &&
+            echoes.intensity_echoes() != 0)
+    {
+        if(length > data.intensities_length_)
+            throw IndexError();
+        uint32_t* intensities = data.compact_ ?
+            data.wide_intensities_buffer() : data.intensities_;
+        if(reduce_planes(multiecho_mode_, echoes.intensity_echoes(),
+                    echoes.intensity_echo_counts(), length, intensities))
+            data.error_ = true;
+        if(data.compact_)
+            data.narrow_intensities();
     }
 }
 
@@ -2290,14 +2687,24 @@ void Sensor::read_3_byte_range_data(ScanData& data, unsigned int num_steps)
     data.model_ = model_;
     data.error_ = false;
 
+    // In multi-echo mode, every echo is decoded into the echo planes and they
+    // are combined once the whole scan is in. Otherwise only the first echo
+    // of each step is used, and it is written straight to the data.
+    bool multiecho(multiecho_mode_ != ME_OFF);
+    ScanData& echoes(keep_echoes_ ? data : echo_scratch_);
+    if(!multiecho || !keep_echoes_)
+        data.release_echoes();
+    if(multiecho)
+        echoes.allocate_echoes(num_steps);
+    EchoCollector range_echoes(multiecho ? echoes.range_echoes_ : 0,
+            multiecho ? echoes.range_echo_counts_ : 0, num_steps);
+
     // 3 byte data is a pain because it crosses the line boundary, it may
     // overlap by 0, 1 or 2 bytes
     char buffer[SCIP2_LINE_LENGTH];
     unsigned int current_step(0);
     int numBytesInLine(0), split_count(0);
     char split_value[3];
-    int echo_buffer[3] = {-1, -1, -1};
-    int echo_buf_ind(0);
     bool done(false);
     while(!done)
     {
@@ -2324,28 +2731,29 @@ void Sensor::read_3_byte_range_data(ScanData& data, unsigned int num_steps)
                 if(buffer[ii] == '&')
                 {
                     // Next echo
-                    echo_buf_ind++;
+                    range_echoes.next_echo();
                     ii++;
                 }
-                else if(echo_buffer[0] != -1)
+                else if(range_echoes.have_value())
                 {
                     // Not the first value, so deal with the previous
-                    data.write_range(current_step,
-                            process_echo_buffer(echo_buffer,
-                                echo_buf_ind + 1));
-                    if(data.ranges_)
+                    if(!multiecho)
                     {
-                        if(data.ranges_[current_step] > max_range_)
+                        data.write_range(current_step, range_echoes.first());
+                        if(data.has_ranges())
                         {
-                            err_output_ << "WARNING: Sensor::" << __func__ <<
-                                "() Value at step " << current_step <<
-                                " beyond maximum range: " <<
-                                data.ranges_[current_step] << '\n';
+                            if(range_echoes.first() > max_range_)
+                            {
+                                err_output_ << "WARNING: Sensor::" <<
+                                    __func__ << "() Value at step " <<
+                                    current_step <<
+                                    " beyond maximum range: " <<
+                                    range_echoes.first() << '\n';
+                            }
                         }
                     }
+                    range_echoes.end_step(current_step);
                     current_step++;
-                    echo_buf_ind = 0;
-                    echo_buffer[0] = -1;
                 }
             }
             if(ii == numBytesInLine - 2)       // Short 1 byte
@@ -2368,20 +2776,20 @@ void Sensor::read_3_byte_range_data(ScanData& data, unsigned int num_steps)
                 if(split_count == 1)
                 {
                     split_value[2] = buffer[ii++];
-                    echo_buffer[echo_buf_ind] =
-                        decode_3_byte_value(split_value);
+                    range_echoes.set(current_step,
+                            decode_3_byte_value(split_value));
                 }
                 else if(split_count == 2)
                 {
                     split_value[1] = buffer[ii++];
                     split_value[2] = buffer[ii++];
-                    echo_buffer[echo_buf_ind] =
-                        decode_3_byte_value(split_value);
+                    range_echoes.set(current_step,
+                            decode_3_byte_value(split_value));
                 }
                 else
                 {
-                    echo_buffer[echo_buf_ind] =
-                        decode_3_byte_value(&buffer[ii]);
+                    range_echoes.set(current_step,
+                            decode_3_byte_value(&buffer[ii]));
                     ii += 3;
                 }
                 split_count = 0;     // Reset this here now that it's been used
@@ -2390,21 +2798,24 @@ void Sensor::read_3_byte_range_data(ScanData& data, unsigned int num_steps)
         // End of this line. Go around again.
     }
     // Last little bit of data
-    if(echo_buffer[0] != -1)
+    if(range_echoes.have_value())
     {
         // Not the first value, so deal with the previous
-        data.write_range(current_step,
-                process_echo_buffer(echo_buffer, echo_buf_ind + 1));
-        if(data.ranges_)
+        if(!multiecho)
         {
-            if(data.ranges_[current_step] > max_range_)
+            data.write_range(current_step, range_echoes.first());
+            if(data.has_ranges())
             {
-                err_output_ << "WARNING: Sensor::" << __func__ <<
-                    "() Value at step " << current_step <<
-                    " beyond maximum range: " <<
-                    data.ranges_[current_step] << '\n';
+                if(range_echoes.first() > max_range_)
+                {
+                    err_output_ << "WARNING: Sensor::" << __func__ <<
+                        "() Value at step " << current_step <<
+                        " beyond maximum range: " <<
+                        range_echoes.first() << '\n';
+                }
             }
         }
+        range_echoes.end_step(current_step);
         current_step++;
     }
 
@@ -2413,6 +2824,9 @@ void Sensor::read_3_byte_range_data(ScanData& data, unsigned int num_steps)
             current_step << " ranges.\n";
     if(current_step != num_steps)
         throw DataCountError();
+
+    if(multiecho)
+        reduce_echoes(data, echoes);
 }
 
 
@@ -2436,6 +2850,19 @@ void Sensor::read_3_byte_range_and_intensity_data(ScanData& data,
     data.allocate_data(num_steps, true);
     data.model_ = model_;
 
+    // As for read_3_byte_range_data(), with a set of echo planes each for
+    // the ranges and the intensities.
+    bool multiecho(multiecho_mode_ != ME_OFF);
+    ScanData& echoes(keep_echoes_ ? data : echo_scratch_);
+    if(!multiecho || !keep_echoes_)
+        data.release_echoes();
+    if(multiecho)
+        echoes.allocate_echoes(num_steps, true);
+    EchoCollector range_echoes(multiecho ? echoes.range_echoes_ : 0,
+            multiecho ? echoes.range_echo_counts_ : 0, num_steps);
+    EchoCollector intensity_echoes(multiecho ? echoes.intensity_echoes_ : 0,
+            multiecho ? echoes.intensity_echo_counts_ : 0, num_steps);
+
     // 3 byte data is a pain because it crosses the line boundary, it may
     // overlap by 0, 1 or 2 bytes
     char buffer[SCIP2_LINE_LENGTH];
@@ -2443,8 +2870,9 @@ void Sensor::read_3_byte_range_and_intensity_data(ScanData& data,
     int numBytesInLine(0), split_count(0);
     char split_value[3];
     bool nextIsIntensity(false);
-    int echo_buffer[3] = {-1, -1, -1};
-    int echo_buf_ind(0);
+    // The values being read, and the step they belong to
+    EchoCollector* current_echoes(&range_echoes);
+    unsigned int* current_step(&current_range);
     bool done(false);
     while(!done)
     {
@@ -2471,49 +2899,59 @@ void Sensor::read_3_byte_range_and_intensity_data(ScanData& data,
                 if(buffer[ii] == '&')
                 {
                     // Next echo
-                    echo_buf_ind++;
+                    current_echoes->next_echo();
                     ii++;
                 }
-                else if(echo_buffer[0] != -1)
+                else if(current_echoes->have_value())
                 {
                     // Not the first value, so deal with the previous
-                    if(nextIsIntensity)
-                    {
-                        data.write_intensity(current_intensity,
-                                process_echo_buffer(echo_buffer,
-                                    echo_buf_ind + 1));
-                    }
-                    else
+                    if(!multiecho)
                     {
-                        data.write_range(current_range,
-                                process_echo_buffer(echo_buffer,
-                                    echo_buf_ind + 1));
-                    }
-                    echo_buf_ind = 0;
-                    echo_buffer[0] = -1;
-                    if(data.ranges_)
-                    {
-                        if(data.ranges_[current_range] > max_range_ &&
-                                !nextIsIntensity)
+                        if(nextIsIntensity)
+                        {
+                            data.write_intensity(current_intensity,
+                                    intensity_echoes.first());
+                        }
+                        else
+                        {
+                            data.write_range(current_range,
+                                    range_echoes.first());
+                        }
+                        if(data.has_ranges())
                         {
-                            err_output_ << "WARNING: Sensor::" << __func__ <<
-                                "() Value at step " << current_range <<
-                                " beyond maximum range: " <<
-                                data.ranges_[current_range] << " (raw bytes: ";
-                            if(split_count != 0)
-                                err_output_ << split_value[0] << split_value[1] <<
-                                    split_value[2] << ")\n";
-                            else
-                                err_output_ << buffer[0] << buffer[1] << buffer[2] <<
-                                    ")\n";
+                            if(range_echoes.first() > max_range_ &&
+                                    !nextIsIntensity)
+                            {
+                                err_output_ << "WARNING: Sensor::" <<
+                                    __func__ << "() Value at step " <<
+                                    current_range <<
+                                    " beyond maximum range: " <<
+                                    range_echoes.first() <<
+                                    " (raw bytes: ";
+                                if(split_count != 0)
+                                    err_output_ << split_value[0] <<
+                                        split_value[1] << split_value[2] <<
+                                        ")\n";
+                                else
+                                    err_output_ << buffer[0] << buffer[1] <<
+                                        buffer[2] << ")\n";
+                            }
                         }
                     }
-                    if(nextIsIntensity)
-                        current_intensity++;
-                    else
-                        current_range++;
+                    current_echoes->end_step(*current_step);
+                    (*current_step)++;
                     // Alternate between range and intensity values
                     nextIsIntensity = !nextIsIntensity;
+                    if(nextIsIntensity)
+                    {
+                        current_echoes = &intensity_echoes;
+                        current_step = &current_intensity;
+                    }
+                    else
+                    {
+                        current_echoes = &range_echoes;
+                        current_step = &current_range;
+                    }
                 }
             }
             if(ii == numBytesInLine - 2)       // Short 1 byte
@@ -2536,20 +2974,20 @@ void Sensor::read_3_byte_range_and_intensity_data(ScanData& data,
                 if(split_count == 1)
                 {
                     split_value[2] = buffer[ii++];
-                    echo_buffer[echo_buf_ind] =
-                        decode_3_byte_value(split_value);
+                    current_echoes->set(*current_step,
+                            decode_3_byte_value(split_value));
                 }
                 else if(split_count == 2)
                 {
                     split_value[1] = buffer[ii++];
                     split_value[2] = buffer[ii++];
-                    echo_buffer[echo_buf_ind] =
-                        decode_3_byte_value(split_value);
+                    current_echoes->set(*current_step,
+                            decode_3_byte_value(split_value));
                 }
                 else
                 {
-                    echo_buffer[echo_buf_ind] =
-                        decode_3_byte_value(&buffer[ii]);
+                    current_echoes->set(*current_step,
+                            decode_3_byte_value(&buffer[ii]));
                     ii += 3;
                 }
                 // Reset this here now that it's been used
@@ -2561,11 +2999,12 @@ void Sensor::read_3_byte_range_and_intensity_data(ScanData& data,
     // The last piece should always be an intensity value (if it isn't
     // then the data count won't add up and an error will be thrown
     // below anyway).
-    if(echo_buffer[0] != -1)
+    if(current_echoes->have_value())
     {
         assert(nextIsIntensity == true);
-        data.write_intensity(current_intensity,
-            process_echo_buffer(echo_buffer, echo_buf_ind + 1));
+        if(!multiecho)
+            data.write_intensity(current_intensity, intensity_echoes.first());
+        intensity_echoes.end_step(current_intensity);
         current_intensity++;
     }
 
@@ -2577,6 +3016,9 @@ void Sensor::read_3_byte_range_and_intensity_data(ScanData& data,
     }
     if(current_range != num_steps || current_intensity != num_steps)
         throw DataCountError();
+
+    if(multiecho)
+        reduce_echoes(data, echoes);
 }
 
 
@@ -22,6 +22,8 @@
 
 #include <string>
 
+#include "scan_data.h"
+
 #if defined(WIN32)
     typedef unsigned char           uint8_t;
     typedef unsigned int            uint32_t;
@@ -61,6 +63,7 @@ namespace hokuyo_aist
 /// - ME_REAR: the furthest reading will be used.
 /// - ME_AVERAGE: the average of all two or three echos will be used.
 /// In all cases, if there is only one echo, then this setting has no effect.
+/// To get every echo as well, see Sensor::set_keep_echoes().
 enum MultiechoMode
 {
     ME_OFF,
@@ -131,10 +134,12 @@ class HOKUYO_AIST_EXPORT Sensor
         /** @brief Open the laser scanner and begin scanning, probing the baud
         rate.
 
-        If the port is a serial connection and communication with the laser
-        fails at the given baud rate, the alternative baud rates supported by
-        the device are tried (see @ref set_baud for these) in order from fastest
-        to slowest.
+        If the port is a serial connection, the baud rate is found with short
+        probes before the laser is started. The baud rate the laser was last
+        used at is tried first if it is in the cache (see
+        @ref set_info_cache), then the given baud rate, then the alternative
+        baud rates supported by the device (see @ref set_baud for these) in
+        order from fastest to slowest.
 
         @return The baud rate at which connection with the laser succeeded, or
         0 for non-serial connections. */
@@ -143,6 +148,19 @@ class HOKUYO_AIST_EXPORT Sensor
         /// @brief Close the connection to the laser scanner.
         void close();
 
+        /** @brief Keep sensor information in a file to speed up opening.
+
+        When set, @ref open and @ref open_with_probing look for the sensor in
+        this file, by the port options and the serial number the sensor gives
+        in reply to the VV command. If it is there with the same firmware
+        version, the PP and II commands are skipped. Otherwise they are sent
+        and the file is updated. The baud rate is recorded as well, for
+        @ref open_with_probing. Only sensors using SCIP version 2 are cached.
+
+        Default is an empty path, which disables the cache. Set before
+        opening. */
+        void set_info_cache(std::string const& path) { info_cache_ = path; }
+
         /// @brief Checks if the connection to the laser scanner is open.
         bool is_open() const;
 
@@ -466,6 +484,45 @@ class HOKUYO_AIST_EXPORT Sensor
                 double start_angle, double end_angle,
                 unsigned int cluster_count = 1);
 
+        /** @brief Ask for a new scan without waiting for it.
+
+        The first half of @ref get_new_ranges and @ref
+        get_new_ranges_intensities: sends the request, and returns straight
+        away. Read the scan with @ref read_new_ranges. In between, the sensor
+        scans while the caller does something else, such as asking other
+        sensors for their scans (see @ref SensorGroup).
+
+        Only one request can be outstanding at a time, and no other commands
+        may be sent until its scan has been read.
+
+        Not available with the SCIP v1 protocol.
+
+        @param start_step The first step to get ranges from. Set to -1 for the
+        first scannable step.
+        @param end_step The last step to get ranges from. Set to -1 for the last
+        scannable step.
+        @param cluster_count The number of readings to cluster together into a
+        single reading.
+        @param intensities Get intensity data as well. */
+        void request_new_ranges(int start_step = -1, int end_step = -1,
+                unsigned int cluster_count = 1, bool intensities = false);
+
+        /** @brief Read the scan asked for by @ref request_new_ranges.
+
+        Blocks until the scan has arrived. The request is finished with even
+        if this throws.
+
+        @param data Pointer to a @ref ScanData object to store the range
+        readings in.
+        @return The number of range readings read into @ref data. */
+        unsigned int read_new_ranges(ScanData& data);
+
+        /** @brief Check if the sensor has sent data that has not been read yet.
+
+        After @ref request_new_ranges, this means the scan has started
+        arriving, so @ref read_new_ranges will not wait long. */
+        bool data_waiting();
+
         /// @brief Return the major version of the SCIP protocol in use.
         uint8_t scip_version() const            { return scip_version_; }
 
@@ -480,6 +537,13 @@ class HOKUYO_AIST_EXPORT Sensor
         /** @brief Set the multi-echo mode to use. Default is ME_OFF. */
         void set_multiecho_mode(MultiechoMode mode) { multiecho_mode_ = mode; }
 
+        /** @brief Keep every echo of multi-echo scans in the ScanData.
+
+        When on, scans read in multi-echo mode also carry all their echoes
+        (see ScanData::range_echoes()), on top of the values combined
+        according to the multi-echo mode. Default is off. */
+        void set_keep_echoes(bool keep)          { keep_echoes_ = keep; }
+
         /// @brief A convenience function to convert a step index to an angle.
         double step_to_angle(unsigned int step);
         /** @brief A convenience function to convert an angle to a step
@@ -495,6 +559,9 @@ class HOKUYO_AIST_EXPORT Sensor
         bool verbose_, enable_checksum_workaround_,
              ignore_unknowns_;
         MultiechoMode multiecho_mode_;
+        bool keep_echoes_;
+        /// Where multi-echo scans are decoded to when the echoes aren't kept.
+        ScanData echo_scratch_;
         double min_angle_, max_angle_, resolution_;
         int first_step_, last_step_, front_step_;
         unsigned int max_range_;
@@ -512,6 +579,19 @@ class HOKUYO_AIST_EXPORT Sensor
         float time_drift_rate_;
         /// The clock skew alpha value.
         float time_skew_alpha_;
+        /// The scan asked for by request_new_ranges(), until it is read.
+        bool request_pending_;
+        char pending_command_[3];
+        char pending_params_[14];
+        int pending_start_step_;
+        unsigned int pending_num_steps_;
+        bool pending_intensities_;
+        /// Where sensor information is cached, or empty.
+        std::string info_cache_;
+        /// The options the port was opened with.
+        std::string port_options_;
+        /// The serial number of the sensor, when the cache is in use.
+        std::string serial_;
 
         void clear_read_buffer();
         int read_line(char* buffer, int expected_length=-1);
@@ -538,13 +618,18 @@ class HOKUYO_AIST_EXPORT Sensor
         unsigned int step_to_time_offset(int start_step);
 
         void find_model(char const* buffer);
-        void get_and_set_scip_version();
-        void get_defaults();
+        void get_and_set_scip_version(SensorInfo* version_info=0);
+        void initialise();
+        bool load_cached_info(SensorInfo& info);
+        void store_cached_info(SensorInfo const& info);
+        unsigned int cached_baud();
+        void cache_baud(unsigned int baud);
+        bool probe_baud(unsigned int baud);
         void process_vv_line(char const* buffer, SensorInfo& info);
         void process_pp_line(char const* buffer, SensorInfo& info);
         void process_ii_line(char const* buffer, SensorInfo& info);
 
-        uint32_t process_echo_buffer(int const* buffer, int num_echos);
+        void reduce_echoes(ScanData& data, ScanData const& echoes);
         void read_2_byte_range_data(ScanData& data, unsigned int num_steps);
         void read_3_byte_range_data(ScanData& data, unsigned int num_steps);
         void read_3_byte_range_and_intensity_data(ScanData& data,
@@ -0,0 +1,255 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * hokuyo_aist Hokuyo laser scanner driver.
+ *
+ * This distribution is licensed to you under the terms described in the
+ * LICENSE file included in this distribution.
+ *
+ * This file is part of hokuyo_aist.
+ *
+ * This software is licensed under the Eclipse Public License -v 1.0 (EPL). See
+ * http://www.opensource.org/licenses/eclipse-1.0.txt
+ */
+
+#include "sensor_group.h"
+
+#include "hokuyo_errors.h"
+#include "sensor.h"
+
+#include <algorithm>
+
+#if defined(WIN32)
+    #include <windows.h>
+#endif
+
+using namespace hokuyo_aist;
+
+namespace
+{
+
+/// Orders the ring's index updates against the accesses to the bundles.
+inline void memory_barrier()
+{
+#if defined(WIN32)
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+#endif
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// SensorGroup class
+///////////////////////////////////////////////////////////////////////////////
+
+SensorGroup::SensorGroup(GroupMode mode, unsigned long long window,
+        unsigned int capacity)
+    : mode_(mode), window_(window), mask_(0), write_(0), read_(0),
+    sequence_(0), overruns_(0), misaligned_(0), errors_(0)
+{
+    unsigned int size(1);
+    while(size < capacity)
+        size <<= 1;
+    slots_.resize(size);
+    mask_ = size - 1;
+}
+
+
+unsigned int SensorGroup::add_sensor(Sensor* sensor, int start_step,
+        int end_step, unsigned int cluster_count, bool intensities)
+{
+    Member member;
+    member.sensor = sensor;
+    member.start_step = start_step;
+    member.end_step = end_step;
+    member.cluster_count = cluster_count;
+    member.intensities = intensities;
+    members_.push_back(member);
+
+    for(unsigned int ii = 0; ii < slots_.size(); ii++)
+    {
+        slots_[ii].scans.resize(members_.size());
+        slots_[ii].present.resize(members_.size(), 0);
+    }
+    overflow_.scans.resize(members_.size());
+    overflow_.present.resize(members_.size(), 0);
+    waiting_.reserve(members_.size());
+    times_.reserve(members_.size());
+    return members_.size() - 1;
+}
+
+
+unsigned int SensorGroup::acquire()
+{
+    // Start every sensor scanning before reading any of them
+    waiting_.clear();
+    for(unsigned int ii = 0; ii < members_.size(); ii++)
+    {
+        Member const& member(members_[ii]);
+        try
+        {
+            member.sensor->request_new_ranges(member.start_step,
+                    member.end_step, member.cluster_count,
+                    member.intensities);
+            waiting_.push_back(ii);
+        }
+        catch(BaseError&)
+        {
+            errors_++;
+        }
+    }
+
+    unsigned int num_read(0);
+    ScanBundle* bundle(0);
+    if(mode_ == GM_BUNDLED)
+    {
+        bundle = &claim_slot();
+        std::fill(bundle->present.begin(), bundle->present.end(), 0);
+    }
+
+    while(!waiting_.empty())
+    {
+        // Read whichever sensor has started sending; if none has, wait on
+        // the one asked first
+        std::vector<unsigned int>::iterator next(waiting_.begin());
+        for(std::vector<unsigned int>::iterator ii = waiting_.begin();
+                ii != waiting_.end(); ++ii)
+        {
+            if(members_[*ii].sensor->data_waiting())
+            {
+                next = ii;
+                break;
+            }
+        }
+        unsigned int index(*next);
+        waiting_.erase(next);
+
+        if(mode_ == GM_INDIVIDUAL)
+        {
+            ScanBundle& single(claim_slot());
+            std::fill(single.present.begin(), single.present.end(), 0);
+            if(read_scan(index, single))
+            {
+                num_read++;
+                single.time = single.scans[index].system_time_stamp();
+                single.spread = 0;
+                publish(single);
+            }
+        }
+        else if(read_scan(index, *bundle))
+            num_read++;
+    }
+
+    if(mode_ == GM_BUNDLED && num_read > 0)
+    {
+        align(*bundle);
+        publish(*bundle);
+    }
+    return num_read;
+}
+
+
+ScanBundle const* SensorGroup::front()
+{
+    if(read_ == write_)
+        return 0;
+    // Don't look at the bundle before seeing that it was published
+    memory_barrier();
+    return &slots_[read_ & mask_];
+}
+
+
+void SensorGroup::pop()
+{
+    if(read_ == write_)
+        return;
+    // Finish with the bundle before handing the slot back
+    memory_barrier();
+    read_ = read_ + 1;
+}
+
+
+/// The next free slot in the ring, or the overflow bundle if there is none.
+ScanBundle& SensorGroup::claim_slot()
+{
+    if(write_ - read_ > mask_)
+        return overflow_;
+    memory_barrier();
+    return slots_[write_ & mask_];
+}
+
+
+void SensorGroup::publish(ScanBundle& bundle)
+{
+    bundle.sequence = sequence_++;
+    if(&bundle == &overflow_)
+    {
+        for(unsigned int ii = 0; ii < bundle.present.size(); ii++)
+            overruns_ += bundle.present[ii] != 0;
+        return;
+    }
+    // Finish writing the bundle before the consumer can see it
+    memory_barrier();
+    write_ = write_ + 1;
+}
+
+
+/// Reads the scan requested from a sensor into its place in a bundle.
+bool SensorGroup::read_scan(unsigned int index, ScanBundle& bundle)
+{
+    try
+    {
+        members_[index].sensor->read_new_ranges(bundle.scans[index]);
+    }
+    catch(BaseError&)
+    {
+        errors_++;
+        return false;
+    }
+    bundle.present[index] = 1;
+    return true;
+}
+
+
+/// Keeps the largest set of scans that fit in the window, the earliest if
+/// there are several.
+void SensorGroup::align(ScanBundle& bundle)
+{
+    times_.clear();
+    for(unsigned int ii = 0; ii < bundle.present.size(); ii++)
+    {
+        if(bundle.present[ii])
+        {
+            times_.push_back(std::make_pair(
+                        bundle.scans[ii].system_time_stamp(), ii));
+        }
+    }
+    std::sort(times_.begin(), times_.end());
+
+    unsigned int best_first(0), best_count(0), first(0);
+    for(unsigned int last = 0; last < times_.size(); last++)
+    {
+        while(times_[last].first - times_[first].first > window_)
+            first++;
+        if(last - first + 1 > best_count)
+        {
+            best_first = first;
+            best_count = last - first + 1;
+        }
+    }
+
+    for(unsigned int ii = 0; ii < times_.size(); ii++)
+    {
+        if(ii < best_first || ii >= best_first + best_count)
+        {
+            bundle.present[times_[ii].second] = 0;
+            misaligned_++;
+        }
+    }
+    bundle.time = times_[best_first].first;
+    bundle.spread = times_[best_first + best_count - 1].first - bundle.time;
+}
@@ -0,0 +1,181 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * hokuyo_aist Hokuyo laser scanner driver.
+ *
+ * This distribution is licensed to you under the terms described in the
+ * LICENSE file included in this distribution.
+ *
+ * This file is part of hokuyo_aist.
+ *
+ * This software is licensed under the Eclipse Public License -v 1.0 (EPL). See
+ * http://www.opensource.org/licenses/eclipse-1.0.txt
+ */
+
+#ifndef SENSOR_GROUP_H__
+#define SENSOR_GROUP_H__
+
+#include "scan_data.h"
+
+#include <utility>
+#include <vector>
+
+/** @ingroup gbx_library_hokuyo_aist
+@{
+*/
+
+namespace hokuyo_aist
+{
+
+class Sensor;
+
+/// How a @ref SensorGroup hands its scans over.
+enum GroupMode
+{
+    /// Each scan on its own, as soon as it has been read.
+    GM_INDIVIDUAL,
+    /// One bundle per acquisition, holding the scans that lie within the
+    /// alignment window of each other.
+    GM_BUNDLED
+};
+
+
+/** @brief A set of scans from the sensors of a @ref SensorGroup. */
+class HOKUYO_AIST_EXPORT ScanBundle
+{
+    public:
+        ScanBundle() : time(0), spread(0), sequence(0) {}
+
+        /// One scan per sensor, in the order the sensors were added.
+        std::vector<ScanData> scans;
+        /// Non-zero for the scans that belong to this bundle. The others hold
+        /// stale data.
+        std::vector<uint8_t> present;
+        /// The earliest system time stamp of the scans present, in
+        /// nanoseconds.
+        unsigned long long time;
+        /// The time between the earliest and the latest scans present, in
+        /// nanoseconds.
+        unsigned long long spread;
+        /// Counts up by one for each bundle the group produces, including
+        /// those lost to overruns.
+        unsigned long long sequence;
+}; // class ScanBundle
+
+
+/** @brief Acquires from several sensors on one thread.
+
+Each call to @ref acquire asks every sensor for a new scan before reading any
+of them, so the sensors scan at the same time and an acquisition takes about
+as long as one scan, not one scan per sensor. Scans are read in the order
+their data arrives, and are stamped with each sensor's own clock model (see
+@ref Sensor::calibrate_time).
+
+Scans are handed over through a lock-free ring of @ref ScanBundle objects,
+either one per scan (@ref GM_INDIVIDUAL) or one per acquisition
+(@ref GM_BUNDLED). In bundled mode, only the largest set of scans whose time
+stamps lie within the alignment window of each other is marked present;
+the rest are counted in @ref misaligned.
+
+The ring has a single producer, the thread calling @ref acquire, and a
+single consumer, the thread calling @ref front and @ref pop. They may be the
+same thread. Scans are read straight into the ring's preallocated bundles,
+so nothing is copied or allocated per scan once every slot has been used.
+When the ring is full, new scans are read and dropped, and counted in
+@ref overruns.
+
+The sensors must be open and configured before they are added, and are not
+owned by the group. Add all sensors before the first acquisition. */
+class HOKUYO_AIST_EXPORT SensorGroup
+{
+    public:
+        /** @brief Create an empty group.
+
+        @param mode How to hand scans over.
+        @param window Alignment window for @ref GM_BUNDLED, in nanoseconds.
+        @param capacity Number of bundles in the ring. Rounded up to a power
+        of two. */
+        SensorGroup(GroupMode mode = GM_BUNDLED,
+                unsigned long long window = 10000000,
+                unsigned int capacity = 16);
+
+        /** @brief Add a sensor to the group.
+
+        @param sensor An open sensor.
+        @param start_step The first step to get ranges from, or -1.
+        @param end_step The last step to get ranges from, or -1.
+        @param cluster_count The number of readings to cluster together.
+        @param intensities Get intensity data as well.
+        @return The index of the sensor's scans in each @ref ScanBundle. */
+        unsigned int add_sensor(Sensor* sensor, int start_step = -1,
+                int end_step = -1, unsigned int cluster_count = 1,
+                bool intensities = false);
+        /// @brief Get the number of sensors in the group.
+        unsigned int size() const { return members_.size(); }
+
+        /** @brief Get one scan from every sensor.
+
+        Call from the acquisition thread only. A sensor that throws while its
+        scan is read is left out of the bundle and counted in @ref errors; the
+        other sensors are still read.
+
+        @return The number of scans read. */
+        unsigned int acquire();
+
+        /// @brief Get the oldest bundle waiting in the ring, or 0 if it is
+        /// empty. Valid until @ref pop.
+        ScanBundle const* front();
+        /// @brief Release the bundle returned by @ref front.
+        void pop();
+
+        /// @brief Scans dropped because the ring was full.
+        unsigned long long overruns() const { return overruns_; }
+        /// @brief Scans left out of bundles for being outside the window.
+        unsigned long long misaligned() const { return misaligned_; }
+        /// @brief Scans that failed to be read.
+        unsigned long long errors() const { return errors_; }
+
+    private:
+        friend class SensorGroupTest;
+
+        struct Member
+        {
+            Sensor* sensor;
+            int start_step, end_step;
+            unsigned int cluster_count;
+            bool intensities;
+        };
+
+        GroupMode mode_;
+        unsigned long long window_;
+        std::vector<Member> members_;
+
+        // The ring. write_ and read_ count up forever, and are only written
+        // by the producer and the consumer respectively.
+        std::vector<ScanBundle> slots_;
+        unsigned int mask_;
+        volatile unsigned int write_;
+        volatile unsigned int read_;
+        // Where scans go when the ring is full
+        ScanBundle overflow_;
+        unsigned long long sequence_;
+
+        unsigned long long overruns_, misaligned_, errors_;
+
+        // Per-acquisition working space
+        std::vector<unsigned int> waiting_;
+        std::vector<std::pair<unsigned long long, unsigned int> > times_;
+
+        ScanBundle& claim_slot();
+        void publish(ScanBundle& bundle);
+        bool read_scan(unsigned int index, ScanBundle& bundle);
+        void align(ScanBundle& bundle);
+}; // class SensorGroup
+
+} // namespace hokuyo_aist
+
+/** @} */
+
+#endif // SENSOR_GROUP_H__
@@ -38,6 +38,57 @@ SensorInfo::SensorInfo()
 }
 
 
+SensorInfo::SensorInfo(SensorInfo const& rhs)
+    : vendor(rhs.vendor), product(rhs.product), firmware(rhs.firmware),
+    protocol(rhs.protocol), serial(rhs.serial), model(rhs.model),
+    min_range(rhs.min_range), max_range(rhs.max_range), steps(rhs.steps),
+    first_step(rhs.first_step), last_step(rhs.last_step),
+    front_step(rhs.front_step), standard_speed(rhs.standard_speed),
+    rot_dir(rhs.rot_dir), power(rhs.power), speed(rhs.speed),
+    speed_level(rhs.speed_level), measure_state(rhs.measure_state),
+    baud(rhs.baud), time(rhs.time), sensor_diagnostic(rhs.sensor_diagnostic),
+    min_angle(rhs.min_angle), max_angle(rhs.max_angle),
+    resolution(rhs.resolution), time_resolution(rhs.time_resolution),
+    scanable_steps(rhs.scanable_steps), max_step(rhs.max_step),
+    detected_model(rhs.detected_model)
+{
+}
+
+
+SensorInfo& SensorInfo::operator=(SensorInfo const& rhs)
+{
+    vendor = rhs.vendor;
+    product = rhs.product;
+    firmware = rhs.firmware;
+    protocol = rhs.protocol;
+    serial = rhs.serial;
+    model = rhs.model;
+    min_range = rhs.min_range;
+    max_range = rhs.max_range;
+    steps = rhs.steps;
+    first_step = rhs.first_step;
+    last_step = rhs.last_step;
+    front_step = rhs.front_step;
+    standard_speed = rhs.standard_speed;
+    rot_dir = rhs.rot_dir;
+    power = rhs.power;
+    speed = rhs.speed;
+    speed_level = rhs.speed_level;
+    measure_state = rhs.measure_state;
+    baud = rhs.baud;
+    time = rhs.time;
+    sensor_diagnostic = rhs.sensor_diagnostic;
+    min_angle = rhs.min_angle;
+    max_angle = rhs.max_angle;
+    resolution = rhs.resolution;
+    time_resolution = rhs.time_resolution;
+    scanable_steps = rhs.scanable_steps;
+    max_step = rhs.max_step;
+    detected_model = rhs.detected_model;
+    return *this;
+}
+
+
 // Set various known values based on what the manual says
 void SensorInfo::set_defaults()
 {
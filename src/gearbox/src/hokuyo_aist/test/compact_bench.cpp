@@ -0,0 +1,165 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * hokuyo_aist Hokuyo laser scanner driver.
+ *
+ * This distribution is licensed to you under the terms described in the
+ * LICENSE file included in this distribution.
+ *
+ * This file is part of hokuyo_aist.
+ *
+ * This software is licensed under the Eclipse Public License -v 1.0 (EPL). See
+ * http://www.opensource.org/licenses/eclipse-1.0.txt
+ */
+
+// Memory traffic of recording scans, with and without compact ScanData
+// storage: filling scans the way the decoders do, copying them into a
+// recording too big for the caches, and reading the recording back.
+//
+// Usage: compact_bench [number of scans]
+
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+#include <sys/time.h>
+
+#include <hokuyo_aist/hokuyo_aist.h>
+
+using namespace hokuyo_aist;
+
+namespace
+{
+
+// UTM-30LX, ranges and intensities
+unsigned int const STEPS = 1081;
+
+double now()
+{
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+
+class BenchScanData : public ScanData
+{
+    public:
+        void fill(uint32_t const* ranges, uint32_t const* intensities)
+        {
+            allocate_data(STEPS, true);
+            for(unsigned int ii = 0; ii < STEPS; ii++)
+            {
+                write_range(ii, ranges[ii]);
+                write_intensity(ii, intensities[ii]);
+            }
+        }
+};
+
+
+void report(char const* name, double seconds, unsigned int num_scans,
+        double bytes_per_scan)
+{
+    printf("%-28s %8.2f us/scan %10.1f MB/s\n", name,
+            seconds / num_scans * 1e6,
+            bytes_per_scan * num_scans / seconds / 1e6);
+}
+
+
+void run(bool compact, unsigned int num_scans, uint32_t const* ranges,
+        uint32_t const* intensities)
+{
+    double const bytes_per_scan = 2.0 * STEPS * (compact ? 2 : 4);
+    std::cout << (compact ? "compact" : "uint32_t") << " storage, " <<
+        bytes_per_scan << " bytes/scan, recording of " <<
+        bytes_per_scan * num_scans / 1e6 << " MB\n";
+
+    BenchScanData scan;
+    scan.set_compact(compact);
+    std::vector<ScanData> recording(num_scans);
+    for(unsigned int ii = 0; ii < num_scans; ii++)
+        recording[ii].set_compact(compact);
+
+    double start = now();
+    for(unsigned int ii = 0; ii < num_scans; ii++)
+        scan.fill(ranges, intensities);
+    report("  decode into scan", now() - start, num_scans, bytes_per_scan);
+
+    start = now();
+    for(unsigned int ii = 0; ii < num_scans; ii++)
+        recording[ii] = scan;
+    report("  copy into recording", now() - start, num_scans,
+            bytes_per_scan);
+
+    // Through the arrays a consumer would use in each mode
+    unsigned long long sum(0);
+    start = now();
+    for(unsigned int ii = 0; ii < num_scans; ii++)
+    {
+        if(compact)
+        {
+            uint16_t const* r = recording[ii].compact_ranges();
+            uint16_t const* i = recording[ii].compact_intensities();
+            for(unsigned int jj = 0; jj < STEPS; jj++)
+                sum += r[jj] + i[jj];
+        }
+        else
+        {
+            uint32_t const* r = recording[ii].ranges();
+            uint32_t const* i = recording[ii].intensities();
+            for(unsigned int jj = 0; jj < STEPS; jj++)
+                sum += r[jj] + i[jj];
+        }
+    }
+    report("  read back recording", now() - start, num_scans,
+            bytes_per_scan);
+
+    // Code that wants uint32_t values from compact scans
+    if(compact)
+    {
+        start = now();
+        for(unsigned int ii = 0; ii < num_scans; ii++)
+        {
+            uint32_t const* r = recording[ii].ranges();
+            for(unsigned int jj = 0; jj < STEPS; jj++)
+                sum += r[jj];
+        }
+        report("  widen and read ranges", now() - start, num_scans,
+                bytes_per_scan / 2);
+    }
+    // Keeps the reads from being optimised away
+    std::cout << "  (checksum " << sum / num_scans << ")\n";
+}
+
+} // namespace
+
+
+int main(int argc, char **argv)
+{
+    int num_scans(20000);
+    if(argc > 1)
+        num_scans = atoi(argv[1]);
+    if(num_scans <= 0)
+    {
+        std::cout << "Usage: " << argv[0] << " [number of scans]\n";
+        return EXIT_FAILURE;
+    }
+
+    // A room, with a few error codes
+    uint32_t ranges[STEPS], intensities[STEPS];
+    uint32_t range(3000);
+    for(unsigned int ii = 0; ii < STEPS; ii++)
+    {
+        if(rand() % 40 == 0)
+            range = 500 + rand() % 25000;
+        range += rand() % 21 - 10;
+        ranges[ii] = rand() % 50 == 0 ? 1 : range;
+        intensities[ii] = rand() % 5000;
+    }
+
+    run(false, num_scans, ranges, intensities);
+    run(true, num_scans, ranges, intensities);
+    return EXIT_SUCCESS;
+}
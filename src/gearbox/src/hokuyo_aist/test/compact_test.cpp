@@ -0,0 +1,264 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * hokuyo_aist Hokuyo laser scanner driver.
+ *
+ * This distribution is licensed to you under the terms described in the
+ * LICENSE file included in this distribution.
+ *
+ * This file is part of hokuyo_aist.
+ *
+ * This software is licensed under the Eclipse Public License -v 1.0 (EPL). See
+ * http://www.opensource.org/licenses/eclipse-1.0.txt
+ */
+
+// Round trip of range and intensity values through compact ScanData storage.
+
+#include <cstdlib>
+#include <iostream>
+
+#include <hokuyo_aist/hokuyo_aist.h>
+#include <hokuyo_aist/hokuyo_errors.h>
+
+using namespace hokuyo_aist;
+
+namespace
+{
+
+int failures(0);
+
+void check(bool ok, char const* what, uint32_t value = 0)
+{
+    if(!ok)
+    {
+        std::cout << "failed: " << what << " (value " << value << ")\n";
+        failures++;
+    }
+}
+
+/// Fills scans the way Sensor does.
+class TestScanData : public ScanData
+{
+    public:
+        void fill(uint32_t const* ranges, uint32_t const* intensities,
+                unsigned int length)
+        {
+            allocate_data(length, intensities != 0);
+            error_ = false;
+            for(unsigned int ii = 0; ii < length; ii++)
+            {
+                write_range(ii, ranges[ii]);
+                if(intensities != 0)
+                    write_intensity(ii, intensities[ii]);
+            }
+        }
+};
+
+
+// What a value should read back as at the given scale
+uint32_t expected_range(uint32_t value, unsigned int scale)
+{
+    if(value < 20)
+        return value;
+    uint32_t max_range = 20 + 65515 * scale;
+    if(value > max_range)
+        value = max_range;
+    return value - (value - 20) % scale;
+}
+
+
+void test_round_trip(unsigned int scale)
+{
+    // Every value that fits, for scale 1, plus error codes and values past
+    // the end for larger scales
+    unsigned int const length(0x10000 + 1000);
+    uint32_t* ranges = new uint32_t[length];
+    uint32_t* intensities = new uint32_t[length];
+    for(unsigned int ii = 0; ii < length; ii++)
+    {
+        ranges[ii] = ii < 0x10000 ? ii * scale : rand() % 0x1000000;
+        intensities[ii] = ii < 0x10000 ? ii : rand() % 0x1000000;
+    }
+
+    TestScanData data;
+    data.set_compact(true, scale);
+    check(data.compact() && data.range_scale() == scale, "compact mode set",
+            scale);
+    data.fill(ranges, intensities, length);
+    check(data.ranges_length() == length &&
+            data.intensities_length() == length, "lengths", length);
+    check(data.get_error_status(), "error codes flagged");
+
+    uint32_t const* wide_ranges = data.ranges();
+    uint32_t const* wide_intensities = data.intensities();
+    for(unsigned int ii = 0; ii < length; ii++)
+    {
+        uint32_t range = expected_range(ranges[ii], scale);
+        uint32_t intensity = intensities[ii] > 0xFFFF ? 0xFFFF :
+            intensities[ii];
+        check(data.range(ii) == range, "range", ranges[ii]);
+        check(wide_ranges[ii] == range, "widened range", ranges[ii]);
+        check(data.intensity(ii) == intensity, "intensity", intensities[ii]);
+        check(wide_intensities[ii] == intensity, "widened intensity",
+                intensities[ii]);
+        // Everything that fits comes back exactly at scale 1
+        if(scale == 1 && ranges[ii] <= 0xFFFF)
+            check(data.range(ii) == ranges[ii], "lossless range", ranges[ii]);
+    }
+
+    // Copies stay compact
+    ScanData copy(data);
+    ScanData assigned;
+    assigned = data;
+    check(copy.compact() && assigned.compact(), "copies compact");
+    for(unsigned int ii = 0; ii < length; ii++)
+    {
+        check(copy.range(ii) == data.range(ii) &&
+                assigned.range(ii) == data.range(ii), "copied range", ii);
+        check(copy.intensity(ii) == data.intensity(ii) &&
+                assigned.intensity(ii) == data.intensity(ii),
+                "copied intensity", ii);
+    }
+
+    // Into provided buffers, the data is widened
+    uint32_t* range_buffer = new uint32_t[length];
+    uint32_t* intensity_buffer = new uint32_t[length];
+    ScanData provided(range_buffer, length, intensity_buffer, length);
+    provided = data;
+    check(!provided.compact(), "provided buffers not compact");
+    for(unsigned int ii = 0; ii < length; ii++)
+    {
+        check(range_buffer[ii] == data.range(ii), "provided range", ii);
+        check(intensity_buffer[ii] == data.intensity(ii),
+                "provided intensity", ii);
+    }
+
+    // A new scan replaces the widened copies
+    ranges[0] = 12345;
+    data.fill(ranges, 0, length);
+    check(data.ranges()[0] == expected_range(12345, scale), "widened again");
+    check(data.intensities() == 0, "intensities dropped");
+
+    delete[] range_buffer;
+    delete[] intensity_buffer;
+    delete[] ranges;
+    delete[] intensities;
+}
+
+
+// The same scan gives the same text in both modes
+void test_as_string()
+{
+    uint32_t ranges[] = {0, 7, 19, 20, 21, 1000, 30000, 65535};
+    uint32_t intensities[] = {0, 1, 2, 3, 500, 1000, 3000, 65535};
+    unsigned int const length(sizeof(ranges) / sizeof(ranges[0]));
+    TestScanData wide, compact;
+    compact.set_compact(true);
+    wide.fill(ranges, intensities, length);
+    compact.fill(ranges, intensities, length);
+    check(wide.as_string() == compact.as_string(), "as_string");
+}
+
+
+// Assignment never drops compact mode
+void test_assign_keeps_mode()
+{
+    uint32_t ranges[] = {0, 7, 19, 20, 21, 1000, 30000, 65535, 70000};
+    uint32_t intensities[] = {0, 1, 2, 3, 500, 1000, 3000, 65535, 70000};
+    unsigned int const length(sizeof(ranges) / sizeof(ranges[0]));
+    TestScanData wide, compact;
+    wide.fill(ranges, intensities, length);
+    compact.set_compact(true, 2);
+    compact.fill(ranges, intensities, length);
+
+    // Normal rhs narrowed with the lhs's scale
+    ScanData narrowed;
+    narrowed.set_compact(true, 2);
+    narrowed = wide;
+    check(narrowed.compact() && narrowed.range_scale() == 2,
+            "compact lhs stays compact");
+    check(narrowed.ranges_length() == length &&
+            narrowed.intensities_length() == length, "narrowed lengths");
+    for(unsigned int ii = 0; ii < length; ii++)
+    {
+        check(narrowed.range(ii) == expected_range(ranges[ii], 2),
+                "narrowed range", ranges[ii]);
+        check(narrowed.intensity(ii) == (intensities[ii] > 0xFFFF ?
+                    0xFFFF : intensities[ii]), "narrowed intensity",
+                intensities[ii]);
+    }
+
+    // Compact rhs copied as is, scale included
+    ScanData scaled;
+    scaled.set_compact(true);
+    scaled = compact;
+    check(scaled.compact() && scaled.range_scale() == 2, "rhs scale copied");
+    for(unsigned int ii = 0; ii < length; ii++)
+        check(scaled.range(ii) == compact.range(ii), "scaled range", ii);
+
+    // A normal rhs leaves a normal lhs normal
+    ScanData normal;
+    normal = wide;
+    check(!normal.compact(), "normal lhs stays normal");
+    for(unsigned int ii = 0; ii < length; ii++)
+        check(normal.ranges()[ii] == ranges[ii], "normal range", ii);
+
+    // An empty rhs empties a compact lhs
+    narrowed = ScanData();
+    check(narrowed.compact() && narrowed.ranges_length() == 0 &&
+            narrowed.compact_ranges() == 0, "emptied compact lhs");
+}
+
+
+void test_errors()
+{
+    uint32_t buffer[10];
+    ScanData provided(buffer, 10);
+    try
+    {
+        provided.set_compact(true);
+        check(false, "compact mode with provided buffers");
+    }
+    catch(UnsupportedError&)
+    {
+    }
+
+    ScanData data;
+    unsigned int const bad_scales[] = {0, 3, 6, 0x10000};
+    for(unsigned int ii = 0; ii < 4; ii++)
+    {
+        try
+        {
+            data.set_compact(true, bad_scales[ii]);
+            check(false, "bad range scale accepted", bad_scales[ii]);
+        }
+        catch(ArgError&)
+        {
+        }
+    }
+    check(!data.compact(), "mode unchanged by a bad scale");
+}
+
+} // namespace
+
+
+int main()
+{
+    srand(1);
+    test_round_trip(1);
+    test_round_trip(2);
+    test_round_trip(8);
+    test_as_string();
+    test_assign_keeps_mode();
+    test_errors();
+
+    if(failures > 0)
+    {
+        std::cout << "Test FAILED: " << failures << " failures\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "Test PASSED\n";
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,238 @@
+/*
+ * GearBox Project: Peer-Reviewed Open-Source Libraries for Robotics
+ *               http://gearbox.sf.net/
+ * Copyright (c) 2026 ClamArm contributors
+ *
+ * hokuyo_aist Hokuyo laser scanner driver.
+ *
+ * This distribution is licensed to you under the terms described in the
+ * LICENSE file included in this distribution.
+ *
+ * This file is part of hokuyo_aist.
+ *
+ * This software is licensed under the Eclipse Public License -v 1.0 (EPL). See
+ * http://www.opensource.org/licenses/eclipse-1.0.txt
+ */
+
+// The ring and the alignment of SensorGroup, driven without sensors.
+
+#include <cstdlib>
+#include <iostream>
+
+#include <hokuyo_aist/hokuyo_aist.h>
+
+using namespace hokuyo_aist;
+
+namespace
+{
+
+int failures(0);
+
+void check(bool ok, char const* what, unsigned long long value = 0)
+{
+    if(!ok)
+    {
+        std::cout << "failed: " << what << " (value " << value << ")\n";
+        failures++;
+    }
+}
+
+/// Time stamp of a sensor left out of a bundle
+unsigned long long const NONE(~0ULL);
+
+/// A scan with only a time stamp.
+class StampedScan : public ScanData
+{
+    public:
+        StampedScan(unsigned long long time) { system_time_ = time; }
+};
+
+} // namespace
+
+
+namespace hokuyo_aist
+{
+
+/// Hands bundles to the ring the way acquire() does, with made up scans.
+class SensorGroupTest
+{
+    public:
+        SensorGroupTest(unsigned int num_sensors, unsigned long long window,
+                unsigned int capacity)
+            : group(GM_BUNDLED, window, capacity)
+        {
+            // The sensors are never used
+            for(unsigned int ii = 0; ii < num_sensors; ii++)
+                group.add_sensor(0);
+        }
+
+        SensorGroup group;
+
+        unsigned int capacity() const { return group.slots_.size(); }
+
+        /// Publishes one bundle. A time of NONE leaves that sensor out.
+        void push(unsigned long long const* times)
+        {
+            ScanBundle& bundle(group.claim_slot());
+            for(unsigned int ii = 0; ii < group.size(); ii++)
+            {
+                bundle.present[ii] = times[ii] != NONE;
+                if(bundle.present[ii])
+                    bundle.scans[ii] = StampedScan(times[ii]);
+            }
+            group.align(bundle);
+            group.publish(bundle);
+        }
+};
+
+} // namespace hokuyo_aist
+
+
+namespace
+{
+
+// Checks which scans of the front bundle are present, then pops it
+void check_front(SensorGroup& group, char const* present,
+        unsigned long long time, unsigned long long spread)
+{
+    ScanBundle const* bundle(group.front());
+    check(bundle != 0, "bundle waiting");
+    if(bundle == 0)
+        return;
+    for(unsigned int ii = 0; ii < group.size(); ii++)
+        check((bundle->present[ii] != 0) == (present[ii] == '1'), present, ii);
+    check(bundle->time == time, "bundle time", bundle->time);
+    check(bundle->spread == spread, "bundle spread", bundle->spread);
+    group.pop();
+}
+
+
+void test_align()
+{
+    SensorGroupTest test(4, 10, 8);
+    SensorGroup& group(test.group);
+
+    // All within the window
+    unsigned long long together[] = {100, 104, 102, 110};
+    test.push(together);
+    check_front(group, "1111", 100, 10);
+    check(group.misaligned() == 0, "nothing misaligned", group.misaligned());
+
+    // One late scan is left out
+    unsigned long long late[] = {200, 205, 400, 208};
+    test.push(late);
+    check_front(group, "1101", 200, 8);
+    check(group.misaligned() == 1, "late scan misaligned", group.misaligned());
+
+    // Two sets of two: the earliest wins
+    unsigned long long pairs[] = {500, 503, 600, 602};
+    test.push(pairs);
+    check_front(group, "1100", 500, 3);
+    check(group.misaligned() == 3, "second pair misaligned",
+            group.misaligned());
+
+    // The largest set wins even if it is not the earliest
+    unsigned long long largest[] = {700, 800, 805, 809};
+    test.push(largest);
+    check_front(group, "0111", 800, 9);
+    check(group.misaligned() == 4, "early scan misaligned", group.misaligned());
+
+    // Missing scans are not misaligned, and one scan is its own bundle
+    unsigned long long single[] = {NONE, 900, NONE, NONE};
+    test.push(single);
+    check_front(group, "0100", 900, 0);
+    check(group.misaligned() == 4, "missing scans not misaligned",
+            group.misaligned());
+
+    check(group.front() == 0, "ring empty");
+}
+
+
+void test_ring_wrap()
+{
+    // Rounded up to a power of two
+    SensorGroupTest test(1, 10, 3);
+    SensorGroup& group(test.group);
+    check(test.capacity() == 4, "capacity", test.capacity());
+
+    // Many times round the ring, at varying fill levels
+    unsigned long long pushed(0), popped(0);
+    for(unsigned int round = 0; round < 50; round++)
+    {
+        unsigned int count(round % 4 + 1);
+        for(unsigned int ii = 0; ii < count; ii++)
+        {
+            unsigned long long time[] = {pushed++};
+            test.push(time);
+        }
+        for(unsigned int ii = 0; ii < count; ii++)
+        {
+            ScanBundle const* bundle(group.front());
+            check(bundle != 0, "bundle waiting", popped);
+            if(bundle == 0)
+                break;
+            check(bundle->sequence == popped, "sequence", bundle->sequence);
+            check(bundle->time == popped, "order", bundle->time);
+            group.pop();
+            popped++;
+        }
+        check(group.front() == 0, "ring empty", round);
+    }
+    check(group.overruns() == 0, "no overruns", group.overruns());
+
+    // Popping an empty ring does nothing
+    group.pop();
+    check(group.front() == 0, "still empty");
+}
+
+
+void test_overruns()
+{
+    SensorGroupTest test(2, 10, 4);
+    SensorGroup& group(test.group);
+
+    // Fill the ring, then two bundles more
+    for(unsigned long long ii = 0; ii < 6; ii++)
+    {
+        unsigned long long times[] = {ii * 100, ii == 5 ? NONE : ii * 100 + 1};
+        test.push(times);
+    }
+    // Every scan present in a dropped bundle counts
+    check(group.overruns() == 3, "overruns", group.overruns());
+
+    // The bundles in the ring are untouched, and the sequence shows the gap
+    for(unsigned long long ii = 0; ii < 4; ii++)
+    {
+        ScanBundle const* bundle(group.front());
+        check(bundle != 0 && bundle->sequence == ii &&
+                bundle->time == ii * 100, "kept bundle", ii);
+        group.pop();
+    }
+    check(group.front() == 0, "ring empty");
+
+    unsigned long long times[] = {600, 601};
+    test.push(times);
+    ScanBundle const* bundle(group.front());
+    check(bundle != 0 && bundle->sequence == 6, "sequence after overrun",
+            bundle != 0 ? bundle->sequence : 0);
+    check(group.overruns() == 3, "no overrun once there is room",
+            group.overruns());
+}
+
+} // namespace
+
+
+int main()
+{
+    test_align();
+    test_ring_wrap();
+    test_overruns();
+
+    if(failures > 0)
+    {
+        std::cout << "Test FAILED: " << failures << " failures\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "Test PASSED\n";
+    return EXIT_SUCCESS;
+}